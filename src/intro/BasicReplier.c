@@ -39,6 +39,8 @@ requestMsgReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClien
     solClient_int32_t operand1 = -1;
     solClient_int32_t operand2 = -1;
     double result;
+    COMMON_PROBE_BEGIN ( callbackProbe, "replier.callback" );
+    COMMON_PROBE_BEGIN ( computeProbe, "replier.compute" );
 
     /*
      * Get the operator, operand1 and operand2 from the stream in the binary
@@ -86,6 +88,7 @@ requestMsgReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClien
     }
 
   createReply:
+    COMMON_PROBE_END ( computeProbe );
     if ( resultOk ) {
         printf( "  Received request for %d %s %d, sending reply with result %f. \n",
                 operand1, RR_operationToString ( operation ), operand2, result );
@@ -99,6 +102,7 @@ requestMsgReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClien
      */
     if ( ( rc = solClient_msg_alloc ( &replyMsg_p ) ) != SOLCLIENT_OK ) {
         common_handleError ( rc, "solClient_msg_alloc()" );
+        COMMON_PROBE_END ( callbackProbe );
         return SOLCLIENT_CALLBACK_OK;
     }
     if ( ( rc = solClient_msg_createBinaryAttachmentStream ( replyMsg_p, &replyStream_p, 32 ) ) != SOLCLIENT_OK ) {
@@ -125,6 +129,7 @@ requestMsgReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClien
         common_handleError ( rc, "solClient_msg_free()" );
     }
     msgReplied ++;
+    COMMON_PROBE_END ( callbackProbe );
     return SOLCLIENT_CALLBACK_OK;
 }
 
@@ -318,6 +323,7 @@ main ( int argc, char *argv[] )
     while ( msgReplied < 1) {
         SLEEP(1);
     }
+    COMMON_PROBE_DUMP (  );
 
     /*************************************************************************
      * CLEANUP
@@ -0,0 +1,646 @@
+/** @example Intro/CacheMergeSubscriber.c
+ */
+
+/*
+ * This sample starts topics=N topics from a solCache snapshot and carries
+ * on live, with neither a gap nor a stale value (see cachemerge.h). It
+ * subscribes to "--topic/>" first, then sends a cache request per topic
+ * "--topic/<i>" to --cache, at most window=W outstanding, with live data
+ * flowing through; each topic's cached and live messages are merged by
+ * topic sequence number (key=seq) or sender timestamp (key=time) when its
+ * request completes. It reports how long until all topics were
+ * consistent, and what the merge dropped.
+ *
+ * Without --cip, the subscriber runs against a model of a publisher at
+ * --mr messages per second over the topics, a cache keeping the last
+ * depth=D messages of each and lagging the live stream by lag=US, serving
+ * one request every serve=US, and a network with rtt=US, in virtual time. For windows of 1, 16, 256 and 1000
+ * outstanding requests it reports the time until consistent, the CPU cost
+ * of the merge per message, how many cached messages a subscriber
+ * delivering as they come would have shown after newer live ones, and
+ * checks that each topic is delivered without a gap, in order, and ends on
+ * its latest value.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "solclient/solCache.h"
+#include "common.h"
+#include "cachemerge.h"
+#include "getopt.h"
+
+#define DEFAULT_TOPICS          10000
+#define DEFAULT_WINDOW          256
+#define MAX_WINDOW              1000    /* Cache requests outstanding in a Session. */
+#define DEFAULT_IDLE_MS         2000
+
+#define EVENT_PUBLISH           0
+#define EVENT_LIVE              1
+#define EVENT_CACHED            2
+#define EVENT_REQUEST           3
+#define EVENT_SERVED            4
+#define EVENT_RESPONSE          5
+
+/**
+ * @struct simEvent
+ */
+struct simEvent
+{
+    solClient_uint64_t timeNs;
+    solClient_uint64_t order;           /* Ties go in the order scheduled. */
+    int             type;
+    solClient_uint32_t topic;
+    solClient_int64_t key;
+};
+
+/**
+ * @struct simModel
+ */
+struct simModel
+{
+    struct simEvent *heap_p;
+    solClient_uint32_t heapCount;
+    solClient_uint32_t heapSize;
+    solClient_uint64_t order;
+    solClient_uint64_t nowNs;
+    solClient_uint64_t serverFreeNs;
+    solClient_uint64_t rng;
+    solClient_int64_t *latest_p;        /* Last sequence number published per topic. */
+    solClient_int64_t *cached_p;        /* Last the cache has. */
+    char          **names_p;
+};
+
+/**
+ * @struct deliveryCheck
+ * What was delivered, per topic.
+ */
+struct deliveryCheck
+{
+    solClient_int64_t *last_p;          /* 0 before the first. */
+    solClient_uint64_t delivered;
+    solClient_uint64_t gaps;
+    solClient_uint64_t disorders;
+};
+
+/**
+ * @struct liveSubscriber
+ */
+struct liveSubscriber
+{
+    struct cachemerge merge;
+    volatile solClient_uint64_t delivered;
+};
+
+/*****************************************************************************
+ * isBefore
+ *****************************************************************************/
+static int
+isBefore ( const struct simEvent *a_p, const struct simEvent *b_p )
+{
+    return a_p->timeNs < b_p->timeNs || ( a_p->timeNs == b_p->timeNs && a_p->order < b_p->order );
+}
+
+/*****************************************************************************
+ * schedule
+ *****************************************************************************/
+static          solClient_returnCode_t
+schedule ( struct simModel *model_p, solClient_uint64_t timeNs, int type, solClient_uint32_t topic,
+           solClient_int64_t key )
+{
+    struct simEvent *heap_p;
+    struct simEvent event;
+    solClient_uint32_t i;
+
+    if ( model_p->heapCount == model_p->heapSize ) {
+        if ( ( heap_p = ( struct simEvent * ) realloc ( model_p->heap_p, model_p->heapSize * 2 *
+                                                        sizeof ( struct simEvent ) ) ) == NULL ) {
+            return SOLCLIENT_FAIL;
+        }
+        model_p->heap_p = heap_p;
+        model_p->heapSize *= 2;
+    }
+    event.timeNs = timeNs;
+    event.order = model_p->order++;
+    event.type = type;
+    event.topic = topic;
+    event.key = key;
+    for ( i = model_p->heapCount++; i > 0 && isBefore ( &event, &model_p->heap_p[( i - 1 ) / 2] ); i = ( i - 1 ) / 2 ) {
+        model_p->heap_p[i] = model_p->heap_p[( i - 1 ) / 2];
+    }
+    model_p->heap_p[i] = event;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * nextEvent
+ *****************************************************************************/
+static int
+nextEvent ( struct simModel *model_p, struct simEvent *event_p )
+{
+    struct simEvent last;
+    solClient_uint32_t i = 0;
+    solClient_uint32_t child;
+
+    if ( model_p->heapCount == 0 ) {
+        return 0;
+    }
+    *event_p = model_p->heap_p[0];
+    last = model_p->heap_p[--model_p->heapCount];
+    while ( ( child = 2 * i + 1 ) < model_p->heapCount ) {
+        if ( child + 1 < model_p->heapCount && isBefore ( &model_p->heap_p[child + 1], &model_p->heap_p[child] ) ) {
+            child++;
+        }
+        if ( !isBefore ( &model_p->heap_p[child], &last ) ) {
+            break;
+        }
+        model_p->heap_p[i] = model_p->heap_p[child];
+        i = child;
+    }
+    model_p->heap_p[i] = last;
+    model_p->nowNs = event_p->timeNs;
+    return 1;
+}
+
+/*****************************************************************************
+ * checkDeliver
+ *****************************************************************************/
+static void
+checkDeliver ( solClient_opaqueMsg_pt msg_p, solClient_uint32_t topic, solClient_int64_t key, int source,
+               void *user_p )
+{
+    struct deliveryCheck *check_p = ( struct deliveryCheck * ) user_p;
+    solClient_int64_t last = check_p->last_p[topic];
+
+    check_p->delivered++;
+    if ( last != 0 && key <= last ) {
+        check_p->disorders++;
+        return;
+    }
+    if ( last != 0 && key > last + 1 ) {
+        check_p->gaps += ( solClient_uint64_t ) ( key - last - 1 );
+    }
+    check_p->last_p[topic] = key;
+}
+
+/*****************************************************************************
+ * offer
+ *
+ * A message as the Session would hand it over.
+ *****************************************************************************/
+static void
+offer ( struct cachemerge *merge_p, struct simModel *model_p, int source, solClient_uint32_t topic,
+        solClient_int64_t key )
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_rxMsgCallback_returnCode_t callbackRc;
+
+    if ( solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ) {
+        return;
+    }
+    if ( source == CACHEMERGE_LIVE ) {
+        callbackRc = cachemerge_liveMsg ( merge_p, model_p->names_p[topic], msg_p, key );
+    } else {
+        callbackRc = cachemerge_cacheMsg ( merge_p, topic, msg_p, key );
+    }
+    if ( callbackRc != SOLCLIENT_CALLBACK_TAKE_MSG ) {
+        solClient_msg_free ( &msg_p );
+    }
+}
+
+/*****************************************************************************
+ * benchMerge
+ *
+ * Subscribes live at time 0 and sends the cache requests, window at a time,
+ * while the publisher goes on until every topic is consistent.
+ *****************************************************************************/
+static void
+benchMerge ( struct simModel *model_p, solClient_uint32_t numTopics, solClient_uint32_t window, double rate,
+             solClient_int64_t depth, solClient_uint64_t oneWayNs, solClient_uint64_t serveNs,
+             solClient_uint64_t lagNs )
+{
+    struct cachemerge merge;
+    struct cachemergeStats stats;
+    struct deliveryCheck check;
+    struct simEvent event;
+    solClient_uint64_t publishNs = ( solClient_uint64_t ) ( 1e9 / rate );
+    solClient_uint64_t consistentNs = 0;
+    solClient_uint64_t published = 0;
+    solClient_uint64_t cpuNs;
+    solClient_uint64_t stale = 0;
+    solClient_uint32_t sent = 0;
+    solClient_uint32_t topic;
+    solClient_uint32_t index;
+    solClient_int64_t key;
+
+    memset ( &check, 0, sizeof ( check ) );
+    if ( ( check.last_p = ( solClient_int64_t * ) calloc ( numTopics, sizeof ( solClient_int64_t ) ) ) == NULL ) {
+        return;
+    }
+    if ( cachemerge_init ( &merge, numTopics, CACHEMERGE_BY_SEQ, checkDeliver, &check ) != SOLCLIENT_OK ) {
+        free ( check.last_p );
+        return;
+    }
+    model_p->heapCount = 0;
+    model_p->nowNs = 0;
+    model_p->serverFreeNs = 0;
+    model_p->rng = COMMON_RANDOM_SEED;
+    for ( topic = 0; topic < numTopics; topic++ ) {
+        /* Some history before the subscriber starts. */
+        model_p->latest_p[topic] = 1 + ( solClient_int64_t ) ( common_random ( &model_p->rng ) % 8 );
+        model_p->cached_p[topic] = model_p->latest_p[topic];
+        cachemerge_addTopic ( &merge, model_p->names_p[topic], &index );
+    }
+
+    cpuNs = os_getCpuTimeNs (  );
+    schedule ( model_p, 0, EVENT_PUBLISH, 0, 0 );
+    for ( ; sent < window && sent < numTopics; sent++ ) {
+        schedule ( model_p, oneWayNs, EVENT_REQUEST, sent, 0 );
+    }
+    while ( nextEvent ( model_p, &event ) ) {
+        switch ( event.type ) {
+            case EVENT_PUBLISH:
+                if ( consistentNs != 0 ) {
+                    break;
+                }
+                topic = ( solClient_uint32_t ) ( common_random ( &model_p->rng ) % numTopics );
+                key = ++model_p->latest_p[topic];
+                published++;
+                schedule ( model_p, model_p->nowNs + oneWayNs, EVENT_LIVE, topic, key );
+                schedule ( model_p, model_p->nowNs + lagNs, EVENT_CACHED, topic, key );
+                schedule ( model_p, model_p->nowNs + publishNs, EVENT_PUBLISH, 0, 0 );
+                break;
+            case EVENT_LIVE:
+                offer ( &merge, model_p, CACHEMERGE_LIVE, event.topic, event.key );
+                break;
+            case EVENT_CACHED:
+                model_p->cached_p[event.topic] = event.key;
+                break;
+            case EVENT_REQUEST:
+                /* One request at a time at the cache. */
+                if ( model_p->serverFreeNs < model_p->nowNs ) {
+                    model_p->serverFreeNs = model_p->nowNs;
+                }
+                model_p->serverFreeNs += serveNs;
+                schedule ( model_p, model_p->serverFreeNs, EVENT_SERVED, event.topic, 0 );
+                break;
+            case EVENT_SERVED:
+                schedule ( model_p, model_p->nowNs + oneWayNs, EVENT_RESPONSE, event.topic,
+                           model_p->cached_p[event.topic] );
+                break;
+            case EVENT_RESPONSE:
+                for ( key = ( event.key > depth ) ? event.key - depth + 1 : 1; key <= event.key; key++ ) {
+                    offer ( &merge, model_p, CACHEMERGE_CACHE, event.topic, key );
+                }
+                cachemerge_cacheDone ( &merge, event.topic, SOLCLIENT_OK );
+                if ( sent < numTopics ) {
+                    schedule ( model_p, model_p->nowNs + oneWayNs, EVENT_REQUEST, sent++, 0 );
+                }
+                cachemerge_getStats ( &merge, &stats );
+                if ( stats.consistent == numTopics ) {
+                    consistentNs = model_p->nowNs;
+                }
+                break;
+        }
+    }
+    cpuNs = os_getCpuTimeNs (  ) - cpuNs;
+
+    for ( topic = 0; topic < numTopics; topic++ ) {
+        if ( check.last_p[topic] != model_p->latest_p[topic] ) {
+            stale++;
+        }
+    }
+    cachemerge_getStats ( &merge, &stats );
+    printf ( "Window %u: consistent after %.1f ms, %llu live published meanwhile\n", window, consistentNs / 1e6,
+             ( unsigned long long ) published );
+    printf ( "  %.0f ns/msg of CPU with the model; %llu cached (%llu older than live, shown after it when delivered as they came), "
+             "%llu live kept, most kept at once %llu\n", ( check.delivered + stats.duplicates ) > 0 ?
+             ( double ) cpuNs / ( check.delivered + stats.duplicates ) : 0, ( unsigned long long ) stats.cached,
+             ( unsigned long long ) stats.staleCached, ( unsigned long long ) stats.buffered,
+             ( unsigned long long ) stats.maxPending );
+    printf ( "  delivered %llu, overlap dropped %llu: %llu gaps, %llu out of order, %llu topics not on their "
+             "latest value\n", ( unsigned long long ) check.delivered, ( unsigned long long ) stats.duplicates,
+             ( unsigned long long ) check.gaps, ( unsigned long long ) check.disorders, ( unsigned long long ) stale );
+    fflush ( stdout );
+
+    cachemerge_destroy ( &merge );
+    free ( check.last_p );
+}
+
+/*****************************************************************************
+ * liveDeliver
+ *****************************************************************************/
+static void
+liveDeliver ( solClient_opaqueMsg_pt msg_p, solClient_uint32_t topic, solClient_int64_t key, int source,
+              void *user_p )
+{
+    struct liveSubscriber *subscriber_p = ( struct liveSubscriber * ) user_p;
+
+    /* The application processes the message here. */
+    subscriber_p->delivered++;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param cache The name of the Distributed Cache.
+ * param topic The base of the topics.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Cache Session */
+    solClient_opaqueCacheSession_pt cacheSession_p;
+    const char     *cacheProps[20] = {0, };
+    int             propIndex = 0;
+    char            depthString[16];
+
+    /* Merge */
+    static struct liveSubscriber subscriber;
+    struct cachemergeStats stats;
+    struct simModel model;
+    solClient_uint32_t windows[] = { 1, 16, 256, MAX_WINDOW };
+    solClient_uint32_t numTopics = DEFAULT_TOPICS;
+    solClient_uint32_t window = DEFAULT_WINDOW;
+    solClient_uint32_t topic;
+    solClient_uint32_t index;
+    solClient_uint64_t startNs;
+    solClient_uint64_t idleSinceNs;
+    solClient_uint64_t lastDelivered = 0;
+    char            topicName[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 16];
+    int             keyMode = CACHEMERGE_BY_SEQ;
+    int             depth = 1;
+    int             rttUs = 500;
+    int             serveUs = 20;
+    int             lagUs = 1000;
+    int             idleMs = DEFAULT_IDLE_MS;
+    int             i;
+
+    printf ( "\nCacheMergeSubscriber.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  CACHE_PARAM_MASK |
+                                  MSG_RATE_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.msgRate = 50000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\ttopics=N            Topics under --topic, from 0 to N-1 (default 10000).\n"
+                                      "\twindow=N            Cache requests outstanding (default 256, at most 1000).\n"
+                                      "\tkey=seq|time        Merge by topic sequence number or sender timestamp (default seq).\n"
+                                      "\tdepth=N             Messages the cache keeps per topic (default 1).\n"
+                                      "\tidle=MS             Stop after MS without a message (default 2000).\n"
+                                      "\trtt=US              Without --cip, the network round trip (default 500).\n"
+                                      "\tserve=US            Without --cip, the cache time per request (default 20).\n"
+                                      "\tlag=US              Without --cip, how far the cache lags live (default 1000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "topics=", 7 ) == 0 ) {
+            numTopics = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "window=", 7 ) == 0 ) {
+            window = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strcmp ( argv[i], "key=seq" ) == 0 ) {
+            keyMode = CACHEMERGE_BY_SEQ;
+        } else if ( strcmp ( argv[i], "key=time" ) == 0 ) {
+            keyMode = CACHEMERGE_BY_TIME;
+        } else if ( strncmp ( argv[i], "depth=", 6 ) == 0 ) {
+            depth = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "idle=", 5 ) == 0 ) {
+            idleMs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "rtt=", 4 ) == 0 ) {
+            rttUs = atoi ( argv[i] + 4 );
+        } else if ( strncmp ( argv[i], "serve=", 6 ) == 0 ) {
+            serveUs = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "lag=", 4 ) == 0 ) {
+            lagUs = atoi ( argv[i] + 4 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( numTopics < 1 || window < 1 || window > MAX_WINDOW || depth < 1 || idleMs < 1 || rttUs < 0 || serveUs < 0 || lagUs < 0 ||
+         commandOpts.msgRate < 1 ) {
+        printf ( "Invalid arguments: topics >= 1, 1 <= window <= 1000, depth >= 1, idle >= 1, --mr >= 1\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ||
+           commandOpts.cacheName[0] == ( char ) 0 ) ) {
+        printf ( "Subscribing requires --cu, --topic and --cache\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: the modelled cache and network
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        memset ( &model, 0, sizeof ( model ) );
+        model.heapSize = 1024;
+        model.heap_p = ( struct simEvent * ) malloc ( model.heapSize * sizeof ( struct simEvent ) );
+        model.latest_p = ( solClient_int64_t * ) calloc ( numTopics, sizeof ( solClient_int64_t ) );
+        model.cached_p = ( solClient_int64_t * ) calloc ( numTopics, sizeof ( solClient_int64_t ) );
+        model.names_p = ( char ** ) calloc ( numTopics, sizeof ( char * ) );
+        if ( model.heap_p == NULL || model.latest_p == NULL || model.cached_p == NULL || model.names_p == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate the model for %u topics", numTopics );
+            goto freeModel;
+        }
+        for ( topic = 0; topic < numTopics; topic++ ) {
+            sprintf ( topicName, "bench/topic/%u", topic );
+            if ( ( model.names_p[topic] = ( char * ) malloc ( strlen ( topicName ) + 1 ) ) == NULL ) {
+                goto freeModel;
+            }
+            strcpy ( model.names_p[topic], topicName );
+        }
+        printf ( "%u topics, %d msgs/s live, cache depth %d and %d us behind, rtt %d us, cache %d us per request:\n",
+                 numTopics, commandOpts.msgRate, depth, lagUs, rttUs, serveUs );
+        for ( i = 0; i < ( int ) ( sizeof ( windows ) / sizeof ( windows[0] ) ); i++ ) {
+            benchMerge ( &model, numTopics, windows[i], commandOpts.msgRate, depth, rttUs * 500ULL,
+                         serveUs * 1000ULL, lagUs * 1000ULL );
+        }
+
+      freeModel:
+        if ( model.names_p != NULL ) {
+            for ( topic = 0; topic < numTopics; topic++ ) {
+                free ( model.names_p[topic] );
+            }
+        }
+        free ( model.names_p );
+        free ( model.latest_p );
+        free ( model.cached_p );
+        free ( model.heap_p );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it handing messages to the merge
+     *************************************************************************/
+    if ( cachemerge_init ( &subscriber.merge, numTopics, keyMode, liveDeliver, &subscriber ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto destroyMerge;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 cachemerge_rxCallback,
+                                                 common_eventCallback, &subscriber.merge, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto destroyMerge;
+    }
+
+    sprintf ( depthString, "%d", depth );
+    cacheProps[propIndex++] = SOLCLIENT_CACHESESSION_PROP_CACHE_NAME;
+    cacheProps[propIndex++] = commandOpts.cacheName;
+    cacheProps[propIndex++] = SOLCLIENT_CACHESESSION_PROP_MAX_MSGS;
+    cacheProps[propIndex++] = depthString;
+    if ( ( rc = solClient_session_createCacheSession ( ( const char * const * ) cacheProps, session_p,
+                                                       &cacheSession_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createCacheSession()" );
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Live first, so that nothing falls between it and the snapshots
+     *************************************************************************/
+    sprintf ( topicName, "%s/>", commandOpts.destinationName );
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      topicName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+        goto destroyCacheSession;
+    }
+    printf ( "Subscribed to '%s', requesting %u topics from '%s', %u at a time\n", topicName, numTopics,
+             commandOpts.cacheName, window );
+    fflush ( stdout );
+
+    /*************************************************************************
+     * Then a cache request per topic, its index as request ID
+     *************************************************************************/
+    startNs = os_getTimeNs (  );
+    for ( topic = 0; topic < numTopics; topic++ ) {
+        sprintf ( topicName, "%s/%u", commandOpts.destinationName, topic );
+        if ( cachemerge_addTopic ( &subscriber.merge, topicName, &index ) != SOLCLIENT_OK ) {
+            goto unsubscribe;
+        }
+        for ( ;; ) {
+            cachemerge_getStats ( &subscriber.merge, &stats );
+            if ( topic - stats.consistent < window ) {
+                break;
+            }
+            OS_SLEEP_US ( 100 );
+        }
+        rc = solClient_cacheSession_sendCacheRequest ( cacheSession_p, topicName, index,
+                                                       cachemerge_cacheEventCallback, &subscriber.merge,
+                                                       SOLCLIENT_CACHEREQUEST_FLAGS_LIVEDATA_FLOWTHRU |
+                                                       SOLCLIENT_CACHEREQUEST_FLAGS_NO_SUBSCRIBE |
+                                                       SOLCLIENT_CACHEREQUEST_FLAGS_NOWAIT_REPLY, 0 );
+        if ( rc != SOLCLIENT_IN_PROGRESS && rc != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_cacheSession_sendCacheRequest()" );
+            cachemerge_cacheDone ( &subscriber.merge, index, SOLCLIENT_FAIL );
+        }
+    }
+
+    /*************************************************************************
+     * Until all topics are consistent, then on live
+     *************************************************************************/
+    for ( ;; ) {
+        cachemerge_getStats ( &subscriber.merge, &stats );
+        if ( stats.consistent == stats.topics ) {
+            break;
+        }
+        OS_SLEEP_US ( 1000 );
+    }
+    printf ( "Consistent after %.1f ms: %llu cached (%llu older than live), %u requests failed, "
+             "%llu live kept, most kept at once %llu\n", ( stats.consistentNs - startNs ) / 1e6,
+             ( unsigned long long ) stats.cached, ( unsigned long long ) stats.staleCached, stats.requestsFailed,
+             ( unsigned long long ) stats.buffered, ( unsigned long long ) stats.maxPending );
+    fflush ( stdout );
+
+    idleSinceNs = os_getTimeNs (  );
+    while ( os_getTimeNs (  ) - idleSinceNs < idleMs * 1000000ULL ) {
+        if ( subscriber.delivered != lastDelivered ) {
+            lastDelivered = subscriber.delivered;
+            idleSinceNs = os_getTimeNs (  );
+        }
+        OS_SLEEP_US ( 10000 );
+    }
+    cachemerge_getStats ( &subscriber.merge, &stats );
+    printf ( "Delivered %llu: %llu by merges, %llu live; %llu dropped as not newer, %llu without a key, "
+             "%llu on other topics\n", ( unsigned long long ) subscriber.delivered,
+             ( unsigned long long ) stats.released, ( unsigned long long ) stats.live,
+             ( unsigned long long ) stats.duplicates, ( unsigned long long ) stats.noKey,
+             ( unsigned long long ) stats.unknownTopic );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  unsubscribe:
+    sprintf ( topicName, "%s/>", commandOpts.destinationName );
+    if ( ( rc = solClient_session_topicUnsubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                        topicName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicUnsubscribeExt()" );
+    }
+
+  destroyCacheSession:
+    if ( ( rc = solClient_cacheSession_destroy ( &cacheSession_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cacheSession_destroy()" );
+    }
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  destroyMerge:
+    cachemerge_destroy ( &subscriber.merge );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
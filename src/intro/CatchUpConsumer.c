@@ -0,0 +1,545 @@
+/** @example Intro/CatchUpConsumer.c
+ */
+
+/*
+ * This sample rebuilds a stream from history and carries on live without
+ * a gap or a duplicate (see catchup.h). A live Flow on a temporary Queue
+ * subscribed to --topic starts first, and its messages are kept in a
+ * bounded ring; then a Flow on queue=NAME replays from start=LOCATION
+ * (BEGINNING, DATE:... or an rmid1:... ID) at full rate. Where the replay
+ * meets the oldest live message, the consumer switches over to the live
+ * Flow and the replay Flow is destroyed. The queue must be subscribed to
+ * the same topics, and message replay enabled in the VPN.
+ *
+ * It reports the catch-up rate, how long the switch took and how far
+ * behind live it happened, and prints the ID of the last message
+ * delivered, from which a later run can restart.
+ *
+ * Without --cip, the same consumer runs against a replay log of
+ * history=N messages and a live stream at --mr messages per second in one
+ * thread, with synthetic IDs, and checks that every message is delivered
+ * once and in order: once with a ring large enough for the catch-up, once
+ * with a ring that overflows, and once without live traffic.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "catchup.h"
+#include "getopt.h"
+
+#define SMALL_RING              1024
+#define DEFAULT_IDLE_MS         2000
+
+/**
+ * @struct deliveryCheck
+ * What the benchmark delivered, by sequence number.
+ */
+struct deliveryCheck
+{
+    solClient_uint64_t expected;
+    solClient_uint64_t delivered;
+    solClient_uint64_t gaps;
+    solClient_uint64_t duplicates;
+};
+
+/**
+ * @struct liveConsumer
+ */
+struct liveConsumer
+{
+    struct catchup  catchup;
+    volatile solClient_uint64_t lastReplayNs;
+    volatile solClient_uint64_t noId;
+    volatile solClient_uint64_t delivered;
+};
+
+/*****************************************************************************
+ * checkDeliver
+ *
+ * Each benchmark message carries its sequence number.
+ *****************************************************************************/
+static void
+checkDeliver ( solClient_opaqueMsg_pt msg_p, int source, void *user_p )
+{
+    struct deliveryCheck *check_p = ( struct deliveryCheck * ) user_p;
+    void           *data_p;
+    solClient_uint32_t size;
+    solClient_uint64_t seq;
+
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &data_p, &size ) != SOLCLIENT_OK || size != sizeof ( seq ) ) {
+        return;
+    }
+    memcpy ( &seq, data_p, sizeof ( seq ) );
+    check_p->delivered++;
+    if ( seq < check_p->expected ) {
+        check_p->duplicates++;
+        return;
+    }
+    check_p->gaps += seq - check_p->expected;
+    check_p->expected = seq + 1;
+}
+
+/*****************************************************************************
+ * makeIds
+ *
+ * Synthetic replication group message IDs, increasing with the sequence.
+ *****************************************************************************/
+static          solClient_replicationGroupMessageId_t *
+makeIds ( solClient_uint64_t numIds )
+{
+    solClient_replicationGroupMessageId_t *ids_p;
+    char            idString[64];
+    solClient_uint64_t seq;
+
+    if ( ( ids_p = ( solClient_replicationGroupMessageId_t * ) malloc ( numIds * sizeof ( *ids_p ) ) ) == NULL ) {
+        return NULL;
+    }
+    for ( seq = 0; seq < numIds; seq++ ) {
+        sprintf ( idString, "rmid1:3ad2b-4f8a1c9e2d7-%08x-%08x", ( unsigned int ) ( seq >> 32 ),
+                  ( unsigned int ) seq );
+        if ( solClient_replicationGroupMessageId_fromString ( &ids_p[seq], sizeof ( ids_p[seq] ), idString ) !=
+             SOLCLIENT_OK ) {
+            free ( ids_p );
+            return NULL;
+        }
+    }
+    return ids_p;
+}
+
+/*****************************************************************************
+ * publishLive
+ *
+ * A live message as the Flow would hand it over.
+ *****************************************************************************/
+static void
+publishLive ( struct catchup *catchup_p, solClient_replicationGroupMessageId_t *ids_p, solClient_uint64_t seq )
+{
+    solClient_opaqueMsg_pt msg_p;
+
+    if ( solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ) {
+        return;
+    }
+    solClient_msg_setBinaryAttachment ( msg_p, &seq, sizeof ( seq ) );
+    if ( catchup_liveMsg ( catchup_p, msg_p, &ids_p[seq] ) != SOLCLIENT_CALLBACK_TAKE_MSG ) {
+        solClient_msg_free ( &msg_p );
+    }
+}
+
+/*****************************************************************************
+ * printStats
+ *****************************************************************************/
+static void
+printStats ( const struct catchupStats *stats_p )
+{
+    double          catchUpNs = ( double ) ( stats_p->switchNs - stats_p->startNs );
+
+    printf ( "  caught up in %.1f ms, %llu replayed at %.0f msgs/s\n", catchUpNs / 1e6,
+             ( unsigned long long ) stats_p->replayed, ( catchUpNs > 0 ) ? stats_p->replayed * 1e9 / catchUpNs : 0 );
+    printf ( "  switch-over %.1f us, %.2f ms behind live; ring high water %llu\n", stats_p->switchDurationNs / 1e3,
+             stats_p->switchLagNs / 1e6, ( unsigned long long ) stats_p->ringHighWater );
+    printf ( "  live buffered %llu, overflowed %llu, overlapped %llu, drained %llu; then live %llu, "
+             "duplicates dropped %llu\n", ( unsigned long long ) stats_p->buffered,
+             ( unsigned long long ) stats_p->overflowed, ( unsigned long long ) stats_p->overlapped,
+             ( unsigned long long ) stats_p->drained, ( unsigned long long ) stats_p->live,
+             ( unsigned long long ) stats_p->duplicates );
+}
+
+/*****************************************************************************
+ * benchCatchUp
+ *
+ * Replays history messages while live ones arrive at rate on the real
+ * clock, then publishes afterMsgs more live, and the replay Flow's last
+ * messages, once live.
+ *****************************************************************************/
+static void
+benchCatchUp ( solClient_replicationGroupMessageId_t *ids_p, solClient_uint64_t numIds, solClient_uint64_t history,
+               double rate, solClient_uint32_t ringSize, solClient_uint64_t afterMsgs )
+{
+    struct catchup  catchup;
+    struct catchupStats stats;
+    struct deliveryCheck check;
+    solClient_opaqueMsg_pt replayMsg_p;
+    solClient_uint64_t replaySeq = 0;
+    solClient_uint64_t replayNext = 0;
+    solClient_uint64_t liveNext = history;
+    solClient_uint64_t startNs;
+    solClient_uint64_t due;
+    solClient_uint64_t i;
+    int             live = 0;
+
+    printf ( "History %llu, live %.0f msgs/s, ring %u:\n", ( unsigned long long ) history, rate, ringSize );
+    memset ( &check, 0, sizeof ( check ) );
+    if ( solClient_msg_alloc ( &replayMsg_p ) != SOLCLIENT_OK ) {
+        return;
+    }
+    solClient_msg_setBinaryAttachmentPtr ( replayMsg_p, &replaySeq, sizeof ( replaySeq ) );
+    if ( catchup_init ( &catchup, ringSize, checkDeliver, &check ) != SOLCLIENT_OK ) {
+        solClient_msg_free ( &replayMsg_p );
+        return;
+    }
+
+    startNs = os_getTimeNs (  );
+    while ( !live ) {
+        due = history + ( solClient_uint64_t ) ( ( os_getTimeNs (  ) - startNs ) * rate / 1e9 );
+        while ( liveNext < due && liveNext < numIds - afterMsgs ) {
+            publishLive ( &catchup, ids_p, liveNext++ );
+        }
+        if ( replayNext < liveNext ) {
+            /* The replay log holds everything published so far. */
+            replaySeq = replayNext;
+            catchup_replayMsg ( &catchup, replayMsg_p, &ids_p[replayNext++] );
+            catchup_getStats ( &catchup, &stats );
+            live = ( stats.state == CATCHUP_LIVE );
+        } else if ( rate == 0 ) {
+            live = catchup_replayIdle ( &catchup );
+        } else if ( liveNext == numIds - afterMsgs ) {
+            printf ( "  the replay did not catch up with %llu live messages\n",
+                     ( unsigned long long ) ( liveNext - history ) );
+            goto destroy;
+        }
+    }
+
+    /* The replay Flow delivers a few more before it is destroyed. */
+    while ( replayNext < liveNext && replayNext < history + 100 ) {
+        replaySeq = replayNext;
+        catchup_replayMsg ( &catchup, replayMsg_p, &ids_p[replayNext++] );
+    }
+    for ( i = 0; i < afterMsgs; i++ ) {
+        publishLive ( &catchup, ids_p, liveNext++ );
+    }
+
+    catchup_getStats ( &catchup, &stats );
+    printStats ( &stats );
+    printf ( "  delivered %llu of %llu: %llu gaps, %llu duplicates\n", ( unsigned long long ) check.delivered,
+             ( unsigned long long ) liveNext, ( unsigned long long ) check.gaps,
+             ( unsigned long long ) check.duplicates );
+
+  destroy:
+    catchup_destroy ( &catchup );
+    solClient_msg_free ( &replayMsg_p );
+    fflush ( stdout );
+}
+
+/*****************************************************************************
+ * liveDeliver
+ *****************************************************************************/
+static void
+liveDeliver ( solClient_opaqueMsg_pt msg_p, int source, void *user_p )
+{
+    struct liveConsumer *consumer_p = ( struct liveConsumer * ) user_p;
+
+    /* The application processes the message here. */
+    consumer_p->delivered++;
+}
+
+/*****************************************************************************
+ * replayRxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+replayRxCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct liveConsumer *consumer_p = ( struct liveConsumer * ) user_p;
+    solClient_replicationGroupMessageId_t rgmid;
+
+    consumer_p->lastReplayNs = os_getTimeNs (  );
+    if ( solClient_msg_getReplicationGroupMessageId ( msg_p, &rgmid, sizeof ( rgmid ) ) != SOLCLIENT_OK ) {
+        consumer_p->noId++;
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    catchup_replayMsg ( &consumer_p->catchup, msg_p, &rgmid );
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * liveRxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+liveRxCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct liveConsumer *consumer_p = ( struct liveConsumer * ) user_p;
+    solClient_replicationGroupMessageId_t rgmid;
+
+    if ( solClient_msg_getReplicationGroupMessageId ( msg_p, &rgmid, sizeof ( rgmid ) ) != SOLCLIENT_OK ) {
+        consumer_p->noId++;
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    return catchup_liveMsg ( &consumer_p->catchup, msg_p, &rgmid );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic of the live stream.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Flows */
+    solClient_opaqueFlow_pt liveFlow_p;
+    solClient_opaqueFlow_pt replayFlow_p = NULL;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    const char     *flowProps[20] = {0, };
+    int             propIndex = 0;
+
+    /* Catch-up */
+    static struct liveConsumer consumer;
+    struct catchupStats stats;
+    solClient_replicationGroupMessageId_t lastId;
+    solClient_replicationGroupMessageId_t *ids_p;
+    char            idString[64];
+    const char     *queue_p = NULL;
+    const char     *start_p = SOLCLIENT_FLOW_PROP_REPLAY_START_LOCATION_BEGINNING;
+    solClient_uint32_t ringSize = CATCHUP_DEFAULT_RING;
+    solClient_uint64_t history = 500000;
+    solClient_uint64_t lastDelivered = 0;
+    solClient_uint64_t idleSinceNs;
+    int             idleMs = DEFAULT_IDLE_MS;
+    int             i;
+
+    printf ( "\nCatchUpConsumer.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  MSG_RATE_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 100000;
+    commandOpts.msgRate = 100000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tqueue=NAME          The Queue to replay (with --cip).\n"
+                                      "\tstart=LOCATION      BEGINNING, DATE:... or rmid1:... (default BEGINNING).\n"
+                                      "\tring=N              Live messages kept while replaying (default 65536).\n"
+                                      "\tidle=MS             The replay is done after MS without a message (default 2000).\n"
+                                      "\thistory=N           Without --cip, messages in the replay log (default 500000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "queue=", 6 ) == 0 ) {
+            queue_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "start=", 6 ) == 0 ) {
+            start_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "ring=", 5 ) == 0 ) {
+            ringSize = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "idle=", 5 ) == 0 ) {
+            idleMs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "history=", 8 ) == 0 ) {
+            history = ( solClient_uint64_t ) atoi ( argv[i] + 8 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( ringSize < 1 || idleMs < 1 ) {
+        printf ( "Invalid arguments: ring >= 1, idle >= 1\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 || queue_p == NULL ) ) {
+        printf ( "Catching up requires --cu, --topic and queue=NAME\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: replay and live in one thread
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        solClient_uint64_t afterMsgs = commandOpts.numMsgsToSend;
+        solClient_uint64_t numIds = history * 3 + afterMsgs;
+
+        if ( ( ids_p = makeIds ( numIds ) ) == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not make %llu IDs", ( unsigned long long ) numIds );
+            goto cleanup;
+        }
+        benchCatchUp ( ids_p, numIds, history, commandOpts.msgRate, ringSize, afterMsgs );
+        benchCatchUp ( ids_p, numIds, history, commandOpts.msgRate, SMALL_RING, afterMsgs );
+        benchCatchUp ( ids_p, numIds, history, 0, ringSize, afterMsgs );
+        free ( ids_p );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    if ( !solClient_session_isCapable ( session_p, SOLCLIENT_SESSION_CAPABILITY_MESSAGE_REPLAY ) ) {
+        printf ( "Message replay not supported on this message broker.\n" );
+        goto sessionConnected;
+    }
+    if ( catchup_init ( &consumer.catchup, ringSize, liveDeliver, &consumer ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * The live Flow first, so that nothing falls between it and the replay
+     *************************************************************************/
+    flowFuncInfo.rxMsgInfo.callback_p = liveRxCallback;
+    flowFuncInfo.rxMsgInfo.user_p = &consumer;
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_BLOCKING;
+    flowProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_DURABLE;
+    flowProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    if ( ( rc = solClient_session_createFlow ( ( char ** ) flowProps, session_p, &liveFlow_p,
+                                               &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createFlow()" );
+        goto destroyCatchUp;
+    }
+    if ( ( rc = solClient_flow_topicSubscribeWithDispatch ( liveFlow_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                            commandOpts.destinationName, NULL, 0 ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_topicSubscribeWithDispatch()" );
+        goto destroyLiveFlow;
+    }
+
+    /*************************************************************************
+     * Then the replay
+     *************************************************************************/
+    flowFuncInfo.rxMsgInfo.callback_p = replayRxCallback;
+    propIndex = 0;
+    memset ( flowProps, 0, sizeof ( flowProps ) );
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_BLOCKING;
+    flowProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_NAME;
+    flowProps[propIndex++] = queue_p;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_REPLAY_START_LOCATION;
+    flowProps[propIndex++] = start_p;
+    consumer.lastReplayNs = os_getTimeNs (  );
+    if ( ( rc = solClient_session_createFlow ( ( char ** ) flowProps, session_p, &replayFlow_p,
+                                               &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createFlow()" );
+        goto destroyLiveFlow;
+    }
+    printf ( "Replaying '%s' from %s while '%s' is live\n", queue_p, start_p, commandOpts.destinationName );
+    fflush ( stdout );
+
+    /*************************************************************************
+     * Catch up, then go on live
+     *************************************************************************/
+    for ( ;; ) {
+        catchup_getStats ( &consumer.catchup, &stats );
+        if ( stats.state == CATCHUP_LIVE ) {
+            break;
+        }
+        if ( os_getTimeNs (  ) - consumer.lastReplayNs > idleMs * 1000000ULL &&
+             !catchup_replayIdle ( &consumer.catchup ) ) {
+            /* Stalled behind the live stream: the replay must be restarted. */
+            printf ( "The replay stopped %llu live messages short\n",
+                     ( unsigned long long ) ( stats.buffered - stats.overflowed ) );
+            goto destroyReplayFlow;
+        }
+        OS_SLEEP_US ( 1000 );
+    }
+    if ( ( rc = solClient_flow_destroy ( &replayFlow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+    catchup_getStats ( &consumer.catchup, &stats );
+    printf ( "Live:\n" );
+    printStats ( &stats );
+    fflush ( stdout );
+
+    /* Until --mn messages have been delivered, or none came for idle. */
+    idleSinceNs = os_getTimeNs (  );
+    while ( consumer.delivered < ( solClient_uint64_t ) commandOpts.numMsgsToSend &&
+            os_getTimeNs (  ) - idleSinceNs < idleMs * 1000000ULL ) {
+        if ( consumer.delivered != lastDelivered ) {
+            lastDelivered = consumer.delivered;
+            idleSinceNs = os_getTimeNs (  );
+        }
+        OS_SLEEP_US ( 10000 );
+    }
+    catchup_getStats ( &consumer.catchup, &stats );
+    printf ( "Delivered %llu: %llu replayed, %llu live; %llu duplicates dropped, %llu without an ID\n",
+             ( unsigned long long ) consumer.delivered, ( unsigned long long ) stats.replayed,
+             ( unsigned long long ) ( stats.drained + stats.live ), ( unsigned long long ) stats.duplicates,
+             ( unsigned long long ) consumer.noId );
+    if ( catchup_getLastId ( &consumer.catchup, &lastId ) == SOLCLIENT_OK &&
+         solClient_replicationGroupMessageId_toString ( &lastId, sizeof ( lastId ), idString,
+                                                        sizeof ( idString ) ) == SOLCLIENT_OK ) {
+        printf ( "Restart with start=%s\n", idString );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroyReplayFlow:
+    if ( replayFlow_p != NULL && ( rc = solClient_flow_destroy ( &replayFlow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+
+  destroyLiveFlow:
+    if ( ( rc = solClient_flow_destroy ( &liveFlow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+
+  destroyCatchUp:
+    catchup_destroy ( &consumer.catchup );
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
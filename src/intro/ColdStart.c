@@ -0,0 +1,206 @@
+/** @example Intro/ColdStart.c
+ */
+
+/*
+ * This sample profiles its own startup with startup.h: the time taken by
+ * solClient_initialize(), Context creation, the loading of the TLS
+ * libraries for a secure host, Session connection, Queue provisioning and
+ * subscriptions, and the time to the first message received, all from the
+ * start of main().
+ *
+ * It subscribes to --topic as a critical subscription, plus extra=N
+ * others under it, provisions queue=NAME when given, and publishes a probe
+ * message to --topic every few ms until it receives one. With fast=1 the
+ * independent phases overlap: the TLS libraries are loaded while the API is
+ * initialized, the requests go out without waiting for each confirmation,
+ * and the extra subscriptions are only added once the first message came.
+ * Run it both ways and compare the time to the first message.
+ *
+ * Without --cip, it profiles the phases that need no broker, initializing
+ * the API and creating a Context, and with tls=1 the loading of the TLS
+ * libraries as for a secure host.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "startup.h"
+#include "getopt.h"
+
+#define DEFAULT_WAIT_MS         5000
+#define PROBE_INTERVAL_US       5000
+
+static char     extraTopics[STARTUP_MAX_SUBSCRIPTIONS][SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 32];     /* --topic and a suffix */
+
+/*****************************************************************************
+ * messageReceiveCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    startup_messageReceived ( ( struct startup * ) user_p );
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic subscribed to and probed.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    /* Started first, for the time from the start of main(). */
+    struct startup cs;
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Options */
+    int             fast = 0;
+    int             tls = 0;
+    int             numExtra = 0;
+    int             waitMs = DEFAULT_WAIT_MS;
+    const char     *queue_p = NULL;
+    const char     *sslLib_p = NULL;
+    const char     *cryptoLib_p = NULL;
+    solClient_uint64_t endNs;
+    int             i;
+
+    for ( i = 1; i < argc; i++ ) {
+        if ( strcmp ( argv[i], "fast=1" ) == 0 ) {
+            fast = 1;
+        }
+    }
+    startup_init ( &cs, fast );
+
+    printf ( "\nColdStart.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tfast=1              Overlap the startup phases and defer the extra subscriptions.\n"
+                                      "\tqueue=NAME          A durable Queue to provision.\n"
+                                      "\textra=N             Non-critical subscriptions under --topic (default 0).\n"
+                                      "\twait=MS             Most time to wait for the first message (default 5000).\n"
+                                      "\tsslLib=PATH         The TLS library (default the API's).\n"
+                                      "\tcryptoLib=PATH      The crypto library (default the API's).\n"
+                                      "\ttls=1               Without --cip, load the TLS libraries as for a secure host.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "fast=", 5 ) == 0 ) {
+            /* Read above. */
+        } else if ( strncmp ( argv[i], "queue=", 6 ) == 0 ) {
+            queue_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "extra=", 6 ) == 0 ) {
+            numExtra = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "wait=", 5 ) == 0 ) {
+            waitMs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "sslLib=", 7 ) == 0 ) {
+            sslLib_p = argv[i] + 7;
+        } else if ( strncmp ( argv[i], "cryptoLib=", 10 ) == 0 ) {
+            cryptoLib_p = argv[i] + 10;
+        } else if ( strncmp ( argv[i], "tls=", 4 ) == 0 ) {
+            tls = atoi ( argv[i] + 4 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( numExtra < 0 || numExtra > STARTUP_MAX_SUBSCRIPTIONS - 1 || waitMs < 1 ) {
+        printf ( "Invalid arguments: extra 0-%d, wait >= 1\n", STARTUP_MAX_SUBSCRIPTIONS - 1 );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Connecting requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        startup_setTls ( &cs, tls ? "tcps:" : NULL, sslLib_p, cryptoLib_p );
+    } else {
+        startup_setTls ( &cs, commandOpts.targetHost, sslLib_p, cryptoLib_p );
+        startup_setQueue ( &cs, queue_p );
+        startup_addSubscription ( &cs, commandOpts.destinationName, 1 );
+        for ( i = 0; i < numExtra; i++ ) {
+            snprintf ( extraTopics[i], sizeof ( extraTopics[i] ), "%s/extra/%d", commandOpts.destinationName, i );
+            startup_addSubscription ( &cs, extraTopics[i], 0 );
+        }
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = startup_initialize ( &cs, commandOpts.logLevel ) ) != SOLCLIENT_OK ) {
+        startup_destroy ( &cs );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    /*************************************************************************
+     * Without a broker: the phases before connecting
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        startup_createContext ( &cs );
+        startup_finish ( &cs, waitMs );
+        startup_print ( &cs );
+        goto destroy;
+    }
+
+    /*************************************************************************
+     * Create a Context, connect a Session, provision and subscribe
+     *************************************************************************/
+    if ( startup_connect ( &cs, &commandOpts, messageReceiveCallback ) != SOLCLIENT_OK ) {
+        startup_print ( &cs );
+        goto destroy;
+    }
+
+    /*************************************************************************
+     * Probe until the first message comes back
+     *************************************************************************/
+    endNs = os_getTimeNs (  ) + waitMs * 1000000ULL;
+    while ( startup_firstMessageNs ( &cs ) == 0 && os_getTimeNs (  ) < endNs ) {
+        common_publishMessage ( cs.session_p, commandOpts.destinationName, SOLCLIENT_DELIVERY_MODE_DIRECT );
+        OS_SLEEP_US ( PROBE_INTERVAL_US );
+    }
+
+    if ( startup_finish ( &cs, waitMs ) != SOLCLIENT_OK ) {
+        printf ( "Confirmations still missing after %d ms\n", waitMs );
+    }
+    startup_print ( &cs );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroy:
+    startup_destroy ( &cs );
+
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,296 @@
+/** @example Intro/EnvelopePublisher.c
+ */
+
+/*
+ * This sample publishes many small logical messages to one topic, first
+ * with one Solace message per logical message, then packed into envelopes
+ * (see envelope.h), and reports the logical message rate of both modes.
+ *
+ *  |-------------------|  ---Topic (envelopes)--> |--------------------|
+ *  | EnvelopePublisher |                          | EnvelopeSubscriber |
+ *  |-------------------|                          |--------------------|
+ *
+ * An envelope is flushed when it reaches the size or record limit, or when
+ * the flush timer (solClient_context_startTimer) expires, so a slow trickle
+ * of records is still delivered promptly.
+ *
+ * With --perf, each mode is followed by its hardware counters per logical
+ * message, the Context thread included (see perfcount.h).
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "envelope.h"
+#include "perfcount.h"
+#include "getopt.h"
+
+#define DEFAULT_RECORD_SIZE 40
+
+/*****************************************************************************
+ * fillRecord
+ *
+ * Builds a telemetry-like record of the requested size.
+ *****************************************************************************/
+static void
+fillRecord ( unsigned char *record_p, solClient_uint32_t size, int seq )
+{
+    solClient_uint32_t i;
+
+    for ( i = 0; i < size; i++ ) {
+        record_p[i] = ( unsigned char ) ( seq + i );
+    }
+}
+
+/*****************************************************************************
+ * publishSingle
+ *
+ * Baseline: one Solace message per logical message.
+ *****************************************************************************/
+static solClient_returnCode_t
+publishSingle ( solClient_opaqueSession_pt session_p, const char *topic_p,
+                unsigned char *record_p, solClient_uint32_t recordSize, int numRecords )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    int             i;
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDeliveryMode()" );
+        goto freeMsg;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = topic_p;
+    if ( ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDestination()" );
+        goto freeMsg;
+    }
+
+    for ( i = 0; i < numRecords; i++ ) {
+        fillRecord ( record_p, recordSize, i );
+        if ( ( rc = solClient_msg_setBinaryAttachmentPtr ( msg_p, record_p, recordSize ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_setBinaryAttachmentPtr()" );
+            goto freeMsg;
+        }
+        if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_sendMsg()" );
+            goto freeMsg;
+        }
+    }
+
+  freeMsg:
+    solClient_msg_free ( &msg_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * publishEnvelopes
+ *
+ * Packs the logical messages into envelopes.
+ *****************************************************************************/
+static solClient_returnCode_t
+publishEnvelopes ( solClient_opaqueContext_pt context_p, solClient_opaqueSession_pt session_p, const char *topic_p,
+                   unsigned char *record_p, solClient_uint32_t recordSize, int numRecords,
+                   struct envelopeStats *stats_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    struct envelopePublisher env;
+    int             i;
+
+    if ( ( rc = envelope_publisherInit ( &env, context_p, session_p, topic_p, SOLCLIENT_DELIVERY_MODE_DIRECT,
+                                         ENVELOPE_DEFAULT_MAX_BYTES, ENVELOPE_DEFAULT_MAX_RECORDS,
+                                         ENVELOPE_DEFAULT_FLUSH_MS ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+
+    for ( i = 0; i < numRecords; i++ ) {
+        fillRecord ( record_p, recordSize, i );
+        if ( ( rc = envelope_add ( &env, record_p, recordSize ) ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+
+    envelope_publisherDestroy ( &env );
+    *stats_p = env.stats;
+    return rc;
+}
+
+/*****************************************************************************
+ * printRate
+ *****************************************************************************/
+static void
+printRate ( const char *mode_p, int numRecords, solClient_uint64_t numSends, unsigned long long elapsedNs )
+{
+    double          secs = ( double ) elapsedNs / 1.0e9;
+
+    printf ( "%-10s %10d logical msgs in %8.3f s: %12.0f logical msgs/s, %10llu sends (%.1f logical msgs/send)\n",
+             mode_p, numRecords, secs, ( secs > 0 ) ? numRecords / secs : 0.0,
+             ( unsigned long long ) numSends, ( numSends != 0 ) ? ( double ) numRecords / ( double ) numSends : 0.0 );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to publish on.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Benchmark */
+    solClient_uint32_t recordSize = DEFAULT_RECORD_SIZE;
+    unsigned char  *record_p = NULL;
+    struct envelopeStats stats;
+    unsigned long long startNs;
+    struct perfCount perf;
+    struct perfCount *perf_p = NULL;
+    struct perfCountValues counts;
+
+    printf ( "\nEnvelopePublisher.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts,
+                                ( USER_PARAM_MASK | DEST_PARAM_MASK ),  /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK |
+                                  PERF_COUNTERS_MASK ) );               /* optional parameters */
+    commandOpts.numMsgsToSend = 1000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tRECORD_SIZE         Size of each logical message (default 40).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    if ( optind < argc ) {
+        recordSize = ( solClient_uint32_t ) atoi ( argv[optind] );
+        if ( recordSize == 0 || recordSize > ENVELOPE_DEFAULT_MAX_BYTES ) {
+            printf ( "RECORD_SIZE must be between 1 and %d\n", ENVELOPE_DEFAULT_MAX_BYTES );
+            exit ( 1 );
+        }
+    }
+    if ( ( record_p = ( unsigned char * ) malloc ( recordSize ) ) == NULL ) {
+        printf ( "Could not allocate a record of %u bytes\n", recordSize );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /* Before the Context, so that its thread is counted too. */
+    if ( commandOpts.perfCounters && perfcount_open ( &perf ) == SOLCLIENT_OK ) {
+        perf_p = &perf;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventPerfCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Publish the same logical messages in both modes
+     *************************************************************************/
+    printf ( "Publishing %d logical messages of %u bytes to '%s'\n\n",
+             commandOpts.numMsgsToSend, recordSize, commandOpts.destinationName );
+
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    if ( publishSingle ( session_p, commandOpts.destinationName, record_p, recordSize,
+                         commandOpts.numMsgsToSend ) == SOLCLIENT_OK ) {
+        if ( perf_p != NULL ) {
+            perfcount_stop ( perf_p, &counts );
+        }
+        printRate ( "single", commandOpts.numMsgsToSend, ( solClient_uint64_t ) commandOpts.numMsgsToSend,
+                    os_getTimeNs (  ) - startNs );
+        if ( perf_p != NULL ) {
+            perfcount_print ( stdout, "           ", &counts, commandOpts.numMsgsToSend, "logical msg" );
+        }
+    }
+
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    if ( publishEnvelopes ( context_p, session_p, commandOpts.destinationName, record_p, recordSize,
+                            commandOpts.numMsgsToSend, &stats ) == SOLCLIENT_OK ) {
+        if ( perf_p != NULL ) {
+            perfcount_stop ( perf_p, &counts );
+        }
+        printRate ( "envelope", commandOpts.numMsgsToSend, stats.envelopesSent, os_getTimeNs (  ) - startNs );
+        printf ( "           flushes by size: %llu, by timer: %llu, send errors: %llu\n",
+                 ( unsigned long long ) stats.flushBySize, ( unsigned long long ) stats.flushByTimer,
+                 ( unsigned long long ) stats.sendErrors );
+        if ( perf_p != NULL ) {
+            perfcount_print ( stdout, "           ", &counts, commandOpts.numMsgsToSend, "logical msg" );
+        }
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    if ( perf_p != NULL ) {
+        perfcount_close ( perf_p );
+    }
+    free ( record_p );
+    return 0;
+}
@@ -0,0 +1,168 @@
+/** @example Intro/EnvelopeSubscriber.c
+ */
+
+/*
+ * This sample subscribes to a topic published by EnvelopePublisher and
+ * iterates the logical messages packed into each received envelope in
+ * place, without copying them out of the message. Messages that are not
+ * envelopes count as one logical message each, so the logical message rate
+ * of both publishing modes can be compared.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "envelope.h"
+
+/* Counters, updated on the Context thread and read by the main thread. */
+static volatile solClient_uint64_t rxMsgs = 0;
+static volatile solClient_uint64_t rxRecords = 0;
+static volatile solClient_uint64_t rxBytes = 0;
+
+/*****************************************************************************
+ * envelopeMessageReceiveCallback
+ *
+ * Walks the logical messages of each envelope. A real application would
+ * process each record where it is summed here.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+envelopeMessageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct envelopeReader reader;
+    const void     *record_p;
+    solClient_uint32_t size;
+
+    rxMsgs++;
+    if ( envelope_readerInit ( &reader, msg_p ) == SOLCLIENT_OK ) {
+        while ( envelope_next ( &reader, &record_p, &size ) == SOLCLIENT_OK ) {
+            rxRecords++;
+            rxBytes += size;
+        }
+    } else {
+        rxRecords++;
+    }
+
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to subscribe to.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Rate reporting */
+    solClient_uint64_t lastMsgs = 0;
+    solClient_uint64_t lastRecords = 0;
+    solClient_uint64_t msgs;
+    solClient_uint64_t records;
+
+    printf ( "\nEnvelopeSubscriber.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts,
+                                ( USER_PARAM_MASK | DEST_PARAM_MASK ),  /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 2000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts, NULL ) == 0 ) {
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 envelopeMessageReceiveCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p,
+                                                      SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribe()" );
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Report rates once a second until enough logical messages arrive
+     *************************************************************************/
+    printf ( "Receiving on '%s' until %d logical messages, Ctrl-C to stop.....\n",
+             commandOpts.destinationName, commandOpts.numMsgsToSend );
+    while ( rxRecords < ( solClient_uint64_t ) commandOpts.numMsgsToSend ) {
+        SLEEP ( 1 );
+        msgs = rxMsgs;
+        records = rxRecords;
+        printf ( "%10llu msgs/s %12llu logical msgs/s (total %llu logical, %llu record bytes)\n",
+                 ( unsigned long long ) ( msgs - lastMsgs ), ( unsigned long long ) ( records - lastRecords ),
+                 ( unsigned long long ) records, ( unsigned long long ) rxBytes );
+        fflush ( stdout );
+        lastMsgs = msgs;
+        lastRecords = records;
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,377 @@
+/** @example Intro/FeedArbiter.c
+ */
+
+/*
+ * This sample subscribes to the same topic through two Sessions on separate
+ * Contexts, normally connected over separate paths, and forwards only the
+ * first copy of each message (see arbiter.h).
+ *
+ *  |-----------|  --path A-->  Session A (Context A)  --\
+ *  | Publisher |                                          >--  arbiter  -->  first arrivals
+ *  |-----------|  --path B-->  Session B (Context B)  --/
+ *
+ * The publisher must send with sender IDs and sequence numbers, as
+ * TopicPublisher and the other samples built on common.c do. Once a second
+ * the sample prints the forwarded rate, which feed won how many pairs, and
+ * by how much it led.
+ *
+ * Without --cip, the sample benchmarks the arbiter alone: first both copies
+ * of each message are offered from one thread with synthetic arrival times
+ * and losses, then each feed is offered from its own thread at full speed.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "arbiter.h"
+#include "getopt.h"
+
+#define BENCH_SENDERS           16
+#define BENCH_MAX_LEAD_NS       50000   /* Synthetic lead of the first copy, up to 50 us. */
+#define BENCH_LOSS_PER_MILLION  1000    /* Synthetic loss on each feed. */
+#define BENCH_MAX_SKEW          1024    /* Messages one feed thread may run ahead of the other. */
+
+struct feed
+{
+    int             feed;               /* ARBITER_FEED_A or _B. */
+    struct arbiter *arb_p;
+    volatile solClient_uint64_t forwarded;
+};
+
+struct benchThread
+{
+    OS_THREAD       thread;
+    struct arbiter *arb_p;
+    int             feed;
+    int             numMsgs;
+    volatile int    progress;
+    struct benchThread *peer_p;
+};
+
+/*****************************************************************************
+ * feedMessageReceiveCallback
+ *
+ * Both Sessions use this callback, on their own Context threads.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+feedMessageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct feed    *feed_p = ( struct feed * ) user_p;
+
+    if ( arbiter_offerMsg ( feed_p->arb_p, feed_p->feed, msg_p ) == ARBITER_FORWARD ) {
+        /* The application processes first arrivals here. */
+        feed_p->forwarded++;
+    }
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * benchInterleaved
+ *
+ * Offers both copies of numMsgs messages from one thread. Each copy is lost
+ * with BENCH_LOSS_PER_MILLION, the first copy comes from either feed, and
+ * the second follows it by up to BENCH_MAX_LEAD_NS of synthetic time.
+ *****************************************************************************/
+static void
+benchInterleaved ( int numMsgs )
+{
+    struct arbiter  arb;
+    struct arbiterStats stats;
+    solClient_uint64_t hashes[BENCH_SENDERS];
+    solClient_uint64_t seqs[BENCH_SENDERS];
+    solClient_uint64_t random = COMMON_RANDOM_SEED;
+    solClient_uint64_t r;
+    solClient_uint64_t nowNs = 0;
+    solClient_uint64_t offers = 0;
+    solClient_uint64_t expected = 0;
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    char            senderId[32];
+    int             first;
+    int             sender;
+    int             i;
+
+    if ( arbiter_init ( &arb, BENCH_SENDERS, 0 ) != SOLCLIENT_OK ) {
+        return;
+    }
+    for ( i = 0; i < BENCH_SENDERS; i++ ) {
+        sprintf ( senderId, "bench/sender/%d", i );
+        hashes[i] = arbiter_hashSender ( senderId );
+        seqs[i] = 0;
+    }
+
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numMsgs; i++ ) {
+        r = common_random ( &random );
+        sender = ( int ) ( r % BENCH_SENDERS );
+        seqs[sender]++;
+        nowNs += 1000;
+        first = ( int ) ( ( r >> 8 ) & 1 );
+        if ( ( r >> 12 ) % 1000000 >= BENCH_LOSS_PER_MILLION ) {
+            arbiter_offer ( &arb, first, hashes[sender], seqs[sender], nowNs );
+            offers++;
+            expected++;
+            if ( ( r >> 32 ) % 1000000 >= BENCH_LOSS_PER_MILLION ) {
+                arbiter_offer ( &arb, 1 - first, hashes[sender], seqs[sender], nowNs + ( r >> 40 ) % BENCH_MAX_LEAD_NS );
+                offers++;
+            }
+        } else if ( ( r >> 32 ) % 1000000 >= BENCH_LOSS_PER_MILLION ) {
+            arbiter_offer ( &arb, 1 - first, hashes[sender], seqs[sender], nowNs );
+            offers++;
+            expected++;
+        }
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+
+    arbiter_getStats ( &arb, &stats );
+    printf ( "\none thread, synthetic leads: %llu offers in %.3f s, %.1f ns/offer, %.1f M offers/s, %s\n",
+             ( unsigned long long ) offers, ( double ) elapsedNs / 1.0e9, ( double ) elapsedNs / ( double ) offers,
+             ( double ) offers * 1.0e3 / ( double ) elapsedNs,
+             ( stats.forwarded == expected ) ? "every message forwarded once" : "FORWARDED COUNT MISMATCH" );
+    arbiter_printStats ( &stats );
+    arbiter_destroy ( &arb );
+}
+
+/*****************************************************************************
+ * benchFeedThread
+ *
+ * Offers every message of one feed as fast as possible, but no more than
+ * BENCH_MAX_SKEW messages ahead of the other feed, as two real feeds stay
+ * within the arbitration window of each other.
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( benchFeedThread, arg_p )
+{
+    struct benchThread *bench_p = ( struct benchThread * ) arg_p;
+    solClient_uint64_t hashes[BENCH_SENDERS];
+    solClient_uint64_t seqs[BENCH_SENDERS];
+    solClient_uint64_t random = COMMON_RANDOM_SEED;
+    char            senderId[32];
+    int             sender;
+    int             i;
+
+    for ( i = 0; i < BENCH_SENDERS; i++ ) {
+        sprintf ( senderId, "bench/sender/%d", i );
+        hashes[i] = arbiter_hashSender ( senderId );
+        seqs[i] = 0;
+    }
+    /* Both threads draw the same senders, so they offer the same messages. */
+    for ( i = 0; i < bench_p->numMsgs; i++ ) {
+        while ( i - bench_p->peer_p->progress > BENCH_MAX_SKEW ) {
+            OS_YIELD (  );
+        }
+        sender = ( int ) ( common_random ( &random ) % BENCH_SENDERS );
+        arbiter_offer ( bench_p->arb_p, bench_p->feed, hashes[sender], ++seqs[sender], os_getTimeNs (  ) );
+        bench_p->progress = i + 1;
+    }
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * benchThreads
+ *****************************************************************************/
+static void
+benchThreads ( int numMsgs )
+{
+    struct arbiter  arb;
+    struct arbiterStats stats;
+    struct benchThread threads[ARBITER_NUM_FEEDS];
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    int             i;
+
+    if ( arbiter_init ( &arb, BENCH_SENDERS, 0 ) != SOLCLIENT_OK ) {
+        return;
+    }
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        threads[i].arb_p = &arb;
+        threads[i].feed = i;
+        threads[i].numMsgs = numMsgs;
+        threads[i].progress = 0;
+        threads[i].peer_p = &threads[1 - i];
+    }
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        if ( os_threadCreate ( &threads[i].thread, benchFeedThread, &threads[i] ) != 0 ) {
+            printf ( "Could not start a feed thread\n" );
+            exit ( 1 );
+        }
+    }
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        os_threadJoin ( threads[i].thread );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+
+    arbiter_getStats ( &arb, &stats );
+    printf ( "\ntwo feed threads: %d messages per feed in %.3f s, %.1f M offers/s, %s\n",
+             numMsgs, ( double ) elapsedNs / 1.0e9, 2.0 * ( double ) numMsgs * 1.0e3 / ( double ) elapsedNs,
+             ( stats.forwarded == ( solClient_uint64_t ) numMsgs ) ? "every message forwarded once" :
+             "FORWARDED COUNT MISMATCH" );
+    arbiter_printStats ( &stats );
+    arbiter_destroy ( &arb );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address of feed A.
+ * param appliance_username The client username.
+ * param topic The topic to subscribe to on both feeds.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    struct commonOptions feedOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Contexts and Sessions, one per feed */
+    solClient_opaqueContext_pt contexts[ARBITER_NUM_FEEDS] = { NULL, NULL };
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    solClient_opaqueSession_pt sessions[ARBITER_NUM_FEEDS] = { NULL, NULL };
+
+    /* Arbitration */
+    struct arbiter  arb;
+    struct arbiterStats stats;
+    struct feed     feeds[ARBITER_NUM_FEEDS];
+    solClient_uint64_t forwarded = 0;
+    solClient_uint64_t lastForwarded = 0;
+    int             i;
+
+    printf ( "\nFeedArbiter.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 10000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tHOST_B              Host of feed B (default: the --cip host).\n"
+                                      "\tWithout --cip, the arbiter is benchmarked with -n messages.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Arbitrating live feeds requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Benchmark
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        benchInterleaved ( commandOpts.numMsgsToSend );
+        benchThreads ( commandOpts.numMsgsToSend );
+        goto cleanup;
+    }
+
+    if ( arbiter_init ( &arb, 0, 0 ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * A Context and a Session for each feed
+     *************************************************************************/
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        feeds[i].feed = i;
+        feeds[i].arb_p = &arb;
+        feeds[i].forwarded = 0;
+
+        feedOpts = commandOpts;
+        if ( i == ARBITER_FEED_B && optind < argc ) {
+            strncpy ( feedOpts.targetHost, argv[optind], sizeof ( feedOpts.targetHost ) - 1 );
+        }
+        if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                               &contexts[i], &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_create()" );
+            goto destroyArbiter;
+        }
+        if ( ( rc = common_createAndConnectSession ( contexts[i],
+                                                     &sessions[i],
+                                                     feedMessageReceiveCallback,
+                                                     common_eventCallback, &feeds[i], &feedOpts ) ) != SOLCLIENT_OK ) {
+            goto sessionsConnected;
+        }
+        printf ( "Feed %c connected to %s\n", 'A' + i, feedOpts.targetHost );
+    }
+
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        if ( ( rc = solClient_session_topicSubscribeExt ( sessions[i],
+                                                          SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                          commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_topicSubscribe()" );
+            goto sessionsConnected;
+        }
+    }
+
+    /*************************************************************************
+     * Arbitrate until enough messages are forwarded
+     *************************************************************************/
+    printf ( "Arbitrating '%s' until %d messages, Ctrl-C to stop.....\n",
+             commandOpts.destinationName, commandOpts.numMsgsToSend );
+    while ( forwarded < ( solClient_uint64_t ) commandOpts.numMsgsToSend ) {
+        SLEEP ( 1 );
+        forwarded = feeds[ARBITER_FEED_A].forwarded + feeds[ARBITER_FEED_B].forwarded;
+        printf ( "%10llu msgs/s forwarded\n", ( unsigned long long ) ( forwarded - lastForwarded ) );
+        lastForwarded = forwarded;
+        arbiter_getStats ( &arb, &stats );
+        arbiter_printStats ( &stats );
+        fflush ( stdout );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionsConnected:
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        if ( sessions[i] != NULL && ( rc = solClient_session_disconnect ( sessions[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_disconnect()" );
+        }
+    }
+    /* No more callbacks can use the arbiter once the Contexts are gone. */
+    for ( i = 0; i < ARBITER_NUM_FEEDS; i++ ) {
+        if ( contexts[i] != NULL ) {
+            solClient_context_destroy ( &contexts[i] );
+        }
+    }
+
+  destroyArbiter:
+    arbiter_destroy ( &arb );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
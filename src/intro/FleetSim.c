@@ -0,0 +1,221 @@
+/** @example Intro/FleetSim.c
+ */
+
+/*
+ * This sample runs a fleet of thousands of Sessions in one process, spread
+ * over a few Contexts, each Session following a scripted profile (see
+ * fleet.h): its subscriptions, publish rate, payload size and reconnect
+ * behavior. Every few seconds, and at the end, it reports per-profile
+ * totals, and the client-side cost of the fleet: resident memory and CPU
+ * time per Session.
+ *
+ * Without --cip the Sessions are only created, not connected, which still
+ * measures the memory a Session costs the client before any traffic.
+ *
+ * Each connected Session holds a socket: raise the open file limit
+ * (ulimit -n) above the number of Sessions first.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "fleet.h"
+#include "getopt.h"
+
+#define REPORT_INTERVAL_SEC     5
+
+/*****************************************************************************
+ * printProfiles
+ *****************************************************************************/
+static void
+printProfiles ( struct fleet *fleet_p, struct fleetStats *previous_p, double intervalSec )
+{
+    struct fleetStats stats;
+    int             profile;
+
+    printf ( "%-12s %9s %12s %12s %10s %12s %12s %8s\n", "profile", "up", "sent/s", "received/s",
+             "MB/s in", "blocked", "failed", "churns" );
+    for ( profile = 0; profile < fleet_p->numProfiles; profile++ ) {
+        fleet_getStats ( fleet_p, profile, &stats );
+        printf ( "%-12s %4u/%-4u %12.0f %12.0f %10.2f %12llu %12llu %8llu\n", fleet_p->profiles[profile].name,
+                 stats.sessionsUp, stats.sessions,
+                 ( double ) ( stats.msgsSent - previous_p[profile].msgsSent ) / intervalSec,
+                 ( double ) ( stats.msgsReceived - previous_p[profile].msgsReceived ) / intervalSec,
+                 ( double ) ( stats.bytesReceived - previous_p[profile].bytesReceived ) / intervalSec / 1.0e6,
+                 ( unsigned long long ) stats.sendsBlocked, ( unsigned long long ) stats.sendsFailed,
+                 ( unsigned long long ) stats.churns );
+        previous_p[profile] = stats;
+    }
+    fflush ( stdout );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Fleet */
+    struct fleet    fleet;
+    struct fleetProfile profiles[FLEET_MAX_PROFILES];
+    struct fleetStats previous[FLEET_MAX_PROFILES];
+    const char     *defaultProfiles[] = { "quote:2000:1:1:200", "trader:500:10:5:512", "mobile:500:2:0.2:1024:30" };
+    int             numProfiles = 0;
+    int             numContexts = 4;
+    int             durationSec = 60;
+    int             numSessions = 0;
+    unsigned long long residentBytes[3];
+    unsigned long long cpuNs[3];
+    unsigned long long startNs;
+    unsigned long long reportNs;
+    unsigned long long nowNs;
+    int             i;
+
+    printf ( "\nFleetSim.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tprofile=NAME:SESSIONS:SUBS:RATE:SIZE[:CHURN]\n"
+                                      "\t                    A profile; may be repeated. SESSIONS publish RATE msgs/s\n"
+                                      "\t                    of SIZE bytes each, subscribe to SUBS of their peers'\n"
+                                      "\t                    topics, and reconnect every CHURN s (default: quote:2000:1:1:200\n"
+                                      "\t                    trader:500:10:5:512 mobile:500:2:0.2:1024:30).\n"
+                                      "\tcontexts=N          Contexts the Sessions are spread over (default 4).\n"
+                                      "\tduration=SEC        Time to run connected (default 60).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "profile=", 8 ) == 0 ) {
+            if ( numProfiles == FLEET_MAX_PROFILES || fleet_parseProfile ( argv[i] + 8, &profiles[numProfiles] ) != SOLCLIENT_OK ) {
+                printf ( "Invalid profile '%s': at most %d, NAME:SESSIONS:SUBS:RATE:SIZE[:CHURN] with SUBS < SESSIONS\n",
+                         argv[i] + 8, FLEET_MAX_PROFILES );
+                exit ( 1 );
+            }
+            numProfiles++;
+        } else if ( strncmp ( argv[i], "contexts=", 9 ) == 0 ) {
+            numContexts = atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "duration=", 9 ) == 0 ) {
+            durationSec = atoi ( argv[i] + 9 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( numProfiles == 0 ) {
+        for ( numProfiles = 0; numProfiles < ( int ) ( sizeof ( defaultProfiles ) / sizeof ( defaultProfiles[0] ) ); numProfiles++ ) {
+            fleet_parseProfile ( defaultProfiles[numProfiles], &profiles[numProfiles] );
+        }
+    }
+    if ( numContexts < 1 || numContexts > FLEET_MAX_CONTEXTS || durationSec < 1 ) {
+        printf ( "Invalid arguments: contexts 1..%d, duration >= 1\n", FLEET_MAX_CONTEXTS );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 && commandOpts.username[0] == ( char ) 0 ) {
+        printf ( "Connecting requires --cu\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Create the fleet
+     *************************************************************************/
+    for ( i = 0; i < numProfiles; i++ ) {
+        numSessions += profiles[i].numSessions;
+        printf ( "profile %-12s %6d Sessions, %3d subscriptions, %8.2f msgs/s of %5d bytes, churn %d s\n",
+                 profiles[i].name, profiles[i].numSessions, profiles[i].numSubs, profiles[i].msgRate,
+                 profiles[i].payloadSize, profiles[i].churnSec );
+    }
+    residentBytes[0] = os_getResidentBytes (  );
+    cpuNs[0] = os_getCpuTimeNs (  );
+    if ( fleet_init ( &fleet, profiles, numProfiles, numContexts, &commandOpts ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    residentBytes[1] = os_getResidentBytes (  );
+    cpuNs[1] = os_getCpuTimeNs (  );
+    printf ( "Created %d Sessions on %d Contexts: %.1f KB resident and %.1f us CPU per Session\n",
+             numSessions, numContexts, ( double ) ( residentBytes[1] - residentBytes[0] ) / 1024.0 / numSessions,
+             ( double ) ( cpuNs[1] - cpuNs[0] ) / 1000.0 / numSessions );
+    fflush ( stdout );
+
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        goto destroyFleet;
+    }
+
+    /*************************************************************************
+     * Run the profiles
+     *************************************************************************/
+    if ( fleet_start ( &fleet ) != SOLCLIENT_OK ) {
+        goto destroyFleet;
+    }
+    memset ( previous, 0, sizeof ( previous ) );
+    startNs = reportNs = os_getTimeNs (  );
+    do {
+        SLEEP ( 1 );
+        fleet_churn ( &fleet );
+        nowNs = os_getTimeNs (  );
+        if ( nowNs - reportNs >= REPORT_INTERVAL_SEC * 1000000000ULL ) {
+            printf ( "\nAfter %.0f s:\n", ( double ) ( nowNs - startNs ) / 1.0e9 );
+            printProfiles ( &fleet, previous, ( double ) ( nowNs - reportNs ) / 1.0e9 );
+            reportNs = nowNs;
+        }
+    } while ( nowNs - startNs < ( unsigned long long ) durationSec * 1000000000ULL );
+
+    residentBytes[2] = os_getResidentBytes (  );
+    cpuNs[2] = os_getCpuTimeNs (  );
+    memset ( previous, 0, sizeof ( previous ) );
+    printf ( "\nTotals over %d s, rates averaged:\n", durationSec );
+    printProfiles ( &fleet, previous, ( double ) ( nowNs - startNs ) / 1.0e9 );
+    printf ( "Running: %.1f KB resident per Session, %.2f%% of a CPU in all, %.2f us CPU per Session-second\n",
+             ( double ) ( residentBytes[2] - residentBytes[0] ) / 1024.0 / numSessions,
+             ( double ) ( cpuNs[2] - cpuNs[1] ) * 100.0 / ( double ) ( nowNs - startNs ),
+             ( double ) ( cpuNs[2] - cpuNs[1] ) / 1000.0 / ( ( double ) ( nowNs - startNs ) / 1.0e9 ) / numSessions );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroyFleet:
+    fleet_destroy ( &fleet );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
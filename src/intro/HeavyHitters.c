@@ -0,0 +1,502 @@
+/** @example Intro/HeavyHitters.c
+ */
+
+/*
+ * This sample finds the topics carrying the most messages and the most
+ * bytes, whatever the number of topics, with the accounting in common.h
+ * (common_topicsEnable()). It subscribes to --topic, which may hold
+ * wildcards, and prints the heaviest top=N topics received every
+ * interval=MS, for duration=S.
+ *
+ * Without --cip, it records a generated stream of --mn messages over
+ * topics=N topics, most of them rare, a few common, plus hot=N runaway
+ * topics taking share=PCT of the messages and one bulk topic of large
+ * messages; it reports the cost of recording a message, at sample=N and
+ * counting every message, against a budget of a few nanoseconds, the
+ * memory of the accounting against that of exact per-topic counters, and
+ * how the reported topics and counts compare with the exact ones.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "getopt.h"
+
+#define DEFAULT_TOPICS          1000000
+#define DEFAULT_HOT             3
+#define DEFAULT_SHARE           20
+#define DEFAULT_INTERVAL_MS     1000
+#define DEFAULT_DURATION_S      10
+#define DEFAULT_TOP             10
+#define BULK_SHARE_PER_MILLE    5
+#define BULK_SIZE               32768
+#define HOT_SIZE                64
+#define BUDGET_NS               10      /* Per message recorded, at the default sampling. */
+
+/*
+ * The generated stream and its exact counts.
+ */
+struct bench
+{
+    char           *names_p;
+    char          **topics_p;           /* hot topics and the bulk topic after the rest */
+    solClient_uint32_t *sizes_p;
+    solClient_uint32_t numTopics;
+    solClient_uint32_t *stream_p;
+    solClient_uint64_t numMsgs;
+    solClient_uint64_t *msgs_p;
+    solClient_uint64_t *bytes_p;
+    size_t          namesBytes;
+};
+
+/*****************************************************************************
+ * benchCreate
+ *
+ * Rare topics are drawn log-uniformly: a bit count, then a topic below
+ * that power of two, so that topic i comes up about 1/i as often as the
+ * first.
+ *****************************************************************************/
+static int
+benchCreate ( struct bench *bench_p, solClient_uint32_t numTopics, int numHot, int sharePct,
+              solClient_uint64_t numMsgs )
+{
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_uint64_t i;
+    solClient_uint32_t bulk = numTopics + numHot;
+    solClient_uint32_t topic;
+    solClient_uint32_t bits = 0;
+    solClient_uint32_t draw;
+    char           *name_p;
+    int             t;
+
+    memset ( bench_p, 0, sizeof ( *bench_p ) );
+    bench_p->numTopics = bulk + 1;
+    bench_p->numMsgs = numMsgs;
+    while ( bits < 31 && ( ( solClient_uint32_t ) 1 << bits ) < numTopics ) {
+        bits++;
+    }
+    bench_p->names_p = ( char * ) malloc ( ( size_t ) bench_p->numTopics * 32 );
+    bench_p->topics_p = ( char ** ) malloc ( bench_p->numTopics * sizeof ( char * ) );
+    bench_p->sizes_p = ( solClient_uint32_t * ) malloc ( bench_p->numTopics * sizeof ( solClient_uint32_t ) );
+    bench_p->stream_p = ( solClient_uint32_t * ) malloc ( numMsgs * sizeof ( solClient_uint32_t ) );
+    bench_p->msgs_p = ( solClient_uint64_t * ) calloc ( bench_p->numTopics, sizeof ( solClient_uint64_t ) );
+    bench_p->bytes_p = ( solClient_uint64_t * ) calloc ( bench_p->numTopics, sizeof ( solClient_uint64_t ) );
+    if ( bench_p->names_p == NULL || bench_p->topics_p == NULL || bench_p->sizes_p == NULL ||
+         bench_p->stream_p == NULL || bench_p->msgs_p == NULL || bench_p->bytes_p == NULL ) {
+        return 0;
+    }
+
+    name_p = bench_p->names_p;
+    for ( topic = 0; topic < bench_p->numTopics; topic++ ) {
+        if ( topic < numTopics ) {
+            sprintf ( name_p, "acme/orders/%u", topic );
+            bench_p->sizes_p[topic] = 100 + topic % 400;
+        } else if ( topic < bulk ) {
+            sprintf ( name_p, "acme/runaway/%u", topic - numTopics );
+            bench_p->sizes_p[topic] = HOT_SIZE;
+        } else {
+            sprintf ( name_p, "acme/bulk/export" );
+            bench_p->sizes_p[topic] = BULK_SIZE;
+        }
+        bench_p->topics_p[topic] = name_p;
+        name_p += strlen ( name_p ) + 1;
+    }
+    bench_p->namesBytes = ( size_t ) ( name_p - bench_p->names_p );
+
+    for ( i = 0; i < numMsgs; i++ ) {
+        common_random ( &x );
+        draw = ( solClient_uint32_t ) ( x % 1000 );
+        if ( draw < BULK_SHARE_PER_MILLE ) {
+            topic = bulk;
+        } else if ( numHot > 0 && draw < BULK_SHARE_PER_MILLE + ( solClient_uint32_t ) sharePct * 10 ) {
+            t = ( int ) ( ( x >> 10 ) % ( solClient_uint64_t ) numHot );
+            topic = numTopics + t;
+        } else {
+            topic = ( solClient_uint32_t ) ( ( x >> 16 ) & ( ( ( solClient_uint64_t ) 1 << ( ( x >> 10 ) % ( bits + 1 ) ) ) - 1 ) );
+            topic %= numTopics;
+        }
+        bench_p->stream_p[i] = topic;
+        bench_p->msgs_p[topic]++;
+        bench_p->bytes_p[topic] += bench_p->sizes_p[topic];
+    }
+    return 1;
+}
+
+/*****************************************************************************
+ * benchDestroy
+ *****************************************************************************/
+static void
+benchDestroy ( struct bench *bench_p )
+{
+    free ( bench_p->names_p );
+    free ( bench_p->topics_p );
+    free ( bench_p->sizes_p );
+    free ( bench_p->stream_p );
+    free ( bench_p->msgs_p );
+    free ( bench_p->bytes_p );
+}
+
+/*****************************************************************************
+ * benchTopK
+ *
+ * The exact top k topics, by messages or by bytes, into top_p.
+ *****************************************************************************/
+static void
+benchTopK ( const struct bench *bench_p, const solClient_uint64_t *counts_p, solClient_uint32_t *top_p, int k )
+{
+    solClient_uint32_t topic;
+    int             n = 0;
+    int             i;
+
+    for ( topic = 0; topic < bench_p->numTopics; topic++ ) {
+        if ( n == k && counts_p[topic] <= counts_p[top_p[k - 1]] ) {
+            continue;
+        }
+        i = ( n < k ) ? n++ : k - 1;
+        while ( i > 0 && counts_p[top_p[i - 1]] < counts_p[topic] ) {
+            top_p[i] = top_p[i - 1];
+            i--;
+        }
+        top_p[i] = topic;
+    }
+}
+
+/*****************************************************************************
+ * benchReport
+ *
+ * Print the reported topics against the exact counts, and how many of the
+ * exact top were reported.
+ *****************************************************************************/
+static void
+benchReport ( const struct bench *bench_p, const struct commonTopicsReport *report_p, int byBytes, int top )
+{
+    const struct commonTopicCount *list_p = byBytes ? report_p->byBytes : report_p->byMsgs;
+    const solClient_uint64_t *exact_p = byBytes ? bench_p->bytes_p : bench_p->msgs_p;
+    int             count = byBytes ? report_p->numByBytes : report_p->numByMsgs;
+    solClient_uint32_t exactTop[COMMON_TOPICS_TOP_K];
+    solClient_uint64_t reported;
+    solClient_uint64_t exact;
+    double          maxError = 0.0;
+    double          error;
+    int             found = 0;
+    int             i;
+    int             j;
+
+    if ( top > count ) {
+        top = count;
+    }
+    if ( top == 0 ) {
+        return;
+    }
+    printf ( "\nTop %d by %s:\n  %-24s %14s %14s %9s\n", top, byBytes ? "bytes" : "messages", "topic", "reported",
+             "exact", "error" );
+    for ( i = 0; i < count; i++ ) {
+        for ( j = 0; j < ( int ) bench_p->numTopics; j++ ) {
+            if ( strcmp ( bench_p->topics_p[j], list_p[i].topic ) == 0 ) {
+                break;
+            }
+        }
+        reported = byBytes ? list_p[i].bytes : list_p[i].msgs;
+        exact = ( j < ( int ) bench_p->numTopics ) ? exact_p[j] : 0;
+        error = ( exact > 0 ) ? 100.0 * ( ( double ) reported - ( double ) exact ) / ( double ) exact : 100.0;
+        if ( i < top ) {
+            printf ( "  %-24s %14llu %14llu %8.2f%%\n", list_p[i].topic, ( unsigned long long ) reported,
+                     ( unsigned long long ) exact, error );
+        }
+        if ( error > maxError ) {
+            maxError = error;
+        }
+    }
+
+    benchTopK ( bench_p, exact_p, exactTop, top );
+    for ( i = 0; i < top; i++ ) {
+        for ( j = 0; j < top; j++ ) {
+            if ( strcmp ( bench_p->topics_p[exactTop[i]], list_p[j].topic ) == 0 ) {
+                found++;
+                break;
+            }
+        }
+    }
+    printf ( "  exact top %d found: %d; largest overestimate of the %d kept: %.2f%%\n", top, found, count,
+             maxError );
+}
+
+/*****************************************************************************
+ * benchRun
+ *****************************************************************************/
+static void
+benchRun ( struct bench *bench_p, int top, int sampling )
+{
+    struct commonTopicsReport report;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    solClient_uint64_t startNs;
+    solClient_uint64_t elapsedNs;
+    solClient_uint64_t i;
+    solClient_uint32_t topic;
+    solClient_uint64_t reps = bench_p->numMsgs;
+    double          topicNs;
+    double          msgNs;
+    size_t          sketchBytes;
+    size_t          exactBytes;
+    char            payload[HOT_SIZE];
+
+    /* Every message counted first, on TX so as not to disturb the report. */
+    common_topicsEnable ( 3600 * 1000 );
+    common_topicsSetSampling ( 1 );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < bench_p->numMsgs; i++ ) {
+        topic = bench_p->stream_p[i];
+        common_topicsRecordTopic ( COMMON_TOPICS_TX, bench_p->topics_p[topic], bench_p->sizes_p[topic] );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    printf ( "Recorded %llu messages on %u topics, every one counted: %.1f ns per message by topic\n",
+             ( unsigned long long ) bench_p->numMsgs, bench_p->numTopics, ( double ) elapsedNs / ( double ) bench_p->numMsgs );
+
+    /* Then one interval for the whole stream at the rate asked, ended by the flush. */
+    common_topicsSetSampling ( sampling );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < bench_p->numMsgs; i++ ) {
+        topic = bench_p->stream_p[i];
+        common_topicsRecordTopic ( COMMON_TOPICS_RX, bench_p->topics_p[topic], bench_p->sizes_p[topic] );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    common_topicsFlush (  );
+    printf ( "Recorded %llu messages on %u topics, one in %d counted: %.1f ns per message by topic\n",
+             ( unsigned long long ) bench_p->numMsgs, bench_p->numTopics, sampling,
+             ( double ) elapsedNs / ( double ) bench_p->numMsgs );
+    printf ( "  (both include the cache misses of reading a stream over %u topic names)\n", bench_p->numTopics );
+
+    /*
+     * The budget: the cost per message where the topic is at hand, as on
+     * the receive and publish paths, by topic and through common_topicsRecord(),
+     * which reads the message only when it is sampled; on TX.
+     */
+    if ( reps > 10000000 ) {
+        reps = 10000000;
+    }
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < reps; i++ ) {
+        common_topicsRecordTopic ( COMMON_TOPICS_TX, bench_p->topics_p[0], HOT_SIZE );
+    }
+    topicNs = ( double ) ( os_getTimeNs (  ) - startNs ) / ( double ) reps;
+    memset ( payload, 0, sizeof ( payload ) );
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = bench_p->topics_p[0];
+    if ( solClient_msg_alloc ( &msg_p ) == SOLCLIENT_OK &&
+         solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) == SOLCLIENT_OK &&
+         solClient_msg_setBinaryAttachment ( msg_p, payload, sizeof ( payload ) ) == SOLCLIENT_OK ) {
+        startNs = os_getTimeNs (  );
+        for ( i = 0; i < reps; i++ ) {
+            common_topicsRecord ( COMMON_TOPICS_TX, msg_p );
+        }
+        msgNs = ( double ) ( os_getTimeNs (  ) - startNs ) / ( double ) reps;
+        printf ( "Per message, one in %d counted: %.1f ns by topic, %.1f ns read from a solClient message: %s the %d ns budget\n",
+                 sampling, topicNs, msgNs, ( topicNs <= BUDGET_NS && msgNs <= BUDGET_NS ) ? "within" : "over", BUDGET_NS );
+    }
+    if ( msg_p != NULL ) {
+        solClient_msg_free ( &msg_p );
+    }
+    common_topicsEnable ( 0 );
+
+    sketchBytes = COMMON_TOPICS_DEPTH * COMMON_TOPICS_WIDTH * 2 * sizeof ( solClient_uint64_t ) +
+        2 * COMMON_TOPICS_TOP_K * ( sizeof ( struct commonTopicCount ) + 2 * sizeof ( solClient_uint64_t ) );
+    /* Names and two counters per topic, before any hash table around them. */
+    exactBytes = bench_p->namesBytes + bench_p->numTopics * 2 * sizeof ( solClient_uint64_t );
+    printf ( "Memory per thread and direction: %lu KB, whatever the topics; exact counters: at least %lu KB\n",
+             ( unsigned long ) ( sketchBytes / 1024 ), ( unsigned long ) ( exactBytes / 1024 ) );
+    printf ( "Estimates exceed the truth by at most %.0f messages (e/width of the stream) with probability %.3f,\n"
+             "  and vary by about the square root of %d times the count from sampling\n",
+             2.718281828 * ( double ) bench_p->numMsgs / COMMON_TOPICS_WIDTH, 1.0 - 0.018315639, sampling );
+
+    if ( common_topicsGetReport ( COMMON_TOPICS_RX, &report ) != SOLCLIENT_OK ) {
+        printf ( "No report\n" );
+        return;
+    }
+    benchReport ( bench_p, &report, 0, top );
+    benchReport ( bench_p, &report, 1, top );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic subscribed to, wildcards allowed.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Accounting */
+    struct bench    bench;
+    solClient_uint32_t numTopics = DEFAULT_TOPICS;
+    int             numHot = DEFAULT_HOT;
+    int             sharePct = DEFAULT_SHARE;
+    int             intervalMs = DEFAULT_INTERVAL_MS;
+    int             durationS = DEFAULT_DURATION_S;
+    int             top = DEFAULT_TOP;
+    int             sampling = COMMON_TOPICS_SAMPLE_DEFAULT;
+    solClient_uint64_t endNs;
+    int             i;
+
+    printf ( "\nHeavyHitters.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 5000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tinterval=MS         The reporting interval (default 1000).\n"
+                                      "\tduration=S          With --cip, how long to report (default 10).\n"
+                                      "\ttop=N               Topics printed by messages and by bytes (default 10).\n"
+                                      "\tsample=N            Count one message in N on average (default 64).\n"
+                                      "\ttopics=N            Without --cip, the number of topics (default 1000000).\n"
+                                      "\thot=N               Without --cip, the runaway topics (default 3).\n"
+                                      "\tshare=PCT           Without --cip, their share of the messages (default 20).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "interval=", 9 ) == 0 ) {
+            intervalMs = atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "duration=", 9 ) == 0 ) {
+            durationS = atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "top=", 4 ) == 0 ) {
+            top = atoi ( argv[i] + 4 );
+        } else if ( strncmp ( argv[i], "sample=", 7 ) == 0 ) {
+            sampling = atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "topics=", 7 ) == 0 ) {
+            numTopics = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "hot=", 4 ) == 0 ) {
+            numHot = atoi ( argv[i] + 4 );
+        } else if ( strncmp ( argv[i], "share=", 6 ) == 0 ) {
+            sharePct = atoi ( argv[i] + 6 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( intervalMs < 1 || durationS < 1 || top < 1 || top > COMMON_TOPICS_TOP_K || numTopics < 1 || numHot < 0 ||
+         sharePct < 0 || sharePct > 99 || sampling < 1 || commandOpts.numMsgsToSend < 1 ) {
+        printf ( "Invalid arguments: interval >= 1, duration >= 1, top 1-%d, sample >= 1, topics >= 1, hot >= 0, share 0-99\n",
+                 COMMON_TOPICS_TOP_K );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Reporting requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: a generated stream against exact counts
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        if ( benchCreate ( &bench, numTopics, numHot, sharePct, ( solClient_uint64_t ) commandOpts.numMsgsToSend ) ) {
+            benchRun ( &bench, top, sampling );
+        } else {
+            printf ( "Out of memory for the stream\n" );
+        }
+        benchDestroy ( &bench );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    /* common_messageReceivePerfCallback() records each message received. */
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    common_topicsSetSampling ( sampling );
+    common_topicsEnable ( intervalMs );
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p,
+                                                      SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+        goto sessionConnected;
+    }
+    printf ( "Reporting the heaviest topics under '%s' every %d ms for %d s\n", commandOpts.destinationName,
+             intervalMs, durationS );
+
+    /*************************************************************************
+     * Print the last interval, each interval
+     *************************************************************************/
+    endNs = os_getTimeNs (  ) + durationS * 1000000000ULL;
+    while ( os_getTimeNs (  ) < endNs ) {
+        OS_SLEEP_US ( intervalMs * 1000 );
+        common_topicsDump ( top );
+    }
+
+    if ( ( rc = solClient_session_topicUnsubscribeExt ( session_p,
+                                                        SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                        commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicUnsubscribeExt()" );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    common_topicsEnable ( 0 );
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,424 @@
+/** @example Intro/HedgedRequestor.c
+ */
+
+/*
+ * This sample measures how hedged requests (see hedge.h) cut the tail
+ * latency of Direct request/reply when one replier is occasionally slow.
+ *
+ *                      ---primary topic-->    | replier A (slow) |
+ *  |-----------------|
+ *  | HedgedRequestor |  --alternate topic-->  | replier B        |
+ *  |-----------------|  <------replies------
+ *
+ * Run the two repliers with role=replier, injecting stalls into the first:
+ *
+ *   HedgedRequestor -c HOST -u USER -t req/a role=replier slow=10 slowMs=20
+ *   HedgedRequestor -c HOST -u USER -t req/b role=replier
+ *   HedgedRequestor -c HOST -u USER -t req/a alt=req/b
+ *
+ * The requestor sends -n requests one at a time, first without hedging and
+ * then with it, and prints the latency percentiles of both runs together
+ * with how many requests were hedged and how many hedges won.
+ *
+ * Without --cip, the same hedge policy is run against simulated replier
+ * latencies instead.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "hedge.h"
+#include "getopt.h"
+
+#define REQUEST_TIMEOUT_MS      5000
+#define SIM_BASE_US             300     /* Simulated reply latency, plus up to SIM_JITTER_US. */
+#define SIM_JITTER_US           200
+
+struct hedgeConfig
+{
+    const char     *role_p;
+    const char     *alternate_p;
+    unsigned int    slowPermille;       /* Requests stalled by the replier, per 1000. */
+    unsigned int    slowMs;
+    unsigned int    percentile;
+    unsigned int    budgetPercent;
+};
+
+struct replier
+{
+    struct hedgeConfig *config_p;
+    solClient_uint64_t random;
+    volatile solClient_uint64_t served;
+};
+
+/*****************************************************************************
+ * compareNs
+ *****************************************************************************/
+static int
+compareNs ( const void *a_p, const void *b_p )
+{
+    unsigned long long a = *( const unsigned long long * ) a_p;
+    unsigned long long b = *( const unsigned long long * ) b_p;
+
+    return ( a < b ) ? -1 : ( a > b ) ? 1 : 0;
+}
+
+/*****************************************************************************
+ * printRun
+ *
+ * Sorts the latencies of a run and prints them with its hedge counters.
+ *****************************************************************************/
+static void
+printRun ( const char *what_p, unsigned long long *latencies_p, int count, const struct hedgeStats *stats_p,
+           unsigned long long delayNs )
+{
+    if ( count == 0 ) {
+        printf ( "%-9s no replies\n", what_p );
+        return;
+    }
+    qsort ( latencies_p, ( size_t ) count, sizeof ( latencies_p[0] ), compareNs );
+    printf ( "%-9s p50 %8.1f us  p99 %8.1f us  p99.9 %8.1f us  max %8.1f us | hedged %.2f%%, hedges won %llu, "
+             "denied %llu, suppressed %llu, timeouts %llu, delay %.1f us\n",
+             what_p, ( double ) latencies_p[count / 2] / 1000.0, ( double ) latencies_p[count * 99 / 100] / 1000.0,
+             ( double ) latencies_p[count * 999 / 1000] / 1000.0, ( double ) latencies_p[count - 1] / 1000.0,
+             ( stats_p->requests != 0 ) ? 100.0 * ( double ) stats_p->hedged / ( double ) stats_p->requests : 0.0,
+             ( unsigned long long ) stats_p->hedgeWins, ( unsigned long long ) stats_p->budgetDenied,
+             ( unsigned long long ) stats_p->suppressed, ( unsigned long long ) stats_p->timeouts,
+             ( double ) delayNs / 1000.0 );
+    fflush ( stdout );
+}
+
+/*****************************************************************************
+ * simulateRun
+ *
+ * Runs the hedge policy against simulated repliers: the primary stalls for
+ * slowMs on slowPermille of requests, the alternate never does.
+ *****************************************************************************/
+static void
+simulateRun ( const char *what_p, const struct hedgeConfig *config_p, unsigned int budgetPercent, int numRequests,
+              unsigned long long *latencies_p )
+{
+    struct hedgePolicy policy;
+    struct hedgeStats stats;
+    solClient_uint64_t random = COMMON_RANDOM_SEED;
+    solClient_uint64_t r;
+    unsigned long long primaryNs;
+    unsigned long long alternateNs;
+    unsigned long long delayNs;
+    int             i;
+
+    hedge_policyInit ( &policy );
+    policy.percentile = config_p->percentile;
+    policy.budgetPercent = budgetPercent;
+    memset ( &stats, 0, sizeof ( stats ) );
+
+    for ( i = 0; i < numRequests; i++ ) {
+        r = common_random ( &random );
+        primaryNs = ( SIM_BASE_US + r % SIM_JITTER_US ) * 1000ULL;
+        if ( ( r >> 16 ) % 1000 < config_p->slowPermille ) {
+            primaryNs += ( unsigned long long ) config_p->slowMs * 1000000ULL;
+        }
+        alternateNs = ( SIM_BASE_US + ( r >> 32 ) % SIM_JITTER_US ) * 1000ULL;
+
+        stats.requests++;
+        hedge_policyOnRequest ( &policy );
+        delayNs = policy.delayNs;
+        latencies_p[i] = primaryNs;
+        if ( delayNs != 0 && primaryNs > delayNs ) {
+            if ( hedge_policyTryHedge ( &policy ) ) {
+                stats.hedged++;
+                stats.suppressed++;
+                if ( delayNs + alternateNs < primaryNs ) {
+                    latencies_p[i] = delayNs + alternateNs;
+                    stats.hedgeWins++;
+                }
+            } else {
+                stats.budgetDenied++;
+            }
+        }
+        hedge_policyRecord ( &policy, latencies_p[i] );
+    }
+    printRun ( what_p, latencies_p, numRequests, &stats, policy.delayNs );
+}
+
+/*****************************************************************************
+ * replierReceiveCallback
+ *
+ * Replies to every request, stalling on slowPermille of them first.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+replierReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct replier *replier_p = ( struct replier * ) user_p;
+    solClient_returnCode_t rc;
+    solClient_opaqueMsg_pt replyMsg_p;
+
+    if ( common_random ( &replier_p->random ) % 1000 < replier_p->config_p->slowPermille ) {
+        OS_SLEEP_US ( replier_p->config_p->slowMs * 1000 );
+    }
+    if ( ( rc = solClient_msg_alloc ( &replyMsg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    if ( ( rc = solClient_session_sendReply ( opaqueSession_p, msg_p, replyMsg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_sendReply()" );
+    }
+    solClient_msg_free ( &replyMsg_p );
+    replier_p->served++;
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * requestRun
+ *
+ * Sends numRequests requests one at a time through the requestor.
+ *****************************************************************************/
+static void
+requestRun ( const char *what_p, struct hedgeRequestor *req_p, const struct hedgeConfig *config_p,
+             unsigned int budgetPercent, int numRequests, unsigned long long *latencies_p )
+{
+    solClient_returnCode_t rc;
+    solClient_opaqueMsg_pt msg_p;
+    solClient_opaqueMsg_pt replyMsg_p;
+    struct hedgeStats stats;
+    unsigned long long startNs;
+    int             count = 0;
+    int             i;
+
+    /* The Session is idle between runs, so the requestor can be reset. */
+    OS_MUTEX_LOCK ( &req_p->lock );
+    memset ( &req_p->stats, 0, sizeof ( req_p->stats ) );
+    hedge_policyInit ( &req_p->policy );
+    req_p->policy.percentile = config_p->percentile;
+    req_p->policy.budgetPercent = budgetPercent;
+    OS_MUTEX_UNLOCK ( &req_p->lock );
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return;
+    }
+    if ( ( rc = solClient_msg_setBinaryAttachment ( msg_p, "request", 7 ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setBinaryAttachment()" );
+        goto freeMsg;
+    }
+    for ( i = 0; i < numRequests; i++ ) {
+        startNs = os_getTimeNs (  );
+        if ( ( rc = hedge_request ( req_p, msg_p, REQUEST_TIMEOUT_MS, &replyMsg_p ) ) == SOLCLIENT_OK ) {
+            latencies_p[count++] = os_getTimeNs (  ) - startNs;
+            solClient_msg_free ( &replyMsg_p );
+        } else if ( rc != SOLCLIENT_INCOMPLETE ) {
+            common_handleError ( rc, "hedge_request()" );
+            break;
+        }
+    }
+    hedge_getStats ( req_p, &stats );
+    printRun ( what_p, latencies_p, count, &stats, req_p->policy.delayNs );
+
+  freeMsg:
+    solClient_msg_free ( &msg_p );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The primary request topic, or the topic a replier serves.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Hedging */
+    static struct hedgeRequestor req;
+    struct hedgeConfig config;
+    struct replier  replier;
+    unsigned long long *latencies_p = NULL;
+    int             isReplier;
+    int             i;
+
+    printf ( "\nHedgedRequestor.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 10000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\trole=ROLE           requestor or replier (default requestor).\n"
+                                      "\talt=TOPIC           Alternate topic to hedge to.\n"
+                                      "\tslow=N              Requests per 1000 a replier stalls on (default 0,\n"
+                                      "\t                    10 without --cip).\n"
+                                      "\tslowMs=N            Length of a stall (default 20).\n"
+                                      "\tpercentile=N        Latency percentile to hedge after (default 95).\n"
+                                      "\tbudget=N            Hedges per 100 requests (default 5).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    config.role_p = "requestor";
+    config.alternate_p = NULL;
+    config.slowPermille = ( commandOpts.targetHost[0] == ( char ) 0 ) ? 10 : 0;
+    config.slowMs = 20;
+    config.percentile = HEDGE_DEFAULT_PERCENTILE;
+    config.budgetPercent = HEDGE_DEFAULT_BUDGET_PERCENT;
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "role=", 5 ) == 0 ) {
+            config.role_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "alt=", 4 ) == 0 ) {
+            config.alternate_p = argv[i] + 4;
+        } else if ( strncmp ( argv[i], "slow=", 5 ) == 0 ) {
+            config.slowPermille = ( unsigned int ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "slowMs=", 7 ) == 0 ) {
+            config.slowMs = ( unsigned int ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "percentile=", 11 ) == 0 ) {
+            config.percentile = ( unsigned int ) atoi ( argv[i] + 11 );
+        } else if ( strncmp ( argv[i], "budget=", 7 ) == 0 ) {
+            config.budgetPercent = ( unsigned int ) atoi ( argv[i] + 7 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    isReplier = ( strcmp ( config.role_p, "replier" ) == 0 );
+    if ( ( !isReplier && strcmp ( config.role_p, "requestor" ) != 0 ) || config.slowPermille > 1000 ||
+         config.slowMs > 900 || config.percentile < 1 || config.percentile > 99 || config.budgetPercent > 100 ||
+         commandOpts.numMsgsToSend < 1 ) {
+        printf ( "Invalid arguments: role requestor or replier, slow 0..1000, slowMs 0..900, percentile 1..99, "
+                 "budget 0..100\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Requests and replies over a broker require --cu and --topic\n" );
+        exit ( 1 );
+    }
+    if ( ( latencies_p = ( unsigned long long * ) malloc ( sizeof ( *latencies_p ) *
+                                                           ( size_t ) commandOpts.numMsgsToSend ) ) == NULL ) {
+        printf ( "Cannot allocate %d latencies\n", commandOpts.numMsgsToSend );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Simulation
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        printf ( "Simulating %d requests, primary replier stalls %u ms on %u per 1000, percentile %u, budget %u%%\n",
+                 commandOpts.numMsgsToSend, config.slowMs, config.slowPermille, config.percentile, config.budgetPercent );
+        simulateRun ( "unhedged", &config, 0, commandOpts.numMsgsToSend, latencies_p );
+        simulateRun ( "hedged", &config, config.budgetPercent, commandOpts.numMsgsToSend, latencies_p );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    replier.config_p = &config;
+    replier.random = common_randomSeed ( ( solClient_uint64_t ) ( size_t ) &replier );
+    replier.served = 0;
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 isReplier ? replierReceiveCallback : hedge_rxCallback,
+                                                 common_eventCallback,
+                                                 isReplier ? ( void * ) &replier : ( void * ) &req,
+                                                 &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Serve requests
+     *************************************************************************/
+    if ( isReplier ) {
+        if ( ( rc = solClient_session_topicSubscribeExt ( session_p,
+                                                          SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                          commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_topicSubscribe()" );
+            goto sessionConnected;
+        }
+        printf ( "Replying on '%s', stalling %u ms on %u per 1000 requests, Ctrl-C to stop.....\n",
+                 commandOpts.destinationName, config.slowMs, config.slowPermille );
+        for ( ;; ) {
+            SLEEP ( 10 );
+            printf ( "%llu requests served\n", ( unsigned long long ) replier.served );
+            fflush ( stdout );
+        }
+    }
+
+    /*************************************************************************
+     * Send requests without and with hedging
+     *************************************************************************/
+    if ( hedge_init ( &req, session_p, commandOpts.destinationName, config.alternate_p, 1 ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+    printf ( "Sending %d requests to '%s', hedging to '%s' after p%u, budget %u%%\n",
+             commandOpts.numMsgsToSend, commandOpts.destinationName,
+             ( config.alternate_p != NULL ) ? config.alternate_p : "(none)", config.percentile, config.budgetPercent );
+    requestRun ( "unhedged", &req, &config, 0, commandOpts.numMsgsToSend, latencies_p );
+    requestRun ( "hedged", &req, &config, config.budgetPercent, commandOpts.numMsgsToSend, latencies_p );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+    if ( ( rc = solClient_session_destroy ( &session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_destroy()" );
+    }
+    /* Late replies refer to the requestor, so it goes after the Session. */
+    if ( req.slots_p != NULL ) {
+        hedge_destroy ( &req );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    free ( latencies_p );
+    return 0;
+}
@@ -0,0 +1,577 @@
+/** @example Intro/HttpGateway.c
+ */
+
+/*
+ * This sample publishes what HTTP clients POST, serving HTTP/1.1 itself
+ * (see httpgw.h) rather than behind a separate proxy: each body becomes a
+ * message on the topic its path maps to, by route=/PATH=TOPIC (repeatable;
+ * by default "/" to --topic), the rest of the path appended. With
+ * mode=persistent, the default, a request is answered 200 once the broker
+ * acknowledges its message; with mode=direct, 202 once sent. Messages read
+ * together go out in one solClient_session_sendMultipleMsg() call, up to
+ * batch=N. It listens on bind=ADDR, port=PORT and stops after --mn
+ * requests answered.
+ *
+ * load=N starts a load generator in the same process: conns=N client
+ * connections, each keeping depth=N POSTs of size=BYTES pipelined, N in
+ * all; it reports requests per second and the latency from sending a
+ * request to reading its answer.
+ *
+ * Without --cip, the gateway sends through a loopback instead of a
+ * Session: each send call costs call=US, as a write to the broker socket
+ * would, and each Persistent message is acknowledged ack=US after it was
+ * sent. The load is run once with batch=1 and once with batch=N, for
+ * comparison.
+ *
+ * Linux only.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "httpgw.h"
+#include "getopt.h"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define DEFAULT_BIND            "127.0.0.1"
+#define DEFAULT_CONNS           8
+#define DEFAULT_DEPTH           16
+#define DEFAULT_SIZE            512
+#define DEFAULT_CALL_US         10
+#define DEFAULT_ACK_US          200
+#define MAX_LOAD_CONNS          256
+#define MAX_DEPTH               256
+
+/*
+ * A load generator connection.
+ */
+struct loadConn
+{
+    OS_THREAD       thread;
+    int             port;
+    const char     *request_p;          /* One POST, sent over and over. */
+    solClient_uint32_t requestLen;
+    int             depth;
+    solClient_uint64_t count;           /* Requests to send. */
+    unsigned long long *latencies_p;    /* Of count. */
+    solClient_uint64_t answered;
+    solClient_uint64_t failed;          /* Answered but not 2xx. */
+};
+
+/*
+ * The loopback in place of a Session: messages sent wait in a ring until
+ * their acknowledgement is due.
+ */
+struct loopback
+{
+    struct httpgw  *gw_p;
+    int             callUs;
+    int             ackUs;
+    int             persistent;
+    OS_MUTEX        lock;
+    void          **pending_p;          /* Correlation pointers, a ring of size. */
+    solClient_uint64_t *dueNs_p;
+    solClient_uint32_t size;
+    solClient_uint32_t head;
+    solClient_uint32_t count;
+    volatile int    running;
+};
+
+/*****************************************************************************
+ * compareNs
+ *****************************************************************************/
+static int
+compareNs ( const void *a_p, const void *b_p )
+{
+    unsigned long long a = *( const unsigned long long * ) a_p;
+    unsigned long long b = *( const unsigned long long * ) b_p;
+
+    return ( a < b ) ? -1 : ( a > b ) ? 1 : 0;
+}
+
+/*****************************************************************************
+ * loadThread
+ *
+ * Keep depth requests pipelined on one connection until count are answered.
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( loadThread, arg_p )
+{
+    struct loadConn *conn_p = ( struct loadConn * ) arg_p;
+    struct sockaddr_in addr;
+    solClient_uint64_t sentNs[MAX_DEPTH];
+    solClient_uint64_t sent = 0;
+    char            buf[16384];
+    solClient_uint32_t have = 0;
+    solClient_uint32_t used;
+    solClient_uint32_t i;
+    ssize_t         n;
+    int             fd;
+    int             one = 1;
+
+    memset ( &addr, 0, sizeof ( addr ) );
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons ( ( unsigned short ) conn_p->port );
+    addr.sin_addr.s_addr = htonl ( INADDR_LOOPBACK );
+    if ( ( fd = socket ( AF_INET, SOCK_STREAM, 0 ) ) < 0 ||
+         connect ( fd, ( struct sockaddr * ) &addr, sizeof ( addr ) ) != 0 ) {
+        printf ( "Load connection failed: %s\n", strerror ( errno ) );
+        if ( fd >= 0 ) {
+            close ( fd );
+        }
+        OS_THREAD_RETURN;
+    }
+    setsockopt ( fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof ( one ) );
+
+    while ( conn_p->answered < conn_p->count ) {
+        while ( sent < conn_p->count && sent - conn_p->answered < ( solClient_uint64_t ) conn_p->depth ) {
+            sentNs[sent % conn_p->depth] = os_getTimeNs (  );
+            if ( send ( fd, conn_p->request_p, conn_p->requestLen, MSG_NOSIGNAL ) != ( ssize_t ) conn_p->requestLen ) {
+                goto done;
+            }
+            sent++;
+        }
+        if ( ( n = recv ( fd, buf + have, sizeof ( buf ) - have - 1, 0 ) ) <= 0 ) {
+            break;
+        }
+        have += ( solClient_uint32_t ) n;
+
+        /* Answers have no body: each ends at its blank line. */
+        for ( used = 0, i = 3; i < have; i++ ) {
+            if ( buf[i] == '\n' && buf[i - 1] == '\r' && buf[i - 2] == '\n' && buf[i - 3] == '\r' ) {
+                if ( memcmp ( buf + used, "HTTP/1.1 2", 10 ) != 0 ) {
+                    conn_p->failed++;
+                }
+                conn_p->latencies_p[conn_p->answered] =
+                    os_getTimeNs (  ) - sentNs[conn_p->answered % conn_p->depth];
+                conn_p->answered++;
+                used = i + 1;
+                i += 3;
+            }
+        }
+        memmove ( buf, buf + used, have - used );
+        have -= used;
+    }
+
+  done:
+    close ( fd );
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * runLoad
+ *
+ * Start the load connections against the gateway, serve them, and report.
+ *****************************************************************************/
+static void
+runLoad ( const char *label_p, struct httpgw *gw_p, int numConns, int depth, solClient_uint64_t total,
+          solClient_uint32_t size, const char *path_p )
+{
+    struct loadConn *conns_p;
+    struct httpgwStats stats;
+    unsigned long long *latencies_p = NULL;
+    char           *request_p = NULL;
+    solClient_uint32_t headerLen;
+    solClient_uint64_t count = 0;
+    solClient_uint64_t failed = 0;
+    solClient_uint64_t startNs;
+    solClient_uint64_t elapsedNs;
+    solClient_uint64_t j;
+    int             started = 0;
+    int             i;
+
+    if ( ( conns_p = ( struct loadConn * ) calloc ( numConns, sizeof ( struct loadConn ) ) ) == NULL ||
+         ( request_p = ( char * ) malloc ( size + 256 ) ) == NULL ||
+         ( latencies_p = ( unsigned long long * ) calloc ( total, sizeof ( unsigned long long ) ) ) == NULL ) {
+        goto done;
+    }
+    headerLen = ( solClient_uint32_t ) sprintf ( request_p, "POST %s HTTP/1.1\r\nHost: localhost\r\n"
+                                                 "Content-Type: application/json\r\nContent-Length: %u\r\n\r\n",
+                                                 path_p, size );
+    memset ( request_p + headerLen, 'x', size );
+
+    for ( i = 0; i < numConns; i++ ) {
+        conns_p[i].port = gw_p->port;
+        conns_p[i].request_p = request_p;
+        conns_p[i].requestLen = headerLen + size;
+        conns_p[i].depth = depth;
+        conns_p[i].count = total / numConns + ( ( solClient_uint64_t ) i < total % numConns ? 1 : 0 );
+        conns_p[i].latencies_p = latencies_p + count;
+        count += conns_p[i].count;
+    }
+    startNs = os_getTimeNs (  );
+    for ( started = 0; started < numConns; started++ ) {
+        if ( os_threadCreate ( &conns_p[started].thread, loadThread, &conns_p[started] ) != 0 ) {
+            break;
+        }
+    }
+    httpgw_run ( gw_p, gw_p->stats.answered + total );
+    elapsedNs = os_getTimeNs (  ) - startNs;
+
+    /* Gather the latencies answered, in place. */
+    count = 0;
+    for ( i = 0; i < started; i++ ) {
+        os_threadJoin ( conns_p[i].thread );
+        for ( j = 0; j < conns_p[i].answered; j++ ) {
+            latencies_p[count++] = conns_p[i].latencies_p[j];
+        }
+        failed += conns_p[i].failed;
+    }
+    httpgw_getStats ( gw_p, &stats );
+    printf ( "%s: %llu requests of %u bytes on %d connections, %d deep\n", label_p,
+             ( unsigned long long ) count, size, numConns, depth );
+    if ( count > 0 ) {
+        qsort ( latencies_p, ( size_t ) count, sizeof ( latencies_p[0] ), compareNs );
+        printf ( "  %.0f req/s, %.1f MB/s; latency p50 %.1f us  p99 %.1f us  p99.9 %.1f us  max %.1f us\n",
+                 count * 1e9 / ( elapsedNs + 1 ), count * ( double ) size * 1e3 / ( elapsedNs + 1 ),
+                 latencies_p[count / 2] / 1000.0, latencies_p[count * 99 / 100] / 1000.0,
+                 latencies_p[count * 999 / 1000] / 1000.0, latencies_p[count - 1] / 1000.0 );
+    }
+    printf ( "  %llu sends of %.1f messages on average; %llu acknowledged, %llu rejected, %llu not sent, "
+             "%llu refused, %llu not 2xx; %u held at most, %llu stalls\n",
+             ( unsigned long long ) stats.batches, stats.sent / ( stats.batches + 1e-9 ),
+             ( unsigned long long ) stats.acked, ( unsigned long long ) stats.rejected,
+             ( unsigned long long ) stats.sendFailed, ( unsigned long long ) stats.refused,
+             ( unsigned long long ) failed, stats.maxInFlightSeen, ( unsigned long long ) stats.stalls );
+    fflush ( stdout );
+
+  done:
+    free ( latencies_p );
+    free ( request_p );
+    free ( conns_p );
+}
+
+/*****************************************************************************
+ * loopbackSend
+ *
+ * The send function in place of a Session.
+ *****************************************************************************/
+static          solClient_returnCode_t
+loopbackSend ( solClient_opaqueMsg_pt * msgs_p, solClient_uint32_t count, solClient_uint32_t * sent_p, void *user_p )
+{
+    struct loopback *loop_p = ( struct loopback * ) user_p;
+    solClient_uint64_t nowNs = os_getTimeNs (  );
+    void           *correlation_p;
+    solClient_uint32_t correlationSize;
+    solClient_uint32_t i;
+
+    while ( os_getTimeNs (  ) - nowNs < loop_p->callUs * 1000ULL ) {
+    }
+    if ( loop_p->persistent ) {
+        OS_MUTEX_LOCK ( &loop_p->lock );
+        for ( i = 0; i < count && loop_p->count < loop_p->size; i++ ) {
+            solClient_msg_getCorrelationTagPtr ( msgs_p[i], &correlation_p, &correlationSize );
+            loop_p->pending_p[( loop_p->head + loop_p->count ) % loop_p->size] = correlation_p;
+            loop_p->dueNs_p[( loop_p->head + loop_p->count ) % loop_p->size] = nowNs + loop_p->ackUs * 1000ULL;
+            loop_p->count++;
+        }
+        OS_MUTEX_UNLOCK ( &loop_p->lock );
+        count = i;
+    }
+    *sent_p = count;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * ackThread
+ *
+ * Acknowledge each message sent through the loopback when it is due.
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( ackThread, arg_p )
+{
+    struct loopback *loop_p = ( struct loopback * ) arg_p;
+    void           *correlation_p;
+
+    while ( loop_p->running ) {
+        correlation_p = NULL;
+        OS_MUTEX_LOCK ( &loop_p->lock );
+        if ( loop_p->count > 0 && loop_p->dueNs_p[loop_p->head] <= os_getTimeNs (  ) ) {
+            correlation_p = loop_p->pending_p[loop_p->head];
+            loop_p->head = ( loop_p->head + 1 ) % loop_p->size;
+            loop_p->count--;
+        }
+        OS_MUTEX_UNLOCK ( &loop_p->lock );
+        if ( correlation_p != NULL ) {
+            httpgw_ack ( loop_p->gw_p, correlation_p, 1 );
+        } else {
+            OS_SLEEP_US ( 50 );
+        }
+    }
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * benchLoopback
+ *****************************************************************************/
+static void
+benchLoopback ( const char *label_p, const char *bind_p, int port, solClient_uint32_t batchMax,
+                solClient_uint32_t maxInFlight, int persistent, int callUs, int ackUs, int numConns, int depth,
+                solClient_uint64_t total, solClient_uint32_t size )
+{
+    static struct httpgw gw;
+    struct loopback loop;
+    OS_THREAD       thread;
+
+    memset ( &loop, 0, sizeof ( loop ) );
+    if ( httpgw_init ( &gw, bind_p, port, 0, maxInFlight, batchMax, persistent ) != SOLCLIENT_OK ) {
+        return;
+    }
+    httpgw_addRoute ( &gw, "/", "http/bench" );
+    loop.gw_p = &gw;
+    loop.callUs = callUs;
+    loop.ackUs = ackUs;
+    loop.persistent = persistent;
+    loop.size = gw.maxInFlight;
+    OS_MUTEX_INIT ( &loop.lock );
+    loop.pending_p = ( void ** ) calloc ( loop.size, sizeof ( void * ) );
+    loop.dueNs_p = ( solClient_uint64_t * ) calloc ( loop.size, sizeof ( solClient_uint64_t ) );
+    loop.running = 1;
+    if ( loop.pending_p == NULL || loop.dueNs_p == NULL || os_threadCreate ( &thread, ackThread, &loop ) != 0 ) {
+        goto done;
+    }
+    httpgw_setSendFunc ( &gw, loopbackSend, &loop );
+
+    runLoad ( label_p, &gw, numConns, depth, total, size, "/orders/eu" );
+
+    loop.running = 0;
+    os_threadJoin ( thread );
+
+  done:
+    httpgw_destroy ( &gw );
+    free ( loop.pending_p );
+    free ( loop.dueNs_p );
+    OS_MUTEX_DESTROY ( &loop.lock );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic for the default route.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Gateway */
+    static struct httpgw gw;
+    struct httpgwStats stats;
+    char            route[HTTPGW_MAX_ROUTES][256];
+    char           *topic_p;
+    const char     *bind_p = DEFAULT_BIND;
+    int             numRoutes = 0;
+    int             port = HTTPGW_DEFAULT_PORT;
+    int             persistent = 1;
+    solClient_uint32_t batchMax = SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT;
+    solClient_uint32_t maxInFlight = HTTPGW_DEFAULT_MAX_IN_FLIGHT;
+    solClient_uint32_t size = DEFAULT_SIZE;
+    solClient_uint64_t load = 0;
+    int             numConns = DEFAULT_CONNS;
+    int             depth = DEFAULT_DEPTH;
+    int             callUs = DEFAULT_CALL_US;
+    int             ackUs = DEFAULT_ACK_US;
+    int             i;
+
+    printf ( "\nHttpGateway.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 100000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\troute=/PATH=TOPIC   Map a path prefix to a topic (repeatable; default / to --topic).\n"
+                                      "\tbind=ADDR           The address to listen on (default 127.0.0.1).\n"
+                                      "\tport=PORT           The port to listen on (default 8080; 0 for any).\n"
+                                      "\tmode=MODE           persistent (answer on acknowledgement) or direct (default persistent).\n"
+                                      "\tbatch=N             Most messages per send (default 50).\n"
+                                      "\tinflight=N          Most requests held unanswered (default 4096).\n"
+                                      "\tload=N              Send N requests from a load generator (without --cip, --mn).\n"
+                                      "\tconns=N             Load generator connections (default 8).\n"
+                                      "\tdepth=N             Requests pipelined per connection (default 16).\n"
+                                      "\tsize=BYTES          Request body size (default 512).\n"
+                                      "\tcall=US             Without --cip, the cost of a send call (default 10).\n"
+                                      "\tack=US              Without --cip, the acknowledgement delay (default 200).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "route=", 6 ) == 0 ) {
+            if ( numRoutes == HTTPGW_MAX_ROUTES || strlen ( argv[i] + 6 ) >= sizeof ( route[0] ) ) {
+                printf ( "Too many or too long routes\n" );
+                exit ( 1 );
+            }
+            strcpy ( route[numRoutes], argv[i] + 6 );
+            numRoutes++;
+        } else if ( strncmp ( argv[i], "bind=", 5 ) == 0 ) {
+            bind_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "port=", 5 ) == 0 ) {
+            port = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "mode=", 5 ) == 0 ) {
+            persistent = ( strcmp ( argv[i] + 5, "direct" ) != 0 );
+        } else if ( strncmp ( argv[i], "batch=", 6 ) == 0 ) {
+            batchMax = ( solClient_uint32_t ) atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "inflight=", 9 ) == 0 ) {
+            maxInFlight = ( solClient_uint32_t ) atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "load=", 5 ) == 0 ) {
+            load = ( solClient_uint64_t ) atol ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "conns=", 6 ) == 0 ) {
+            numConns = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "depth=", 6 ) == 0 ) {
+            depth = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            size = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "call=", 5 ) == 0 ) {
+            callUs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "ack=", 4 ) == 0 ) {
+            ackUs = atoi ( argv[i] + 4 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( port < 0 || port > 65535 || batchMax < 1 || batchMax > SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT ||
+         maxInFlight < 1 || numConns < 1 || numConns > MAX_LOAD_CONNS || depth < 1 || depth > MAX_DEPTH ||
+         size > HTTPGW_DEFAULT_MAX_BODY || callUs < 0 || ackUs < 0 ) {
+        printf ( "Invalid arguments: port 0-65535, batch 1-%d, inflight >= 1, conns 1-%d, depth 1-%d, "
+                 "size <= %d, call and ack >= 0\n", SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT, MAX_LOAD_CONNS,
+                 MAX_DEPTH, HTTPGW_DEFAULT_MAX_BODY );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || ( numRoutes == 0 && commandOpts.destinationName[0] == ( char ) 0 ) ) ) {
+        printf ( "Publishing requires --cu, and route=/PATH=TOPIC or --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: the gateway over a loopback
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        solClient_uint64_t total = ( load > 0 ) ? load : ( solClient_uint64_t ) commandOpts.numMsgsToSend;
+
+        printf ( "Loopback: %d us per send call, acknowledged %d us after sending\n", callUs, ackUs );
+        benchLoopback ( "One message per send", bind_p, 0, 1, maxInFlight, persistent, callUs, ackUs,
+                        numConns, depth, total, size );
+        benchLoopback ( "Batched", bind_p, 0, batchMax, maxInFlight, persistent, callUs, ackUs,
+                        numConns, depth, total, size );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it acknowledging to the gateway
+     *************************************************************************/
+    if ( httpgw_init ( &gw, bind_p, port, 0, maxInFlight, batchMax, persistent ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    for ( i = 0; i < numRoutes; i++ ) {
+        if ( ( topic_p = strchr ( route[i], '=' ) ) == NULL ) {
+            printf ( "Invalid route '%s'\n", route[i] );
+            goto destroyGateway;
+        }
+        *topic_p++ = '\0';
+        if ( httpgw_addRoute ( &gw, route[i], topic_p ) != SOLCLIENT_OK ) {
+            goto destroyGateway;
+        }
+    }
+    if ( numRoutes == 0 ) {
+        httpgw_addRoute ( &gw, "/", commandOpts.destinationName );
+    }
+
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto destroyGateway;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 httpgw_eventCallback, &gw, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto destroyGateway;
+    }
+    httpgw_setSession ( &gw, session_p );
+
+    /*************************************************************************
+     * Serve, with or without the load generator
+     *************************************************************************/
+    if ( load > 0 ) {
+        runLoad ( "Load", &gw, numConns, depth, load, size,
+                  ( numRoutes > 0 ) ? route[0] : "/" );
+    } else {
+        printf ( "Listening on %s:%d, %s, until %d requests are answered\n", bind_p, gw.port,
+                 persistent ? "answering on acknowledgement" : "answering when sent", commandOpts.numMsgsToSend );
+        httpgw_run ( &gw, ( solClient_uint64_t ) commandOpts.numMsgsToSend );
+        httpgw_getStats ( &gw, &stats );
+        printf ( "Answered %llu of %llu requests on %llu connections: %llu acknowledged, %llu rejected, "
+                 "%llu not sent, %llu refused; %llu sends of %.1f messages on average\n",
+                 ( unsigned long long ) stats.answered, ( unsigned long long ) stats.requests,
+                 ( unsigned long long ) stats.connections, ( unsigned long long ) stats.acked,
+                 ( unsigned long long ) stats.rejected, ( unsigned long long ) stats.sendFailed,
+                 ( unsigned long long ) stats.refused, ( unsigned long long ) stats.batches,
+                 stats.sent / ( stats.batches + 1e-9 ) );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  destroyGateway:
+    /* Acknowledgements no longer come once the Session is down. */
+    httpgw_destroy ( &gw );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,449 @@
+/** @example Intro/JournalPublisher.c
+ */
+
+/*
+ * This sample publishes Persistent messages through a store-and-forward
+ * journal (see pubjournal.h): each message is appended to a memory-mapped
+ * file and sent on by a sender thread, and it stays in the file until the
+ * broker acknowledges it. Messages published while the Session is down, or
+ * left unacknowledged by an earlier run, are replayed once it is up, each
+ * carrying an application message ID that consumers can drop duplicates by.
+ *
+ * Without --cip it benchmarks the journal itself, with a stand-in for
+ * solClient_session_sendMsg() that acknowledges every message:
+ *   - steady state: the cost per message of the append, of the send from the
+ *     journal and of the trim on acknowledgement;
+ *   - outage recovery: messages are journaled while the Session is down,
+ *     the journal is closed and reopened as after a crash, and the rate at
+ *     which the backlog is replayed and trimmed once the Session is up.
+ *
+ * With --perf, the hardware counters per message follow each result,
+ * including the sender and Context threads (see perfcount.h).
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "pubjournal.h"
+#include "perfcount.h"
+#include "getopt.h"
+
+#define DEFAULT_JOURNAL         "pubjournal.dat"
+#define DEFAULT_TOPIC           "journal/bench"
+#define ACK_WINDOW              50
+#define DRAIN_TIMEOUT_SEC       60
+
+/*****************************************************************************
+ * benchSend
+ *
+ * Stands in for solClient_session_sendMsg() in the offline benchmark.
+ *****************************************************************************/
+static          solClient_uint64_t benchSends = 0;
+
+static          solClient_returnCode_t
+benchSend ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p )
+{
+    benchSends++;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * sessionEvent
+ *
+ * Feeds a Session event to the journal, as the API would.
+ *****************************************************************************/
+static void
+sessionEvent ( struct pubjournal *journal_p, solClient_session_event_t event )
+{
+    solClient_session_eventCallbackInfo_t eventInfo;
+
+    eventInfo.sessionEvent = event;
+    eventInfo.responseCode = 0;
+    eventInfo.info_p = "";
+    eventInfo.correlation_p = NULL;
+    pubjournal_eventCallback ( NULL, &eventInfo, journal_p );
+}
+
+/*****************************************************************************
+ * createMsg
+ *****************************************************************************/
+static          solClient_returnCode_t
+createMsg ( const char *topic_p, char *payload_p, int payloadSize, solClient_opaqueMsg_pt * msg_p )
+{
+    solClient_returnCode_t rc;
+    solClient_destination_t destination;
+
+    if ( ( rc = solClient_msg_alloc ( msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = topic_p;
+    if ( ( rc = solClient_msg_setDestination ( *msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDestination()" );
+        solClient_msg_free ( msg_p );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_setBinaryAttachmentPtr ( *msg_p, payload_p, ( solClient_uint32_t ) payloadSize ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setBinaryAttachmentPtr()" );
+        solClient_msg_free ( msg_p );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * benchSteadyState
+ *****************************************************************************/
+static void
+benchSteadyState ( struct pubjournal *journal_p, solClient_opaqueMsg_pt msg_p, int numMsgs, struct perfCount *perf_p )
+{
+    struct pubjournalStats stats;
+    struct perfCountValues counts;
+    unsigned long long appendNs = 0;
+    unsigned long long sendNs = 0;
+    unsigned long long trimNs = 0;
+    unsigned long long t0;
+    unsigned long long t1;
+    int             done = 0;
+    int             batch;
+    int             i;
+
+    sessionEvent ( journal_p, SOLCLIENT_SESSION_EVENT_UP_NOTICE );
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    while ( done < numMsgs ) {
+        batch = ( numMsgs - done < ACK_WINDOW ) ? numMsgs - done : ACK_WINDOW;
+        t0 = os_getTimeNs (  );
+        for ( i = 0; i < batch; i++ ) {
+            if ( pubjournal_publish ( journal_p, msg_p ) != SOLCLIENT_OK ) {
+                printf ( "Journal append failed\n" );
+                return;
+            }
+        }
+        t1 = os_getTimeNs (  );
+        appendNs += t1 - t0;
+        pubjournal_pump ( journal_p, ( solClient_uint32_t ) batch );
+        t0 = os_getTimeNs (  );
+        sendNs += t0 - t1;
+        pubjournal_ack ( journal_p, journal_p->sendSeq - 1 );
+        trimNs += os_getTimeNs (  ) - t0;
+        done += batch;
+    }
+    if ( perf_p != NULL ) {
+        perfcount_stop ( perf_p, &counts );
+    }
+    pubjournal_getStats ( journal_p, &stats );
+    printf ( "Steady state, %d msgs acknowledged in windows of %d:\n", numMsgs, ACK_WINDOW );
+    printf ( "  append %8.0f ns/msg, send from journal %8.0f ns/msg, trim %6.0f ns/msg\n",
+             ( double ) appendNs / numMsgs, ( double ) sendNs / numMsgs, ( double ) trimNs / numMsgs );
+    printf ( "  %.0f msgs/s through the journal, %llu pending\n",
+             ( double ) numMsgs * 1.0e9 / ( double ) ( appendNs + sendNs + trimNs ),
+             ( unsigned long long ) stats.pending );
+    if ( perf_p != NULL ) {
+        perfcount_print ( stdout, "  ", &counts, numMsgs, "msg" );
+    }
+}
+
+/*****************************************************************************
+ * benchOutage
+ *****************************************************************************/
+static          solClient_returnCode_t
+benchOutage ( struct pubjournal *journal_p, const char *path_p, solClient_opaqueMsg_pt msg_p, int numMsgs,
+              struct perfCount *perf_p )
+{
+    struct pubjournalStats stats;
+    struct perfCountValues counts;
+    unsigned long long startNs;
+    unsigned long long reopenNs;
+    unsigned long long elapsedNs;
+    char            idPrefix[PUBJOURNAL_MAX_ID_PREFIX];
+    int             journaled;
+
+    sessionEvent ( journal_p, SOLCLIENT_SESSION_EVENT_DOWN_ERROR );
+    for ( journaled = 0; journaled < numMsgs; journaled++ ) {
+        if ( pubjournal_publish ( journal_p, msg_p ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    strcpy ( idPrefix, journal_p->idPrefix );
+    pubjournal_close ( journal_p );
+
+    startNs = os_getTimeNs (  );
+    if ( pubjournal_open ( journal_p, path_p, 0, idPrefix ) != SOLCLIENT_OK ) {
+        return SOLCLIENT_FAIL;
+    }
+    reopenNs = os_getTimeNs (  ) - startNs;
+    journal_p->send_p = benchSend;
+
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    sessionEvent ( journal_p, SOLCLIENT_SESSION_EVENT_UP_NOTICE );
+    while ( journal_p->sendSeq != journal_p->tailSeq ) {
+        pubjournal_pump ( journal_p, ACK_WINDOW );
+        pubjournal_ack ( journal_p, journal_p->sendSeq - 1 );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    if ( perf_p != NULL ) {
+        perfcount_stop ( perf_p, &counts );
+    }
+    pubjournal_getStats ( journal_p, &stats );
+    printf ( "Outage of %d msgs (journal %s when the Session came back):\n", journaled,
+             ( journaled < numMsgs ) ? "full" : "not full" );
+    printf ( "  reopen recovered %llu entries in %.3f ms\n", ( unsigned long long ) stats.recovered,
+             ( double ) reopenNs / 1.0e6 );
+    printf ( "  replayed and trimmed in %.3f s: %.0f msgs/s, %llu pending\n", ( double ) elapsedNs / 1.0e9,
+             ( elapsedNs != 0 ) ? ( double ) stats.recovered * 1.0e9 / ( double ) elapsedNs : 0.0,
+             ( unsigned long long ) stats.pending );
+    if ( perf_p != NULL ) {
+        perfcount_print ( stdout, "  ", &counts, ( double ) stats.recovered, "replayed msg" );
+    }
+    return SOLCLIENT_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to publish on.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p = NULL;
+
+    /* Journal */
+    struct pubjournal journal;
+    int             journalOpen = 0;
+    struct pubjournalStats stats;
+    const char     *path_p = DEFAULT_JOURNAL;
+    int             payloadSize = 256;
+    int             capacityMb = 0;
+    int             syncEvery = 0;
+    char           *payload_p = NULL;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    unsigned long long startNs;
+    struct perfCount perf;
+    struct perfCount *perf_p = NULL;
+    struct perfCountValues counts;
+    int             i;
+
+    printf ( "\nJournalPublisher.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK |
+                                  PERF_COUNTERS_MASK ) );               /* optional parameters */
+    commandOpts.numMsgsToSend = 200000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tjournal=PATH        Journal file (default " DEFAULT_JOURNAL ").\n"
+                                      "\tsize=N              Payload bytes (default 256).\n"
+                                      "\tcapacity=MB         Ring size of a new journal (default 64).\n"
+                                      "\tsync=N              Sync the file to disk every N appends (default 0, never).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "journal=", 8 ) == 0 ) {
+            path_p = argv[i] + 8;
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            payloadSize = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "capacity=", 9 ) == 0 ) {
+            capacityMb = atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "sync=", 5 ) == 0 ) {
+            syncEvery = atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( payloadSize < 1 || capacityMb < 0 || syncEvery < 0 || commandOpts.numMsgsToSend < 1 ) {
+        printf ( "Invalid arguments: size >= 1, capacity >= 0, sync >= 0, --n >= 1\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 && commandOpts.username[0] == ( char ) 0 ) {
+        printf ( "Connecting requires --cu\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.destinationName[0] == ( char ) 0 ) {
+        strcpy ( commandOpts.destinationName, DEFAULT_TOPIC );
+    }
+    if ( ( payload_p = ( char * ) malloc ( payloadSize ) ) == NULL ) {
+        printf ( "Could not allocate a payload of %d bytes\n", payloadSize );
+        exit ( 1 );
+    }
+    memset ( payload_p, 'j', payloadSize );
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /* Before the Context and the sender thread, so that they are counted too. */
+    if ( commandOpts.perfCounters && perfcount_open ( &perf ) == SOLCLIENT_OK ) {
+        perf_p = &perf;
+    }
+
+    if ( createMsg ( commandOpts.destinationName, payload_p, payloadSize, &msg_p ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Offline: benchmark the journal
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        /* A fresh file, so earlier runs do not show up as recovered. */
+        remove ( path_p );
+        if ( pubjournal_open ( &journal, path_p, ( solClient_uint64_t ) capacityMb * 1024 * 1024, "bench" ) != SOLCLIENT_OK ) {
+            goto cleanup;
+        }
+        journal.send_p = benchSend;
+        journal.syncEvery = ( solClient_uint32_t ) syncEvery;
+        printf ( "Journal %s: %llu byte ring, %d byte payloads, sync every %d appends\n\n", path_p,
+                 ( unsigned long long ) journal.capacity, payloadSize, syncEvery );
+        benchSteadyState ( &journal, msg_p, commandOpts.numMsgsToSend, perf_p );
+        if ( benchOutage ( &journal, path_p, msg_p, commandOpts.numMsgsToSend, perf_p ) == SOLCLIENT_OK ) {
+            pubjournal_close ( &journal );
+        }
+        remove ( path_p );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Open the journal; entries left by an earlier run are sent first
+     *************************************************************************/
+    if ( pubjournal_open ( &journal, path_p, ( solClient_uint64_t ) capacityMb * 1024 * 1024, commandOpts.username ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    journalOpen = 1;
+    journal.syncEvery = ( solClient_uint32_t ) syncEvery;
+    pubjournal_getStats ( &journal, &stats );
+    printf ( "Journal %s: %llu entries recovered\n", path_p, ( unsigned long long ) stats.recovered );
+
+    /*************************************************************************
+     * Create a Context, and a Session on it that feeds the journal its events
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( pubjournal_startSender ( &journal ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 pubjournal_eventCallback, &journal, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Publish, then wait for every entry to be acknowledged
+     *************************************************************************/
+    printf ( "Publishing %d Persistent messages of %d bytes to '%s'\n", commandOpts.numMsgsToSend, payloadSize,
+             commandOpts.destinationName );
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < commandOpts.numMsgsToSend; i++ ) {
+        while ( ( rc = pubjournal_publish ( &journal, msg_p ) ) == SOLCLIENT_WOULD_BLOCK ) {
+            OS_SLEEP_US ( 1000 );
+        }
+        if ( rc != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    printf ( "Journaled %d messages in %.3f s\n", i, ( double ) ( os_getTimeNs (  ) - startNs ) / 1.0e9 );
+
+    for ( i = 0; i < DRAIN_TIMEOUT_SEC * 10; i++ ) {
+        pubjournal_getStats ( &journal, &stats );
+        if ( stats.pending == 0 ) {
+            break;
+        }
+        if ( !stats.connected && i % 50 == 49 ) {
+            /* Reconnect retries ran out: keep trying, the journal holds the messages. */
+            if ( ( rc = solClient_session_connect ( session_p ) ) != SOLCLIENT_OK ) {
+                common_handleError ( rc, "solClient_session_connect()" );
+            }
+        }
+        OS_SLEEP_US ( 100000 );
+    }
+    if ( perf_p != NULL ) {
+        perfcount_stop ( perf_p, &counts );
+    }
+    pubjournal_getStats ( &journal, &stats );
+    printf ( "Done in %.3f s: appended %llu, sent %llu (%llu replays), acked %llu, rejected %llu, "
+             "send failures %llu, still pending %llu\n", ( double ) ( os_getTimeNs (  ) - startNs ) / 1.0e9,
+             ( unsigned long long ) stats.appended, ( unsigned long long ) stats.sent,
+             ( unsigned long long ) stats.replays, ( unsigned long long ) stats.acked,
+             ( unsigned long long ) stats.rejected, ( unsigned long long ) stats.sendsFailed,
+             ( unsigned long long ) stats.pending );
+    if ( perf_p != NULL ) {
+        perfcount_print ( stdout, "", &counts, ( double ) stats.appended, "msg" );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( msg_p != NULL ) {
+        solClient_msg_free ( &msg_p );
+    }
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+    /* After the Session is gone, as it calls into the journal until then.
+     * Unacknowledged entries stay in the file for the next run. */
+    if ( journalOpen ) {
+        pubjournal_close ( &journal );
+    }
+
+  notInitialized:
+    if ( perf_p != NULL ) {
+        perfcount_close ( perf_p );
+    }
+    free ( payload_p );
+    return 0;
+}
@@ -0,0 +1,685 @@
+/** @example Intro/JsonFieldExtract.c
+ */
+
+/*
+ * This sample reads a few fields from JSON payloads without parsing them
+ * (see jsonpick.h). It subscribes to --topic and, for each message, looks
+ * up the compiled paths given as field=PATH (up to 8; header.id if none),
+ * printing the values of the first few messages, then the extraction time
+ * per message over --mn messages, or until idle=MS without one.
+ *
+ * Without --cip, it compares, on order-like payloads of about 512 bytes,
+ * 4 KB and 64 KB, the time to read one field near the start, one in the
+ * middle and two at either end: by building a tree of the whole document,
+ * as a DOM parser does, and with jsonpick, its index built with SIMD and
+ * with a byte loop. The three agree on every value looked up, escaped
+ * strings included, before anything is timed. The speedups need -O2:
+ * without optimization the SIMD index is no faster than the byte loop, so
+ * the Makefiles build this sample and jsonpick.c with -O2 although the other
+ * samples build without optimization, and a build without it says so
+ * before the timings.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "jsonpick.h"
+#include "getopt.h"
+
+#define MAX_FIELDS              8
+#define NUM_PAYLOADS            16
+#define NUM_SHOWN               5
+#define DEFAULT_IDLE_MS         2000
+
+#define DOM_STRING              1
+#define DOM_NUMBER              2
+#define DOM_OBJECT              3
+#define DOM_ARRAY               4
+#define DOM_LITERAL             5
+
+/**
+ * @struct domNode
+ * A node of the tree a DOM parser builds: every string unescaped into a
+ * copy of its own.
+ */
+struct domNode
+{
+    int             type;
+    char           *key_p;
+    char           *string_p;
+    const char     *number_p;
+    solClient_uint32_t numberLen;
+    struct domNode *child_p;
+    struct domNode *next_p;
+};
+
+/**
+ * @struct extractor
+ */
+struct extractor
+{
+    struct jsonpickDoc doc;
+    struct jsonpickPath paths[MAX_FIELDS];
+    int             numPaths;
+    solClient_uint64_t *latencies_p;
+    solClient_uint64_t maxSamples;
+    volatile solClient_uint64_t received;
+    solClient_uint64_t notFound;
+    solClient_uint64_t malformed;
+};
+
+/*****************************************************************************
+ * compareNs
+ *****************************************************************************/
+static int
+compareNs ( const void *a_p, const void *b_p )
+{
+    solClient_uint64_t a = *( const solClient_uint64_t * ) a_p;
+    solClient_uint64_t b = *( const solClient_uint64_t * ) b_p;
+
+    return ( a > b ) - ( a < b );
+}
+
+/*****************************************************************************
+ * makePayload
+ *
+ * An order of about size bytes: a header, a string full of escapes and
+ * structural characters, as many lines as fit, and a trailer.
+ *****************************************************************************/
+static          solClient_uint32_t
+makePayload ( char *buf_p, solClient_uint32_t size, solClient_uint32_t seq )
+{
+    solClient_uint32_t len;
+    solClient_uint32_t line;
+
+    len = ( solClient_uint32_t ) sprintf ( buf_p, "{\"header\": {\"id\": %u, \"type\": \"order\", \"source\": \"gw-3\"},\n"
+                                           " \"note\": \"say \\\"hi\\\" \\\\ {not} [structural], ok\",\n"
+                                           " \"lines\": [", seq );
+    for ( line = 0; line < 4 || len + 200 < size; line++ ) {
+        len += ( solClient_uint32_t ) sprintf ( buf_p + len, "%s\n  {\"sku\": \"SKU-%u-%u\", \"qty\": %u, \"price\": 12.5, "
+                                                "\"tags\": [\"a\", \"b\"], \"ok\": true, \"ref\": null}",
+                                                ( line == 0 ) ? "" : ",", seq, line, line + 1 );
+    }
+    len += ( solClient_uint32_t ) sprintf ( buf_p + len, "],\n \"trailer\": {\"count\": %u, \"total\": %u}}\n", line,
+                                            seq * 7 );
+    return len;
+}
+
+/*****************************************************************************
+ * domFree
+ *****************************************************************************/
+static void
+domFree ( struct domNode *node_p )
+{
+    struct domNode *next_p;
+
+    while ( node_p != NULL ) {
+        next_p = node_p->next_p;
+        domFree ( node_p->child_p );
+        free ( node_p->key_p );
+        free ( node_p->string_p );
+        free ( node_p );
+        node_p = next_p;
+    }
+}
+
+/*****************************************************************************
+ * domSkipSpace
+ *****************************************************************************/
+static void
+domSkipSpace ( const char *buf_p, solClient_uint32_t len, solClient_uint32_t *pos_p )
+{
+    while ( *pos_p < len && ( buf_p[*pos_p] == ' ' || buf_p[*pos_p] == '\n' ||
+                              buf_p[*pos_p] == '\r' || buf_p[*pos_p] == '\t' ) ) {
+        ( *pos_p )++;
+    }
+}
+
+/*****************************************************************************
+ * domParseString
+ *
+ * An unescaped copy of the string at *pos_p, its opening quote.
+ *****************************************************************************/
+static char    *
+domParseString ( const char *buf_p, solClient_uint32_t len, solClient_uint32_t *pos_p )
+{
+    solClient_uint32_t end = *pos_p + 1;
+    solClient_uint32_t out = 0;
+    char           *string_p;
+
+    while ( end < len && buf_p[end] != '"' ) {
+        end += ( buf_p[end] == '\\' ) ? 2 : 1;
+    }
+    if ( end >= len || ( string_p = ( char * ) malloc ( end - *pos_p ) ) == NULL ) {
+        return NULL;
+    }
+    for ( ( *pos_p )++; *pos_p < end; ( *pos_p )++ ) {
+        if ( buf_p[*pos_p] != '\\' ) {
+            string_p[out++] = buf_p[*pos_p];
+            continue;
+        }
+        switch ( buf_p[++( *pos_p )] ) {
+            case 'n':
+                string_p[out++] = '\n';
+                break;
+            case 't':
+                string_p[out++] = '\t';
+                break;
+            case 'r':
+                string_p[out++] = '\r';
+                break;
+            case 'b':
+                string_p[out++] = '\b';
+                break;
+            case 'f':
+                string_p[out++] = '\f';
+                break;
+            case 'u':
+                string_p[out++] = '?';
+                *pos_p += 4;
+                break;
+            default:
+                string_p[out++] = buf_p[*pos_p];
+                break;
+        }
+    }
+    string_p[out] = '\0';
+    ( *pos_p )++;
+    return string_p;
+}
+
+/*****************************************************************************
+ * domParse
+ *
+ * The value at *pos_p, and everything in it.
+ *****************************************************************************/
+static struct domNode *
+domParse ( const char *buf_p, solClient_uint32_t len, solClient_uint32_t *pos_p )
+{
+    struct domNode *node_p;
+    struct domNode **last_pp;
+    char            close;
+
+    domSkipSpace ( buf_p, len, pos_p );
+    if ( *pos_p >= len || ( node_p = ( struct domNode * ) calloc ( 1, sizeof ( *node_p ) ) ) == NULL ) {
+        return NULL;
+    }
+    switch ( buf_p[*pos_p] ) {
+        case '"':
+            node_p->type = DOM_STRING;
+            if ( ( node_p->string_p = domParseString ( buf_p, len, pos_p ) ) == NULL ) {
+                goto malformed;
+            }
+            return node_p;
+        case '{':
+        case '[':
+            node_p->type = ( buf_p[*pos_p] == '{' ) ? DOM_OBJECT : DOM_ARRAY;
+            close = ( node_p->type == DOM_OBJECT ) ? '}' : ']';
+            last_pp = &node_p->child_p;
+            ( *pos_p )++;
+            domSkipSpace ( buf_p, len, pos_p );
+            if ( *pos_p < len && buf_p[*pos_p] == close ) {
+                ( *pos_p )++;
+                return node_p;
+            }
+            for ( ;; ) {
+                char           *key_p = NULL;
+
+                if ( node_p->type == DOM_OBJECT ) {
+                    domSkipSpace ( buf_p, len, pos_p );
+                    if ( *pos_p >= len || buf_p[*pos_p] != '"' ||
+                         ( key_p = domParseString ( buf_p, len, pos_p ) ) == NULL ) {
+                        goto malformed;
+                    }
+                    domSkipSpace ( buf_p, len, pos_p );
+                    if ( *pos_p >= len || buf_p[( *pos_p )++] != ':' ) {
+                        free ( key_p );
+                        goto malformed;
+                    }
+                }
+                if ( ( *last_pp = domParse ( buf_p, len, pos_p ) ) == NULL ) {
+                    free ( key_p );
+                    goto malformed;
+                }
+                ( *last_pp )->key_p = key_p;
+                last_pp = &( *last_pp )->next_p;
+                domSkipSpace ( buf_p, len, pos_p );
+                if ( *pos_p < len && buf_p[*pos_p] == ',' ) {
+                    ( *pos_p )++;
+                } else if ( *pos_p < len && buf_p[*pos_p] == close ) {
+                    ( *pos_p )++;
+                    return node_p;
+                } else {
+                    goto malformed;
+                }
+            }
+        default:
+            node_p->type = ( buf_p[*pos_p] == '-' || ( buf_p[*pos_p] >= '0' && buf_p[*pos_p] <= '9' ) ) ?
+                DOM_NUMBER : DOM_LITERAL;
+            node_p->number_p = buf_p + *pos_p;
+            while ( *pos_p < len && buf_p[*pos_p] != ',' && buf_p[*pos_p] != '}' && buf_p[*pos_p] != ']' &&
+                    buf_p[*pos_p] != ' ' && buf_p[*pos_p] != '\n' ) {
+                ( *pos_p )++;
+            }
+            node_p->numberLen = ( solClient_uint32_t ) ( buf_p + *pos_p - node_p->number_p );
+            return node_p;
+    }
+
+  malformed:
+    domFree ( node_p );
+    return NULL;
+}
+
+/*****************************************************************************
+ * domGet
+ *****************************************************************************/
+static struct domNode *
+domGet ( struct domNode *node_p, const struct jsonpickPath *path_p )
+{
+    const struct jsonpickStep *step_p;
+    solClient_uint32_t s;
+    solClient_uint32_t k;
+
+    for ( s = 0; s < path_p->numSteps && node_p != NULL; s++ ) {
+        step_p = &path_p->steps[s];
+        if ( node_p->type != ( step_p->isIndex ? DOM_ARRAY : DOM_OBJECT ) ) {
+            return NULL;
+        }
+        node_p = node_p->child_p;
+        if ( step_p->isIndex ) {
+            for ( k = 0; k < step_p->index && node_p != NULL; k++ ) {
+                node_p = node_p->next_p;
+            }
+        } else {
+            while ( node_p != NULL && ( strlen ( node_p->key_p ) != step_p->keyLen ||
+                                        memcmp ( node_p->key_p, path_p->text + step_p->keyOffset,
+                                                 step_p->keyLen ) != 0 ) ) {
+                node_p = node_p->next_p;
+            }
+        }
+    }
+    return node_p;
+}
+
+/*****************************************************************************
+ * sameValue
+ *
+ * Whether jsonpick and the tree found the same value; a jsonpick string is
+ * compared unescaped.
+ *****************************************************************************/
+static int
+sameValue ( const struct jsonpickValue *value_p, const struct domNode *node_p )
+{
+    char            raw[256];
+    solClient_uint32_t pos = 0;
+    char           *string_p;
+    int             same;
+
+    if ( value_p->type == JSONPICK_STRING && node_p->type == DOM_STRING ) {
+        if ( value_p->len + 3 > sizeof ( raw ) ) {
+            return 0;
+        }
+        raw[0] = '"';
+        memcpy ( raw + 1, value_p->ptr_p, value_p->len );
+        raw[value_p->len + 1] = '"';
+        if ( ( string_p = domParseString ( raw, value_p->len + 2, &pos ) ) == NULL ) {
+            return 0;
+        }
+        same = ( strcmp ( string_p, node_p->string_p ) == 0 );
+        free ( string_p );
+        return same;
+    }
+    if ( value_p->type == JSONPICK_NUMBER && node_p->type == DOM_NUMBER ) {
+        return value_p->len == node_p->numberLen && memcmp ( value_p->ptr_p, node_p->number_p, value_p->len ) == 0;
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * benchSize
+ *****************************************************************************/
+static void
+benchSize ( solClient_uint32_t size, solClient_uint64_t budget )
+{
+    static const char *const fieldNames[] = { "header.id", "lines[3].sku", "header.id+trailer.total" };
+    static const char *const pathTexts[] = { "header.id", "lines[3].sku", "trailer.total", "note" };
+    struct jsonpickPath paths[4];
+    struct jsonpickDoc simdDoc;
+    struct jsonpickDoc scalarDoc;
+    struct jsonpickDoc *doc_p;
+    struct jsonpickValue value;
+    struct jsonpickValue scalarValue;
+    struct domNode *root_p;
+    struct domNode *node_p;
+    char           *payloads_p[NUM_PAYLOADS];
+    solClient_uint32_t lens[NUM_PAYLOADS];
+    solClient_uint64_t ns[3][3];
+    solClient_uint64_t blocks[3];
+    solClient_uint64_t iterations;
+    solClient_uint64_t startNs;
+    solClient_uint64_t n;
+    solClient_uint64_t found = 0;
+    solClient_uint64_t mismatches = 0;
+    solClient_uint64_t totalBytes = 0;
+    solClient_uint32_t pos;
+    int             method;
+    int             field;
+    int             i;
+    int             p;
+
+    for ( p = 0; p < 4; p++ ) {
+        jsonpick_compile ( &paths[p], pathTexts[p] );
+    }
+    jsonpick_init ( &simdDoc, 0 );
+    jsonpick_init ( &scalarDoc, JSONPICK_FLAG_SCALAR );
+    for ( i = 0; i < NUM_PAYLOADS; i++ ) {
+        payloads_p[i] = ( char * ) malloc ( size + 4096 );
+        lens[i] = makePayload ( payloads_p[i], size, ( solClient_uint32_t ) i * 1000 + 1 );
+        totalBytes += lens[i];
+    }
+
+    /* The three agree before anything is timed. */
+    for ( i = 0; i < NUM_PAYLOADS; i++ ) {
+        pos = 0;
+        root_p = domParse ( payloads_p[i], lens[i], &pos );
+        jsonpick_open ( &simdDoc, payloads_p[i], lens[i] );
+        jsonpick_open ( &scalarDoc, payloads_p[i], lens[i] );
+        for ( p = 0; p < 4; p++ ) {
+            node_p = domGet ( root_p, &paths[p] );
+            if ( jsonpick_get ( &simdDoc, &paths[p], &value ) != SOLCLIENT_OK ||
+                 jsonpick_get ( &scalarDoc, &paths[p], &scalarValue ) != SOLCLIENT_OK || node_p == NULL ||
+                 value.ptr_p != scalarValue.ptr_p || value.len != scalarValue.len || !sameValue ( &value, node_p ) ) {
+                mismatches++;
+            }
+        }
+        domFree ( root_p );
+    }
+
+    iterations = budget / ( totalBytes / NUM_PAYLOADS ) + 1;
+    for ( field = 0; field < 3; field++ ) {
+        for ( method = 0; method < 3; method++ ) {
+            doc_p = ( method == 1 ) ? &scalarDoc : &simdDoc;
+            blocks[field] = doc_p->blocks;
+            startNs = os_getTimeNs (  );
+            for ( n = 0; n < iterations; n++ ) {
+                i = ( int ) ( n % NUM_PAYLOADS );
+                if ( method == 0 ) {
+                    pos = 0;
+                    root_p = domParse ( payloads_p[i], lens[i], &pos );
+                    found += ( domGet ( root_p, &paths[( field == 2 ) ? 0 : field] ) != NULL );
+                    if ( field == 2 ) {
+                        found += ( domGet ( root_p, &paths[2] ) != NULL );
+                    }
+                    domFree ( root_p );
+                } else {
+                    jsonpick_open ( doc_p, payloads_p[i], lens[i] );
+                    found += ( jsonpick_get ( doc_p, &paths[( field == 2 ) ? 0 : field], &value ) == SOLCLIENT_OK );
+                    if ( field == 2 ) {
+                        found += ( jsonpick_get ( doc_p, &paths[2], &value ) == SOLCLIENT_OK );
+                    }
+                }
+            }
+            ns[field][method] = ( os_getTimeNs (  ) - startNs ) / iterations;
+            blocks[field] = ( doc_p->blocks - blocks[field] ) / iterations;
+        }
+    }
+
+    printf ( "%u byte payloads (%llu lookups checked, %llu mismatches):\n", lens[0],
+             ( unsigned long long ) ( NUM_PAYLOADS * 4 ), ( unsigned long long ) mismatches );
+    printf ( "  %-26s %10s %10s %10s %8s %10s %12s\n", "fields", "DOM ns", "bytes ns", "SIMD ns", "speedup",
+             "SIMD MB/s", "bytes indexed" );
+    for ( field = 0; field < 3; field++ ) {
+        printf ( "  %-26s %10llu %10llu %10llu %7.1fx %10.0f %12llu\n", fieldNames[field],
+                 ( unsigned long long ) ns[field][0], ( unsigned long long ) ns[field][1],
+                 ( unsigned long long ) ns[field][2], ( double ) ns[field][0] / ( ns[field][2] + 1 ),
+                 ( double ) lens[0] * 1e3 / ( ns[field][2] + 1 ), ( unsigned long long ) ( blocks[field] * 64 ) );
+    }
+    if ( found == 0 ) {
+        printf ( "  nothing found\n" );
+    }
+
+    for ( i = 0; i < NUM_PAYLOADS; i++ ) {
+        free ( payloads_p[i] );
+    }
+    jsonpick_destroy ( &simdDoc );
+    jsonpick_destroy ( &scalarDoc );
+}
+
+/*****************************************************************************
+ * messageReceiveCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct extractor *extractor_p = ( struct extractor * ) user_p;
+    struct jsonpickValue values[MAX_FIELDS];
+    solClient_returnCode_t rcs[MAX_FIELDS];
+    solClient_uint64_t startNs = os_getTimeNs (  );
+    solClient_uint64_t n = extractor_p->received;
+    char            text[128];
+    int             i;
+
+    if ( jsonpick_openMsg ( &extractor_p->doc, msg_p ) == SOLCLIENT_OK ) {
+        for ( i = 0; i < extractor_p->numPaths; i++ ) {
+            rcs[i] = jsonpick_get ( &extractor_p->doc, &extractor_p->paths[i], &values[i] );
+        }
+    } else {
+        for ( i = 0; i < extractor_p->numPaths; i++ ) {
+            rcs[i] = SOLCLIENT_NOT_FOUND;
+        }
+    }
+    if ( n < extractor_p->maxSamples ) {
+        extractor_p->latencies_p[n] = os_getTimeNs (  ) - startNs;
+    }
+
+    for ( i = 0; i < extractor_p->numPaths; i++ ) {
+        if ( rcs[i] == SOLCLIENT_NOT_FOUND ) {
+            extractor_p->notFound++;
+        } else if ( rcs[i] != SOLCLIENT_OK ) {
+            extractor_p->malformed++;
+        }
+        if ( n < NUM_SHOWN ) {
+            if ( rcs[i] != SOLCLIENT_OK ) {
+                strcpy ( text, ( rcs[i] == SOLCLIENT_NOT_FOUND ) ? "(not found)" : "(malformed)" );
+            } else if ( jsonpick_copy ( &values[i], text, sizeof ( text ) ) != SOLCLIENT_OK ) {
+                strcpy ( text, "(too long to show)" );
+            }
+            printf ( "%s%s=%s%s", ( i == 0 ) ? "  " : ", ", extractor_p->paths[i].text, text,
+                     ( i == extractor_p->numPaths - 1 ) ? "\n" : "" );
+        }
+    }
+    extractor_p->received = n + 1;
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to subscribe to.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Extraction */
+    static struct extractor extractor;
+    solClient_uint64_t lastReceived = 0;
+    solClient_uint64_t idleSinceNs;
+    solClient_uint64_t samples;
+    int             idleMs = DEFAULT_IDLE_MS;
+    int             i;
+
+    printf ( "\nJsonFieldExtract.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 100000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tfield=PATH          A field to extract, as a.b[0].c; up to 8 (default header.id).\n"
+                                      "\tidle=MS             Stop after MS without a message (default 2000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    jsonpick_init ( &extractor.doc, 0 );
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "field=", 6 ) == 0 ) {
+            if ( extractor.numPaths == MAX_FIELDS ||
+                 jsonpick_compile ( &extractor.paths[extractor.numPaths++], argv[i] + 6 ) != SOLCLIENT_OK ) {
+                printf ( "Invalid field '%s'\n", argv[i] + 6 );
+                exit ( 1 );
+            }
+        } else if ( strncmp ( argv[i], "idle=", 5 ) == 0 ) {
+            idleMs = atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( extractor.numPaths == 0 ) {
+        jsonpick_compile ( &extractor.paths[extractor.numPaths++], "header.id" );
+    }
+    if ( idleMs < 1 ) {
+        printf ( "Invalid arguments: idle >= 1\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Subscribing requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: DOM against jsonpick
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        solClient_uint64_t budget = ( solClient_uint64_t ) commandOpts.numMsgsToSend * 256;
+
+#ifndef __OPTIMIZE__
+        printf ( "Built without optimization: the timings below are not representative, build with -O2.\n" );
+#endif
+        benchSize ( 512, budget );
+        benchSize ( 4096, budget );
+        benchSize ( 65536, budget );
+        goto cleanup;
+    }
+
+    extractor.maxSamples = ( solClient_uint64_t ) commandOpts.numMsgsToSend;
+    if ( ( extractor.latencies_p = ( solClient_uint64_t * ) malloc ( extractor.maxSamples *
+                                                                     sizeof ( solClient_uint64_t ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate %llu samples",
+                        ( unsigned long long ) extractor.maxSamples );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 messageReceiveCallback,
+                                                 common_eventCallback, &extractor, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+        goto sessionConnected;
+    }
+    printf ( "Extracting %d field(s) from messages on '%s'\n", extractor.numPaths, commandOpts.destinationName );
+
+    /* Until --mn messages came, or none for idle. */
+    idleSinceNs = os_getTimeNs (  );
+    while ( extractor.received < extractor.maxSamples && os_getTimeNs (  ) - idleSinceNs < idleMs * 1000000ULL ) {
+        if ( extractor.received != lastReceived ) {
+            lastReceived = extractor.received;
+            idleSinceNs = os_getTimeNs (  );
+        }
+        OS_SLEEP_US ( 10000 );
+    }
+
+    if ( ( rc = solClient_session_topicUnsubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                        commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicUnsubscribeExt()" );
+    }
+
+    samples = ( extractor.received < extractor.maxSamples ) ? extractor.received : extractor.maxSamples;
+    if ( samples > 0 ) {
+        qsort ( extractor.latencies_p, ( size_t ) samples, sizeof ( solClient_uint64_t ), compareNs );
+        printf ( "Extracted from %llu messages: %llu fields not found, %llu in malformed payloads; "
+                 "ns per message p50 %llu, p99 %llu, p99.9 %llu, max %llu\n",
+                 ( unsigned long long ) extractor.received, ( unsigned long long ) extractor.notFound,
+                 ( unsigned long long ) extractor.malformed,
+                 ( unsigned long long ) extractor.latencies_p[samples / 2],
+                 ( unsigned long long ) extractor.latencies_p[samples * 99 / 100],
+                 ( unsigned long long ) extractor.latencies_p[samples * 999 / 1000],
+                 ( unsigned long long ) extractor.latencies_p[samples - 1] );
+    } else {
+        printf ( "No messages received\n" );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    free ( extractor.latencies_p );
+    jsonpick_destroy ( &extractor.doc );
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
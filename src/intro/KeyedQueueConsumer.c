@@ -0,0 +1,460 @@
+/** @example Intro/KeyedQueueConsumer.c
+ */
+
+/*
+ * This sample processes one Queue's messages on several worker threads,
+ * keeping the order of each key's messages (see keyorder.h). The key is
+ * the user property key=NAME, or the topic. Each message takes work=US
+ * to process, slept as for a call to another service, or spun with
+ * spin=1; it is acknowledged as soon as it is done, and the low
+ * watermark, below which everything is acknowledged, is reported as it
+ * rises. It binds to queue=NAME, or to a temporary Queue subscribed to
+ * --topic, with workers=N, and stops after --mn messages processed, or
+ * idle=MS without one.
+ *
+ * Without --cip, it measures throughput against the number of workers:
+ * --mn messages spread over keys=N keys are put with the pool's window
+ * as the only limit, for each count in workers=1,2,4,..., checking that
+ * each key's messages were processed in order.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "keyorder.h"
+#include "getopt.h"
+
+#define DEFAULT_WORKERS         "1,2,4,8,16"
+#define DEFAULT_KEYS            256
+#define DEFAULT_WORK_US         200
+#define DEFAULT_IDLE_MS         2000
+#define KEY_PROP                "key"
+#define MAX_RUNS                16
+
+/*
+ * What the benchmark's messages carry, and what it checks.
+ */
+struct benchPayload
+{
+    solClient_uint32_t key;
+    solClient_uint64_t keySeq;
+};
+
+struct bench
+{
+    solClient_uint64_t *nextSeq_p;      /* Expected per key. */
+    solClient_uint64_t outOfOrder[KEYORDER_MAX_WORKERS];
+    int             workUs;
+    int             spin;
+};
+
+/*****************************************************************************
+ * doWork
+ *****************************************************************************/
+static void
+doWork ( int workUs, int spin )
+{
+    solClient_uint64_t startNs;
+
+    if ( workUs <= 0 ) {
+        return;
+    }
+    if ( spin ) {
+        startNs = os_getTimeNs (  );
+        while ( os_getTimeNs (  ) - startNs < workUs * 1000ULL ) {
+        }
+    } else {
+        OS_SLEEP_US ( workUs );
+    }
+}
+
+/*****************************************************************************
+ * benchProcess
+ *
+ * A key is only ever on one worker, so its entry needs no lock.
+ *****************************************************************************/
+static void
+benchProcess ( struct keyorderItem *item_p, int worker, void *user_p )
+{
+    struct bench   *bench_p = ( struct bench * ) user_p;
+    struct benchPayload payload;
+    void           *ptr_p;
+    solClient_uint32_t size;
+
+    if ( solClient_msg_getBinaryAttachmentPtr ( item_p->msg_p, &ptr_p, &size ) == SOLCLIENT_OK &&
+         size == sizeof ( payload ) ) {
+        memcpy ( &payload, ptr_p, sizeof ( payload ) );
+        if ( bench_p->nextSeq_p[payload.key] != payload.keySeq ) {
+            bench_p->outOfOrder[worker]++;
+        }
+        bench_p->nextSeq_p[payload.key] = payload.keySeq + 1;
+    }
+    doWork ( bench_p->workUs, bench_p->spin );
+}
+
+/*****************************************************************************
+ * benchWorkers
+ *
+ * Put numMsgs over numKeys keys, as a receive callback would, and wait
+ * until all are processed. Returns the rate.
+ *****************************************************************************/
+static double
+benchWorkers ( int numWorkers, solClient_uint64_t numMsgs, solClient_uint32_t numKeys, solClient_uint32_t window,
+               int workUs, int spin, double baseRate )
+{
+    static struct keyorder pool;
+    struct keyorderStats stats;
+    struct bench    bench;
+    struct benchPayload payload;
+    solClient_opaqueMsg_pt msg_p;
+    solClient_opaqueContainer_pt map_p;
+    solClient_destination_t destination;
+    solClient_uint64_t *sent_p;
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_uint64_t startNs;
+    solClient_uint64_t elapsedNs;
+    solClient_uint64_t outOfOrder = 0;
+    solClient_uint64_t i;
+    char            key[32];
+    double          rate = 0.0;
+    int             w;
+
+    memset ( &bench, 0, sizeof ( bench ) );
+    bench.workUs = workUs;
+    bench.spin = spin;
+    bench.nextSeq_p = ( solClient_uint64_t * ) calloc ( numKeys, sizeof ( solClient_uint64_t ) );
+    sent_p = ( solClient_uint64_t * ) calloc ( numKeys, sizeof ( solClient_uint64_t ) );
+    if ( bench.nextSeq_p == NULL || sent_p == NULL ||
+         keyorder_init ( &pool, numWorkers, window, KEY_PROP, benchProcess, &bench ) != SOLCLIENT_OK ) {
+        goto done;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = "orders/bench";
+
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numMsgs; i++ ) {
+        payload.key = ( solClient_uint32_t ) ( common_random ( &x ) % numKeys );
+        payload.keySeq = sent_p[payload.key]++;
+        sprintf ( key, "key-%u", payload.key );
+        if ( solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ) {
+            break;
+        }
+        if ( solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) != SOLCLIENT_OK ||
+             solClient_msg_setBinaryAttachment ( msg_p, &payload, sizeof ( payload ) ) != SOLCLIENT_OK ||
+             solClient_msg_createUserPropertyMap ( msg_p, &map_p, 64 ) != SOLCLIENT_OK ||
+             solClient_container_addString ( map_p, key, KEY_PROP ) != SOLCLIENT_OK ||
+             keyorder_put ( &pool, NULL, msg_p ) != SOLCLIENT_CALLBACK_TAKE_MSG ) {
+            solClient_msg_free ( &msg_p );
+            break;
+        }
+    }
+    do {
+        OS_SLEEP_US ( 1000 );
+        keyorder_getStats ( &pool, &stats );
+    } while ( stats.processed < stats.received );
+    elapsedNs = os_getTimeNs (  ) - startNs;
+
+    for ( w = 0; w < numWorkers; w++ ) {
+        outOfOrder += bench.outOfOrder[w];
+    }
+    rate = stats.processed * 1e9 / ( elapsedNs + 1 );
+    printf ( "  %7d %10.0f %8.2fx %12llu %12llu %10llu %12llu\n", numWorkers, rate,
+             ( baseRate > 0.0 ) ? rate / baseRate : 1.0, ( unsigned long long ) outOfOrder,
+             ( unsigned long long ) stats.maxLag, ( unsigned long long ) stats.waits,
+             ( unsigned long long ) stats.lowSeq );
+    fflush ( stdout );
+    keyorder_destroy ( &pool );
+
+  done:
+    free ( bench.nextSeq_p );
+    free ( sent_p );
+    return rate;
+}
+
+/*****************************************************************************
+ * liveProcess
+ *****************************************************************************/
+static void
+liveProcess ( struct keyorderItem *item_p, int worker, void *user_p )
+{
+    struct bench   *bench_p = ( struct bench * ) user_p;
+
+    /* The application processes the message here. */
+    doWork ( bench_p->workUs, bench_p->spin );
+}
+
+/*****************************************************************************
+ * flowRxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+flowRxCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    return keyorder_put ( ( struct keyorder * ) user_p, opaqueFlow_p, msg_p );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic for a temporary Queue.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Flow */
+    solClient_opaqueFlow_pt flow_p;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    const char     *flowProps[20] = {0, };
+    int             propIndex = 0;
+
+    /* Workers */
+    static struct keyorder pool;
+    struct keyorderStats stats;
+    struct bench    bench;
+    const char     *queue_p = NULL;
+    const char     *keyProp_p = NULL;
+    const char     *workers_p = DEFAULT_WORKERS;
+    const char     *p;
+    int             workers[MAX_RUNS];
+    int             numRuns = 0;
+    solClient_uint32_t numKeys = DEFAULT_KEYS;
+    solClient_uint32_t window = KEYORDER_DEFAULT_WINDOW;
+    int             idleMs = DEFAULT_IDLE_MS;
+    solClient_uint64_t lastProcessed = 0;
+    solClient_uint64_t idleSinceNs;
+    double          baseRate = 0.0;
+    int             i;
+
+    printf ( "\nKeyedQueueConsumer.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 20000;
+    memset ( &bench, 0, sizeof ( bench ) );
+    bench.workUs = DEFAULT_WORK_US;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tqueue=NAME          The Queue to consume (with --cip; else a temporary one on --topic).\n"
+                                      "\tkey=NAME            The user property holding the key (default: the topic).\n"
+                                      "\tworkers=N,...       Worker threads; without --cip, each count is measured (default 1,2,4,8,16).\n"
+                                      "\twindow=N            Most messages held above the watermark (default 4096).\n"
+                                      "\twork=US             Time to process a message (default 200).\n"
+                                      "\tspin=1              Spin for work=US instead of sleeping.\n"
+                                      "\tidle=MS             Stop after MS without a message (default 2000).\n"
+                                      "\tkeys=N              Without --cip, the number of keys (default 256).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "queue=", 6 ) == 0 ) {
+            queue_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "key=", 4 ) == 0 ) {
+            keyProp_p = argv[i] + 4;
+        } else if ( strncmp ( argv[i], "workers=", 8 ) == 0 ) {
+            workers_p = argv[i] + 8;
+        } else if ( strncmp ( argv[i], "window=", 7 ) == 0 ) {
+            window = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "work=", 5 ) == 0 ) {
+            bench.workUs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "spin=", 5 ) == 0 ) {
+            bench.spin = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "idle=", 5 ) == 0 ) {
+            idleMs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "keys=", 5 ) == 0 ) {
+            numKeys = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    for ( p = workers_p; *p != ( char ) 0 && numRuns < MAX_RUNS; p++ ) {
+        workers[numRuns++] = atoi ( p );
+        if ( ( p = strchr ( p, ',' ) ) == NULL ) {
+            break;
+        }
+    }
+    for ( i = 0; i < numRuns; i++ ) {
+        if ( workers[i] < 1 || workers[i] > KEYORDER_MAX_WORKERS ) {
+            numRuns = 0;
+        }
+    }
+    if ( numRuns == 0 || window < 1 || numKeys < 1 || bench.workUs < 0 || idleMs < 1 ) {
+        printf ( "Invalid arguments: workers 1-%d, window >= 1, keys >= 1, work >= 0, idle >= 1\n",
+                 KEYORDER_MAX_WORKERS );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || ( queue_p == NULL && commandOpts.destinationName[0] == ( char ) 0 ) ) ) {
+        printf ( "Consuming requires --cu, and queue=NAME or --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: throughput against the number of workers
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        printf ( "%d messages over %u keys, %d us of %s each, window %u:\n", commandOpts.numMsgsToSend, numKeys,
+                 bench.workUs, bench.spin ? "spinning" : "sleeping", window );
+        printf ( "  workers     msgs/s  speedup out-of-order      max lag window waits    watermark\n" );
+        for ( i = 0; i < numRuns; i++ ) {
+            double          rate = benchWorkers ( workers[i], ( solClient_uint64_t ) commandOpts.numMsgsToSend,
+                                                  numKeys, window, bench.workUs, bench.spin, baseRate );
+
+            if ( i == 0 ) {
+                baseRate = rate;
+            }
+        }
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( keyorder_init ( &pool, workers[0], window, keyProp_p, liveProcess, &bench ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * A client-acknowledged Flow, handing every message to the pool
+     *************************************************************************/
+    flowFuncInfo.rxMsgInfo.callback_p = flowRxCallback;
+    flowFuncInfo.rxMsgInfo.user_p = &pool;
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_BLOCKING;
+    flowProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE_CLIENT;
+    if ( queue_p != NULL ) {
+        flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_NAME;
+        flowProps[propIndex++] = queue_p;
+    } else {
+        flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_DURABLE;
+        flowProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    }
+    if ( ( rc = solClient_session_createFlow ( ( char ** ) flowProps, session_p, &flow_p,
+                                               &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createFlow()" );
+        goto destroyPool;
+    }
+    if ( queue_p == NULL &&
+         ( rc = solClient_flow_topicSubscribeWithDispatch ( flow_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                            commandOpts.destinationName, NULL, 0 ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_topicSubscribeWithDispatch()" );
+        goto destroyFlow;
+    }
+    printf ( "Consuming on %d workers keyed by %s, %d us per message\n", workers[0],
+             ( keyProp_p != NULL ) ? keyProp_p : "topic", bench.workUs );
+
+    /*************************************************************************
+     * Report once a second until --mn are done or none came for idle
+     *************************************************************************/
+    idleSinceNs = os_getTimeNs (  );
+    for ( ;; ) {
+        OS_SLEEP_US ( 100000 );
+        keyorder_getStats ( &pool, &stats );
+        if ( stats.processed != lastProcessed ) {
+            idleSinceNs = os_getTimeNs (  );
+        }
+        if ( stats.processed / 10000 != lastProcessed / 10000 ) {
+            printf ( "processed %llu of %llu received, watermark %llu (message ID %llu), %llu above it\n",
+                     ( unsigned long long ) stats.processed, ( unsigned long long ) stats.received,
+                     ( unsigned long long ) stats.lowSeq, ( unsigned long long ) stats.lowMsgId,
+                     ( unsigned long long ) ( stats.processed - stats.lowSeq ) );
+        }
+        lastProcessed = stats.processed;
+        if ( stats.processed >= ( solClient_uint64_t ) commandOpts.numMsgsToSend ||
+             os_getTimeNs (  ) - idleSinceNs >= idleMs * 1000000ULL ) {
+            break;
+        }
+    }
+    keyorder_getStats ( &pool, &stats );
+    printf ( "Processed %llu: %llu acknowledged, %llu failed to acknowledge, %llu redeliveries skipped; "
+             "watermark %llu, %llu held at most, Flow stopped %llu times at the window, %llu waits for room\n",
+             ( unsigned long long ) stats.processed, ( unsigned long long ) stats.acked,
+             ( unsigned long long ) stats.ackFailed, ( unsigned long long ) stats.skipped,
+             ( unsigned long long ) stats.lowSeq, ( unsigned long long ) stats.maxLag,
+             ( unsigned long long ) stats.flowStops, ( unsigned long long ) stats.waits );
+    for ( i = 0; i < workers[0]; i++ ) {
+        printf ( "  worker %d: %llu\n", i, ( unsigned long long ) pool.workers_p[i].processed );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroyFlow:
+    if ( ( rc = solClient_flow_destroy ( &flow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+
+  destroyPool:
+    /* What is left unprocessed is redelivered. */
+    keyorder_destroy ( &pool );
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,248 @@
+/** @example Intro/MockCallbackPerf.c
+ */
+
+/*
+ * This sample drives the receive and event callbacks in common.c through
+ * the mock Session layer (solClientMock.c) instead of a live broker, and
+ * reports the cost of each callback in ns/call. Because the mock delivers
+ * messages synchronously on this thread, the numbers are repeatable and
+ * the process can be profiled without network noise.
+ *
+ * No broker is needed. The printing callbacks ("rx", "flowack") write one
+ * line per message to STDOUT, so results are reported on STDERR; run with
+ * STDOUT redirected to /dev/null to measure them. With --perf, each line is
+ * followed by the hardware counters per call (see perfcount.h).
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "getopt.h"
+#include "solClientMock.h"
+#include "perfcount.h"
+
+#define CALLBACK_NAMES "perf rx flowcount flowack event flowevent"
+
+/*****************************************************************************
+ * buildMessage
+ *
+ * A message shaped like the ones the samples receive: sender ID, sequence
+ * number and the common sample attachment.
+ *****************************************************************************/
+static solClient_returnCode_t
+buildMessage ( solClient_opaqueMsg_pt * msg_pp )
+{
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_alloc ( msg_pp ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    solClient_msg_setSenderId ( *msg_pp, "mock-sender" );
+    solClient_msg_setSequenceNumber ( *msg_pp, 1 );
+    solClient_msg_setBinaryAttachment ( *msg_pp, COMMON_ATTACHMENT_TEXT, ( solClient_uint32_t ) strlen ( COMMON_ATTACHMENT_TEXT ) );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * runCallback
+ *
+ * Injects numCalls messages or events into the callback named by name_p.
+ * perf_p is NULL without --perf.
+ *****************************************************************************/
+static int
+runCallback ( const char *name_p, int numCalls, solClient_opaqueContext_pt context_p,
+              solClient_opaqueSession_pt session_p, solClient_opaqueMsg_pt msg_p, struct perfCount *perf_p )
+{
+    solClient_opaqueFlow_pt flow_p = NULL;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    struct solClientMock_stats stats;
+    int             flowCounter = 0;
+    int             isFlow = 0;
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    struct perfCountValues counts;
+    const struct common_solClientApi *api_p = common_getSolClientApi (  );
+    int             i;
+
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+    if ( strcmp ( name_p, "flowcount" ) == 0 ) {
+        flowFuncInfo.rxMsgInfo.callback_p = common_flowMessageReceiveCallback;
+        flowFuncInfo.rxMsgInfo.user_p = &flowCounter;
+        isFlow = 1;
+    } else if ( strcmp ( name_p, "flowack" ) == 0 ) {
+        flowFuncInfo.rxMsgInfo.callback_p = common_flowMessageReceiveAckCallback;
+        isFlow = 1;
+    } else if ( strcmp ( name_p, "flowevent" ) == 0 ) {
+        flowFuncInfo.rxMsgInfo.callback_p = common_flowMessageReceiveCallback;
+        isFlow = 1;
+    } else if ( strcmp ( name_p, "perf" ) != 0 && strcmp ( name_p, "rx" ) != 0 && strcmp ( name_p, "event" ) != 0 ) {
+        fprintf ( stderr, "Unknown callback '%s', expected one of: %s\n", name_p, CALLBACK_NAMES );
+        return 0;
+    }
+    if ( isFlow && api_p->session_createFlow ( NULL, session_p, &flow_p, &flowFuncInfo, sizeof ( flowFuncInfo ) ) != SOLCLIENT_OK ) {
+        return 0;
+    }
+
+    /* The perf and rx callbacks are registered by swapping Sessions. */
+    if ( strcmp ( name_p, "perf" ) == 0 || strcmp ( name_p, "rx" ) == 0 ) {
+        solClient_session_createFuncInfo_t sessionFuncInfo = SOLCLIENT_SESSION_CREATEFUNC_INITIALIZER;
+
+        sessionFuncInfo.rxMsgInfo.callback_p = ( strcmp ( name_p, "perf" ) == 0 ) ?
+            common_messageReceivePerfCallback : common_messageReceiveCallback;
+        sessionFuncInfo.eventInfo.callback_p = common_eventCallback;
+        api_p->session_create ( NULL, context_p, &session_p, &sessionFuncInfo, sizeof ( sessionFuncInfo ) );
+        api_p->session_connect ( session_p );
+        solClientMock_processEvents ( context_p, 0 );
+    }
+
+    /* One tight loop per kind of injection keeps the driver out of the numbers. */
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    if ( strcmp ( name_p, "event" ) == 0 ) {
+        for ( i = 0; i < numCalls; i++ ) {
+            solClientMock_injectSessionEvent ( session_p, SOLCLIENT_SESSION_EVENT_ACKNOWLEDGEMENT, 0, NULL, NULL );
+        }
+    } else if ( strcmp ( name_p, "flowevent" ) == 0 ) {
+        for ( i = 0; i < numCalls; i++ ) {
+            solClientMock_injectFlowEvent ( flow_p, SOLCLIENT_FLOW_EVENT_ACTIVE, 0, NULL );
+        }
+    } else if ( isFlow ) {
+        for ( i = 0; i < numCalls; i++ ) {
+            solClientMock_injectFlowMsg ( flow_p, msg_p, ( solClient_msgId_t ) i + 1 );
+        }
+    } else {
+        for ( i = 0; i < numCalls; i++ ) {
+            solClientMock_injectMsg ( session_p, msg_p );
+        }
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    if ( perf_p != NULL ) {
+        perfcount_stop ( perf_p, &counts );
+    }
+
+    fflush ( stdout );
+    fprintf ( stderr, "%-10s %10d calls %10.1f ns/call %12.0f calls/s",
+              name_p, numCalls, ( double ) elapsedNs / numCalls, numCalls * 1.0e9 / ( double ) ( elapsedNs ? elapsedNs : 1 ) );
+    if ( flow_p != NULL ) {
+        solClientMock_getStats ( session_p, flow_p, &stats );
+        fprintf ( stderr, " (acks %llu)", ( unsigned long long ) stats.acks );
+        api_p->flow_destroy ( &flow_p );
+    }
+    fprintf ( stderr, "\n" );
+    if ( perf_p != NULL ) {
+        perfcount_print ( stderr, "           ", &counts, numCalls, "call" );
+    }
+
+    if ( strcmp ( name_p, "perf" ) == 0 || strcmp ( name_p, "rx" ) == 0 ) {
+        api_p->session_disconnect ( session_p );
+        api_p->session_destroy ( &session_p );
+    }
+    return 1;
+}
+
+
+/*
+ * fn main()
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    solClient_opaqueSession_pt session_p;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    struct perfCount perf;
+    struct perfCount *perf_p = NULL;
+    const struct common_solClientApi *api_p;
+    const char     *defaultNames[] = { "perf", "flowcount", "event", "flowevent" };
+    int             i;
+
+    fprintf ( stderr, "\nMockCallbackPerf.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( NUM_MSGS_MASK | LOG_LEVEL_MASK | PERF_COUNTERS_MASK ) );    /* optional parameters */
+    commandOpts.numMsgsToSend = 10000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tCALLBACK...         Callbacks to drive: " CALLBACK_NAMES "\n"
+                                      "\t                    (default: perf flowcount event flowevent).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the real API; the mock supplies Context and Sessions
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        return 1;
+    }
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+    solClientMock_install (  );
+    api_p = common_getSolClientApi (  );
+
+    /* Before the Context, so that its thread is counted too. */
+    if ( commandOpts.perfCounters && perfcount_open ( &perf ) == SOLCLIENT_OK ) {
+        perf_p = &perf;
+    }
+
+    if ( ( rc = api_p->context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                        &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    /* The same helper the samples use, now connected to the mock. */
+    if ( ( rc = common_createAndConnectSession ( context_p, &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    solClientMock_processEvents ( context_p, 0 );
+
+    if ( buildMessage ( &msg_p ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Drive each callback
+     *************************************************************************/
+    if ( optind < argc ) {
+        for ( i = optind; i < argc; i++ ) {
+            runCallback ( argv[i], commandOpts.numMsgsToSend, context_p, session_p, msg_p, perf_p );
+        }
+    } else {
+        for ( i = 0; i < ( int ) ( sizeof ( defaultNames ) / sizeof ( defaultNames[0] ) ); i++ ) {
+            runCallback ( defaultNames[i], commandOpts.numMsgsToSend, context_p, session_p, msg_p, perf_p );
+        }
+    }
+
+    COMMON_PROBE_DUMP (  );
+
+    solClient_msg_free ( &msg_p );
+    api_p->session_disconnect ( session_p );
+    api_p->session_destroy ( &session_p );
+    api_p->context_destroy ( &context_p );
+
+  cleanup:
+    solClient_cleanup (  );
+    if ( perf_p != NULL ) {
+        perfcount_close ( perf_p );
+    }
+    return 0;
+}
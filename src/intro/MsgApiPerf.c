@@ -0,0 +1,925 @@
+/** @example Intro/MsgApiPerf.c
+ */
+
+/*
+ * This sample measures the message and container APIs on their own. These
+ * calls need no Session, so the benchmark runs on any build box without a
+ * broker and gives the floor of the per-message cost of the other samples.
+ *
+ * Each benchmark repeats one operation and reports ns/op together with the
+ * message allocations and message buffer re-allocations per operation,
+ * taken from solClient_msg_getStat(). The allocations count the messages
+ * allocated by solClient_msg_alloc(), solClient_msg_dup() and
+ * solClient_msg_decodeFromSmf(). The library keeps the data blocks and
+ * containers as the numbers in use rather than running totals, so they are
+ * shown in columns of their own: the most one operation holds at once,
+ * read in one more, untimed, operation just before it frees what it
+ * allocated. A benchmark that fills a message it reuses thus shows blocks
+ * held but no allocations. The payload benchmarks run across several
+ * attachment sizes and the container benchmarks across several container
+ * shapes. The "rr-" and "publish-msg" benchmarks repeat the exact call
+ * sequences of BasicRequestor, BasicReplier and common_publishMessage(),
+ * without the send.
+ *
+ * The library version is printed first, so runs can be compared across
+ * library upgrades. Name benchmarks on the command line to run a subset.
+ * With --perf, each benchmark is followed by its hardware counters per
+ * operation (see perfcount.h).
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "solclient/solClientDeprecated.h"
+#include "common.h"
+#include "RRcommon.h"
+#include "perfcount.h"
+#include "getopt.h"
+
+#define BENCH_TOPIC             "my/sample/topic"
+#define BENCH_MAX_PAYLOAD       65536
+#define BENCH_CONTAINER_BYTES   16384
+#define BENCH_BYTES_PER_RUN     ( 4096ULL * 1000000ULL )   /* Caps iterations for large payloads. */
+
+static const solClient_uint32_t payloadSizes[] = { 16, 256, 4096, BENCH_MAX_PAYLOAD };
+#define NUM_PAYLOAD_SIZES ( ( int ) ( sizeof ( payloadSizes ) / sizeof ( payloadSizes[0] ) ) )
+
+/*
+ * A container shape: a stream or map of numFields scalar fields, optionally
+ * with a nested map and stream of the same number of fields.
+ */
+struct containerShape
+{
+    const char     *name_p;
+    int             isStream;
+    int             numFields;
+    int             nested;
+};
+
+static const struct containerShape containerShapes[] = {
+    {"stream8", 1, 8, 0},
+    {"map8", 0, 8, 0},
+    {"map32", 0, 32, 0},
+    {"nested", 0, 8, 1}
+};
+#define NUM_CONTAINER_SHAPES ( ( int ) ( sizeof ( containerShapes ) / sizeof ( containerShapes[0] ) ) )
+
+static const char *fieldNames[] = {
+    "f0", "f1", "f2", "f3", "f4", "f5", "f6", "f7", "f8", "f9", "f10", "f11", "f12", "f13", "f14", "f15",
+    "f16", "f17", "f18", "f19", "f20", "f21", "f22", "f23", "f24", "f25", "f26", "f27", "f28", "f29", "f30", "f31"
+};
+
+/*
+ * The message statistics a benchmark reports.
+ */
+struct allocCounts
+{
+    solClient_uint64_t msgs;            /* Allocated so far. */
+    solClient_uint64_t reallocs;        /* Buffer re-allocations so far. */
+    solClient_uint64_t blocks;          /* Data blocks in use, of every quanta. */
+    solClient_uint64_t containers;      /* Containers in use. */
+};
+
+/*
+ * Everything the operations work on, built before any timing starts.
+ */
+struct benchState
+{
+    unsigned char   payload[BENCH_MAX_PAYLOAD];
+    solClient_destination_t destination;
+
+    /* One message per payload size, and its SMF encoding. */
+    solClient_opaqueMsg_pt sizedMsg_p[NUM_PAYLOAD_SIZES];
+    solClient_opaqueDatablock_pt smfDatab_p[NUM_PAYLOAD_SIZES];
+    solClient_bufInfo_t smf[NUM_PAYLOAD_SIZES];
+
+    /* A reusable message for the setter and request benchmarks. */
+    solClient_opaqueMsg_pt workMsg_p;
+    /* A message with all headers set, for the getter benchmark. */
+    solClient_opaqueMsg_pt headerMsg_p;
+
+    /* A BasicRequestor request and a BasicReplier reply, as received. */
+    solClient_opaqueMsg_pt requestMsg_p;
+    solClient_opaqueMsg_pt replyMsg_p;
+
+    /* Containers of each shape, built in place and left open for reading. */
+    char            shapeMem[NUM_CONTAINER_SHAPES][BENCH_CONTAINER_BYTES];
+    solClient_opaqueContainer_pt shape_p[NUM_CONTAINER_SHAPES];
+    char            buildMem[BENCH_CONTAINER_BYTES];
+
+    /* See noteHeld(). */
+    int             probing;
+    struct allocCounts held;
+};
+
+typedef         solClient_returnCode_t ( *benchOpFunc_t ) ( struct benchState * state_p, int param );
+
+
+/*****************************************************************************
+ * allocCounters
+ *
+ * Messages allocated so far (the library counts solClient_msg_dup() and
+ * solClient_msg_decodeFromSmf() as allocations too), buffer re-allocations,
+ * and the data blocks, including those over the largest quanta, and
+ * containers in use now.
+ *****************************************************************************/
+static void
+allocCounters ( struct allocCounts *counts_p )
+{
+    solClient_uint64_t value;
+    solClient_uint32_t quanta;
+
+    memset ( counts_p, 0, sizeof ( *counts_p ) );
+    solClient_msg_getStat ( SOLCLIENT_MSG_STATS_MSG_ALLOCS, 0, &counts_p->msgs );
+    solClient_msg_getStat ( SOLCLIENT_MSG_STATS_MSG_REALLOCS, 0, &counts_p->reallocs );
+    for ( quanta = 0; quanta <= SOLCLIENT_MSG_NUMDBQUANTA; quanta++ ) {
+        if ( solClient_msg_getStat ( SOLCLIENT_MSG_STATS_ALLOC_DATA_BLOCKS, quanta, &value ) == SOLCLIENT_OK ) {
+            counts_p->blocks += value;
+        }
+    }
+    solClient_msg_getStat ( SOLCLIENT_MSG_STATS_ALLOC_CONTAINERS, 0, &counts_p->containers );
+}
+
+/*****************************************************************************
+ * noteHeld
+ *
+ * Called by the operations before they free what they allocated: while
+ * one operation is probed, keeps the most data blocks and containers in use.
+ *****************************************************************************/
+static void
+noteHeld ( struct benchState *state_p )
+{
+    struct allocCounts counts;
+
+    if ( !state_p->probing ) {
+        return;
+    }
+    allocCounters ( &counts );
+    if ( counts.blocks > state_p->held.blocks ) {
+        state_p->held.blocks = counts.blocks;
+    }
+    if ( counts.containers > state_p->held.containers ) {
+        state_p->held.containers = counts.containers;
+    }
+}
+
+/*****************************************************************************
+ * addFields
+ *
+ * Adds numFields named scalar fields of mixed types (names are ignored for
+ * streams).
+ *****************************************************************************/
+static          solClient_returnCode_t
+addFields ( solClient_opaqueContainer_pt container_p, int numFields, int isStream )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    const char     *name_p;
+    int             i;
+
+    for ( i = 0; i < numFields && rc == SOLCLIENT_OK; i++ ) {
+        name_p = isStream ? NULL : fieldNames[i];
+        switch ( i % 5 ) {
+            case 0:
+                rc = solClient_container_addInt32 ( container_p, i, name_p );
+                break;
+            case 1:
+                rc = solClient_container_addInt64 ( container_p, ( solClient_int64_t ) i << 40, name_p );
+                break;
+            case 2:
+                rc = solClient_container_addDouble ( container_p, i * 0.5, name_p );
+                break;
+            case 3:
+                rc = solClient_container_addString ( container_p, "value", name_p );
+                break;
+            default:
+                rc = solClient_container_addBoolean ( container_p, 1, name_p );
+                break;
+        }
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * buildShape
+ *
+ * Builds a container of the given shape in mem_p. The container is left
+ * open; the caller closes it with solClient_container_closeMapStream().
+ *****************************************************************************/
+static          solClient_returnCode_t
+buildShape ( const struct containerShape *shape_p, char *mem_p, size_t size, solClient_opaqueContainer_pt * container_pp )
+{
+    solClient_returnCode_t rc;
+    solClient_opaqueContainer_pt sub_p = NULL;
+
+    if ( shape_p->isStream ) {
+        rc = solClient_container_createStream ( container_pp, mem_p, size );
+    } else {
+        rc = solClient_container_createMap ( container_pp, mem_p, size );
+    }
+    if ( rc != SOLCLIENT_OK ) {
+        return rc;
+    }
+    if ( ( rc = addFields ( *container_pp, shape_p->numFields, shape_p->isStream ) ) != SOLCLIENT_OK || !shape_p->nested ) {
+        return rc;
+    }
+
+    if ( ( rc = solClient_container_openSubMap ( *container_pp, &sub_p, "subMap" ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    rc = addFields ( sub_p, shape_p->numFields, 0 );
+    solClient_container_closeMapStream ( &sub_p );
+    if ( rc != SOLCLIENT_OK ) {
+        return rc;
+    }
+    if ( ( rc = solClient_container_openSubStream ( *container_pp, &sub_p, "subStream" ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    rc = addFields ( sub_p, shape_p->numFields, 1 );
+    solClient_container_closeMapStream ( &sub_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * Message operations
+ *****************************************************************************/
+static          solClient_returnCode_t
+opNoop ( struct benchState *state_p, int param )
+{
+    return SOLCLIENT_OK;
+}
+
+static          solClient_returnCode_t
+opAllocFree ( struct benchState *state_p, int param )
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_free ( &msg_p );
+}
+
+static          solClient_returnCode_t
+opDupFree ( struct benchState *state_p, int param )
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_dup ( state_p->sizedMsg_p[param], &msg_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_free ( &msg_p );
+}
+
+static          solClient_returnCode_t
+opAttachCopy ( struct benchState *state_p, int param )
+{
+    return solClient_msg_setBinaryAttachment ( state_p->workMsg_p, state_p->payload, payloadSizes[param] );
+}
+
+static          solClient_returnCode_t
+opAttachPtr ( struct benchState *state_p, int param )
+{
+    return solClient_msg_setBinaryAttachmentPtr ( state_p->workMsg_p, state_p->payload, payloadSizes[param] );
+}
+
+static          solClient_returnCode_t
+opAttachGet ( struct benchState *state_p, int param )
+{
+    void           *buf_p;
+    solClient_uint32_t size;
+
+    return solClient_msg_getBinaryAttachmentPtr ( state_p->sizedMsg_p[param], &buf_p, &size );
+}
+
+static          solClient_returnCode_t
+opAttachReset ( struct benchState *state_p, int param )
+{
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_setBinaryAttachment ( state_p->workMsg_p, state_p->payload, payloadSizes[param] ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_reset ( state_p->workMsg_p );
+}
+
+static          solClient_returnCode_t
+opHeadersSet ( struct benchState *state_p, int param )
+{
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_setDeliveryMode ( state_p->workMsg_p, SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setDestination ( state_p->workMsg_p, &state_p->destination,
+                                               sizeof ( state_p->destination ) ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setSenderId ( state_p->workMsg_p, "bench-sender" ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setSequenceNumber ( state_p->workMsg_p, 42 ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    return solClient_msg_setCorrelationId ( state_p->workMsg_p, "bench-correlation" );
+}
+
+static          solClient_returnCode_t
+opHeadersGet ( struct benchState *state_p, int param )
+{
+    solClient_returnCode_t rc;
+    solClient_uint32_t deliveryMode;
+    solClient_destination_t destination;
+    const char     *str_p;
+    solClient_int64_t seqNum;
+
+    if ( ( rc = solClient_msg_getDeliveryMode ( state_p->headerMsg_p, &deliveryMode ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_getDestination ( state_p->headerMsg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_getSenderId ( state_p->headerMsg_p, &str_p ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_getSequenceNumber ( state_p->headerMsg_p, &seqNum ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    return solClient_msg_getCorrelationId ( state_p->headerMsg_p, &str_p );
+}
+
+static          solClient_returnCode_t
+opEncode ( struct benchState *state_p, int param )
+{
+    solClient_bufInfo_t bufInfo;
+    solClient_opaqueDatablock_pt datab_p = NULL;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_encodeToSMF ( state_p->sizedMsg_p[param], &bufInfo, &datab_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_datablock_free ( &datab_p );
+}
+
+static          solClient_returnCode_t
+opDecode ( struct benchState *state_p, int param )
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_decodeFromSmf ( &state_p->smf[param], &msg_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_free ( &msg_p );
+}
+
+/*****************************************************************************
+ * Container operations
+ *****************************************************************************/
+static          solClient_returnCode_t
+opContainerBuild ( struct benchState *state_p, int param )
+{
+    solClient_opaqueContainer_pt container_p = NULL;
+    solClient_returnCode_t rc;
+
+    rc = buildShape ( &containerShapes[param], state_p->buildMem, sizeof ( state_p->buildMem ), &container_p );
+    if ( container_p != NULL ) {
+        noteHeld ( state_p );
+        solClient_container_closeMapStream ( &container_p );
+    }
+    return rc;
+}
+
+static          solClient_returnCode_t
+opContainerIterate ( struct benchState *state_p, int param )
+{
+    solClient_field_t field;
+    const char     *name_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_container_rewind ( state_p->shape_p[param] ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    while ( ( rc = solClient_container_getNextField ( state_p->shape_p[param], &field, sizeof ( field ), &name_p ) ) == SOLCLIENT_OK ) {
+        /* Nested containers are opened for the caller. */
+        if ( field.type == SOLCLIENT_MAP || field.type == SOLCLIENT_STREAM ) {
+            noteHeld ( state_p );
+            solClient_container_closeMapStream ( &field.value.map );
+        }
+    }
+    return ( rc == SOLCLIENT_EOS ) ? SOLCLIENT_OK : rc;
+}
+
+static          solClient_returnCode_t
+opContainerLookup ( struct benchState *state_p, int param )
+{
+    solClient_int32_t value;
+    solClient_returnCode_t rc;
+
+    /* A stream can only be read in order, from the start. */
+    if ( containerShapes[param].isStream ) {
+        if ( ( rc = solClient_container_rewind ( state_p->shape_p[param] ) ) != SOLCLIENT_OK ) {
+            return rc;
+        }
+        return solClient_container_getInt32 ( state_p->shape_p[param], &value, NULL );
+    }
+    /* Fields are added in order, so the last int32 field is the worst case for a map. */
+    return solClient_container_getInt32 ( state_p->shape_p[param], &value,
+                                          fieldNames[( ( containerShapes[param].numFields - 1 ) / 5 ) * 5] );
+}
+
+static          solClient_returnCode_t
+opMsgMapBuild ( struct benchState *state_p, int param )
+{
+    solClient_opaqueContainer_pt map_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_createBinaryAttachmentMap ( state_p->workMsg_p, &map_p, 1024 ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    if ( ( rc = addFields ( map_p, containerShapes[param].numFields, 0 ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_reset ( state_p->workMsg_p );
+}
+
+/*****************************************************************************
+ * Sample call sequences
+ *****************************************************************************/
+
+/* common_publishMessage(), up to the send. */
+static          solClient_returnCode_t
+opPublishMsg ( struct benchState *state_p, int param )
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    if ( ( rc = solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setBinaryAttachment ( msg_p, COMMON_ATTACHMENT_TEXT,
+                                                    ( solClient_uint32_t ) strlen ( COMMON_ATTACHMENT_TEXT ) ) ) != SOLCLIENT_OK ) {
+        solClient_msg_free ( &msg_p );
+        return rc;
+    }
+    rc = solClient_msg_setDestination ( msg_p, &state_p->destination, sizeof ( state_p->destination ) );
+    noteHeld ( state_p );
+    solClient_msg_free ( &msg_p );
+    return rc;
+}
+
+/* One iteration of the BasicRequestor request loop, up to the send. */
+static          solClient_returnCode_t
+opRrRequest ( struct benchState *state_p, int param )
+{
+    solClient_opaqueContainer_pt stream_p;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_setDestination ( state_p->workMsg_p, &state_p->destination,
+                                               sizeof ( state_p->destination ) ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_createBinaryAttachmentStream ( state_p->workMsg_p, &stream_p, 100 ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_addInt8 ( stream_p, ( solClient_int8_t ) plusOperation, NULL ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_addInt32 ( stream_p, 5, NULL ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_addInt32 ( stream_p, 7, NULL ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    return solClient_msg_reset ( state_p->workMsg_p );
+}
+
+/*
+ * The BasicReplier receive callback, up to the send. The request stream is
+ * closed at the end so that the next iteration reads it from the start; in
+ * the sample it is released when the API frees the message.
+ */
+static          solClient_returnCode_t
+opRrReply ( struct benchState *state_p, int param )
+{
+    solClient_opaqueContainer_pt stream_p;
+    solClient_opaqueContainer_pt replyStream_p;
+    solClient_opaqueMsg_pt replyMsg_p;
+    solClient_int8_t operation;
+    solClient_int32_t operand1;
+    solClient_int32_t operand2;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_getBinaryAttachmentStream ( state_p->requestMsg_p, &stream_p ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_getInt8 ( stream_p, &operation, NULL ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_getInt32 ( stream_p, &operand1, NULL ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_getInt32 ( stream_p, &operand2, NULL ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    noteHeld ( state_p );
+    solClient_container_closeMapStream ( &stream_p );
+
+    if ( ( rc = solClient_msg_alloc ( &replyMsg_p ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    if ( ( rc = solClient_msg_createBinaryAttachmentStream ( replyMsg_p, &replyStream_p, 32 ) ) == SOLCLIENT_OK &&
+         ( rc = solClient_container_addBoolean ( replyStream_p, 1, NULL ) ) == SOLCLIENT_OK ) {
+        rc = solClient_container_addDouble ( replyStream_p, ( double ) ( operand1 + operand2 ), NULL );
+    }
+    noteHeld ( state_p );
+    solClient_msg_free ( &replyMsg_p );
+    return rc;
+}
+
+/* BasicRequestor reading the reply; the stream is closed as in opRrReply(). */
+static          solClient_returnCode_t
+opRrParseReply ( struct benchState *state_p, int param )
+{
+    solClient_opaqueContainer_pt replyStream_p;
+    solClient_bool_t resultOk;
+    double          result;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_getBinaryAttachmentStream ( state_p->replyMsg_p, &replyStream_p ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_container_getBoolean ( replyStream_p, &resultOk, NULL ) ) != SOLCLIENT_OK ) {
+        return rc;
+    }
+    rc = solClient_container_getDouble ( replyStream_p, &result, NULL );
+    noteHeld ( state_p );
+    solClient_container_closeMapStream ( &replyStream_p );
+    return rc;
+}
+
+/*
+ * The benchmarks, in the order they run. A benchmark runs once per payload
+ * size, once per container shape, or once.
+ */
+#define PARAM_NONE      0
+#define PARAM_SIZE      1
+#define PARAM_SHAPE     2
+
+struct benchmark
+{
+    const char     *name_p;
+    benchOpFunc_t   op_p;
+    int             paramKind;
+};
+
+static const struct benchmark benchmarks[] = {
+    {"noop", opNoop, PARAM_NONE},
+    {"alloc-free", opAllocFree, PARAM_NONE},
+    {"dup-free", opDupFree, PARAM_SIZE},
+    {"attach-copy", opAttachCopy, PARAM_SIZE},
+    {"attach-ptr", opAttachPtr, PARAM_SIZE},
+    {"attach-get", opAttachGet, PARAM_SIZE},
+    {"attach-reset", opAttachReset, PARAM_SIZE},
+    {"headers-set", opHeadersSet, PARAM_NONE},
+    {"headers-get", opHeadersGet, PARAM_NONE},
+    {"encode", opEncode, PARAM_SIZE},
+    {"decode", opDecode, PARAM_SIZE},
+    {"container-build", opContainerBuild, PARAM_SHAPE},
+    {"container-iterate", opContainerIterate, PARAM_SHAPE},
+    {"container-lookup", opContainerLookup, PARAM_SHAPE},
+    {"msg-map-build", opMsgMapBuild, PARAM_SHAPE},
+    {"publish-msg", opPublishMsg, PARAM_NONE},
+    {"rr-request", opRrRequest, PARAM_NONE},
+    {"rr-reply", opRrReply, PARAM_NONE},
+    {"rr-parse-reply", opRrParseReply, PARAM_NONE}
+};
+#define NUM_BENCHMARKS ( ( int ) ( sizeof ( benchmarks ) / sizeof ( benchmarks[0] ) ) )
+
+/*****************************************************************************
+ * receivedCopy
+ *
+ * Round-trips a message through SMF so that it looks like one the API
+ * delivered to a receive callback.
+ *****************************************************************************/
+static          solClient_returnCode_t
+receivedCopy ( solClient_opaqueMsg_pt msg_p, solClient_opaqueMsg_pt * copy_pp )
+{
+    solClient_bufInfo_t bufInfo;
+    solClient_opaqueDatablock_pt datab_p = NULL;
+    solClient_returnCode_t rc;
+
+    if ( ( rc = solClient_msg_encodeToSMF ( msg_p, &bufInfo, &datab_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_encodeToSMF()" );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_decodeFromSmf ( &bufInfo, copy_pp ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_decodeFromSmf()" );
+    }
+    solClient_datablock_free ( &datab_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * setupState
+ *****************************************************************************/
+static          solClient_returnCode_t
+setupState ( struct benchState *state_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    int             i;
+
+    for ( i = 0; i < BENCH_MAX_PAYLOAD; i++ ) {
+        state_p->payload[i] = ( unsigned char ) i;
+    }
+    state_p->destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    state_p->destination.dest = BENCH_TOPIC;
+
+    for ( i = 0; i < NUM_PAYLOAD_SIZES; i++ ) {
+        if ( ( rc = solClient_msg_alloc ( &state_p->sizedMsg_p[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_alloc()" );
+            return rc;
+        }
+        solClient_msg_setDeliveryMode ( state_p->sizedMsg_p[i], SOLCLIENT_DELIVERY_MODE_DIRECT );
+        solClient_msg_setDestination ( state_p->sizedMsg_p[i], &state_p->destination, sizeof ( state_p->destination ) );
+        solClient_msg_setBinaryAttachment ( state_p->sizedMsg_p[i], state_p->payload, payloadSizes[i] );
+        if ( ( rc = solClient_msg_encodeToSMF ( state_p->sizedMsg_p[i], &state_p->smf[i], &state_p->smfDatab_p[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_encodeToSMF()" );
+            return rc;
+        }
+    }
+
+    if ( ( rc = solClient_msg_alloc ( &state_p->workMsg_p ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_alloc ( &state_p->headerMsg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    if ( ( rc = opHeadersSet ( state_p, 0 ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_dup ( state_p->workMsg_p, &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "building the header message" );
+        return rc;
+    }
+    solClient_msg_free ( &state_p->headerMsg_p );
+    state_p->headerMsg_p = msg_p;
+    solClient_msg_reset ( state_p->workMsg_p );
+
+    /* The request as BasicReplier receives it. */
+    {
+        solClient_opaqueContainer_pt stream_p;
+
+        solClient_msg_setDestination ( state_p->workMsg_p, &state_p->destination, sizeof ( state_p->destination ) );
+        solClient_msg_createBinaryAttachmentStream ( state_p->workMsg_p, &stream_p, 100 );
+        solClient_container_addInt8 ( stream_p, ( solClient_int8_t ) plusOperation, NULL );
+        solClient_container_addInt32 ( stream_p, 5, NULL );
+        solClient_container_addInt32 ( stream_p, 7, NULL );
+        if ( ( rc = receivedCopy ( state_p->workMsg_p, &state_p->requestMsg_p ) ) != SOLCLIENT_OK ) {
+            return rc;
+        }
+        solClient_msg_reset ( state_p->workMsg_p );
+
+        /* The reply as BasicRequestor receives it. */
+        solClient_msg_setDestination ( state_p->workMsg_p, &state_p->destination, sizeof ( state_p->destination ) );
+        solClient_msg_createBinaryAttachmentStream ( state_p->workMsg_p, &stream_p, 32 );
+        solClient_container_addBoolean ( stream_p, 1, NULL );
+        solClient_container_addDouble ( stream_p, 12.0, NULL );
+        if ( ( rc = receivedCopy ( state_p->workMsg_p, &state_p->replyMsg_p ) ) != SOLCLIENT_OK ) {
+            return rc;
+        }
+        solClient_msg_reset ( state_p->workMsg_p );
+    }
+
+    for ( i = 0; i < NUM_CONTAINER_SHAPES; i++ ) {
+        if ( ( rc = buildShape ( &containerShapes[i], state_p->shapeMem[i], BENCH_CONTAINER_BYTES,
+                                 &state_p->shape_p[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "building a container" );
+            return rc;
+        }
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * freeState
+ *****************************************************************************/
+static void
+freeState ( struct benchState *state_p )
+{
+    int             i;
+
+    for ( i = 0; i < NUM_PAYLOAD_SIZES; i++ ) {
+        if ( state_p->smfDatab_p[i] != NULL ) {
+            solClient_datablock_free ( &state_p->smfDatab_p[i] );
+        }
+        if ( state_p->sizedMsg_p[i] != NULL ) {
+            solClient_msg_free ( &state_p->sizedMsg_p[i] );
+        }
+    }
+    for ( i = 0; i < NUM_CONTAINER_SHAPES; i++ ) {
+        if ( state_p->shape_p[i] != NULL ) {
+            solClient_container_closeMapStream ( &state_p->shape_p[i] );
+        }
+    }
+    if ( state_p->workMsg_p != NULL ) {
+        solClient_msg_free ( &state_p->workMsg_p );
+    }
+    if ( state_p->headerMsg_p != NULL ) {
+        solClient_msg_free ( &state_p->headerMsg_p );
+    }
+    if ( state_p->requestMsg_p != NULL ) {
+        solClient_msg_free ( &state_p->requestMsg_p );
+    }
+    if ( state_p->replyMsg_p != NULL ) {
+        solClient_msg_free ( &state_p->replyMsg_p );
+    }
+}
+
+/*****************************************************************************
+ * perOp
+ *
+ * The change of a statistic per operation; a count in use may go down.
+ *****************************************************************************/
+static double
+perOp ( solClient_uint64_t before, solClient_uint64_t after, int numOps )
+{
+    return ( ( double ) after - ( double ) before ) / numOps;
+}
+
+/*****************************************************************************
+ * runBenchmark
+ *
+ * Warms up the API free lists, then times numOps operations. perf_p is
+ * NULL without --perf.
+ *****************************************************************************/
+static void
+runBenchmark ( struct benchState *state_p, const struct benchmark *bench_p, int param, const char *paramName_p, int numOps,
+               struct perfCount *perf_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    struct allocCounts before;
+    struct allocCounts after;
+    struct allocCounts held;
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    struct perfCountValues counts;
+    int             i;
+
+    for ( i = 0; i < numOps / 10 + 1 && rc == SOLCLIENT_OK; i++ ) {
+        rc = bench_p->op_p ( state_p, param );
+    }
+
+    allocCounters ( &before );
+    if ( perf_p != NULL ) {
+        perfcount_start ( perf_p );
+    }
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numOps && rc == SOLCLIENT_OK; i++ ) {
+        rc = bench_p->op_p ( state_p, param );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    if ( perf_p != NULL ) {
+        perfcount_stop ( perf_p, &counts );
+    }
+    allocCounters ( &after );
+
+    /* One more, untimed, for the data blocks and containers it holds at once. */
+    if ( rc == SOLCLIENT_OK ) {
+        allocCounters ( &state_p->held );
+        held = state_p->held;
+        state_p->probing = 1;
+        rc = bench_p->op_p ( state_p, param );
+        noteHeld ( state_p );
+        state_p->probing = 0;
+    }
+
+    if ( rc != SOLCLIENT_OK ) {
+        common_handleError ( rc, bench_p->name_p );
+        printf ( "%-18s %-8s failed after %d ops\n", bench_p->name_p, paramName_p, i );
+        return;
+    }
+    printf ( "%-18s %-8s %10d %10.1f %10.2f %11.2f %11llu %11llu\n", bench_p->name_p, paramName_p, numOps,
+             ( double ) elapsedNs / numOps, perOp ( before.msgs, after.msgs, numOps ),
+             perOp ( before.reallocs, after.reallocs, numOps ),
+             ( unsigned long long ) ( state_p->held.blocks - held.blocks ),
+             ( unsigned long long ) ( state_p->held.containers - held.containers ) );
+    if ( perf_p != NULL ) {
+        perfcount_print ( stdout, "    ", &counts, numOps, "op" );
+    }
+    fflush ( stdout );
+}
+
+/*****************************************************************************
+ * isSelected
+ *****************************************************************************/
+static int
+isSelected ( const char *name_p, int argc, char *argv[] )
+{
+    int             i;
+
+    if ( optind >= argc ) {
+        return 1;
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strcmp ( argv[i], name_p ) == 0 ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ * fn main()
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    struct benchState *state_p = NULL;
+    const struct benchmark *bench_p;
+    struct perfCount perf;
+    struct perfCount *perf_p = NULL;
+    char            paramName[16];
+    int             numOps;
+    int             b;
+    int             p;
+
+    printf ( "\nMsgApiPerf.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( NUM_MSGS_MASK | LOG_LEVEL_MASK | PERF_COUNTERS_MASK ) );    /* optional parameters */
+    commandOpts.numMsgsToSend = 1000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tBENCHMARK...        Benchmarks to run (default: all). -n is the number\n"
+                                      "\t                    of operations per benchmark (default 1000000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API; no Context or Session is needed
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    if ( ( state_p = ( struct benchState * ) calloc ( 1, sizeof ( *state_p ) ) ) == NULL ) {
+        printf ( "Could not allocate the benchmark state\n" );
+        goto cleanup;
+    }
+    if ( setupState ( state_p ) != SOLCLIENT_OK ) {
+        goto freeState;
+    }
+    if ( commandOpts.perfCounters && perfcount_open ( &perf ) == SOLCLIENT_OK ) {
+        perf_p = &perf;
+    }
+
+    /*************************************************************************
+     * Run the benchmarks
+     *************************************************************************/
+    printf ( "%-18s %-8s %10s %10s %10s %11s %11s %11s\n", "benchmark", "param", "ops", "ns/op", "allocs/op",
+             "reallocs/op", "blocks held", "conts held" );
+    for ( b = 0; b < NUM_BENCHMARKS; b++ ) {
+        bench_p = &benchmarks[b];
+        if ( !isSelected ( bench_p->name_p, argc, argv ) ) {
+            continue;
+        }
+        switch ( bench_p->paramKind ) {
+            case PARAM_SIZE:
+                for ( p = 0; p < NUM_PAYLOAD_SIZES; p++ ) {
+                    /* Bound the bytes touched so that large payloads do not dominate the run time. */
+                    numOps = commandOpts.numMsgsToSend;
+                    if ( ( unsigned long long ) numOps * payloadSizes[p] > BENCH_BYTES_PER_RUN ) {
+                        numOps = ( int ) ( BENCH_BYTES_PER_RUN / payloadSizes[p] );
+                    }
+                    sprintf ( paramName, "%uB", payloadSizes[p] );
+                    runBenchmark ( state_p, bench_p, p, paramName, numOps > 0 ? numOps : 1, perf_p );
+                }
+                break;
+            case PARAM_SHAPE:
+                for ( p = 0; p < NUM_CONTAINER_SHAPES; p++ ) {
+                    runBenchmark ( state_p, bench_p, p, containerShapes[p].name_p, commandOpts.numMsgsToSend, perf_p );
+                }
+                break;
+            default:
+                runBenchmark ( state_p, bench_p, 0, "-", commandOpts.numMsgsToSend, perf_p );
+                break;
+        }
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+    if ( perf_p != NULL ) {
+        perfcount_close ( perf_p );
+    }
+
+  freeState:
+    freeState ( state_p );
+    free ( state_p );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
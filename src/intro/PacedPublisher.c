@@ -0,0 +1,245 @@
+/** @example Intro/PacedPublisher.c
+ */
+
+/*
+ * This sample publishes Direct messages at the rate given by --mr on an
+ * open-loop timeline (see pacer.h), with constant, Poisson or burst-train
+ * arrivals, and reports the rate achieved together with how late and how
+ * unevenly the sends went out.
+ *
+ * Without --cip nothing is sent: each pattern is paced on its own, and the
+ * constant pattern once more with sleeping only, to show what the spin
+ * margin buys.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "pacer.h"
+#include "getopt.h"
+
+#define MAX_PAYLOAD_SIZE        65536
+
+/*****************************************************************************
+ * paceOnly
+ *
+ * Paces numSends sends that do nothing. A spinNs of 0 sleeps only.
+ *****************************************************************************/
+static void
+paceOnly ( double rate, int pattern, unsigned int burstSize, int spin, int numSends )
+{
+    struct pacer    pacer;
+    int             i;
+
+    if ( pacer_init ( &pacer, rate, pattern, burstSize ) != SOLCLIENT_OK ) {
+        return;
+    }
+    if ( !spin ) {
+        pacer.spinNs = 0;
+        printf ( "sleep only:\n" );
+    }
+    pacer_start ( &pacer );
+    for ( i = 0; i < numSends; i++ ) {
+        pacer_wait ( &pacer );
+    }
+    pacer_printStats ( &pacer );
+    fflush ( stdout );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to publish to.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Message */
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    static char     payload[MAX_PAYLOAD_SIZE];
+
+    /* Pacing */
+    struct pacer    pacer;
+    const char     *pattern_p = "constant";
+    unsigned int    burstSize = PACER_DEFAULT_BURST_SIZE;
+    int             size = 100;
+    int             spin = 1;
+    int             pattern;
+    int             i;
+
+    printf ( "\nPacedPublisher.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  MSG_RATE_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 100000;
+    commandOpts.msgRate = 10000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tpattern=PATTERN     constant, poisson or burst (default constant).\n"
+                                      "\tburst=N             Messages per burst train (default 10).\n"
+                                      "\tsize=N              Payload size (default 100).\n"
+                                      "\tspin=0|1            Spin before each send, or sleep only (default 1).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "pattern=", 8 ) == 0 ) {
+            pattern_p = argv[i] + 8;
+        } else if ( strncmp ( argv[i], "burst=", 6 ) == 0 ) {
+            burstSize = ( unsigned int ) atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            size = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "spin=", 5 ) == 0 ) {
+            spin = atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( ( pattern = pacer_patternFromString ( pattern_p ) ) < 0 || burstSize < 1 || size < 0 ||
+         size > MAX_PAYLOAD_SIZE || commandOpts.numMsgsToSend < 2 ) {
+        printf ( "Invalid arguments: pattern constant, poisson or burst, burst >= 1, size 0..%d, -n >= 2\n",
+                 MAX_PAYLOAD_SIZE );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Publishing requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Pacing alone
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        printf ( "Pacing %d sends at %d/s without a broker\n", commandOpts.numMsgsToSend, commandOpts.msgRate );
+        paceOnly ( commandOpts.msgRate, PACER_CONSTANT, burstSize, 1, commandOpts.numMsgsToSend );
+        paceOnly ( commandOpts.msgRate, PACER_POISSON, burstSize, 1, commandOpts.numMsgsToSend );
+        paceOnly ( commandOpts.msgRate, PACER_BURST, burstSize, 1, commandOpts.numMsgsToSend );
+        paceOnly ( commandOpts.msgRate, PACER_CONSTANT, burstSize, 0, commandOpts.numMsgsToSend );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Build the message once
+     *************************************************************************/
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        goto sessionConnected;
+    }
+    if ( ( rc = solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDeliveryMode()" );
+        goto freeMsg;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = commandOpts.destinationName;
+    if ( ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDestination()" );
+        goto freeMsg;
+    }
+    if ( ( rc = solClient_msg_setBinaryAttachmentPtr ( msg_p, payload, ( solClient_uint32_t ) size ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setBinaryAttachmentPtr()" );
+        goto freeMsg;
+    }
+
+    /*************************************************************************
+     * Publish on the timeline
+     *************************************************************************/
+    if ( pacer_init ( &pacer, commandOpts.msgRate, pattern, burstSize ) != SOLCLIENT_OK ) {
+        goto freeMsg;
+    }
+    if ( !spin ) {
+        pacer.spinNs = 0;
+    }
+    printf ( "Publishing %d messages of %d bytes to '%s' at %d/s, %s\n", commandOpts.numMsgsToSend, size,
+             commandOpts.destinationName, commandOpts.msgRate, pacer_patternToString ( pattern ) );
+    pacer_start ( &pacer );
+    for ( i = 0; i < commandOpts.numMsgsToSend; i++ ) {
+        pacer_wait ( &pacer );
+        if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_sendMsg()" );
+            break;
+        }
+    }
+    pacer_printStats ( &pacer );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  freeMsg:
+    if ( ( rc = solClient_msg_free ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_free()" );
+    }
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
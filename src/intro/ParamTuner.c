@@ -0,0 +1,749 @@
+/** @example Intro/ParamTuner.c
+ */
+
+/*
+ * This sample searches Session and Flow settings for the best Guaranteed
+ * messaging throughput, or the lowest 99th percentile latency at the rate
+ * given by --mr, within a budget of trials (see tune.h). The settings tuned
+ * are the publisher window, the Session buffer, the socket send and receive
+ * buffers, and the Flow window, acknowledgement threshold, acknowledgement
+ * timer and maximum unacknowledged messages. The best configuration is
+ * printed as NAME=VALUE lines, which out=PATH also writes to a file.
+ *
+ * With --cip, each trial creates a Session with the settings on a shared
+ * Context, binds a Flow with them to a temporary Queue, and publishes --mn
+ * Persistent messages to it, paced at --mr for the p99 objective. Each
+ * message carries its send time; the Flow callback acknowledges it and
+ * records its latency.
+ *
+ * Without --cip the trials run against a model of the same pipeline in
+ * virtual time: publisher window, Session buffer and TCP windows on the way
+ * to the broker, spooling, and Flow window, TCP window and batched
+ * acknowledgements on the way back, with the round trip time, bandwidth and
+ * per-message costs given on the command line. The model is deterministic,
+ * so a whole search takes a fraction of a second and shows how the
+ * settings trade off, not what a given broker will do.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "pacer.h"
+#include "tune.h"
+#include "getopt.h"
+
+#define MAX_PAYLOAD_SIZE        65536
+#define MSG_OVERHEAD            64          /**< Header bytes added to each message on the wire. */
+#define OS_SOCKET_BUF_SIZE      212992      /**< Assumed when a socket buffer is left at 0. */
+#define LIVE_IDLE_TIMEOUT_MS    5000        /**< Give up on a trial after this long without a message. */
+
+/* The tuned parameters, in the order they are added. */
+#define P_PUB_WINDOW            0
+#define P_BUFFER                1
+#define P_SOCKET_SEND_BUF       2
+#define P_SOCKET_RCV_BUF        3
+#define P_FLOW_WINDOW           4
+#define P_ACK_THRESHOLD         5
+#define P_ACK_TIMER             6
+#define P_MAX_UNACKED           7
+
+/**
+ * @struct model
+ * The stand-in pipeline, and its per-message timelines in ns.
+ */
+struct model
+{
+    double          rttNs;
+    double          bytesPerNs;
+    double          persistNs;          /**< Broker cost to spool a message. */
+    double          processNs;          /**< Application cost per message. */
+    double          ackNs;              /**< API cost to send a Flow acknowledgement. */
+    double          rate;               /**< Offered messages per second, 0 for as fast as possible. */
+    int             size;
+    int             numMsgs;
+    double         *sockWrite_p;        /**< Left the Session buffer for the socket. */
+    double         *wireEnd_p;          /**< Fully on the wire to the broker. */
+    double         *persist_p;          /**< Spooled. */
+    double         *ackSent_p;          /**< The Flow acknowledgement covering it went out. */
+    double         *procStart_p;        /**< Handed to the application. */
+    double         *procEnd_p;          /**< Processed. */
+    double         *latencyUs_p;
+};
+
+/**
+ * @struct liveTrial
+ */
+struct liveTrial
+{
+    struct commonOptions *commandOpts_p;
+    solClient_opaqueContext_pt context_p;
+    double          rate;
+    int             size;
+    int             numMsgs;
+    double         *latencyUs_p;
+    volatile int    received;
+    volatile int    rejected;
+    volatile solClient_uint64_t lastRxNs;
+};
+
+/*****************************************************************************
+ * compareDouble
+ *****************************************************************************/
+static int
+compareDouble ( const void *a_p, const void *b_p )
+{
+    double          a = *( const double * ) a_p;
+    double          b = *( const double * ) b_p;
+
+    return ( a < b ) ? -1 : ( a > b );
+}
+
+/*****************************************************************************
+ * setPercentiles
+ *
+ * Sorts the latencies in place.
+ *****************************************************************************/
+static void
+setPercentiles ( double *latencyUs_p, int count, struct tuneResult *result_p )
+{
+    if ( count == 0 ) {
+        return;
+    }
+    qsort ( latencyUs_p, count, sizeof ( double ), compareDouble );
+    result_p->p50Us = latencyUs_p[( count - 1 ) / 2];
+    result_p->p99Us = latencyUs_p[( int ) ( ( count - 1 ) * 0.99 )];
+}
+
+/*****************************************************************************
+ * maxDouble
+ *****************************************************************************/
+static double
+maxDouble ( double a, double b )
+{
+    return ( a > b ) ? a : b;
+}
+
+/*****************************************************************************
+ * bufferMsgs
+ *
+ * How many messages of the given size fit in a buffer, at least one.
+ *****************************************************************************/
+static int
+bufferMsgs ( int bufferSize, int msgBytes )
+{
+    int             msgs;
+
+    if ( bufferSize == 0 ) {
+        bufferSize = OS_SOCKET_BUF_SIZE;
+    }
+    msgs = bufferSize / msgBytes;
+    return ( msgs < 1 ) ? 1 : msgs;
+}
+
+/*****************************************************************************
+ * model_closeBatch
+ *
+ * Sends the Flow acknowledgement for messages first..last at ackTime.
+ *****************************************************************************/
+static void
+model_closeBatch ( struct model *model_p, int first, int last, double ackTime )
+{
+    int             i;
+
+    for ( i = first; i <= last; i++ ) {
+        model_p->ackSent_p[i] = ackTime;
+    }
+}
+
+/*****************************************************************************
+ * modelTrial
+ *
+ * Runs the messages through the pipeline model, in order. Each stage starts
+ * a message once the previous message left it and once the window or buffer
+ * in front of it has room: a message is held back until the one a window
+ * size earlier was acknowledged, or a buffer size earlier was drained.
+ *****************************************************************************/
+static void
+modelTrial ( const int *values_p, struct tuneResult *result_p, void *user_p )
+{
+    struct model   *model_p = ( struct model * ) user_p;
+    int             msgBytes = model_p->size + MSG_OVERHEAD;
+    double          halfRtt = model_p->rttNs / 2;
+    double          wireNs = msgBytes / model_p->bytesPerNs;
+    int             pubWindow = values_p[P_PUB_WINDOW];
+    int             bufferMsgsPub = bufferMsgs ( values_p[P_BUFFER], msgBytes );
+    int             sendMsgs = bufferMsgs ( values_p[P_SOCKET_SEND_BUF], msgBytes );
+    int             rcvMsgs = bufferMsgs ( values_p[P_SOCKET_RCV_BUF], msgBytes );
+    int             flowWindow = values_p[P_FLOW_WINDOW];
+    int             ackBatch = flowWindow * values_p[P_ACK_THRESHOLD] / 100;
+    double          ackTimerNs = values_p[P_ACK_TIMER] * 1000000.0;
+    double          ready = 0;
+    double          brokerSend = 0;
+    double          downWireEnd = 0;
+    double          busyUntil = 0;
+    int             batchFirst = -1;    /* Oldest message not yet acknowledged, -1 for none. */
+    int             acks = 0;
+    int             i;
+
+    if ( values_p[P_MAX_UNACKED] > 0 && values_p[P_MAX_UNACKED] < flowWindow ) {
+        flowWindow = values_p[P_MAX_UNACKED];
+    }
+    if ( ackBatch < 1 ) {
+        ackBatch = 1;
+    }
+
+    for ( i = 0; i < model_p->numMsgs; i++ ) {
+        double          arrival = ( model_p->rate > 0 ) ? i * 1e9 / model_p->rate : 0;
+        double          sockWrite;
+        double          wireStart;
+        double          recv;
+        double          start;
+
+        /* Publisher: the window and the Session buffer. */
+        ready = maxDouble ( arrival, ready );
+        if ( i >= pubWindow ) {
+            ready = maxDouble ( ready, model_p->persist_p[i - pubWindow] + halfRtt );
+        }
+        if ( i >= bufferMsgsPub ) {
+            ready = maxDouble ( ready, model_p->sockWrite_p[i - bufferMsgsPub] );
+        }
+        /* The socket takes it once TCP has room: sendMsgs unacknowledged bytes. */
+        sockWrite = ready;
+        if ( i > 0 ) {
+            sockWrite = maxDouble ( sockWrite, model_p->sockWrite_p[i - 1] );
+        }
+        if ( i >= sendMsgs ) {
+            sockWrite = maxDouble ( sockWrite, model_p->wireEnd_p[i - sendMsgs] + model_p->rttNs );
+        }
+        model_p->sockWrite_p[i] = sockWrite;
+        wireStart = ( i > 0 ) ? maxDouble ( sockWrite, model_p->wireEnd_p[i - 1] ) : sockWrite;
+        model_p->wireEnd_p[i] = wireStart + wireNs;
+
+        /* Broker: spool, then deliver within the Flow window and the receiver's TCP window. */
+        model_p->persist_p[i] = maxDouble ( model_p->wireEnd_p[i] + halfRtt,
+                                            ( i > 0 ) ? model_p->persist_p[i - 1] : 0 ) + model_p->persistNs;
+        brokerSend = maxDouble ( model_p->persist_p[i], brokerSend );
+        if ( i >= flowWindow ) {
+            int             credit = i - flowWindow;
+
+            if ( batchFirst >= 0 && credit >= batchFirst ) {
+                /* Out of credit with the acknowledgement still pending: the timer sends it. */
+                double          ackTime = maxDouble ( model_p->procEnd_p[batchFirst] + ackTimerNs,
+                                                      model_p->procEnd_p[i - 1] );
+
+                model_closeBatch ( model_p, batchFirst, i - 1, ackTime );
+                busyUntil = ackTime + model_p->ackNs;
+                batchFirst = -1;
+                acks++;
+            }
+            brokerSend = maxDouble ( brokerSend, model_p->ackSent_p[credit] + halfRtt );
+        }
+        if ( i >= rcvMsgs ) {
+            brokerSend = maxDouble ( brokerSend, model_p->procStart_p[i - rcvMsgs] + halfRtt );
+        }
+        downWireEnd = maxDouble ( brokerSend, downWireEnd ) + wireNs;
+        recv = downWireEnd + halfRtt;
+
+        /* Application: the timer may fire before this message is taken. */
+        start = maxDouble ( recv, ( i > 0 ) ? model_p->procEnd_p[i - 1] : 0 );
+        if ( batchFirst >= 0 && model_p->procEnd_p[batchFirst] + ackTimerNs <= start ) {
+            double          ackTime = maxDouble ( model_p->procEnd_p[batchFirst] + ackTimerNs,
+                                                  model_p->procEnd_p[i - 1] );
+
+            model_closeBatch ( model_p, batchFirst, i - 1, ackTime );
+            busyUntil = ackTime + model_p->ackNs;
+            batchFirst = -1;
+            acks++;
+        }
+        start = maxDouble ( start, busyUntil );
+        model_p->procStart_p[i] = start;
+        model_p->procEnd_p[i] = start + model_p->processNs;
+        if ( batchFirst < 0 ) {
+            batchFirst = i;
+        }
+        if ( i - batchFirst + 1 >= ackBatch ) {
+            model_closeBatch ( model_p, batchFirst, i, model_p->procEnd_p[i] );
+            model_p->procEnd_p[i] += model_p->ackNs;
+            batchFirst = -1;
+            acks++;
+        }
+        model_p->latencyUs_p[i] = ( model_p->procEnd_p[i] - arrival ) / 1000.0;
+    }
+    if ( batchFirst >= 0 ) {
+        acks++;
+    }
+
+    result_p->ok = 1;
+    result_p->msgsPerSec = model_p->numMsgs * 1e9 / model_p->procEnd_p[model_p->numMsgs - 1];
+    result_p->acksPerMsg = ( double ) acks / model_p->numMsgs;
+    setPercentiles ( model_p->latencyUs_p, model_p->numMsgs, result_p );
+}
+
+/*****************************************************************************
+ * liveEventCallback
+ *****************************************************************************/
+static void
+liveEventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                    solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct liveTrial *live_p = ( struct liveTrial * ) user_p;
+
+    if ( eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_ACKNOWLEDGEMENT ) {
+        return;
+    }
+    if ( eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_REJECTED_MSG_ERROR ) {
+        live_p->rejected++;
+    }
+    common_eventCallback ( opaqueSession_p, eventInfo_p, user_p );
+}
+
+/*****************************************************************************
+ * liveRxCallback
+ *
+ * Records the latency of each message and acknowledges it.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+liveRxCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct liveTrial *live_p = ( struct liveTrial * ) user_p;
+    solClient_uint64_t now = os_getTimeNs (  );
+    solClient_uint64_t sentNs;
+    solClient_msgId_t msgId;
+    void           *data_p;
+    solClient_uint32_t size;
+
+    if ( live_p->received < live_p->numMsgs &&
+         solClient_msg_getBinaryAttachmentPtr ( msg_p, &data_p, &size ) == SOLCLIENT_OK && size >= sizeof ( sentNs ) ) {
+        memcpy ( &sentNs, data_p, sizeof ( sentNs ) );
+        live_p->latencyUs_p[live_p->received] = ( double ) ( now - sentNs ) / 1000.0;
+        live_p->received++;
+    }
+    live_p->lastRxNs = now;
+    if ( solClient_msg_getMsgId ( msg_p, &msgId ) == SOLCLIENT_OK ) {
+        solClient_flow_sendAck ( opaqueFlow_p, msgId );
+    }
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * liveTrial
+ *
+ * One Session and Flow per trial, created with the settings under test.
+ *****************************************************************************/
+static void
+liveTrial ( const int *values_p, struct tuneResult *result_p, void *user_p )
+{
+    struct liveTrial *live_p = ( struct liveTrial * ) user_p;
+    struct commonOptions *commonOpts = live_p->commandOpts_p;
+    solClient_returnCode_t rc;
+    solClient_opaqueSession_pt session_p;
+    solClient_session_createFuncInfo_t sessionFuncInfo = SOLCLIENT_SESSION_CREATEFUNC_INITIALIZER;
+    solClient_opaqueFlow_pt flow_p;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    const char     *props[50] = {0, };
+    char            values[TUNE_MAX_PARAMS][16];
+    int             propIndex = 0;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    static char     payload[MAX_PAYLOAD_SIZE];
+    struct pacer    pacer;
+    solClient_uint64_t startNs;
+    solClient_uint64_t endNs;
+    solClient_uint64_t sentNs;
+    int             p;
+    int             i;
+
+    for ( p = 0; p <= P_MAX_UNACKED; p++ ) {
+        sprintf ( values[p], "%d", values_p[p] );
+    }
+    live_p->received = 0;
+    live_p->rejected = 0;
+    live_p->lastRxNs = os_getTimeNs (  );
+
+    sessionFuncInfo.rxMsgInfo.callback_p = common_messageReceivePerfCallback;
+    sessionFuncInfo.eventInfo.callback_p = liveEventCallback;
+    sessionFuncInfo.eventInfo.user_p = live_p;
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_HOST;
+    props[propIndex++] = commonOpts->targetHost;
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_COMPRESSION_LEVEL;
+    props[propIndex++] = ( commonOpts->enableCompression ) ? "9" : "0";
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_CONNECT_RETRIES;
+    props[propIndex++] = "3";
+    if ( commonOpts->vpn[0] ) {
+        props[propIndex++] = SOLCLIENT_SESSION_PROP_VPN_NAME;
+        props[propIndex++] = commonOpts->vpn;
+    }
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_SSL_VALIDATE_CERTIFICATE;
+    props[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_USERNAME;
+    props[propIndex++] = commonOpts->username;
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_PASSWORD;
+    props[propIndex++] = commonOpts->password;
+    if ( commonOpts->useGSS ) {
+        props[propIndex++] = SOLCLIENT_SESSION_PROP_AUTHENTICATION_SCHEME;
+        props[propIndex++] = SOLCLIENT_SESSION_PROP_AUTHENTICATION_SCHEME_GSS_KRB;
+    }
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_PUB_WINDOW_SIZE;
+    props[propIndex++] = values[P_PUB_WINDOW];
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_BUFFER_SIZE;
+    props[propIndex++] = values[P_BUFFER];
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_SOCKET_SEND_BUF_SIZE;
+    props[propIndex++] = values[P_SOCKET_SEND_BUF];
+    props[propIndex++] = SOLCLIENT_SESSION_PROP_SOCKET_RCV_BUF_SIZE;
+    props[propIndex++] = values[P_SOCKET_RCV_BUF];
+    if ( ( rc = solClient_session_create ( ( char ** ) props, live_p->context_p, &session_p,
+                                           &sessionFuncInfo, sizeof ( sessionFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_create()" );
+        return;
+    }
+    if ( ( rc = solClient_session_connect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_connect()" );
+        goto destroySession;
+    }
+
+    /* A temporary Queue, so that no trial sees messages left by another. */
+    flowFuncInfo.rxMsgInfo.callback_p = liveRxCallback;
+    flowFuncInfo.rxMsgInfo.user_p = live_p;
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+    propIndex = 0;
+    memset ( props, 0, sizeof ( props ) );
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_BLOCKING;
+    props[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_DURABLE;
+    props[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE_CLIENT;
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_WINDOWSIZE;
+    props[propIndex++] = values[P_FLOW_WINDOW];
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_ACK_THRESHOLD;
+    props[propIndex++] = values[P_ACK_THRESHOLD];
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_ACK_TIMER_MS;
+    props[propIndex++] = values[P_ACK_TIMER];
+    props[propIndex++] = SOLCLIENT_FLOW_PROP_MAX_UNACKED_MESSAGES;
+    props[propIndex++] = values[P_MAX_UNACKED];
+    if ( ( rc = solClient_session_createFlow ( ( char ** ) props, session_p, &flow_p,
+                                               &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createFlow()" );
+        goto disconnect;
+    }
+    if ( ( rc = solClient_flow_getDestination ( flow_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_getDestination()" );
+        goto destroyFlow;
+    }
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        goto destroyFlow;
+    }
+    solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_PERSISTENT );
+    solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) );
+    solClient_msg_setBinaryAttachmentPtr ( msg_p, payload, ( solClient_uint32_t ) live_p->size );
+    if ( live_p->rate > 0 && pacer_init ( &pacer, live_p->rate, PACER_CONSTANT, 0 ) != SOLCLIENT_OK ) {
+        goto freeMsg;
+    }
+
+    /* Publish; with a rate, stamp the scheduled time so that a late send counts as latency. */
+    startNs = os_getTimeNs (  );
+    if ( live_p->rate > 0 ) {
+        pacer_start ( &pacer );
+    }
+    for ( i = 0; i < live_p->numMsgs; i++ ) {
+        sentNs = ( live_p->rate > 0 ) ? pacer_wait ( &pacer ) : os_getTimeNs (  );
+        memcpy ( payload, &sentNs, sizeof ( sentNs ) );
+        if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_sendMsg()" );
+            goto freeMsg;
+        }
+    }
+    while ( live_p->received < live_p->numMsgs &&
+            os_getTimeNs (  ) - live_p->lastRxNs < LIVE_IDLE_TIMEOUT_MS * 1000000ULL ) {
+        OS_SLEEP_US ( 1000 );
+    }
+    endNs = live_p->lastRxNs;
+
+    if ( live_p->received < live_p->numMsgs || live_p->rejected > 0 ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "Trial received %d of %d messages, %d rejected", live_p->received,
+                        live_p->numMsgs, live_p->rejected );
+    } else {
+        result_p->ok = 1;
+        result_p->msgsPerSec = live_p->numMsgs * 1e9 / ( double ) ( endNs - startNs );
+        /* The API does not count the acknowledgements it sends to the broker. */
+        result_p->acksPerMsg = -1;
+        setPercentiles ( live_p->latencyUs_p, live_p->numMsgs, result_p );
+    }
+
+  freeMsg:
+    solClient_msg_free ( &msg_p );
+
+  destroyFlow:
+    if ( ( rc = solClient_flow_destroy ( &flow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+
+  disconnect:
+    solClient_session_disconnect ( session_p );
+
+  destroySession:
+    if ( ( rc = solClient_session_destroy ( &session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_destroy()" );
+    }
+}
+
+/*****************************************************************************
+ * addParams
+ *
+ * Candidates for each setting, in increasing order, with the API defaults.
+ *****************************************************************************/
+static          solClient_returnCode_t
+addParams ( struct tuner *tuner_p )
+{
+    if ( tune_addParam ( tuner_p, SOLCLIENT_SESSION_PROP_PUB_WINDOW_SIZE, "1,4,16,50,128,255",
+                         atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_PUB_WINDOW_SIZE ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_SESSION_PROP_BUFFER_SIZE, "16384,90000,262144,1048576,4194304",
+                         atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_BUFFER_SIZE ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_SESSION_PROP_SOCKET_SEND_BUF_SIZE, "16384,90000,262144,1048576,4194304",
+                         atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_SOCKET_SEND_BUF_SIZE ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_SESSION_PROP_SOCKET_RCV_BUF_SIZE, "16384,150000,262144,1048576,4194304",
+                         atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_SOCKET_RCV_BUF_SIZE ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_FLOW_PROP_WINDOWSIZE, "1,4,16,64,128,255",
+                         atoi ( SOLCLIENT_FLOW_PROP_DEFAULT_WINDOWSIZE ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_FLOW_PROP_ACK_THRESHOLD, "1,10,30,60,75",
+                         atoi ( SOLCLIENT_FLOW_PROP_DEFAULT_ACK_THRESHOLD ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_FLOW_PROP_ACK_TIMER_MS, "20,50,100,200,500,1000,1500",
+                         atoi ( SOLCLIENT_FLOW_PROP_DEFAULT_ACK_TIMER_MS ) ) != SOLCLIENT_OK ||
+         tune_addParam ( tuner_p, SOLCLIENT_FLOW_PROP_MAX_UNACKED_MESSAGES, "16,64,256,1024,-1",
+                         atoi ( SOLCLIENT_FLOW_PROP_DEFAULT_MAX_UNACKED_MESSAGES ) ) != SOLCLIENT_OK ) {
+        return SOLCLIENT_FAIL;
+    }
+    return SOLCLIENT_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Tuning */
+    struct tuner    tuner;
+    struct model    model;
+    struct liveTrial live;
+    const char     *objective_p = "throughput";
+    const char     *out_p = NULL;
+    const char     *sets[TUNE_MAX_PARAMS];
+    int             numSets = 0;
+    int             objective;
+    int             budget = 60;
+    double          rttUs = 1000;
+    double          bandwidthMBps = 125;
+    FILE           *out_fp;
+    int             i;
+
+    printf ( "\nParamTuner.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  MSG_RATE_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 20000;
+    commandOpts.msgRate = 0;
+    memset ( &model, 0, sizeof ( model ) );
+    memset ( &live, 0, sizeof ( live ) );
+    model.persistNs = 4000;
+    model.processNs = 2000;
+    model.ackNs = 3000;
+    model.size = 1024;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tobjective=OBJ       throughput, or p99 at the rate given by --mr (default throughput).\n"
+                                      "\tbudget=N            Trials (default 60).\n"
+                                      "\tsize=N              Payload size (default 1024).\n"
+                                      "\tset=NAME=V1,V2,...  Candidates for a tuned property, e.g. set=FLOW_WINDOWSIZE=8,64,255.\n"
+                                      "\tout=PATH            Also write the best settings to PATH.\n"
+                                      "\tWithout --cip, the model:\n"
+                                      "\trtt=US              Round trip time to the broker (default 1000).\n"
+                                      "\tbw=MBPS             Bandwidth in MB/s (default 125).\n"
+                                      "\tpersist=NS          Broker cost to spool a message (default 4000).\n"
+                                      "\tprocess=NS          Application cost per message (default 2000).\n"
+                                      "\tackcost=NS          Cost of sending a Flow acknowledgement (default 3000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "objective=", 10 ) == 0 ) {
+            objective_p = argv[i] + 10;
+        } else if ( strncmp ( argv[i], "budget=", 7 ) == 0 ) {
+            budget = atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            model.size = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "set=", 4 ) == 0 && numSets < TUNE_MAX_PARAMS ) {
+            sets[numSets++] = argv[i] + 4;
+        } else if ( strncmp ( argv[i], "out=", 4 ) == 0 ) {
+            out_p = argv[i] + 4;
+        } else if ( strncmp ( argv[i], "rtt=", 4 ) == 0 ) {
+            rttUs = atof ( argv[i] + 4 );
+        } else if ( strncmp ( argv[i], "bw=", 3 ) == 0 ) {
+            bandwidthMBps = atof ( argv[i] + 3 );
+        } else if ( strncmp ( argv[i], "persist=", 8 ) == 0 ) {
+            model.persistNs = atof ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "process=", 8 ) == 0 ) {
+            model.processNs = atof ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "ackcost=", 8 ) == 0 ) {
+            model.ackNs = atof ( argv[i] + 8 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( strcmp ( objective_p, "throughput" ) == 0 ) {
+        objective = TUNE_MAX_THROUGHPUT;
+    } else if ( strcmp ( objective_p, "p99" ) == 0 && commandOpts.msgRate > 0 ) {
+        objective = TUNE_MIN_P99;
+    } else {
+        printf ( "Invalid objective '%s': throughput, or p99 with --mr\n", objective_p );
+        exit ( 1 );
+    }
+    if ( model.size < ( int ) sizeof ( solClient_uint64_t ) || model.size > MAX_PAYLOAD_SIZE ||
+         commandOpts.numMsgsToSend < 1 || rttUs < 0 || bandwidthMBps <= 0 ) {
+        printf ( "Invalid arguments: size %d..%d, -n >= 1, rtt >= 0, bw > 0\n", ( int ) sizeof ( solClient_uint64_t ),
+                 MAX_PAYLOAD_SIZE );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 && commandOpts.username[0] == ( char ) 0 ) {
+        printf ( "Tuning against a broker requires --cu\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * The trials: the model, or Sessions on a broker
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        model.rttNs = rttUs * 1000.0;
+        model.bytesPerNs = bandwidthMBps * 1000000.0 / 1e9;
+        model.rate = commandOpts.msgRate;
+        model.numMsgs = commandOpts.numMsgsToSend;
+        model.sockWrite_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.wireEnd_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.persist_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.ackSent_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.procStart_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.procEnd_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        model.latencyUs_p = ( double * ) malloc ( model.numMsgs * sizeof ( double ) );
+        if ( model.sockWrite_p == NULL || model.wireEnd_p == NULL || model.persist_p == NULL ||
+             model.ackSent_p == NULL || model.procStart_p == NULL || model.procEnd_p == NULL ||
+             model.latencyUs_p == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate the model for %d messages", model.numMsgs );
+            goto freeModel;
+        }
+        printf ( "Tuning against the model: %d messages of %d bytes, rtt %.0f us, %.0f MB/s, spool %.0f ns, "
+                 "process %.0f ns, ack %.0f ns per message\n", model.numMsgs, model.size, rttUs, bandwidthMBps,
+                 model.persistNs, model.processNs, model.ackNs );
+        rc = tune_init ( &tuner, objective, commandOpts.msgRate, budget, modelTrial, &model );
+    } else {
+        live.commandOpts_p = &commandOpts;
+        live.rate = ( objective == TUNE_MIN_P99 ) ? commandOpts.msgRate : 0;
+        live.size = model.size;
+        live.numMsgs = commandOpts.numMsgsToSend;
+        if ( ( live.latencyUs_p = ( double * ) malloc ( live.numMsgs * sizeof ( double ) ) ) == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate %d latencies", live.numMsgs );
+            goto cleanup;
+        }
+        if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                               &live.context_p, &contextFuncInfo,
+                                               sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_create()" );
+            goto freeModel;
+        }
+        printf ( "Tuning against %s: %d Persistent messages of %d bytes per trial\n", commandOpts.targetHost,
+                 live.numMsgs, live.size );
+        rc = tune_init ( &tuner, objective, commandOpts.msgRate, budget, liveTrial, &live );
+    }
+    if ( rc != SOLCLIENT_OK || addParams ( &tuner ) != SOLCLIENT_OK ) {
+        goto destroyTuner;
+    }
+    for ( i = 0; i < numSets; i++ ) {
+        if ( tune_setValues ( &tuner, sets[i] ) != SOLCLIENT_OK ) {
+            goto destroyTuner;
+        }
+    }
+
+    /*************************************************************************
+     * Search
+     *************************************************************************/
+    if ( tune_run ( &tuner ) == SOLCLIENT_OK ) {
+        printf ( "\n" );
+        tune_printBest ( &tuner, stdout );
+        if ( out_p != NULL ) {
+            if ( ( out_fp = fopen ( out_p, "w" ) ) == NULL ) {
+                solClient_log ( SOLCLIENT_LOG_ERROR, "Could not open '%s'", out_p );
+            } else {
+                tune_printBest ( &tuner, out_fp );
+                fclose ( out_fp );
+                printf ( "Written to %s\n", out_p );
+            }
+        }
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroyTuner:
+    tune_destroy ( &tuner );
+
+  freeModel:
+    free ( model.sockWrite_p );
+    free ( model.wireEnd_p );
+    free ( model.persist_p );
+    free ( model.ackSent_p );
+    free ( model.procStart_p );
+    free ( model.procEnd_p );
+    free ( model.latencyUs_p );
+    /* solClient_cleanup() destroys the Context. */
+    free ( live.latencyUs_p );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
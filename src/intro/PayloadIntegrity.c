@@ -0,0 +1,511 @@
+/** @example Intro/PayloadIntegrity.c
+ */
+
+/*
+ * This sample shows the payload integrity mode in common.h
+ * (common_integrityEnable()): a CRC32C trailer appended to each payload
+ * when published and verified when received. It publishes --mn messages
+ * of size=BYTES on --topic, with sequence numbers, and receives them on
+ * its own subscription; with corrupt=N it damages every Nth payload after
+ * sealing, and reports the corrupt messages found.
+ *
+ * Without --cip, it checks the hardware CRC against the software one,
+ * checks that a damaged payload is caught with its sequence number and
+ * topic, and measures for each of sizes=N,... the CRC throughput of the
+ * hardware, of the software tables and of a byte at a time, and what
+ * sealing and verifying add to setting and reading a binary attachment.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "getopt.h"
+
+#define DEFAULT_SIZES           "16,64,256,1024,4096,16384,65536,262144"
+#define DEFAULT_SIZE            256
+#define CHECK_SIZE              300
+#define MAX_SIZES               16
+#define BENCH_BYTES             ( 64 * 1024 * 1024 )
+#define BENCH_MIN_ITERATIONS    2000
+
+/*
+ * Received on the subscription.
+ */
+struct rxStats
+{
+    volatile solClient_uint64_t received;
+};
+
+/*****************************************************************************
+ * crc32cBytewise
+ *
+ * A byte at a time: what a plain checksum loop costs.
+ *****************************************************************************/
+static          solClient_uint32_t
+crc32cBytewise ( solClient_uint32_t crc, const void *data_p, size_t size )
+{
+    const unsigned char *p = ( const unsigned char * ) data_p;
+    int             bit;
+
+    crc = ~crc;
+    while ( size-- > 0 ) {
+        crc ^= *p++;
+        for ( bit = 0; bit < 8; bit++ ) {
+            crc = ( crc >> 1 ) ^ ( ( crc & 1 ) ? 0x82f63b78U : 0 );
+        }
+    }
+    return ~crc;
+}
+
+/*****************************************************************************
+ * fillRandom
+ *****************************************************************************/
+static void
+fillRandom ( unsigned char *buf_p, size_t size, solClient_uint64_t * x_p )
+{
+    size_t          i;
+
+    for ( i = 0; i < size; i++ ) {
+        buf_p[i] = ( unsigned char ) common_random ( x_p );
+    }
+}
+
+/*****************************************************************************
+ * checkCrc
+ *
+ * The check value of CRC32C, and the hardware against the software over
+ * random lengths and alignments, in one piece and in two.
+ *****************************************************************************/
+static int
+checkCrc ( void )
+{
+    unsigned char   buf[4096 + 8];
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_uint32_t hw;
+    size_t          offset;
+    size_t          size;
+    size_t          split;
+    int             failed = 0;
+    int             i;
+
+    if ( common_crc32c ( 0, "123456789", 9 ) != 0xe3069283U ||
+         common_crc32cSoftware ( 0, "123456789", 9 ) != 0xe3069283U || crc32cBytewise ( 0, "123456789", 9 ) != 0xe3069283U ) {
+        printf ( "CRC32C of \"123456789\" is not e3069283\n" );
+        return 0;
+    }
+    fillRandom ( buf, sizeof ( buf ), &x );
+    for ( i = 0; i < 10000; i++ ) {
+        common_random ( &x );
+        offset = ( size_t ) ( x & 7 );
+        size = ( size_t ) ( ( x >> 3 ) % 4096 );
+        split = ( size > 0 ) ? ( size_t ) ( ( x >> 20 ) % size ) : 0;
+        hw = common_crc32c ( common_crc32c ( 0, buf + offset, split ), buf + offset + split, size - split );
+        if ( hw != common_crc32cSoftware ( 0, buf + offset, size ) ) {
+            failed++;
+        }
+    }
+    printf ( "CRC32C (%s) matches the software on 10000 random buffers: %s\n", common_crc32cImplementation (  ),
+             ( failed == 0 ) ? "yes" : "NO" );
+    return failed == 0;
+}
+
+/*****************************************************************************
+ * checkDetection
+ *
+ * A sealed payload passes, the same with one bit flipped is caught with
+ * its sequence number and topic, and one with no room for a trailer is
+ * counted as missing.
+ *****************************************************************************/
+static int
+checkDetection ( void )
+{
+    struct commonIntegrityStats stats;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    unsigned char   payload[CHECK_SIZE + COMMON_INTEGRITY_TRAILER_LEN];
+    unsigned char  *ptr_p;
+    solClient_uint32_t size;
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_returnCode_t intact;
+    solClient_returnCode_t damaged;
+    solClient_returnCode_t shortened;
+    int             ok;
+
+    fillRandom ( payload, CHECK_SIZE, &x );
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = "acme/integrity/check";
+    common_integrityResetStats (  );
+    if ( solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ||
+         solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) != SOLCLIENT_OK ||
+         solClient_msg_setSequenceNumber ( msg_p, 42 ) != SOLCLIENT_OK ||
+         common_integritySetPayload ( msg_p, payload, CHECK_SIZE ) != SOLCLIENT_OK ) {
+        printf ( "Could not build a message\n" );
+        if ( msg_p != NULL ) {
+            solClient_msg_free ( &msg_p );
+        }
+        return 0;
+    }
+    intact = common_integrityCheck ( msg_p, NULL, NULL );
+    solClient_msg_getBinaryAttachmentPtr ( msg_p, ( void ** ) &ptr_p, &size );
+    ptr_p[123] ^= 0x10;
+    damaged = common_integrityCheck ( msg_p, NULL, NULL );
+    solClient_msg_setBinaryAttachment ( msg_p, payload, 2 );
+    shortened = common_integrityCheck ( msg_p, NULL, NULL );
+    solClient_msg_free ( &msg_p );
+
+    common_integrityGetStats ( &stats );
+    ok = intact == SOLCLIENT_OK && damaged == SOLCLIENT_FAIL && shortened == SOLCLIENT_NOT_FOUND &&
+        stats.checked == 1 && stats.corrupt == 1 && stats.missing == 1 && stats.lastCorruptSeq == 42 &&
+        strcmp ( stats.lastCorruptTopic, destination.dest ) == 0;
+    printf ( "One bit flipped in %d bytes: caught as sequence number %lld on '%s': %s\n", CHECK_SIZE,
+             ( long long ) stats.lastCorruptSeq, stats.lastCorruptTopic, ok ? "yes" : "NO" );
+    common_integrityResetStats (  );
+    return ok;
+}
+
+/*****************************************************************************
+ * benchCrc
+ *
+ * GB/s of a CRC function over size bytes, iterations times.
+ *****************************************************************************/
+static double
+benchCrc ( solClient_uint32_t ( *crc_p ) ( solClient_uint32_t, const void *, size_t ), const unsigned char *buf_p,
+           size_t size, solClient_uint64_t iterations )
+{
+    volatile solClient_uint32_t sink = 0;
+    solClient_uint64_t startNs;
+    solClient_uint64_t elapsedNs;
+    solClient_uint64_t i;
+
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < iterations; i++ ) {
+        sink ^= crc_p ( 0, buf_p, size );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    return ( double ) size * ( double ) iterations / ( double ) ( elapsedNs + 1 );
+}
+
+/*****************************************************************************
+ * benchMessages
+ *
+ * ns per message to set the payload and to read it back, with the
+ * integrity mode off or on.
+ *****************************************************************************/
+static void
+benchMessages ( solClient_opaqueMsg_pt msg_p, unsigned char *buf_p, solClient_uint32_t size,
+                solClient_uint64_t iterations, int integrity, double *setNs_p, double *getNs_p )
+{
+    solClient_uint64_t startNs;
+    solClient_uint64_t i;
+    void           *ptr_p;
+    solClient_uint32_t got;
+
+    common_integrityEnable ( integrity );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < iterations; i++ ) {
+        common_integritySetPayload ( msg_p, buf_p, size );
+    }
+    *setNs_p = ( double ) ( os_getTimeNs (  ) - startNs ) / ( double ) iterations;
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < iterations; i++ ) {
+        common_integrityCheck ( msg_p, &ptr_p, &got );
+    }
+    *getNs_p = ( double ) ( os_getTimeNs (  ) - startNs ) / ( double ) iterations;
+}
+
+/*****************************************************************************
+ * benchRun
+ *****************************************************************************/
+static void
+benchRun ( const solClient_uint32_t * sizes_p, int numSizes )
+{
+    struct commonIntegrityStats stats;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_uint64_t iterations;
+    solClient_uint32_t maxSize = 0;
+    unsigned char  *buf_p;
+    double          setPlain;
+    double          getPlain;
+    double          setSealed;
+    double          getChecked;
+    int             i;
+
+    for ( i = 0; i < numSizes; i++ ) {
+        if ( sizes_p[i] > maxSize ) {
+            maxSize = sizes_p[i];
+        }
+    }
+    if ( ( buf_p = ( unsigned char * ) malloc ( maxSize + COMMON_INTEGRITY_TRAILER_LEN ) ) == NULL || solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ) {
+        printf ( "Out of memory\n" );
+        free ( buf_p );
+        return;
+    }
+    fillRandom ( buf_p, maxSize, &x );
+
+    printf ( "\n%9s %10s %10s %10s   %-26s %-26s\n", "", "CRC GB/s", "", "", "set payload, ns per msg", "read payload, ns per msg" );
+    printf ( "%9s %10s %10s %10s   %8s %8s %8s %8s %8s %8s\n", "bytes", common_crc32cImplementation (  ), "tables",
+             "bytewise", "plain", "sealed", "+%", "plain", "checked", "+%" );
+    for ( i = 0; i < numSizes; i++ ) {
+        iterations = BENCH_BYTES / ( sizes_p[i] + 1 );
+        if ( iterations < BENCH_MIN_ITERATIONS ) {
+            iterations = BENCH_MIN_ITERATIONS;
+        }
+        printf ( "%9u %10.2f %10.2f", sizes_p[i], benchCrc ( common_crc32c, buf_p, sizes_p[i], iterations ),
+                 benchCrc ( common_crc32cSoftware, buf_p, sizes_p[i], iterations ) );
+        printf ( " %10.2f", benchCrc ( crc32cBytewise, buf_p, sizes_p[i], iterations / 16 + 1 ) );
+        benchMessages ( msg_p, buf_p, sizes_p[i], iterations, 0, &setPlain, &getPlain );
+        benchMessages ( msg_p, buf_p, sizes_p[i], iterations, 1, &setSealed, &getChecked );
+        printf ( "   %8.1f %8.1f %7.0f%% %8.1f %8.1f %7.0f%%\n", setPlain, setSealed,
+                 100.0 * ( setSealed - setPlain ) / setPlain, getPlain, getChecked,
+                 100.0 * ( getChecked - getPlain ) / getPlain );
+        fflush ( stdout );
+    }
+    common_integrityGetStats ( &stats );
+    printf ( "%llu payloads sealed, %llu checked, %llu corrupt\n", ( unsigned long long ) stats.sealed,
+             ( unsigned long long ) stats.checked, ( unsigned long long ) stats.corrupt );
+
+    solClient_msg_free ( &msg_p );
+    free ( buf_p );
+}
+
+/*****************************************************************************
+ * rxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct rxStats *rx_p = ( struct rxStats * ) user_p;
+
+    /* Corrupt messages are counted and logged by the check. */
+    common_integrityCheck ( msg_p, NULL, NULL );
+    rx_p->received++;
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic published to and subscribed to.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Messages */
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    struct commonIntegrityStats stats;
+    struct rxStats  rx;
+    unsigned char  *payload_p = NULL;
+    unsigned char  *ptr_p;
+    solClient_uint32_t sealedSize;
+    solClient_uint64_t x = COMMON_RANDOM_SEED;
+    solClient_uint64_t waitStartNs;
+    const char     *sizes_p = DEFAULT_SIZES;
+    const char     *p;
+    solClient_uint32_t sizes[MAX_SIZES];
+    int             numSizes = 0;
+    solClient_uint32_t size = DEFAULT_SIZE;
+    int             corruptEvery = 0;
+    int             sent = 0;
+    int             ok;
+    int             i;
+
+    printf ( "\nPayloadIntegrity.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 10000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tsize=BYTES          With --cip, the payload size (default 256).\n"
+                                      "\tcorrupt=N           With --cip, damage every Nth payload after sealing (default none).\n"
+                                      "\tsizes=N,...         Without --cip, the payload sizes measured.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            size = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "corrupt=", 8 ) == 0 ) {
+            corruptEvery = atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "sizes=", 6 ) == 0 ) {
+            sizes_p = argv[i] + 6;
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    for ( p = sizes_p; *p != ( char ) 0 && numSizes < MAX_SIZES; p++ ) {
+        sizes[numSizes++] = ( solClient_uint32_t ) atoi ( p );
+        if ( ( p = strchr ( p, ',' ) ) == NULL ) {
+            break;
+        }
+    }
+    for ( i = 0; i < numSizes; i++ ) {
+        if ( sizes[i] < 1 ) {
+            numSizes = 0;
+        }
+    }
+    if ( numSizes == 0 || size < 1 || corruptEvery < 0 || commandOpts.numMsgsToSend < 1 ) {
+        printf ( "Invalid arguments: sizes >= 1, size >= 1, corrupt >= 0\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Publishing requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    common_integrityEnable ( 1 );
+
+    /*************************************************************************
+     * Without a broker: correctness, then the cost against payload size
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        ok = checkCrc (  );
+        ok = checkDetection (  ) && ok;
+        if ( ok ) {
+            benchRun ( sizes, numSizes );
+        }
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it receiving into rxCallback
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    memset ( ( void * ) &rx, 0, sizeof ( rx ) );
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 rxCallback,
+                                                 common_eventCallback, &rx, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p,
+                                                      SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Publish sealed payloads, damaging every Nth after sealing
+     *************************************************************************/
+    if ( ( payload_p = ( unsigned char * ) malloc ( size + COMMON_INTEGRITY_TRAILER_LEN ) ) == NULL ) {
+        goto unsubscribe;
+    }
+    fillRandom ( payload_p, size, &x );
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = commandOpts.destinationName;
+    printf ( "Publishing %d messages of %u bytes to '%s'%s\n", commandOpts.numMsgsToSend, size,
+             commandOpts.destinationName, ( corruptEvery > 0 ) ? ", some damaged" : "" );
+    for ( i = 1; i <= commandOpts.numMsgsToSend; i++ ) {
+        if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_alloc()" );
+            break;
+        }
+        if ( ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ||
+             ( rc = solClient_msg_setSequenceNumber ( msg_p, ( solClient_uint64_t ) i ) ) != SOLCLIENT_OK ||
+             ( rc = common_integritySetPayload ( msg_p, payload_p, size ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "building the message" );
+            solClient_msg_free ( &msg_p );
+            break;
+        }
+        if ( corruptEvery > 0 && i % corruptEvery == 0 &&
+             solClient_msg_getBinaryAttachmentPtr ( msg_p, ( void ** ) &ptr_p, &sealedSize ) == SOLCLIENT_OK ) {
+            ptr_p[( solClient_uint32_t ) i % size] ^= 0x01;
+        }
+        if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_sendMsg()" );
+            solClient_msg_free ( &msg_p );
+            break;
+        }
+        solClient_msg_free ( &msg_p );
+        sent++;
+    }
+
+    /* Wait for the messages to come back, up to a second after the last. */
+    waitStartNs = os_getTimeNs (  );
+    while ( rx.received < ( solClient_uint64_t ) sent && os_getTimeNs (  ) - waitStartNs < 1000000000ULL ) {
+        OS_SLEEP_US ( 10000 );
+    }
+    common_integrityGetStats ( &stats );
+    printf ( "Sent %d, received %llu: %llu intact, %llu corrupt", sent, ( unsigned long long ) rx.received,
+             ( unsigned long long ) stats.checked, ( unsigned long long ) stats.corrupt );
+    if ( stats.corrupt > 0 ) {
+        printf ( " (last: sequence number %lld on '%s')", ( long long ) stats.lastCorruptSeq, stats.lastCorruptTopic );
+    }
+    printf ( ", %llu without a trailer\n", ( unsigned long long ) stats.missing );
+    free ( payload_p );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  unsubscribe:
+    if ( ( rc = solClient_session_topicUnsubscribeExt ( session_p,
+                                                        SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                        commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicUnsubscribeExt()" );
+    }
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
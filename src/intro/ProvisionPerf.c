@@ -0,0 +1,236 @@
+/** @example Intro/ProvisionPerf.c
+ */
+
+/*
+ * This sample measures how many endpoints per second can be created and
+ * deleted, first one confirmed request at a time with common_createQueue()
+ * and common_deleteQueue(), then with a provisionBatch (provision.h) at each
+ * of a list of request windows.
+ *
+ * The queues are named PREFIX-000000 onwards and are deleted again after
+ * each measurement. Errors are listed from the batch's result table.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "provision.h"
+#include "getopt.h"
+
+#define MAX_ERRORS_SHOWN        5
+
+/* The Session's events are passed to the batch from the start. */
+static struct provisionBatch batch;
+
+/*****************************************************************************
+ * printBatch
+ *****************************************************************************/
+static void
+printBatch ( const char *what_p, unsigned int window )
+{
+    unsigned long long sumNs = 0;
+    unsigned long long maxNs = 0;
+    unsigned int    shown = 0;
+    unsigned int    i;
+
+    for ( i = 0; i < batch.numEntries; i++ ) {
+        sumNs += batch.entries_p[i].latencyNs;
+        if ( batch.entries_p[i].latencyNs > maxNs ) {
+            maxNs = batch.entries_p[i].latencyNs;
+        }
+    }
+    printf ( "window %4u %-6s %9.0f endpoints/s  ok %u, errors %u, timeouts %u  latency mean %.2f ms, max %.2f ms"
+             "  peak in flight %u\n",
+             window, what_p, ( double ) batch.numEntries * 1.0e9 / ( double ) batch.elapsedNs,
+             batch.numOk, batch.numErrors, batch.numTimeouts,
+             ( double ) sumNs / ( double ) batch.numEntries / 1.0e6, ( double ) maxNs / 1.0e6, batch.peakOutstanding );
+
+    for ( i = 0; i < batch.numEntries && shown < MAX_ERRORS_SHOWN; i++ ) {
+        if ( batch.entries_p[i].state != PROVISION_STATE_OK ) {
+            printf ( "    %s: %s, response %d, %s %s\n", batch.entries_p[i].name_p,
+                     provision_stateToString ( batch.entries_p[i].state ), batch.entries_p[i].responseCode,
+                     solClient_subCodeToString ( batch.entries_p[i].subCode ), batch.entries_p[i].info );
+            shown++;
+        }
+    }
+    fflush ( stdout );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Endpoints */
+    const char     *prefix_p = "provPerf";
+    static const unsigned int defaultWindows[] = { 1, 16, 64, 256 };
+    struct provisionEntry *entries_p = NULL;
+    char           *names_p = NULL;
+    unsigned long long startNs;
+    unsigned int    numEntries;
+    unsigned int    window;
+    unsigned int    i;
+    int             w;
+    int             numWindows;
+
+    printf ( "\nProvisionPerf.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, ( HOST_PARAM_MASK | USER_PARAM_MASK ),    /* required parameters */
+                                ( PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 1000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tPREFIX              Queue name prefix (default provPerf).\n"
+                                      "\tWINDOW...           Requests in flight to measure (default 1 16 64 256).\n"
+                                      "\t-n sets the number of queues.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    if ( optind < argc ) {
+        prefix_p = argv[optind];
+    }
+    numWindows = ( optind + 1 < argc ) ? argc - optind - 1 : ( int ) ( sizeof ( defaultWindows ) / sizeof ( defaultWindows[0] ) );
+    numEntries = ( unsigned int ) commandOpts.numMsgsToSend;
+
+    entries_p = ( struct provisionEntry * ) calloc ( numEntries, sizeof ( struct provisionEntry ) );
+    names_p = ( char * ) malloc ( ( size_t ) numEntries * 128 );
+    if ( entries_p == NULL || names_p == NULL || strlen ( prefix_p ) > 100 ) {
+        printf ( "Cannot set up %u queue names\n", numEntries );
+        exit ( 1 );
+    }
+    for ( i = 0; i < numEntries; i++ ) {
+        sprintf ( names_p + ( size_t ) i * 128, "%s-%06u", prefix_p, i );
+        entries_p[i].name_p = names_p + ( size_t ) i * 128;
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 provision_eventCallback, &batch, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( !solClient_session_isCapable ( session_p, SOLCLIENT_SESSION_CAPABILITY_ENDPOINT_MANAGEMENT ) ) {
+        printf ( "Endpoint management not supported on this broker.\n" );
+        goto sessionConnected;
+    }
+    if ( provision_batchInit ( &batch, session_p, entries_p, numEntries, 1 ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * One confirmed request at a time
+     *************************************************************************/
+    printf ( "Creating and deleting %u queues '%s-NNNNNN'\n", numEntries, prefix_p );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numEntries; i++ ) {
+        if ( common_createQueue ( session_p, entries_p[i].name_p ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    printf ( "blocking    create %9.0f endpoints/s\n", ( double ) i * 1.0e9 / ( double ) ( os_getTimeNs (  ) - startNs ) );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numEntries; i++ ) {
+        if ( common_deleteQueue ( session_p, entries_p[i].name_p ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    printf ( "blocking    delete %9.0f endpoints/s\n", ( double ) i * 1.0e9 / ( double ) ( os_getTimeNs (  ) - startNs ) );
+
+    /*************************************************************************
+     * Pipelined at each window
+     *************************************************************************/
+    for ( w = 0; w < numWindows; w++ ) {
+        window = ( optind + 1 < argc ) ? ( unsigned int ) atoi ( argv[optind + 1 + w] ) : defaultWindows[w];
+        if ( window == 0 ) {
+            continue;
+        }
+        batch.maxOutstanding = window;
+
+        for ( i = 0; i < numEntries; i++ ) {
+            entries_p[i].op = PROVISION_OP_CREATE;
+        }
+        provision_run ( &batch );
+        printBatch ( "create", window );
+
+        for ( i = 0; i < numEntries; i++ ) {
+            entries_p[i].op = PROVISION_OP_DELETE;
+        }
+        provision_run ( &batch );
+        printBatch ( "delete", window );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+    if ( ( rc = solClient_session_destroy ( &session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_destroy()" );
+    }
+    /* Late events refer to the batch, so it goes after the Session. */
+    if ( batch.entries_p != NULL ) {
+        provision_batchDestroy ( &batch );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    free ( entries_p );
+    free ( names_p );
+    return 0;
+}
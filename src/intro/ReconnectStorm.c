@@ -0,0 +1,359 @@
+/** @example Intro/ReconnectStorm.c
+ */
+
+/*
+ * This sample simulates a broker restart under a fleet of thousands of
+ * Sessions spread over several Contexts, each Context's Sessions managed by
+ * a connection manager (see connmgr.h), and measures the time until every
+ * Session is back up with all of its subscriptions.
+ *
+ * The Contexts and Sessions are those of the mock Session layer
+ * (solClientMock.c) on a virtual clock, and a stand-in broker decides each
+ * connect through the mock's connect hook. The stand-in refuses every
+ * connect while it restarts, and afterwards accepts a limited number of
+ * connects per tick and works off subscriptions at a limited rate; while
+ * its subscription backlog is too long it refuses connects as well.
+ *
+ * The storm is run twice: once with the managers in lockstep mode, which
+ * behaves as the API's own retries with RECONNECT_RETRY_WAIT_MS 3000 and
+ * REAPPLY_SUBSCRIPTIONS do, and once with jittered backoff, the reconnect
+ * token bucket and staged subscription reapplication.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "connmgr.h"
+#include "solClientMock.h"
+#include "getopt.h"
+
+#define MAX_CONTEXTS            64
+#define TICK_MS                 10
+#define MAX_SIMULATED_MS        900000ULL   /* Give up on a storm after 15 minutes. */
+
+/*
+ * The stand-in broker.
+ */
+struct broker
+{
+    solClient_uint64_t nowMs;
+    solClient_uint64_t restartUntilMs;  /* Refuses every connect until then. */
+    solClient_uint32_t connectsPerTick; /* Connects accepted per tick. */
+    solClient_uint32_t subsPerTick;     /* Subscriptions worked off per tick. */
+    solClient_uint64_t maxBacklog;      /* Refuses connects beyond this many subscriptions queued. */
+    solClient_uint32_t connectsThisTick;
+    solClient_uint64_t backlog;
+    solClient_uint64_t subsSeen;
+    solClient_uint64_t refused;
+    solClient_uint64_t peakSubsPerTick;
+    solClient_uint64_t peakBacklog;
+};
+
+/*
+ * The simulation's parameters.
+ */
+struct storm
+{
+    int             numClients;
+    int             numContexts;
+    int             numSubs;
+    solClient_uint32_t outageMs;
+    solClient_uint32_t connectsPerTick;
+    solClient_uint32_t subsPerTick;
+};
+
+/*****************************************************************************
+ * brokerConnectHook
+ *****************************************************************************/
+static          solClient_session_event_t
+brokerConnectHook ( solClient_opaqueSession_pt opaqueSession_p, void *user_p )
+{
+    struct broker  *broker_p = ( struct broker * ) user_p;
+
+    if ( broker_p->nowMs < broker_p->restartUntilMs ) {
+        return SOLCLIENT_SESSION_EVENT_CONNECT_FAILED_ERROR;
+    }
+    if ( broker_p->connectsThisTick >= broker_p->connectsPerTick || broker_p->backlog > broker_p->maxBacklog ) {
+        broker_p->refused++;
+        return SOLCLIENT_SESSION_EVENT_CONNECT_FAILED_ERROR;
+    }
+    broker_p->connectsThisTick++;
+    return SOLCLIENT_SESSION_EVENT_UP_NOTICE;
+}
+
+/*****************************************************************************
+ * step
+ *
+ * Advances the broker and every Context by one tick.
+ * Returns the number of Sessions up with all their subscriptions.
+ *****************************************************************************/
+static solClient_uint32_t
+step ( struct broker *broker_p, solClient_opaqueContext_pt * contexts_p, struct connmgr *mgrs_p, int numContexts )
+{
+    struct connmgrStats stats;
+    solClient_uint64_t subs = 0;
+    solClient_uint32_t clientsUp = 0;
+    int             i;
+
+    broker_p->nowMs += TICK_MS;
+    broker_p->connectsThisTick = 0;
+    for ( i = 0; i < numContexts; i++ ) {
+        solClientMock_processEvents ( contexts_p[i], TICK_MS );
+    }
+    for ( i = 0; i < numContexts; i++ ) {
+        connmgr_getStats ( &mgrs_p[i], &stats );
+        subs += stats.subsApplied;
+        clientsUp += stats.clientsUp;
+    }
+
+    /* Subscriptions arriving this tick join the backlog. */
+    if ( subs - broker_p->subsSeen > broker_p->peakSubsPerTick ) {
+        broker_p->peakSubsPerTick = subs - broker_p->subsSeen;
+    }
+    broker_p->backlog += subs - broker_p->subsSeen;
+    broker_p->subsSeen = subs;
+    if ( broker_p->backlog > broker_p->peakBacklog ) {
+        broker_p->peakBacklog = broker_p->backlog;
+    }
+    broker_p->backlog = ( broker_p->backlog > broker_p->subsPerTick ) ? broker_p->backlog - broker_p->subsPerTick : 0;
+    return clientsUp;
+}
+
+/*****************************************************************************
+ * runStorm
+ *****************************************************************************/
+static void
+runStorm ( const char *name_p, const struct storm *storm_p, const struct connmgrConfig *config_p,
+           struct commonOptions *commandOpts )
+{
+    solClient_opaqueContext_pt contexts[MAX_CONTEXTS];
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    const struct common_solClientApi *api_p = common_getSolClientApi (  );
+    struct connmgr *mgrs_p;
+    struct connmgrClient *client_p;
+    struct connmgrStats stats;
+    struct broker   broker;
+    solClient_uint64_t attempts = 0;
+    solClient_uint64_t failures = 0;
+    solClient_uint64_t startMs;
+    solClient_uint64_t halfMs = 0;
+    solClient_uint64_t mostMs = 0;
+    solClient_uint32_t clientsUp;
+    solClient_uint32_t total = ( solClient_uint32_t ) storm_p->numClients;
+    int             numContexts = 0;
+    char            topic[64];
+    int             i;
+    int             sub;
+
+    if ( ( mgrs_p = ( struct connmgr * ) calloc ( storm_p->numContexts, sizeof ( struct connmgr ) ) ) == NULL ) {
+        printf ( "Could not allocate the managers\n" );
+        return;
+    }
+    /* The fleet is first brought up against a broker without limits. */
+    memset ( &broker, 0, sizeof ( broker ) );
+    broker.connectsPerTick = 0xffffffffu;
+    broker.subsPerTick = 0xffffffffu;
+    broker.maxBacklog = 0xffffffffffffffffULL;
+
+    /*************************************************************************
+     * A manager per Context, the clients dealt out between them
+     *************************************************************************/
+    for ( numContexts = 0; numContexts < storm_p->numContexts; numContexts++ ) {
+        if ( api_p->context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                     &contexts[numContexts], &contextFuncInfo, sizeof ( contextFuncInfo ) ) != SOLCLIENT_OK ) {
+            goto cleanup;
+        }
+        solClientMock_setConnectHook ( contexts[numContexts], brokerConnectHook, &broker );
+        if ( connmgr_init ( &mgrs_p[numContexts], contexts[numContexts],
+                            ( storm_p->numClients + storm_p->numContexts - 1 ) / storm_p->numContexts, config_p ) != SOLCLIENT_OK ) {
+            api_p->context_destroy ( &contexts[numContexts] );
+            goto cleanup;
+        }
+    }
+    for ( i = 0; i < storm_p->numClients; i++ ) {
+        if ( connmgr_addClient ( &mgrs_p[i % storm_p->numContexts], commandOpts,
+                                 common_messageReceivePerfCallback, NULL, &client_p ) != SOLCLIENT_OK ) {
+            goto cleanup;
+        }
+        for ( sub = 0; sub < storm_p->numSubs; sub++ ) {
+            sprintf ( topic, "storm/%d/%d", i, sub );
+            if ( connmgr_subscribe ( client_p, topic ) != SOLCLIENT_OK ) {
+                goto cleanup;
+            }
+        }
+    }
+    for ( i = 0; i < numContexts; i++ ) {
+        if ( connmgr_start ( &mgrs_p[i] ) != SOLCLIENT_OK ) {
+            goto cleanup;
+        }
+    }
+
+    /*************************************************************************
+     * Bring the fleet up, then restart the broker under it
+     *************************************************************************/
+    while ( step ( &broker, contexts, mgrs_p, numContexts ) < total ) {
+        if ( broker.nowMs > MAX_SIMULATED_MS ) {
+            printf ( "%-9s the fleet did not come up\n", name_p );
+            goto cleanup;
+        }
+    }
+    for ( i = 0; i < numContexts; i++ ) {
+        connmgr_getStats ( &mgrs_p[i], &stats );
+        attempts -= stats.attempts;
+        failures -= stats.failures;
+    }
+    broker.connectsPerTick = storm_p->connectsPerTick;
+    broker.subsPerTick = storm_p->subsPerTick;
+    broker.maxBacklog = 10ULL * storm_p->subsPerTick;
+    broker.refused = 0;
+    broker.peakSubsPerTick = 0;
+    broker.peakBacklog = 0;
+
+    startMs = broker.nowMs;
+    broker.restartUntilMs = startMs + storm_p->outageMs;
+    for ( i = 0; i < storm_p->numClients; i++ ) {
+        client_p = &mgrs_p[i % storm_p->numContexts].clients_p[i / storm_p->numContexts];
+        solClientMock_injectSessionEvent ( client_p->session_p, SOLCLIENT_SESSION_EVENT_DOWN_ERROR, 0, "broker restart", NULL );
+    }
+    do {
+        clientsUp = step ( &broker, contexts, mgrs_p, numContexts );
+        if ( halfMs == 0 && clientsUp >= total / 2 ) {
+            halfMs = broker.nowMs - startMs;
+        }
+        if ( mostMs == 0 && clientsUp >= total - total / 100 ) {
+            mostMs = broker.nowMs - startMs;
+        }
+    } while ( clientsUp < total && broker.nowMs - startMs < MAX_SIMULATED_MS );
+
+    for ( i = 0; i < numContexts; i++ ) {
+        connmgr_getStats ( &mgrs_p[i], &stats );
+        attempts += stats.attempts;
+        failures += stats.failures;
+    }
+    if ( clientsUp < total ) {
+        printf ( "%-9s %u of %u Sessions recovered after %.1f s\n", name_p, clientsUp, total,
+                 ( double ) ( broker.nowMs - startMs ) / 1000.0 );
+    } else {
+        printf ( "%-9s full recovery %7.1f s  (50%% %7.1f s, 99%% %7.1f s, outage %.1f s)\n", name_p,
+                 ( double ) ( broker.nowMs - startMs ) / 1000.0, ( double ) halfMs / 1000.0,
+                 ( double ) mostMs / 1000.0, ( double ) storm_p->outageMs / 1000.0 );
+    }
+    /* The failures also count the Sessions going down at the restart. */
+    printf ( "          attempts %llu, failed %llu, refused by the busy broker %llu\n",
+             ( unsigned long long ) attempts, ( unsigned long long ) ( failures - total ),
+             ( unsigned long long ) broker.refused );
+    printf ( "          peak subscriptions per tick %llu, peak backlog %llu (broker works off %u per tick)\n",
+             ( unsigned long long ) broker.peakSubsPerTick, ( unsigned long long ) broker.peakBacklog,
+             storm_p->subsPerTick );
+    fflush ( stdout );
+
+  cleanup:
+    for ( i = 0; i < numContexts; i++ ) {
+        connmgr_destroy ( &mgrs_p[i] );
+        api_p->context_destroy ( &contexts[i] );
+    }
+    free ( mgrs_p );
+}
+
+
+/*
+ * fn main()
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    struct storm    storm;
+    struct connmgrConfig lockstep = { TICK_MS, 3000, 3000, 0, 0, 0, 0 };
+    struct connmgrConfig managed = CONNMGR_CONFIG_DEFAULT;
+    int             i;
+
+    printf ( "\nReconnectStorm.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                LOG_LEVEL_MASK );   /* optional parameters */
+    storm.numClients = 4000;
+    storm.numContexts = 8;
+    storm.numSubs = 20;
+    storm.outageMs = 5000;
+    storm.connectsPerTick = 20;
+    storm.subsPerTick = 200;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tclients=N           Sessions in the fleet (default 4000).\n"
+                                      "\tcontexts=N          Contexts, each with its own manager (default 8).\n"
+                                      "\tsubs=N              Subscriptions per Session (default 20).\n"
+                                      "\toutage=MS           Time the broker refuses all connects (default 5000).\n"
+                                      "\taccept=N            Connects the broker accepts per 10 ms (default 20).\n"
+                                      "\tsubrate=N           Subscriptions the broker applies per 10 ms (default 200).\n"
+                                      "\trate=N              Managed: connects per second per Context (default 100).\n"
+                                      "\tcap=MS              Managed: longest backoff (default 30000).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "clients=", 8 ) == 0 ) {
+            storm.numClients = atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "contexts=", 9 ) == 0 ) {
+            storm.numContexts = atoi ( argv[i] + 9 );
+        } else if ( strncmp ( argv[i], "subs=", 5 ) == 0 ) {
+            storm.numSubs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "outage=", 7 ) == 0 ) {
+            storm.outageMs = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "accept=", 7 ) == 0 ) {
+            storm.connectsPerTick = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "subrate=", 8 ) == 0 ) {
+            storm.subsPerTick = ( solClient_uint32_t ) atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "rate=", 5 ) == 0 ) {
+            managed.connectsPerSec = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "cap=", 4 ) == 0 ) {
+            managed.capMs = ( solClient_uint32_t ) atoi ( argv[i] + 4 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( storm.numClients < 1 || storm.numContexts < 1 || storm.numContexts > MAX_CONTEXTS ||
+         storm.numSubs < 0 || storm.connectsPerTick < 1 || storm.subsPerTick < 1 || managed.capMs < managed.baseMs ) {
+        printf ( "Invalid arguments: clients >= 1, contexts 1..%d, subs >= 0, accept >= 1, subrate >= 1, cap >= %u\n",
+                 MAX_CONTEXTS, managed.baseMs );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the real API; the mock supplies Contexts and Sessions
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+    solClientMock_install (  );
+
+    printf ( "%d Sessions on %d Contexts, %d subscriptions each; broker down %.1f s, then accepting %u connects "
+             "and %u subscriptions per %d ms\n", storm.numClients, storm.numContexts, storm.numSubs,
+             ( double ) storm.outageMs / 1000.0, storm.connectsPerTick, storm.subsPerTick, TICK_MS );
+    runStorm ( "lockstep", &storm, &lockstep, &commandOpts );
+    runStorm ( "managed", &storm, &managed, &commandOpts );
+
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
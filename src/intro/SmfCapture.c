@@ -0,0 +1,257 @@
+/** @example Intro/SmfCapture.c
+ */
+
+/*
+ * This sample writes the messages received on a topic to an SMF capture
+ * log (see smflog.h), to be analysed offline with SmfLogQuery.
+ *
+ *  |-----------|  --Topic-->  |------------|  --->  PREFIX.000000.smfl ...
+ *  | Publisher |              | SmfCapture |
+ *  |-----------|              |------------|
+ *
+ * Each message is stamped with its wall-clock receive time and stored in
+ * SMF form. Segments are rolled at SEGMENT_MB megabytes; a segment gets its
+ * block index when it is closed, and a segment left open by Ctrl-C is still
+ * readable, only more slowly.
+ *
+ * Without --cip, the sample writes a synthetic capture of market-data-like
+ * traffic instead, so that the query tool can be tried on any build box.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "smflog.h"
+#include "getopt.h"
+
+#define SYNTHETIC_TOPICS        64
+#define SYNTHETIC_MEAN_GAP_NS   10000       /* 100k messages/s on average. */
+
+/* The capture log is only touched on the Context thread once connected. */
+static struct smflogWriter writer;
+static volatile solClient_uint64_t rxMsgs = 0;
+static volatile solClient_uint64_t captureErrors = 0;
+
+/*****************************************************************************
+ * captureMessageReceiveCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+captureMessageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    if ( smflog_append ( &writer, msg_p, os_getRealTimeNs (  ) ) != SOLCLIENT_OK ) {
+        captureErrors++;
+    }
+    rxMsgs++;
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * writeSynthetic
+ *
+ * Writes numMsgs messages over SYNTHETIC_TOPICS topics, starting at the
+ * current minute. Gaps are uniform around SYNTHETIC_MEAN_GAP_NS, payloads
+ * 64 to 1024 bytes, and the sender timestamp trails the capture time by up
+ * to a millisecond.
+ *****************************************************************************/
+static          solClient_returnCode_t
+writeSynthetic ( int numMsgs )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    unsigned char   payload[1024];
+    char            topics[SYNTHETIC_TOPICS][64];
+    solClient_uint64_t random = COMMON_RANDOM_SEED;
+    solClient_uint64_t captureNs;
+    solClient_uint64_t r;
+    int             i;
+
+    for ( i = 0; i < SYNTHETIC_TOPICS; i++ ) {
+        sprintf ( topics[i], "md/%s/SYM%02d/trades", ( i % 4 == 0 ) ? "FX" : "EQ", i );
+    }
+    memset ( payload, 'x', sizeof ( payload ) );
+    captureNs = ( os_getRealTimeNs (  ) / 60000000000ULL ) * 60000000000ULL;
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT );
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+
+    for ( i = 0; i < numMsgs; i++ ) {
+        r = common_random ( &random );
+        captureNs += ( r >> 40 ) % ( 2 * SYNTHETIC_MEAN_GAP_NS );
+
+        destination.dest = topics[( r >> 8 ) % SYNTHETIC_TOPICS];
+        if ( ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ||
+             ( rc = solClient_msg_setBinaryAttachmentPtr ( msg_p, payload, 64 + ( solClient_uint32_t ) ( ( r >> 16 ) % 961 ) ) ) != SOLCLIENT_OK ||
+             ( rc = solClient_msg_setSequenceNumber ( msg_p, i + 1 ) ) != SOLCLIENT_OK ||
+             ( rc = solClient_msg_setSenderTimestamp ( msg_p, ( solClient_int64_t ) ( ( captureNs - ( r >> 32 ) % 1000000 ) / 1000000 ) ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "building a synthetic message" );
+            break;
+        }
+        if ( ( rc = smflog_append ( &writer, msg_p, captureNs ) ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+
+    solClient_msg_free ( &msg_p );
+    return rc;
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic to capture.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Capture */
+    const char     *prefix_p = "capture";
+    solClient_uint64_t segmentBytes = SMFLOG_DEFAULT_SEGMENT_BYTES;
+    solClient_uint64_t lastMsgs = 0;
+    unsigned long long startNs;
+
+    printf ( "\nSmfCapture.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 1000000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tPREFIX              Path prefix of the segment files (default capture).\n"
+                                      "\tSEGMENT_MB          Segment size in megabytes (default 256).\n"
+                                      "\tWithout --cip, a synthetic capture of -n messages is written.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    if ( optind < argc ) {
+        prefix_p = argv[optind];
+    }
+    if ( optind + 1 < argc ) {
+        segmentBytes = ( solClient_uint64_t ) atoi ( argv[optind + 1] ) * 1024 * 1024;
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Capturing from a broker requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    if ( smflog_writerOpen ( &writer, prefix_p, segmentBytes ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Synthetic capture
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        printf ( "Writing a synthetic capture of %d messages to '%s.*.smfl'\n", commandOpts.numMsgsToSend, prefix_p );
+        startNs = os_getTimeNs (  );
+        writeSynthetic ( commandOpts.numMsgsToSend );
+        smflog_writerClose ( &writer );
+        printf ( "Wrote %llu messages, %llu bytes in %u segments in %.3f s\n",
+                 ( unsigned long long ) writer.records, ( unsigned long long ) writer.bytes, writer.segmentNum,
+                 ( double ) ( os_getTimeNs (  ) - startNs ) / 1.0e9 );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto closeWriter;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 captureMessageReceiveCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto closeWriter;
+    }
+
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p,
+                                                      SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      commandOpts.destinationName ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribe()" );
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Capture until enough messages arrive
+     *************************************************************************/
+    printf ( "Capturing '%s' to '%s.*.smfl' until %d messages, Ctrl-C to stop.....\n",
+             commandOpts.destinationName, prefix_p, commandOpts.numMsgsToSend );
+    while ( rxMsgs < ( solClient_uint64_t ) commandOpts.numMsgsToSend ) {
+        SLEEP ( 1 );
+        printf ( "%10llu msgs/s (total %llu, errors %llu)\n", ( unsigned long long ) ( rxMsgs - lastMsgs ),
+                 ( unsigned long long ) rxMsgs, ( unsigned long long ) captureErrors );
+        fflush ( stdout );
+        lastMsgs = rxMsgs;
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    /* Disconnecting stops the callbacks, so the writer can be closed here. */
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  closeWriter:
+    smflog_writerClose ( &writer );
+    printf ( "Captured %llu messages in %u segments\n", ( unsigned long long ) writer.records, writer.segmentNum );
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,629 @@
+/** @example Intro/SmfLogQuery.c
+ */
+
+/*
+ * This sample answers questions about captured traffic, such as "what was
+ * the p99 inter-arrival time on topic X between 09:30 and 09:31", from the
+ * SMF capture log segments written by SmfCapture.
+ *
+ * Segments are memory-mapped and shared out to worker threads one segment
+ * at a time. Each worker uses the sparse block index of a segment to skip
+ * blocks outside the time range or without the topic prefix, matches the
+ * topic stored with each record, and decodes only the matching records with
+ * solClient_msg_decodeFromSmf(). The results are merged into message and
+ * byte rates, and histograms of inter-arrival gaps, payload sizes and
+ * latency (capture time minus the sender timestamp, which has millisecond
+ * resolution).
+ *
+ * Query terms are given as KEY=VALUE arguments before the segment files:
+ *
+ *     topic=md/EQ/>            Topic or wildcard subscription (default >).
+ *     from=09:30 to=09:31      UTC time of day on the first capture day,
+ *                              HH:MM[:SS[.fraction]], or seconds since the
+ *                              epoch.
+ *     threads=8                Worker threads (default: one per CPU).
+ *
+ * Segments are expected to be given in capture order, as a shell glob of
+ * PREFIX.*.smfl lists them.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "smflog.h"
+#include "getopt.h"
+
+#define MAX_THREADS             256
+#define NS_PER_DAY              ( 86400ULL * 1000000000ULL )
+
+/*
+ * A log-linear histogram: exact below 16, then 16 buckets per power of two,
+ * so any recorded value is reported within about 3%.
+ */
+#define HIST_BUCKETS            ( 61 * 16 )
+
+struct histogram
+{
+    solClient_uint64_t counts[HIST_BUCKETS];
+    solClient_uint64_t count;
+    solClient_uint64_t max;
+    double          sum;
+};
+
+/* The parsed query. */
+struct query
+{
+    const char     *pattern_p;
+    size_t          patternLen;
+    int             literal;            /* No wildcards: compare the topic directly. */
+    int             usePrefix;          /* The pattern starts with literal levels. */
+    solClient_uint32_t prefixHash;      /* Hash of those levels, for the Bloom filters. */
+    solClient_uint64_t fromNs;
+    solClient_uint64_t toNs;
+};
+
+/* What one worker found. */
+struct queryResult
+{
+    solClient_uint64_t matches;
+    solClient_uint64_t payloadBytes;
+    solClient_uint64_t firstNs;
+    solClient_uint64_t lastNs;
+    solClient_uint64_t blocksScanned;
+    solClient_uint64_t blocksSkipped;
+    solClient_uint64_t recordsScanned;
+    solClient_uint64_t bytesScanned;
+    solClient_uint64_t decodeErrors;
+    struct histogram gaps;
+    struct histogram sizes;
+    struct histogram latency;
+};
+
+/* Matches at the edges of a segment, for the gaps between segments. */
+struct segmentEdge
+{
+    solClient_uint64_t matches;
+    solClient_uint64_t firstNs;
+    solClient_uint64_t lastNs;
+};
+
+/* Shared by the workers. */
+struct queryWork
+{
+    const struct query *query_p;
+    struct smflogSegment *segments_p;
+    struct segmentEdge *edges_p;
+    int             numSegments;
+    int             nextSegment;
+    OS_MUTEX        lock;
+};
+
+struct worker
+{
+    OS_THREAD       thread;
+    struct queryWork *work_p;
+    struct queryResult *result_p;
+};
+
+/*****************************************************************************
+ * Histograms
+ *****************************************************************************/
+static int
+highestBit ( solClient_uint64_t value )
+{
+#ifdef __GNUC__
+    return 63 - __builtin_clzll ( value );
+#else
+    int             bit = 0;
+
+    while ( value >>= 1 ) {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+static void
+histogramAdd ( struct histogram *hist_p, solClient_uint64_t value )
+{
+    int             bit;
+    int             index;
+
+    if ( value < 16 ) {
+        index = ( int ) value;
+    } else {
+        bit = highestBit ( value );
+        index = ( bit - 3 ) * 16 + ( int ) ( ( value >> ( bit - 4 ) ) & 15 );
+    }
+    hist_p->counts[index]++;
+    hist_p->count++;
+    hist_p->sum += ( double ) value;
+    if ( value > hist_p->max ) {
+        hist_p->max = value;
+    }
+}
+
+static void
+histogramMerge ( struct histogram *into_p, const struct histogram *from_p )
+{
+    int             i;
+
+    for ( i = 0; i < HIST_BUCKETS; i++ ) {
+        into_p->counts[i] += from_p->counts[i];
+    }
+    into_p->count += from_p->count;
+    into_p->sum += from_p->sum;
+    if ( from_p->max > into_p->max ) {
+        into_p->max = from_p->max;
+    }
+}
+
+/* The middle of the bucket holding the given percentile, at most the maximum. */
+static double
+histogramPercentile ( const struct histogram *hist_p, double percentile )
+{
+    solClient_uint64_t rank = ( solClient_uint64_t ) ( percentile / 100.0 * ( double ) hist_p->count );
+    solClient_uint64_t seen = 0;
+    solClient_uint64_t low;
+    double          mid;
+    int             shift;
+    int             i;
+
+    for ( i = 0; i < HIST_BUCKETS; i++ ) {
+        seen += hist_p->counts[i];
+        if ( seen > rank ) {
+            if ( i < 16 ) {
+                return ( double ) i;
+            }
+            shift = i / 16 - 1;
+            low = ( solClient_uint64_t ) ( 16 + i % 16 ) << shift;
+            mid = ( double ) low + ( double ) ( ( 1ULL << shift ) - 1 ) / 2.0;
+            return ( mid < ( double ) hist_p->max ) ? mid : ( double ) hist_p->max;
+        }
+    }
+    return ( double ) hist_p->max;
+}
+
+static void
+histogramPrint ( const char *title_p, const struct histogram *hist_p, double divisor, const char *unit_p )
+{
+    if ( hist_p->count == 0 ) {
+        printf ( "%-22s no samples\n", title_p );
+        return;
+    }
+    printf ( "%-22s n=%llu mean=%.1f p50=%.1f p90=%.1f p99=%.1f p99.9=%.1f max=%.1f %s\n", title_p,
+             ( unsigned long long ) hist_p->count, hist_p->sum / ( double ) hist_p->count / divisor,
+             histogramPercentile ( hist_p, 50.0 ) / divisor, histogramPercentile ( hist_p, 90.0 ) / divisor,
+             histogramPercentile ( hist_p, 99.0 ) / divisor, histogramPercentile ( hist_p, 99.9 ) / divisor,
+             ( double ) hist_p->max / divisor, unit_p );
+}
+
+/*****************************************************************************
+ * topicMatches
+ *
+ * Topic subscription matching: '*' matches one level, or the rest of a level
+ * after a prefix ("ab*"); a final '>' matches one or more levels.
+ *****************************************************************************/
+static int
+topicMatches ( const char *pattern_p, size_t patternLen, const char *topic_p, size_t topicLen )
+{
+    size_t          p = 0;
+    size_t          t = 0;
+    size_t          pEnd;
+    size_t          tEnd;
+
+    while ( p < patternLen ) {
+        for ( pEnd = p; pEnd < patternLen && pattern_p[pEnd] != '/'; pEnd++ ) {
+        }
+        if ( t > topicLen ) {
+            return 0;
+        }
+        for ( tEnd = t; tEnd < topicLen && topic_p[tEnd] != '/'; tEnd++ ) {
+        }
+        if ( pEnd - p == 1 && pattern_p[p] == '>' && pEnd == patternLen ) {
+            return t < topicLen;
+        }
+        if ( pEnd > p && pattern_p[pEnd - 1] == '*' ) {
+            if ( tEnd - t < pEnd - p - 1 || memcmp ( pattern_p + p, topic_p + t, pEnd - p - 1 ) != 0 ) {
+                return 0;
+            }
+        } else if ( pEnd - p != tEnd - t || memcmp ( pattern_p + p, topic_p + t, pEnd - p ) != 0 ) {
+            return 0;
+        }
+        p = pEnd + 1;
+        t = tEnd + 1;
+    }
+    return t == topicLen + 1;
+}
+
+/*****************************************************************************
+ * queryInit
+ *
+ * Finds the literal leading levels of the pattern for the Bloom filters.
+ *****************************************************************************/
+static void
+queryInit ( struct query *query_p, const char *pattern_p )
+{
+    size_t          i;
+    size_t          levelStart = 0;
+    size_t          literalEnd = 0;
+
+    query_p->pattern_p = pattern_p;
+    query_p->patternLen = strlen ( pattern_p );
+    query_p->literal = 1;
+    for ( i = 0; i <= query_p->patternLen; i++ ) {
+        if ( i == query_p->patternLen || pattern_p[i] == '/' ) {
+            if ( memchr ( pattern_p + levelStart, '*', i - levelStart ) != NULL ||
+                 ( i - levelStart == 1 && pattern_p[levelStart] == '>' ) ) {
+                query_p->literal = 0;
+                break;
+            }
+            literalEnd = i;
+            levelStart = i + 1;
+        }
+    }
+    query_p->usePrefix = ( literalEnd > 0 );
+    query_p->prefixHash = smflog_hash ( pattern_p, literalEnd );
+}
+
+/*****************************************************************************
+ * parseTime
+ *
+ * HH:MM[:SS[.fraction]] on the UTC day starting at dayStartNs, or seconds
+ * since the epoch.
+ *****************************************************************************/
+static int
+parseTime ( const char *str_p, solClient_uint64_t dayStartNs, solClient_uint64_t * ns_p )
+{
+    int             hours = 0;
+    int             minutes = 0;
+    double          seconds = 0.0;
+
+    if ( strchr ( str_p, ':' ) != NULL ) {
+        if ( sscanf ( str_p, "%d:%d:%lf", &hours, &minutes, &seconds ) < 2 ) {
+            return 0;
+        }
+        *ns_p = dayStartNs + ( ( solClient_uint64_t ) hours * 3600 + ( solClient_uint64_t ) minutes * 60 ) * 1000000000ULL +
+            ( solClient_uint64_t ) ( seconds * 1.0e9 );
+        return 1;
+    }
+    if ( sscanf ( str_p, "%lf", &seconds ) != 1 ) {
+        return 0;
+    }
+    *ns_p = ( solClient_uint64_t ) ( seconds * 1.0e9 );
+    return 1;
+}
+
+/*****************************************************************************
+ * formatTime
+ *****************************************************************************/
+static const char *
+formatTime ( solClient_uint64_t ns, char *buf_p )
+{
+    time_t          secs = ( time_t ) ( ns / 1000000000ULL );
+    struct tm      *tm_p = gmtime ( &secs );
+
+    if ( tm_p == NULL ) {
+        strcpy ( buf_p, "?" );
+    } else {
+        sprintf ( buf_p, "%04d-%02d-%02d %02d:%02d:%02d.%06u", tm_p->tm_year + 1900, tm_p->tm_mon + 1, tm_p->tm_mday,
+                  tm_p->tm_hour, tm_p->tm_min, tm_p->tm_sec, ( unsigned int ) ( ns % 1000000000ULL / 1000 ) );
+    }
+    return buf_p;
+}
+
+/*****************************************************************************
+ * scanSegment
+ *****************************************************************************/
+static void
+scanSegment ( const struct query *query_p, const struct smflogSegment *segment_p,
+              struct segmentEdge *edge_p, struct queryResult *result_p )
+{
+    const struct smflogBlock *block_p;
+    struct smflogCursor cursor;
+    struct smflogRecord record;
+    solClient_opaqueMsg_pt msg_p;
+    void           *payload_p;
+    solClient_uint32_t payloadSize;
+    solClient_int64_t senderMs;
+    solClient_uint64_t senderNs;
+    solClient_uint32_t b;
+
+    for ( b = 0; b < segment_p->numBlocks; b++ ) {
+        block_p = &segment_p->blocks_p[b];
+        if ( block_p->lastNs < query_p->fromNs || block_p->firstNs >= query_p->toNs ||
+             ( query_p->usePrefix && !smflog_blockMayContain ( block_p, query_p->prefixHash ) ) ) {
+            result_p->blocksSkipped++;
+            continue;
+        }
+        result_p->blocksScanned++;
+        result_p->bytesScanned += block_p->endOffset - block_p->offset;
+
+        smflog_cursorInit ( &cursor, segment_p, block_p );
+        while ( smflog_next ( &cursor, &record ) == SOLCLIENT_OK ) {
+            result_p->recordsScanned++;
+            if ( record.captureNs < query_p->fromNs || record.captureNs >= query_p->toNs ) {
+                continue;
+            }
+            if ( query_p->literal ) {
+                if ( record.topicLen != query_p->patternLen || memcmp ( record.topic_p, query_p->pattern_p, record.topicLen ) != 0 ) {
+                    continue;
+                }
+            } else if ( !topicMatches ( query_p->pattern_p, query_p->patternLen, record.topic_p, record.topicLen ) ) {
+                continue;
+            }
+
+            /* A match: the gap to the previous one, then what the message itself says. */
+            if ( edge_p->matches > 0 && record.captureNs >= edge_p->lastNs ) {
+                histogramAdd ( &result_p->gaps, record.captureNs - edge_p->lastNs );
+            }
+            if ( edge_p->matches++ == 0 ) {
+                edge_p->firstNs = record.captureNs;
+            }
+            edge_p->lastNs = record.captureNs;
+
+            if ( solClient_msg_decodeFromSmf ( &record.smf, &msg_p ) != SOLCLIENT_OK ) {
+                result_p->decodeErrors++;
+                continue;
+            }
+            if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &payload_p, &payloadSize ) != SOLCLIENT_OK ) {
+                payloadSize = 0;
+            }
+            histogramAdd ( &result_p->sizes, payloadSize );
+            result_p->payloadBytes += payloadSize;
+            if ( solClient_msg_getSenderTimestamp ( msg_p, &senderMs ) == SOLCLIENT_OK && senderMs > 0 ) {
+                senderNs = ( solClient_uint64_t ) senderMs * 1000000ULL;
+                if ( record.captureNs >= senderNs ) {
+                    histogramAdd ( &result_p->latency, record.captureNs - senderNs );
+                }
+            }
+            solClient_msg_free ( &msg_p );
+        }
+    }
+}
+
+/*****************************************************************************
+ * queryWorker
+ *
+ * Takes segments from the shared list until none are left.
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( queryWorker, arg_p )
+{
+    struct worker  *worker_p = ( struct worker * ) arg_p;
+    struct queryWork *work_p = worker_p->work_p;
+    int             segment;
+
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &work_p->lock );
+        segment = work_p->nextSegment++;
+        OS_MUTEX_UNLOCK ( &work_p->lock );
+        if ( segment >= work_p->numSegments ) {
+            break;
+        }
+        scanSegment ( work_p->query_p, &work_p->segments_p[segment], &work_p->edges_p[segment], worker_p->result_p );
+    }
+    OS_THREAD_RETURN;
+}
+
+
+/*
+ * fn main()
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    struct query    query;
+    struct queryWork work;
+    struct worker   workers[MAX_THREADS];
+    struct queryResult *total_p = NULL;
+    const char     *from_p = NULL;
+    const char     *to_p = NULL;
+    const char     *pattern_p = ">";
+    int             numThreads = os_getNumCpus (  );
+    int             numOpened = 0;
+    int             numIndexed = 0;
+    solClient_uint64_t mappedBytes = 0;
+    solClient_uint64_t dayStartNs;
+    solClient_uint64_t lastNs = 0;
+    solClient_uint64_t spanNs;
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    char            time1[40];
+    char            time2[40];
+    int             i;
+
+    printf ( "\nSmfLogQuery.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                LOG_LEVEL_MASK );   /* optional parameters */
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\t[topic=PATTERN] [from=TIME] [to=TIME] [threads=N] SEGMENT...\n"
+                                      "\t                    TIME is UTC HH:MM[:SS[.frac]] on the first capture day,\n"
+                                      "\t                    or seconds since the epoch.\n" ) == 0 ) {
+        exit ( 1 );
+    }
+
+    memset ( &work, 0, sizeof ( work ) );
+    if ( ( work.segments_p = ( struct smflogSegment * ) calloc ( argc, sizeof ( struct smflogSegment ) ) ) == NULL ||
+         ( work.edges_p = ( struct segmentEdge * ) calloc ( argc, sizeof ( struct segmentEdge ) ) ) == NULL ||
+         ( total_p = ( struct queryResult * ) calloc ( MAX_THREADS + 1, sizeof ( struct queryResult ) ) ) == NULL ) {
+        printf ( "Could not allocate the query state\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API; no Context or Session is needed
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Query terms, then map every segment
+     *************************************************************************/
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "topic=", 6 ) == 0 ) {
+            pattern_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "from=", 5 ) == 0 ) {
+            from_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "to=", 3 ) == 0 ) {
+            to_p = argv[i] + 3;
+        } else if ( strncmp ( argv[i], "threads=", 8 ) == 0 ) {
+            numThreads = atoi ( argv[i] + 8 );
+        } else if ( smflog_segmentOpen ( &work.segments_p[work.numSegments], argv[i] ) == SOLCLIENT_OK ) {
+            mappedBytes += work.segments_p[work.numSegments].map.size;
+            numIndexed += work.segments_p[work.numSegments].indexed;
+            work.numSegments++;
+        }
+    }
+    numOpened = work.numSegments;
+    if ( numOpened == 0 ) {
+        printf ( "No capture segments to query\n" );
+        goto cleanup;
+    }
+    if ( numThreads < 1 ) {
+        numThreads = 1;
+    }
+    if ( numThreads > MAX_THREADS ) {
+        numThreads = MAX_THREADS;
+    }
+    if ( numThreads > numOpened ) {
+        numThreads = numOpened;
+    }
+
+    /* Times of day are on the UTC day of the first indexed segment. */
+    dayStartNs = 0;
+    for ( i = 0; i < numOpened; i++ ) {
+        if ( work.segments_p[i].indexed && work.segments_p[i].records > 0 ) {
+            dayStartNs = work.segments_p[i].firstNs / NS_PER_DAY * NS_PER_DAY;
+            break;
+        }
+    }
+    queryInit ( &query, pattern_p );
+    query.fromNs = 0;
+    query.toNs = ~( solClient_uint64_t ) 0;
+    if ( ( from_p != NULL && !parseTime ( from_p, dayStartNs, &query.fromNs ) ) ||
+         ( to_p != NULL && !parseTime ( to_p, dayStartNs, &query.toNs ) ) ) {
+        printf ( "Could not parse the time range\n" );
+        goto closeSegments;
+    }
+
+    printf ( "Query: topic '%s', %s to %s UTC\n", pattern_p,
+             ( from_p != NULL ) ? formatTime ( query.fromNs, time1 ) : "start",
+             ( to_p != NULL ) ? formatTime ( query.toNs, time2 ) : "end" );
+    printf ( "       %d segments (%d indexed), %.1f MB mapped, %d threads\n\n",
+             numOpened, numIndexed, ( double ) mappedBytes / 1.0e6, numThreads );
+
+    /*************************************************************************
+     * Scan in parallel, one segment at a time per worker
+     *************************************************************************/
+    work.query_p = &query;
+    OS_MUTEX_INIT ( &work.lock );
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numThreads; i++ ) {
+        workers[i].work_p = &work;
+        workers[i].result_p = &total_p[i + 1];
+        if ( os_threadCreate ( &workers[i].thread, queryWorker, &workers[i] ) != 0 ) {
+            printf ( "Could not start worker %d\n", i );
+            numThreads = i;
+            break;
+        }
+    }
+    for ( i = 0; i < numThreads; i++ ) {
+        os_threadJoin ( workers[i].thread );
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    OS_MUTEX_DESTROY ( &work.lock );
+    if ( numThreads == 0 ) {
+        goto closeSegments;
+    }
+
+    /*************************************************************************
+     * Merge: worker totals, then the gaps between segments
+     *************************************************************************/
+    for ( i = 1; i <= numThreads; i++ ) {
+        total_p->payloadBytes += total_p[i].payloadBytes;
+        total_p->blocksScanned += total_p[i].blocksScanned;
+        total_p->blocksSkipped += total_p[i].blocksSkipped;
+        total_p->recordsScanned += total_p[i].recordsScanned;
+        total_p->bytesScanned += total_p[i].bytesScanned;
+        total_p->decodeErrors += total_p[i].decodeErrors;
+        histogramMerge ( &total_p->gaps, &total_p[i].gaps );
+        histogramMerge ( &total_p->sizes, &total_p[i].sizes );
+        histogramMerge ( &total_p->latency, &total_p[i].latency );
+    }
+    for ( i = 0; i < numOpened; i++ ) {
+        if ( work.edges_p[i].matches == 0 ) {
+            continue;
+        }
+        if ( total_p->matches == 0 ) {
+            total_p->firstNs = work.edges_p[i].firstNs;
+        } else if ( work.edges_p[i].firstNs >= lastNs ) {
+            histogramAdd ( &total_p->gaps, work.edges_p[i].firstNs - lastNs );
+        }
+        total_p->matches += work.edges_p[i].matches;
+        lastNs = work.edges_p[i].lastNs;
+    }
+    total_p->lastNs = lastNs;
+
+    /*************************************************************************
+     * Report
+     *************************************************************************/
+    printf ( "Scanned   %llu of %llu blocks, %llu records, %.1f MB in %.3f s: %.2f GB/s, %.1f M records/s\n",
+             ( unsigned long long ) total_p->blocksScanned,
+             ( unsigned long long ) ( total_p->blocksScanned + total_p->blocksSkipped ),
+             ( unsigned long long ) total_p->recordsScanned, ( double ) total_p->bytesScanned / 1.0e6,
+             ( double ) elapsedNs / 1.0e9, ( double ) total_p->bytesScanned / ( double ) ( elapsedNs ? elapsedNs : 1 ),
+             ( double ) total_p->recordsScanned * 1.0e3 / ( double ) ( elapsedNs ? elapsedNs : 1 ) );
+    if ( total_p->matches == 0 ) {
+        printf ( "Matched   0 messages\n" );
+        goto closeSegments;
+    }
+    spanNs = total_p->lastNs - total_p->firstNs;
+    printf ( "Matched   %llu messages (%llu decode errors), %s to %s\n",
+             ( unsigned long long ) total_p->matches, ( unsigned long long ) total_p->decodeErrors,
+             formatTime ( total_p->firstNs, time1 ), formatTime ( total_p->lastNs, time2 ) );
+    printf ( "Rate      %.0f msgs/s, %.3f MB/s of payload\n\n",
+             ( spanNs > 0 ) ? ( double ) ( total_p->matches - 1 ) * 1.0e9 / ( double ) spanNs : 0.0,
+             ( spanNs > 0 ) ? ( double ) total_p->payloadBytes * 1.0e3 / ( double ) spanNs : 0.0 );
+    histogramPrint ( "Inter-arrival", &total_p->gaps, 1000.0, "us" );
+    histogramPrint ( "Payload size", &total_p->sizes, 1.0, "bytes" );
+    histogramPrint ( "Latency (ms stamps)", &total_p->latency, 1000.0, "us" );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  closeSegments:
+    for ( i = 0; i < numOpened; i++ ) {
+        smflog_segmentClose ( &work.segments_p[i] );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    free ( work.segments_p );
+    free ( work.edges_p );
+    free ( total_p );
+    return 0;
+}
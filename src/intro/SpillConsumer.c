@@ -0,0 +1,422 @@
+/** @example Intro/SpillConsumer.c
+ */
+
+/*
+ * This sample consumes from a Queue faster than it processes, absorbing
+ * the backlog in a spill buffer (see spillbuf.h): the first window=N
+ * messages are kept in memory, the rest appended in SMF form to segment
+ * files prefix=PATH.<n>.spill of seg=BYTES, and read back in order once
+ * processing catches up. Each message takes process=US to process, and is
+ * acknowledged only then, whether it was kept or spilled. It binds to
+ * queue=NAME, or to a temporary Queue subscribed to --topic, and stops
+ * after --mn messages processed, or idle=MS without one.
+ *
+ * Without --cip, it measures the buffer on its own: --mn messages of
+ * size=BYTES are put with nothing taken, as during a stall, then all taken
+ * back, checking that they come in order and that a message read back
+ * stays valid after its segment is gone. It reports the spill and drain
+ * rates, the bytes kept in memory and on disk, and the same with a window
+ * holding everything, for comparison.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "spillbuf.h"
+#include "getopt.h"
+
+#define DEFAULT_SIZE            1024
+#define DEFAULT_PROCESS_US      100
+#define DEFAULT_IDLE_MS         2000
+#define DEFAULT_PREFIX          "SpillConsumer"
+
+/*****************************************************************************
+ * makeMsg
+ *
+ * A persistent message with an attachment of size bytes starting with seq.
+ *****************************************************************************/
+static          solClient_returnCode_t
+makeMsg ( solClient_opaqueMsg_pt * msg_p, solClient_uint64_t seq, char *payload_p, solClient_uint32_t size,
+          solClient_destination_t * destination_p )
+{
+    solClient_returnCode_t rc;
+
+    memcpy ( payload_p, &seq, sizeof ( seq ) );
+    if ( ( rc = solClient_msg_alloc ( msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_setDeliveryMode ( *msg_p, SOLCLIENT_DELIVERY_MODE_PERSISTENT ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setDestination ( *msg_p, destination_p, sizeof ( *destination_p ) ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setBinaryAttachment ( *msg_p, payload_p, size ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_set...()" );
+        solClient_msg_free ( msg_p );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * getSeq
+ *****************************************************************************/
+static          solClient_uint64_t
+getSeq ( solClient_opaqueMsg_pt msg_p )
+{
+    void           *payload_p;
+    solClient_uint32_t size;
+    solClient_uint64_t seq;
+
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &payload_p, &size ) != SOLCLIENT_OK || size < sizeof ( seq ) ) {
+        return ( solClient_uint64_t ) - 1;
+    }
+    memcpy ( &seq, payload_p, sizeof ( seq ) );
+    return seq;
+}
+
+/*****************************************************************************
+ * benchSpill
+ *
+ * Put numMsgs with nothing taken, then take them all back.
+ *****************************************************************************/
+static void
+benchSpill ( const char *label_p, solClient_uint64_t numMsgs, solClient_uint32_t size, solClient_uint32_t window,
+             const char *prefix_p, size_t segmentBytes )
+{
+    struct spillbuf buf;
+    struct spillbufStats stats;
+    struct spillbufItem item;
+    struct spillbufItem prev;
+    solClient_destination_t destination;
+    solClient_opaqueMsg_pt msg_p;
+    char           *payload_p;
+    solClient_uint64_t seq;
+    solClient_uint64_t expected = 0;
+    solClient_uint64_t disorder = 0;
+    solClient_uint64_t putNs;
+    solClient_uint64_t drainNs;
+    solClient_uint64_t startNs;
+    int             havePrev = 0;
+
+    if ( size < sizeof ( seq ) ) {
+        size = sizeof ( seq );
+    }
+    if ( ( payload_p = ( char * ) calloc ( 1, size ) ) == NULL ) {
+        return;
+    }
+    if ( spillbuf_init ( &buf, window, prefix_p, segmentBytes ) != SOLCLIENT_OK ) {
+        free ( payload_p );
+        return;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = "spill/bench";
+
+    startNs = os_getTimeNs (  );
+    for ( seq = 0; seq < numMsgs; seq++ ) {
+        if ( makeMsg ( &msg_p, seq, payload_p, size, &destination ) != SOLCLIENT_OK ) {
+            goto done;
+        }
+        if ( spillbuf_put ( &buf, NULL, msg_p ) != SOLCLIENT_CALLBACK_TAKE_MSG ) {
+            solClient_msg_free ( &msg_p );
+        }
+    }
+    putNs = os_getTimeNs (  ) - startNs;
+    spillbuf_getStats ( &buf, &stats );
+    printf ( "%s (window %u, %llu messages of %u bytes):\n", label_p, buf.capacity,
+             ( unsigned long long ) numMsgs, size );
+    printf ( "  put:   %llu kept, %llu spilled (%llu failed), %.0f msgs/s, %.1f MB/s; %llu segments, "
+             "%llu KB on disk at most\n",
+             ( unsigned long long ) stats.kept, ( unsigned long long ) stats.spilled,
+             ( unsigned long long ) stats.spillFailed, numMsgs * 1e9 / ( putNs + 1 ),
+             stats.spilledBytes * 1e3 / ( putNs + 1 ), ( unsigned long long ) stats.segments,
+             ( unsigned long long ) ( stats.diskHighWater / 1024 ) );
+
+    /*
+     * The previous message is checked after the next is taken, which may
+     * unmap and remove the segment it was read from.
+     */
+    startNs = os_getTimeNs (  );
+    while ( spillbuf_get ( &buf, &item, 0 ) != SOLCLIENT_WOULD_BLOCK ) {
+        if ( item.msg_p == NULL ) {
+            continue;
+        }
+        if ( havePrev ) {
+            if ( getSeq ( prev.msg_p ) != expected++ ) {
+                disorder++;
+            }
+            spillbuf_done ( &buf, &prev );
+        }
+        prev = item;
+        havePrev = 1;
+    }
+    if ( havePrev ) {
+        if ( getSeq ( prev.msg_p ) != expected++ ) {
+            disorder++;
+        }
+        spillbuf_done ( &buf, &prev );
+    }
+    drainNs = os_getTimeNs (  ) - startNs;
+    spillbuf_getStats ( &buf, &stats );
+    printf ( "  drain: %llu processed, %llu read back, %.0f msgs/s; %llu out of order or missing\n",
+             ( unsigned long long ) stats.processed, ( unsigned long long ) stats.readBack,
+             stats.processed * 1e9 / ( drainNs + 1 ),
+             ( unsigned long long ) ( disorder + ( numMsgs - stats.processed ) ) );
+
+  done:
+    spillbuf_destroy ( &buf );
+    free ( payload_p );
+}
+
+/*****************************************************************************
+ * flowRxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+flowRxCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    return spillbuf_put ( ( struct spillbuf * ) user_p, opaqueFlow_p, msg_p );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The topic for a temporary Queue.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Flow */
+    solClient_opaqueFlow_pt flow_p;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    const char     *flowProps[20] = {0, };
+    int             propIndex = 0;
+
+    /* Spill buffer */
+    static struct spillbuf buf;
+    struct spillbufStats stats;
+    struct spillbufItem item;
+    const char     *queue_p = NULL;
+    const char     *prefix_p = DEFAULT_PREFIX;
+    solClient_uint32_t window = SPILLBUF_DEFAULT_WINDOW;
+    solClient_uint32_t size = DEFAULT_SIZE;
+    size_t          segmentBytes = SPILLBUF_DEFAULT_SEGMENT_BYTES;
+    int             processUs = DEFAULT_PROCESS_US;
+    int             idleMs = DEFAULT_IDLE_MS;
+    solClient_uint64_t idleSinceNs;
+    solClient_uint64_t reportNs;
+    int             i;
+
+    printf ( "\nSpillConsumer.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 200000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tqueue=NAME          The Queue to consume (with --cip; else a temporary one on --topic).\n"
+                                      "\twindow=N            Messages kept in memory (default 10000).\n"
+                                      "\tprefix=PATH         Path prefix of the segment files (default SpillConsumer).\n"
+                                      "\tseg=BYTES           Segment file size (default 64 MB).\n"
+                                      "\tprocess=US          Time to process a message (default 100).\n"
+                                      "\tidle=MS             Stop after MS without a message (default 2000).\n"
+                                      "\tsize=BYTES          Without --cip, the message size (default 1024).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "queue=", 6 ) == 0 ) {
+            queue_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "window=", 7 ) == 0 ) {
+            window = ( solClient_uint32_t ) atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "prefix=", 7 ) == 0 ) {
+            prefix_p = argv[i] + 7;
+        } else if ( strncmp ( argv[i], "seg=", 4 ) == 0 ) {
+            segmentBytes = ( size_t ) atol ( argv[i] + 4 );
+        } else if ( strncmp ( argv[i], "process=", 8 ) == 0 ) {
+            processUs = atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "idle=", 5 ) == 0 ) {
+            idleMs = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            size = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( window < 1 || segmentBytes < 4096 || processUs < 0 || idleMs < 1 ) {
+        printf ( "Invalid arguments: window >= 1, seg >= 4096, process >= 0, idle >= 1\n" );
+        exit ( 1 );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || ( queue_p == NULL && commandOpts.destinationName[0] == ( char ) 0 ) ) ) {
+        printf ( "Consuming requires --cu, and queue=NAME or --topic\n" );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: the buffer on its own
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        solClient_uint64_t numMsgs = ( solClient_uint64_t ) commandOpts.numMsgsToSend;
+
+        benchSpill ( "All in memory", numMsgs, size, ( solClient_uint32_t ) numMsgs, prefix_p, segmentBytes );
+        benchSpill ( "Spilled", numMsgs, size, window, prefix_p, segmentBytes );
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 common_eventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( spillbuf_init ( &buf, window, prefix_p, segmentBytes ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * A client-acknowledged Flow, putting every message in the buffer
+     *************************************************************************/
+    flowFuncInfo.rxMsgInfo.callback_p = flowRxCallback;
+    flowFuncInfo.rxMsgInfo.user_p = &buf;
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_BLOCKING;
+    flowProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_ACKMODE_CLIENT;
+    if ( queue_p != NULL ) {
+        flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_NAME;
+        flowProps[propIndex++] = queue_p;
+    } else {
+        flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_DURABLE;
+        flowProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    }
+    if ( ( rc = solClient_session_createFlow ( ( char ** ) flowProps, session_p, &flow_p,
+                                               &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createFlow()" );
+        goto destroySpill;
+    }
+    if ( queue_p == NULL &&
+         ( rc = solClient_flow_topicSubscribeWithDispatch ( flow_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                            commandOpts.destinationName, NULL, 0 ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_topicSubscribeWithDispatch()" );
+        goto destroyFlow;
+    }
+    printf ( "Consuming, %d us per message, %u kept in memory, the rest spilled to %s.<n>.spill\n",
+             processUs, window, prefix_p );
+
+    /*************************************************************************
+     * Process in this thread, until --mn are done or none came for idle
+     *************************************************************************/
+    idleSinceNs = reportNs = os_getTimeNs (  );
+    for ( ;; ) {
+        spillbuf_getStats ( &buf, &stats );
+        if ( stats.processed >= ( solClient_uint64_t ) commandOpts.numMsgsToSend ||
+             os_getTimeNs (  ) - idleSinceNs >= idleMs * 1000000ULL ) {
+            break;
+        }
+        if ( os_getTimeNs (  ) - reportNs >= 1000000000ULL ) {
+            reportNs = os_getTimeNs (  );
+            printf ( "processed %llu, in memory %llu, on disk %llu (%llu KB at most), spilled %llu, failed %llu\n",
+                     ( unsigned long long ) stats.processed, ( unsigned long long ) stats.inMemory,
+                     ( unsigned long long ) stats.onDisk, ( unsigned long long ) ( stats.diskHighWater / 1024 ),
+                     ( unsigned long long ) stats.spilled, ( unsigned long long ) stats.spillFailed );
+        }
+        rc = spillbuf_get ( &buf, &item, 100 );
+        if ( rc == SOLCLIENT_WOULD_BLOCK ) {
+            continue;
+        }
+        idleSinceNs = os_getTimeNs (  );
+        if ( rc != SOLCLIENT_OK ) {
+            continue;
+        }
+        /* The application processes the message here. */
+        if ( processUs > 0 ) {
+            OS_SLEEP_US ( processUs );
+        }
+        spillbuf_done ( &buf, &item );
+    }
+    spillbuf_getStats ( &buf, &stats );
+    printf ( "Processed %llu: %llu kept, %llu spilled (%llu MB), %llu read back; acknowledged %llu, "
+             "%llu failed to spill, %llu to acknowledge; %llu KB on disk at most\n",
+             ( unsigned long long ) stats.processed, ( unsigned long long ) stats.kept,
+             ( unsigned long long ) stats.spilled, ( unsigned long long ) ( stats.spilledBytes >> 20 ),
+             ( unsigned long long ) stats.readBack, ( unsigned long long ) stats.acked,
+             ( unsigned long long ) stats.spillFailed, ( unsigned long long ) stats.ackFailed,
+             ( unsigned long long ) ( stats.diskHighWater / 1024 ) );
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  destroyFlow:
+    if ( ( rc = solClient_flow_destroy ( &flow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_destroy()" );
+    }
+
+  destroySpill:
+    /* What is left unprocessed is redelivered. */
+    spillbuf_destroy ( &buf );
+
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
@@ -0,0 +1,521 @@
+/** @example Intro/TrafficClassPublisher.c
+ */
+
+/*
+ * This sample measures how a flood of large bulk messages delays small
+ * urgent ones, with all traffic on one Session and with a Session per
+ * traffic class (see the traffic class router in common.h).
+ *
+ * A thread publishes size=N byte messages to "--topic/bulk" as fast as the
+ * Session takes them, while the main thread publishes --mn urgent messages
+ * of 8 bytes at --mr per second to "--topic/urgent", with priority 255. A
+ * Session on its own Context subscribes to the urgent topic and measures
+ * each message's latency from the send timestamp it carries, on the same
+ * host clock. This runs with the classes sharing one Session, then with
+ * each on its own (mode=shared|isolated|both), and prints the urgent
+ * latency percentiles and the bulk rate of each. ucpu=, ncpu= and bcpu=
+ * pin the Context thread of each class to a list of CPUs.
+ *
+ * Without --cip, the same runs go against a model of one link of bw=MB/s,
+ * with each connection holding up to buf=N bytes unsent (the API buffer
+ * plus the socket send buffer) and the link taking a segment in turn from
+ * each connection with data, as fair queueing would.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "getopt.h"
+
+#define MODE_SHARED             1
+#define MODE_ISOLATED           2
+
+#define URGENT_PRIORITY         255
+#define SIM_MSS                 1448    /* Bytes per segment. */
+#define SIM_HEADER              64      /* Bytes of message header. */
+#define SIM_MAX_QUEUED          4096    /* Messages a connection holds. */
+
+/**
+ * @struct simMsg
+ */
+struct simMsg
+{
+    solClient_uint32_t remaining;
+    int             urgent;
+    solClient_uint64_t sentNs;          /* When the application sent it. */
+};
+
+/**
+ * @struct simConnection
+ */
+struct simConnection
+{
+    struct simMsg   msgs[SIM_MAX_QUEUED];
+    solClient_uint32_t head;
+    solClient_uint32_t count;
+    solClient_uint64_t bytes;           /* Unsent. */
+};
+
+/**
+ * @struct liveRun
+ */
+struct liveRun
+{
+    struct commonClassRouter router;
+    solClient_opaqueMsg_pt bulkMsg_p;
+    volatile int    running;
+    volatile solClient_uint64_t bulkSent;
+    unsigned long long *latencies_p;
+    volatile int    received;
+    int             expected;
+};
+
+/*****************************************************************************
+ * compareNs
+ *****************************************************************************/
+static int
+compareNs ( const void *a_p, const void *b_p )
+{
+    unsigned long long a = *( const unsigned long long * ) a_p;
+    unsigned long long b = *( const unsigned long long * ) b_p;
+
+    return ( a < b ) ? -1 : ( a > b ) ? 1 : 0;
+}
+
+/*****************************************************************************
+ * printRun
+ *****************************************************************************/
+static void
+printRun ( const char *what_p, unsigned long long *latencies_p, int count, int expected, double bulkMBps )
+{
+    if ( count == 0 ) {
+        printf ( "%-9s no urgent messages received\n", what_p );
+        return;
+    }
+    qsort ( latencies_p, ( size_t ) count, sizeof ( latencies_p[0] ), compareNs );
+    printf ( "%-9s urgent p50 %8.1f us  p99 %8.1f us  p99.9 %8.1f us  max %8.1f us (%d of %d) | bulk %.1f MB/s\n",
+             what_p, ( double ) latencies_p[count / 2] / 1000.0, ( double ) latencies_p[count * 99 / 100] / 1000.0,
+             ( double ) latencies_p[count * 999 / 1000] / 1000.0, ( double ) latencies_p[count - 1] / 1000.0, count,
+             expected, bulkMBps );
+    fflush ( stdout );
+}
+
+/*****************************************************************************
+ * simEnqueue
+ *****************************************************************************/
+static void
+simEnqueue ( struct simConnection *conn_p, solClient_uint32_t bytes, int urgent, solClient_uint64_t sentNs )
+{
+    struct simMsg  *msg_p = &conn_p->msgs[( conn_p->head + conn_p->count ) % SIM_MAX_QUEUED];
+
+    msg_p->remaining = bytes;
+    msg_p->urgent = urgent;
+    msg_p->sentNs = sentNs;
+    conn_p->count++;
+    conn_p->bytes += bytes;
+}
+
+/*****************************************************************************
+ * simulateRun
+ *
+ * Connection 0 carries bulk, and urgent too when shared; connection 1
+ * carries urgent when isolated. The bulk sender keeps its connection full;
+ * an urgent sender blocks while its connection is full, as a blocking
+ * send does.
+ *****************************************************************************/
+static void
+simulateRun ( int mode, int numUrgent, double rate, solClient_uint32_t bulkBytes, double bwMBps,
+              solClient_uint64_t bufBytes, unsigned long long *latencies_p )
+{
+    static struct simConnection conns[2];
+    struct simConnection *urgentConn_p = &conns[( mode == MODE_SHARED ) ? 0 : 1];
+    struct simConnection *conn_p;
+    struct simMsg  *msg_p;
+    solClient_uint32_t urgentBytes = SIM_HEADER + 8;
+    solClient_uint32_t segment;
+    solClient_uint64_t nowNs = 0;
+    solClient_uint64_t nextUrgentNs = 0;
+    solClient_uint64_t bulkDone = 0;
+    double          nsPerByte = 1000.0 / bwMBps;
+    int             urgentSent = 0;
+    int             urgentDone = 0;
+    int             turn = 0;
+
+    memset ( conns, 0, sizeof ( conns ) );
+    bulkBytes += SIM_HEADER;
+    while ( urgentDone < numUrgent ) {
+        /* The bulk flood fills its connection. */
+        while ( conns[0].bytes + bulkBytes <= bufBytes && conns[0].count < SIM_MAX_QUEUED ) {
+            simEnqueue ( &conns[0], bulkBytes, 0, nowNs );
+        }
+        /* Urgent messages due, while there is room for them. */
+        while ( urgentSent < numUrgent && nextUrgentNs <= nowNs &&
+                urgentConn_p->bytes + urgentBytes <= bufBytes && urgentConn_p->count < SIM_MAX_QUEUED ) {
+            simEnqueue ( urgentConn_p, urgentBytes, 1, nextUrgentNs );
+            urgentSent++;
+            nextUrgentNs = ( solClient_uint64_t ) ( urgentSent * 1e9 / rate );
+        }
+        if ( conns[turn].count == 0 ) {
+            turn ^= 1;
+        }
+        conn_p = &conns[turn];
+        if ( conn_p->count == 0 ) {
+            nowNs = nextUrgentNs;
+            continue;
+        }
+
+        /* One segment on the link, from this connection's oldest messages. */
+        segment = SIM_MSS;
+        while ( segment > 0 && conn_p->count > 0 ) {
+            msg_p = &conn_p->msgs[conn_p->head];
+            if ( msg_p->remaining > segment ) {
+                msg_p->remaining -= segment;
+                conn_p->bytes -= segment;
+                nowNs += ( solClient_uint64_t ) ( segment * nsPerByte );
+                segment = 0;
+                break;
+            }
+            segment -= msg_p->remaining;
+            conn_p->bytes -= msg_p->remaining;
+            nowNs += ( solClient_uint64_t ) ( msg_p->remaining * nsPerByte );
+            if ( msg_p->urgent ) {
+                latencies_p[urgentDone++] = nowNs - msg_p->sentNs;
+            } else {
+                bulkDone++;
+            }
+            conn_p->head = ( conn_p->head + 1 ) % SIM_MAX_QUEUED;
+            conn_p->count--;
+        }
+        if ( mode == MODE_ISOLATED ) {
+            turn ^= 1;
+        }
+    }
+    printRun ( ( mode == MODE_SHARED ) ? "shared" : "isolated", latencies_p, urgentDone, numUrgent,
+               ( nowNs > 0 ) ? bulkDone * ( bulkBytes - SIM_HEADER ) * 1000.0 / nowNs : 0 );
+}
+
+/*****************************************************************************
+ * urgentRxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+urgentRxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct liveRun *run_p = ( struct liveRun * ) user_p;
+    solClient_uint64_t sentNs;
+    void           *data_p;
+    solClient_uint32_t size;
+
+    if ( run_p->received < run_p->expected &&
+         solClient_msg_getBinaryAttachmentPtr ( msg_p, &data_p, &size ) == SOLCLIENT_OK && size == sizeof ( sentNs ) ) {
+        memcpy ( &sentNs, data_p, sizeof ( sentNs ) );
+        run_p->latencies_p[run_p->received] = os_getTimeNs (  ) - sentNs;
+        run_p->received++;
+    }
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * bulkThread
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( bulkThread, arg_p )
+{
+    struct liveRun *run_p = ( struct liveRun * ) arg_p;
+
+    while ( run_p->running ) {
+        if ( common_classSend ( &run_p->router, run_p->bulkMsg_p ) == SOLCLIENT_OK ) {
+            run_p->bulkSent++;
+        }
+    }
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * liveRunMode
+ *****************************************************************************/
+static void
+liveRunMode ( struct liveRun *run_p, struct commonOptions *commonOpts, const struct commonClassConfig *configs_p,
+              int mode, solClient_uint32_t bulkBytes )
+{
+    solClient_returnCode_t rc;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    char            topic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 16];
+    char           *payload_p = NULL;
+    OS_THREAD       thread;
+    solClient_uint64_t sentNs;
+    solClient_uint64_t startNs;
+    solClient_uint64_t waitNs;
+    double          elapsedNs;
+    int             i;
+
+    run_p->received = 0;
+    run_p->bulkSent = 0;
+    if ( common_classRouterCreate ( &run_p->router, commonOpts, configs_p, mode == MODE_ISOLATED,
+                                    common_messageReceivePerfCallback, common_eventCallback, NULL ) != SOLCLIENT_OK ) {
+        return;
+    }
+    sprintf ( topic, "%s/urgent", commonOpts->destinationName );
+    common_classAddRoute ( &run_p->router, topic, COMMON_CLASS_URGENT );
+    sprintf ( topic, "%s/bulk", commonOpts->destinationName );
+    common_classAddRoute ( &run_p->router, topic, COMMON_CLASS_BULK );
+
+    /* One bulk message, sent over and over. */
+    if ( ( payload_p = ( char * ) calloc ( 1, bulkBytes ) ) == NULL ||
+         solClient_msg_alloc ( &run_p->bulkMsg_p ) != SOLCLIENT_OK || solClient_msg_alloc ( &msg_p ) != SOLCLIENT_OK ) {
+        goto destroyRouter;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = topic;
+    solClient_msg_setDeliveryMode ( run_p->bulkMsg_p, SOLCLIENT_DELIVERY_MODE_DIRECT );
+    solClient_msg_setDestination ( run_p->bulkMsg_p, &destination, sizeof ( destination ) );
+    solClient_msg_setBinaryAttachmentPtr ( run_p->bulkMsg_p, payload_p, bulkBytes );
+
+    sprintf ( topic, "%s/urgent", commonOpts->destinationName );
+    solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT );
+    solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) );
+    solClient_msg_setPriority ( msg_p, URGENT_PRIORITY );
+
+    run_p->running = 1;
+    if ( os_threadCreate ( &thread, bulkThread, run_p ) != 0 ) {
+        goto destroyRouter;
+    }
+    OS_SLEEP_US ( 200000 );
+
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < run_p->expected; i++ ) {
+        waitNs = startNs + ( solClient_uint64_t ) ( i * 1e9 / commonOpts->msgRate );
+        while ( os_getTimeNs (  ) < waitNs ) {
+        }
+        sentNs = os_getTimeNs (  );
+        solClient_msg_setBinaryAttachment ( msg_p, &sentNs, sizeof ( sentNs ) );
+        if ( ( rc = common_classSend ( &run_p->router, msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "common_classSend()" );
+            break;
+        }
+    }
+    elapsedNs = ( double ) ( os_getTimeNs (  ) - startNs );
+    OS_SLEEP_US ( 500000 );
+    run_p->running = 0;
+    os_threadJoin ( thread );
+
+    printRun ( ( mode == MODE_SHARED ) ? "shared" : "isolated", run_p->latencies_p, run_p->received, run_p->expected,
+               ( elapsedNs > 0 ) ? run_p->bulkSent * ( double ) bulkBytes * 1000.0 / elapsedNs : 0 );
+
+  destroyRouter:
+    if ( msg_p != NULL ) {
+        solClient_msg_free ( &msg_p );
+    }
+    if ( run_p->bulkMsg_p != NULL ) {
+        solClient_msg_free ( &run_p->bulkMsg_p );
+    }
+    free ( payload_p );
+    common_classRouterDestroy ( &run_p->router );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * param topic The base of the urgent and bulk topics.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Classes */
+    static struct liveRun run;
+    struct commonClassConfig configs[COMMON_NUM_CLASSES] = {
+        {NULL, NULL, NULL, NULL, 200},
+        {NULL, NULL, NULL, NULL, 100},
+        {NULL, NULL, NULL, NULL, 0}
+    };
+    char            topic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 16];
+    solClient_uint32_t bulkBytes = 65536;
+    solClient_uint64_t bufBytes = 0;
+    double          bwMBps = 125;
+    int             modes = MODE_SHARED | MODE_ISOLATED;
+    int             i;
+
+    printf ( "\nTrafficClassPublisher.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, 0,    /* required parameters */
+                                ( HOST_PARAM_MASK |
+                                  USER_PARAM_MASK |
+                                  DEST_PARAM_MASK |
+                                  PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  MSG_RATE_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 5000;
+    commandOpts.msgRate = 1000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tmode=M              shared, isolated or both (default both).\n"
+                                      "\tsize=N              Bytes per bulk message (default 65536).\n"
+                                      "\tucpu=LIST           CPUs of the urgent Context thread, e.g. 2 or 2-3.\n"
+                                      "\tncpu=LIST           CPUs of the normal Context thread.\n"
+                                      "\tbcpu=LIST           CPUs of the bulk Context thread.\n"
+                                      "\tbw=MBPS             Without --cip, the link rate in MB/s (default 125).\n"
+                                      "\tbuf=N               Without --cip, unsent bytes per connection (default\n"
+                                      "\t                    the API buffer plus the socket send buffer).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    for ( i = optind; i < argc; i++ ) {
+        if ( strcmp ( argv[i], "mode=shared" ) == 0 ) {
+            modes = MODE_SHARED;
+        } else if ( strcmp ( argv[i], "mode=isolated" ) == 0 ) {
+            modes = MODE_ISOLATED;
+        } else if ( strcmp ( argv[i], "mode=both" ) == 0 ) {
+            modes = MODE_SHARED | MODE_ISOLATED;
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            bulkBytes = ( solClient_uint32_t ) atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "ucpu=", 5 ) == 0 ) {
+            configs[COMMON_CLASS_URGENT].cpuList_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "ncpu=", 5 ) == 0 ) {
+            configs[COMMON_CLASS_NORMAL].cpuList_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "bcpu=", 5 ) == 0 ) {
+            configs[COMMON_CLASS_BULK].cpuList_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "bw=", 3 ) == 0 ) {
+            bwMBps = atof ( argv[i] + 3 );
+        } else if ( strncmp ( argv[i], "buf=", 4 ) == 0 ) {
+            bufBytes = ( solClient_uint64_t ) atoi ( argv[i] + 4 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( bulkBytes < 1 || bwMBps <= 0 || commandOpts.numMsgsToSend < 1 || commandOpts.msgRate < 1 ) {
+        printf ( "Invalid arguments: size >= 1, bw > 0, --mn >= 1, --mr >= 1\n" );
+        exit ( 1 );
+    }
+    if ( bufBytes == 0 ) {
+        bufBytes = atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_BUFFER_SIZE ) +
+            atoi ( SOLCLIENT_SESSION_PROP_DEFAULT_SOCKET_SEND_BUF_SIZE );
+    }
+    if ( commandOpts.targetHost[0] != ( char ) 0 &&
+         ( commandOpts.username[0] == ( char ) 0 || commandOpts.destinationName[0] == ( char ) 0 ) ) {
+        printf ( "Publishing requires --cu and --topic\n" );
+        exit ( 1 );
+    }
+
+    /* The bulk classes get larger buffers, the urgent class the defaults. */
+    configs[COMMON_CLASS_BULK].sendBufSize_p = "1048576";
+    configs[COMMON_CLASS_BULK].bufferSize_p = "1048576";
+
+    if ( ( run.latencies_p = ( unsigned long long * ) malloc ( commandOpts.numMsgsToSend *
+                                                               sizeof ( unsigned long long ) ) ) == NULL ) {
+        exit ( 1 );
+    }
+    run.expected = commandOpts.numMsgsToSend;
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    /*************************************************************************
+     * Without a broker: the modelled link
+     *************************************************************************/
+    if ( commandOpts.targetHost[0] == ( char ) 0 ) {
+        printf ( "%d urgent msgs at %d/s under a flood of %u byte bulk msgs, link %.0f MB/s, %llu bytes unsent "
+                 "per connection:\n", commandOpts.numMsgsToSend, commandOpts.msgRate, bulkBytes, bwMBps,
+                 ( unsigned long long ) bufBytes );
+        if ( modes & MODE_SHARED ) {
+            simulateRun ( MODE_SHARED, commandOpts.numMsgsToSend, commandOpts.msgRate, bulkBytes, bwMBps, bufBytes,
+                          run.latencies_p );
+        }
+        if ( modes & MODE_ISOLATED ) {
+            simulateRun ( MODE_ISOLATED, commandOpts.numMsgsToSend, commandOpts.msgRate, bulkBytes, bwMBps, bufBytes,
+                          run.latencies_p );
+        }
+        goto cleanup;
+    }
+
+    /*************************************************************************
+     * A Session on its own Context receives the urgent messages
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 urgentRxCallback,
+                                                 common_eventCallback, &run, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+    sprintf ( topic, "%s/urgent", commandOpts.destinationName );
+    if ( ( rc = solClient_session_topicSubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                      topic ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Publish, shared then isolated
+     *************************************************************************/
+    printf ( "%d urgent msgs at %d/s to '%s' under a flood of %u byte bulk msgs:\n", commandOpts.numMsgsToSend,
+             commandOpts.msgRate, topic, bulkBytes );
+    fflush ( stdout );
+    if ( modes & MODE_SHARED ) {
+        liveRunMode ( &run, &commandOpts, configs, MODE_SHARED, bulkBytes );
+    }
+    if ( modes & MODE_ISOLATED ) {
+        liveRunMode ( &run, &commandOpts, configs, MODE_ISOLATED, bulkBytes );
+    }
+
+    if ( ( rc = solClient_session_topicUnsubscribeExt ( session_p, SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM,
+                                                        topic ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_topicUnsubscribeExt()" );
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    free ( run.latencies_p );
+    return 0;
+}
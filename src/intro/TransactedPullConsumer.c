@@ -0,0 +1,793 @@
+/** @example Intro/TransactedPullConsumer.c
+ */
+
+/*
+ * This sample consumes a queue with transacted Flows that have no receive
+ * callback. Each worker thread owns a Transacted Session and its Flow, pulls
+ * messages with solClient_flow_receiveMsg() until it has a batch or the
+ * batch deadline passes, processes them, and commits once per batch.
+ *
+ *  |-------|  --->  Transacted Session 1 / Flow 1  <-- receiveMsg, commit --  worker 1
+ *  | Queue |  --->  Transacted Session 2 / Flow 2  <-- receiveMsg, commit --  worker 2
+ *  |-------|  --->  ...
+ *
+ * Pulling on the thread that processes avoids a queue hop, and a worker that
+ * falls behind simply stops pulling, so the Flow window gives back-pressure
+ * without a bounded queue of its own.
+ *
+ * For comparison, mode=handoff consumes the same way through a receive
+ * callback: each Transacted Session gets its own Message Dispatcher thread,
+ * whose callback hands messages to the worker thread and, at the end of each
+ * batch, waits for the worker to finish them before committing. The
+ * transaction is only committed from the callback while messages can still
+ * arrive in it; the last partial batch is committed by the main thread once
+ * the Flow is stopped and the worker closed to further callbacks, whose
+ * messages are then left to the rollback when the Session is destroyed.
+ *
+ * The queue is provisioned as a non-exclusive durable queue and loaded with
+ * -n persistent messages before each run. Settings are KEY=VALUE arguments:
+ *
+ *     queue=NAME      Queue to consume (default txPullQueue).
+ *     mode=both       pull, handoff or both.
+ *     workers=4       Worker threads.
+ *     batch=100       Messages per transaction, at most 256.
+ *     batchMs=10      Commit a partial batch this long after its first message.
+ *     workUs=0        Processing time per message, spun on the worker.
+ *     size=256        Payload size of the loaded messages.
+ *     load=1          0 to consume -n messages already on the queue.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+ *  For Windows builds, os.h should always be included first to ensure that
+ *  _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "getopt.h"
+
+#define MAX_WORKERS             64
+#define MAX_BATCH               256
+#define FIRST_MSG_WAIT_MS       100     /* Pull wait for the first message of a batch. */
+#define IDLE_STOP_SECS          5       /* A run ends early after this long without a commit. */
+
+#define MODE_PULL               0
+#define MODE_HANDOFF            1
+
+struct config
+{
+    const char     *queue_p;
+    int             workers;
+    int             batch;
+    int             batchMs;
+    int             workUs;
+    int             size;
+    int             load;
+};
+
+struct worker
+{
+    OS_THREAD       thread;
+    const struct config *config_p;
+    solClient_opaqueTransactedSession_pt txSession_p;
+    solClient_opaqueFlow_pt flow_p;
+
+    /* Handoff mode: messages from the dispatcher callback to the worker. */
+    OS_MUTEX        lock;               /* For the ring and the batch. */
+    OS_EVENT        pushed;
+    OS_EVENT        processed;          /* Also at the end of each callback. */
+    solClient_opaqueMsg_pt ring[MAX_BATCH];
+    unsigned int    head;               /* Messages pushed. */
+    unsigned int    tail;               /* Messages processed. */
+    unsigned int    batchCount;         /* Pushed in the open transaction. */
+    unsigned long long batchStartNs;
+    int             inCallback;
+    int             closed;             /* The main thread owns the transaction. */
+    volatile int    quit;
+
+    /* Results */
+    solClient_uint64_t msgs;
+    solClient_uint64_t commits;
+    solClient_uint64_t rollbacks;
+    solClient_uint64_t commitNs;
+    solClient_uint64_t maxCommitNs;
+    solClient_uint64_t checksum;
+    int             failed;
+};
+
+static volatile int stopping = 0;
+static OS_MUTEX countLock;
+static solClient_uint64_t consumed = 0;
+static solClient_uint64_t target = 0;
+static OS_EVENT finished;
+
+/* Publisher acknowledgements while loading the queue, under countLock. */
+static int      acksPending = 0;
+static int      rejected = 0;
+
+
+/*****************************************************************************
+ * loadEventCallback
+ *****************************************************************************/
+static void
+loadEventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                    solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    if ( eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_ACKNOWLEDGEMENT ) {
+        OS_MUTEX_LOCK ( &countLock );
+        acksPending--;
+        OS_MUTEX_UNLOCK ( &countLock );
+    } else if ( eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_REJECTED_MSG_ERROR ) {
+        OS_MUTEX_LOCK ( &countLock );
+        acksPending--;
+        rejected++;
+        OS_MUTEX_UNLOCK ( &countLock );
+    } else {
+        common_eventCallback ( opaqueSession_p, eventInfo_p, user_p );
+    }
+}
+
+/*****************************************************************************
+ * provisionQueue
+ *
+ * Unlike common_createQueue(), the queue is non-exclusive so that every
+ * worker's Flow gets a share of it.
+ *****************************************************************************/
+static          solClient_returnCode_t
+provisionQueue ( solClient_opaqueSession_pt session_p, const char *queueName_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    const char     *props[20] = {0, };
+    int             propIndex = 0;
+
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_ID;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_QUEUE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_NAME;
+    props[propIndex++] = queueName_p;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_ACCESSTYPE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_ACCESSTYPE_NONEXCLUSIVE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_PERMISSION;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PERM_DELETE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_QUOTA_MB;
+    props[propIndex++] = "1000";
+
+    if ( ( rc = solClient_session_endpointProvision ( ( char ** ) props, session_p,
+                                                      SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM |
+                                                      SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS,
+                                                      NULL, NULL, 0 ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_endpointProvision()" );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * loadQueue
+ *
+ * Publishes numMsgs persistent messages to the queue and waits until the
+ * broker has acknowledged them all, so that a run starts with a full queue.
+ *****************************************************************************/
+static          solClient_returnCode_t
+loadQueue ( solClient_opaqueSession_pt session_p, const struct config *config_p, int numMsgs )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_opaqueMsg_pt msg_p = NULL;
+    solClient_destination_t destination;
+    char           *payload_p;
+    int             waitSecs = 0;
+    int             pending;
+    int             i;
+
+    if ( ( payload_p = ( char * ) malloc ( ( size_t ) config_p->size + 1 ) ) == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    memset ( payload_p, 'p', ( size_t ) config_p->size );
+
+    if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        goto freePayload;
+    }
+    destination.destType = SOLCLIENT_QUEUE_DESTINATION;
+    destination.dest = config_p->queue_p;
+    if ( ( rc = solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_PERSISTENT ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setBinaryAttachmentPtr ( msg_p, payload_p, ( solClient_uint32_t ) config_p->size ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "building the load message" );
+        goto freeMsg;
+    }
+
+    OS_MUTEX_LOCK ( &countLock );
+    rejected = 0;
+    OS_MUTEX_UNLOCK ( &countLock );
+    for ( i = 0; i < numMsgs; i++ ) {
+        OS_MUTEX_LOCK ( &countLock );
+        acksPending++;
+        OS_MUTEX_UNLOCK ( &countLock );
+        if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+            OS_MUTEX_LOCK ( &countLock );
+            acksPending--;
+            OS_MUTEX_UNLOCK ( &countLock );
+            common_handleError ( rc, "solClient_session_sendMsg()" );
+            goto freeMsg;
+        }
+    }
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &countLock );
+        pending = acksPending;
+        OS_MUTEX_UNLOCK ( &countLock );
+        if ( pending == 0 || waitSecs++ == 30 ) {
+            break;
+        }
+        SLEEP ( 1 );
+    }
+    if ( pending > 0 || rejected > 0 ) {
+        printf ( "Loading the queue: %d messages unacknowledged, %d rejected\n", pending, rejected );
+        rc = SOLCLIENT_FAIL;
+    }
+
+  freeMsg:
+    solClient_msg_free ( &msg_p );
+  freePayload:
+    free ( payload_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * processMessage
+ *
+ * Stands in for the application's work: reads the payload and spins for
+ * workUs microseconds.
+ *****************************************************************************/
+static void
+processMessage ( struct worker *worker_p, solClient_opaqueMsg_pt msg_p )
+{
+    void           *data_p;
+    solClient_uint32_t size;
+    unsigned long long endNs;
+    solClient_uint32_t i;
+
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &data_p, &size ) == SOLCLIENT_OK ) {
+        for ( i = 0; i < size; i += 64 ) {
+            worker_p->checksum += ( ( unsigned char * ) data_p )[i];
+        }
+    }
+    if ( worker_p->config_p->workUs > 0 ) {
+        endNs = os_getTimeNs (  ) + ( unsigned long long ) worker_p->config_p->workUs * 1000ULL;
+        while ( os_getTimeNs (  ) < endNs ) {
+        }
+    }
+}
+
+/*****************************************************************************
+ * commitBatch
+ *
+ * Commits the open transaction of numMsgs messages and counts them.
+ *****************************************************************************/
+static          solClient_returnCode_t
+commitBatch ( struct worker *worker_p, unsigned int numMsgs )
+{
+    solClient_returnCode_t rc;
+    unsigned long long startNs = os_getTimeNs (  );
+    unsigned long long commitNs;
+
+    rc = solClient_transactedSession_commit ( worker_p->txSession_p );
+    commitNs = os_getTimeNs (  ) - startNs;
+    worker_p->commitNs += commitNs;
+    if ( commitNs > worker_p->maxCommitNs ) {
+        worker_p->maxCommitNs = commitNs;
+    }
+
+    if ( rc == SOLCLIENT_ROLLBACK ) {
+        /* The messages are redelivered and counted again then. */
+        worker_p->rollbacks++;
+        return rc;
+    }
+    if ( rc != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_transactedSession_commit()" );
+        worker_p->failed = 1;
+        return rc;
+    }
+    worker_p->commits++;
+    worker_p->msgs += numMsgs;
+
+    OS_MUTEX_LOCK ( &countLock );
+    consumed += numMsgs;
+    if ( consumed >= target ) {
+        os_eventSignal ( &finished );
+    }
+    OS_MUTEX_UNLOCK ( &countLock );
+    return rc;
+}
+
+/*****************************************************************************
+ * pullWorker
+ *
+ * Pulls a batch, waiting FIRST_MSG_WAIT_MS at most for its first message
+ * and then until batchMs after it, processes each message as it arrives,
+ * and commits the batch.
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( pullWorker, arg_p )
+{
+    struct worker  *worker_p = ( struct worker * ) arg_p;
+    const struct config *config_p = worker_p->config_p;
+    solClient_returnCode_t rc;
+    solClient_opaqueMsg_pt msg_p;
+    unsigned long long deadlineNs;
+    unsigned long long nowNs;
+    unsigned int    numMsgs;
+
+    while ( !stopping && !worker_p->failed ) {
+        if ( ( rc = solClient_flow_receiveMsg ( worker_p->flow_p, &msg_p, FIRST_MSG_WAIT_MS ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_flow_receiveMsg()" );
+            worker_p->failed = 1;
+            break;
+        }
+        if ( msg_p == NULL ) {
+            continue;
+        }
+
+        deadlineNs = os_getTimeNs (  ) + ( unsigned long long ) config_p->batchMs * 1000000ULL;
+        numMsgs = 0;
+        while ( msg_p != NULL ) {
+            processMessage ( worker_p, msg_p );
+            solClient_msg_free ( &msg_p );
+            if ( ++numMsgs == ( unsigned int ) config_p->batch || ( nowNs = os_getTimeNs (  ) ) >= deadlineNs ) {
+                break;
+            }
+            /* A deadline less than a millisecond away is a poll. */
+            if ( ( rc = solClient_flow_receiveMsg ( worker_p->flow_p, &msg_p,
+                                                    ( solClient_int32_t ) ( ( deadlineNs - nowNs ) / 1000000ULL ) ) ) != SOLCLIENT_OK ) {
+                common_handleError ( rc, "solClient_flow_receiveMsg()" );
+                worker_p->failed = 1;
+                msg_p = NULL;
+            }
+        }
+        commitBatch ( worker_p, numMsgs );
+    }
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * handoffMessageReceiveCallback
+ *
+ * Runs on the Transacted Session's Message Dispatcher thread. The message is
+ * handed to the worker; once the batch is full or due, the callback waits
+ * until the worker has processed it and commits. After the worker is closed
+ * the message is returned to the API, and rolled back with the Session.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+handoffMessageReceiveCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct worker  *worker_p = ( struct worker * ) user_p;
+    const struct config *config_p = worker_p->config_p;
+    unsigned long long nowNs = os_getTimeNs (  );
+    unsigned int    batchCount = 0;
+    int             drained;
+
+    /* The ring holds a whole batch, and is drained before the next one. */
+    OS_MUTEX_LOCK ( &worker_p->lock );
+    if ( worker_p->closed ) {
+        OS_MUTEX_UNLOCK ( &worker_p->lock );
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    worker_p->inCallback = 1;
+    if ( worker_p->batchCount == 0 ) {
+        worker_p->batchStartNs = nowNs;
+    }
+    worker_p->ring[worker_p->head++ % MAX_BATCH] = msg_p;
+    if ( ++worker_p->batchCount == ( unsigned int ) config_p->batch ||
+         nowNs - worker_p->batchStartNs >= ( unsigned long long ) config_p->batchMs * 1000000ULL ) {
+        batchCount = worker_p->batchCount;
+    }
+    OS_MUTEX_UNLOCK ( &worker_p->lock );
+    os_eventSignal ( &worker_p->pushed );
+
+    if ( batchCount != 0 ) {
+        for ( ;; ) {
+            OS_MUTEX_LOCK ( &worker_p->lock );
+            drained = ( worker_p->tail == worker_p->head );
+            OS_MUTEX_UNLOCK ( &worker_p->lock );
+            if ( drained ) {
+                break;
+            }
+            os_eventWait ( &worker_p->processed, 100 );
+        }
+        commitBatch ( worker_p, batchCount );
+    }
+
+    OS_MUTEX_LOCK ( &worker_p->lock );
+    if ( batchCount != 0 ) {
+        worker_p->batchCount = 0;
+    }
+    worker_p->inCallback = 0;
+    OS_MUTEX_UNLOCK ( &worker_p->lock );
+    os_eventSignal ( &worker_p->processed );
+
+    /* The worker frees the message. */
+    return SOLCLIENT_CALLBACK_TAKE_MSG;
+}
+
+/*****************************************************************************
+ * handoffWorker
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( handoffWorker, arg_p )
+{
+    struct worker  *worker_p = ( struct worker * ) arg_p;
+    solClient_opaqueMsg_pt msg_p;
+
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &worker_p->lock );
+        if ( worker_p->tail == worker_p->head ) {
+            OS_MUTEX_UNLOCK ( &worker_p->lock );
+            if ( worker_p->quit ) {
+                break;
+            }
+            os_eventWait ( &worker_p->pushed, 100 );
+            continue;
+        }
+        msg_p = worker_p->ring[worker_p->tail % MAX_BATCH];
+        OS_MUTEX_UNLOCK ( &worker_p->lock );
+
+        processMessage ( worker_p, msg_p );
+        solClient_msg_free ( &msg_p );
+
+        OS_MUTEX_LOCK ( &worker_p->lock );
+        worker_p->tail++;
+        OS_MUTEX_UNLOCK ( &worker_p->lock );
+        os_eventSignal ( &worker_p->processed );
+    }
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * commitHandoffRemainder
+ *
+ * The last partial batch of a handoff worker is not due until another
+ * message arrives, so it is committed here once the Flow is stopped. The
+ * messages still on their way to the dispatcher are given a while to
+ * arrive; then, with no callback running and the batch processed, the
+ * worker is closed under its lock, so that no later callback touches the
+ * Transacted Session, and the batch is committed from this thread.
+ *****************************************************************************/
+static void
+commitHandoffRemainder ( struct worker *worker_p )
+{
+    unsigned int    head = 0;
+    unsigned int    batchCount = 0;
+    int             quiet = 0;
+
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &worker_p->lock );
+        quiet = ( worker_p->head == head && worker_p->tail == head && !worker_p->inCallback ) ? quiet + 1 : 0;
+        if ( quiet == 2 ) {
+            worker_p->closed = 1;
+            batchCount = worker_p->batchCount;
+            worker_p->batchCount = 0;
+            OS_MUTEX_UNLOCK ( &worker_p->lock );
+            break;
+        }
+        head = worker_p->head;
+        OS_MUTEX_UNLOCK ( &worker_p->lock );
+        os_eventWait ( &worker_p->processed, 50 );
+    }
+    if ( batchCount > 0 ) {
+        commitBatch ( worker_p, batchCount );
+    }
+}
+
+/*****************************************************************************
+ * createWorkerFlow
+ *
+ * Creates the worker's Transacted Session and a stopped Flow on the queue;
+ * in handoff mode with a receive callback on a dispatcher of its own.
+ *****************************************************************************/
+static          solClient_returnCode_t
+createWorkerFlow ( solClient_opaqueSession_pt session_p, struct worker *worker_p, int mode )
+{
+    solClient_returnCode_t rc;
+    solClient_flow_createFuncInfo_t flowFuncInfo = SOLCLIENT_FLOW_CREATEFUNC_INITIALIZER;
+    const char     *txProps[10] = {0, };
+    const char     *flowProps[20] = {0, };
+    int             propIndex = 0;
+
+    txProps[propIndex++] = SOLCLIENT_TRANSACTEDSESSION_PROP_HAS_PUBLISHER;
+    txProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    txProps[propIndex++] = SOLCLIENT_TRANSACTEDSESSION_PROP_CREATE_MESSAGE_DISPATCHER;
+    txProps[propIndex++] = ( mode == MODE_HANDOFF ) ? SOLCLIENT_PROP_ENABLE_VAL : SOLCLIENT_PROP_DISABLE_VAL;
+
+    if ( ( rc = solClient_session_createTransactedSession ( ( char ** ) txProps, session_p,
+                                                            &worker_p->txSession_p, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_createTransactedSession()" );
+        return rc;
+    }
+
+    if ( mode == MODE_HANDOFF ) {
+        flowFuncInfo.rxMsgInfo.callback_p = handoffMessageReceiveCallback;
+        flowFuncInfo.rxMsgInfo.user_p = worker_p;
+    }
+    flowFuncInfo.eventInfo.callback_p = common_flowEventCallback;
+
+    propIndex = 0;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_ID;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_ENTITY_QUEUE;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_BIND_NAME;
+    flowProps[propIndex++] = worker_p->config_p->queue_p;
+    flowProps[propIndex++] = SOLCLIENT_FLOW_PROP_START_STATE;
+    flowProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+
+    if ( ( rc = solClient_transactedSession_createFlow ( ( char ** ) flowProps, worker_p->txSession_p,
+                                                         &worker_p->flow_p, &flowFuncInfo, sizeof ( flowFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_transactedSession_createFlow()" );
+        solClient_transactedSession_destroy ( &worker_p->txSession_p );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * runMode
+ *
+ * Consumes numMsgs messages with config_p->workers workers and reports the
+ * rate and the commit statistics.
+ *****************************************************************************/
+static void
+runMode ( solClient_opaqueSession_pt session_p, const struct config *config_p, int mode, int numMsgs )
+{
+    struct worker  *workers_p;
+    struct worker   total;
+    unsigned long long startNs;
+    unsigned long long elapsedNs;
+    solClient_uint64_t lastConsumed = 0;
+    int             idleSecs = 0;
+    int             numWorkers = 0;
+    int             i;
+
+    if ( ( workers_p = ( struct worker * ) calloc ( ( size_t ) config_p->workers, sizeof ( struct worker ) ) ) == NULL ) {
+        return;
+    }
+    stopping = 0;
+    consumed = 0;
+    target = ( solClient_uint64_t ) numMsgs;
+    os_eventWait ( &finished, 0 );
+
+    for ( i = 0; i < config_p->workers; i++ ) {
+        workers_p[i].config_p = config_p;
+        OS_MUTEX_INIT ( &workers_p[i].lock );
+        os_eventInit ( &workers_p[i].pushed );
+        os_eventInit ( &workers_p[i].processed );
+        if ( createWorkerFlow ( session_p, &workers_p[i], mode ) != SOLCLIENT_OK ) {
+            break;
+        }
+        if ( os_threadCreate ( &workers_p[i].thread, ( mode == MODE_PULL ) ? pullWorker : handoffWorker,
+                               &workers_p[i] ) != 0 ) {
+            printf ( "Could not start worker %d\n", i );
+            solClient_flow_destroy ( &workers_p[i].flow_p );
+            solClient_transactedSession_destroy ( &workers_p[i].txSession_p );
+            break;
+        }
+        numWorkers++;
+    }
+
+    startNs = os_getTimeNs (  );
+    for ( i = 0; i < numWorkers; i++ ) {
+        solClient_flow_start ( workers_p[i].flow_p );
+    }
+    while ( numWorkers > 0 && os_eventWait ( &finished, 1000 ) != 0 ) {
+        OS_MUTEX_LOCK ( &countLock );
+        idleSecs = ( consumed == lastConsumed ) ? idleSecs + 1 : 0;
+        lastConsumed = consumed;
+        OS_MUTEX_UNLOCK ( &countLock );
+        if ( idleSecs == IDLE_STOP_SECS ) {
+            printf ( "No commits for %d s, stopping with %llu of %d messages\n", IDLE_STOP_SECS,
+                     ( unsigned long long ) lastConsumed, numMsgs );
+            break;
+        }
+    }
+    elapsedNs = os_getTimeNs (  ) - startNs;
+    stopping = 1;
+
+    for ( i = 0; i < numWorkers; i++ ) {
+        solClient_flow_stop ( workers_p[i].flow_p );
+    }
+    memset ( &total, 0, sizeof ( total ) );
+    for ( i = 0; i < numWorkers; i++ ) {
+        if ( mode == MODE_HANDOFF ) {
+            commitHandoffRemainder ( &workers_p[i] );
+            workers_p[i].quit = 1;
+        }
+        os_threadJoin ( workers_p[i].thread );
+        /* Uncommitted messages are rolled back and stay on the queue. */
+        solClient_flow_destroy ( &workers_p[i].flow_p );
+        solClient_transactedSession_destroy ( &workers_p[i].txSession_p );
+
+        total.msgs += workers_p[i].msgs;
+        total.commits += workers_p[i].commits;
+        total.rollbacks += workers_p[i].rollbacks;
+        total.commitNs += workers_p[i].commitNs;
+        if ( workers_p[i].maxCommitNs > total.maxCommitNs ) {
+            total.maxCommitNs = workers_p[i].maxCommitNs;
+        }
+    }
+    for ( i = 0; i < config_p->workers; i++ ) {
+        OS_MUTEX_DESTROY ( &workers_p[i].lock );
+        os_eventDestroy ( &workers_p[i].pushed );
+        os_eventDestroy ( &workers_p[i].processed );
+    }
+    free ( workers_p );
+
+    if ( numWorkers == 0 || total.commits == 0 ) {
+        printf ( "%-8s no messages consumed\n", ( mode == MODE_PULL ) ? "pull" : "handoff" );
+        return;
+    }
+    printf ( "%-8s %3d workers %8llu msgs %8.3f s %10.0f msgs/s  commits %llu (avg batch %.1f, "
+             "mean %.0f us, max %.0f us)  rollbacks %llu\n",
+             ( mode == MODE_PULL ) ? "pull" : "handoff", numWorkers, ( unsigned long long ) total.msgs,
+             ( double ) elapsedNs / 1.0e9, ( double ) total.msgs * 1.0e9 / ( double ) elapsedNs,
+             ( unsigned long long ) total.commits, ( double ) total.msgs / ( double ) total.commits,
+             ( double ) total.commitNs / ( double ) total.commits / 1000.0, ( double ) total.maxCommitNs / 1000.0,
+             ( unsigned long long ) total.rollbacks );
+    fflush ( stdout );
+}
+
+
+/*
+ * fn main()
+ * param appliance_ip The message backbone IP address.
+ * param appliance_username The client username.
+ * The entry point to the application.
+ */
+int
+main ( int argc, char *argv[] )
+{
+    struct commonOptions commandOpts;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    /* Context */
+    solClient_opaqueContext_pt context_p;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+
+    /* Session */
+    solClient_opaqueSession_pt session_p;
+
+    /* Runs */
+    struct config   config;
+    const char     *mode_p = "both";
+    int             i;
+
+    printf ( "\nTransactedPullConsumer.c (Copyright 2026 Solace Corporation. All rights reserved.)\n" );
+
+    /*************************************************************************
+     * Parse command options
+     *************************************************************************/
+    common_initCommandOptions ( &commandOpts, ( HOST_PARAM_MASK | USER_PARAM_MASK ),    /* required parameters */
+                                ( PASS_PARAM_MASK |
+                                  NUM_MSGS_MASK |
+                                  LOG_LEVEL_MASK |
+                                  USE_GSS_MASK |
+                                  ZIP_LEVEL_MASK ) );                   /* optional parameters */
+    commandOpts.numMsgsToSend = 100000;
+    if ( common_parseCommandOptions ( argc, argv, &commandOpts,
+                                      "\tqueue=NAME          Queue to consume (default txPullQueue).\n"
+                                      "\tmode=MODE           pull, handoff or both (default both).\n"
+                                      "\tworkers=N           Worker threads (default 4).\n"
+                                      "\tbatch=N             Messages per transaction, at most 256 (default 100).\n"
+                                      "\tbatchMs=N           Partial batch commit deadline (default 10).\n"
+                                      "\tworkUs=N            Processing time per message (default 0).\n"
+                                      "\tsize=N              Payload size of loaded messages (default 256).\n"
+                                      "\tload=0|1            Load -n messages before each run (default 1).\n" ) == 0 ) {
+        exit ( 1 );
+    }
+    config.queue_p = "txPullQueue";
+    config.workers = 4;
+    config.batch = 100;
+    config.batchMs = 10;
+    config.workUs = 0;
+    config.size = 256;
+    config.load = 1;
+    for ( i = optind; i < argc; i++ ) {
+        if ( strncmp ( argv[i], "queue=", 6 ) == 0 ) {
+            config.queue_p = argv[i] + 6;
+        } else if ( strncmp ( argv[i], "mode=", 5 ) == 0 ) {
+            mode_p = argv[i] + 5;
+        } else if ( strncmp ( argv[i], "workers=", 8 ) == 0 ) {
+            config.workers = atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "batch=", 6 ) == 0 ) {
+            config.batch = atoi ( argv[i] + 6 );
+        } else if ( strncmp ( argv[i], "batchMs=", 8 ) == 0 ) {
+            config.batchMs = atoi ( argv[i] + 8 );
+        } else if ( strncmp ( argv[i], "workUs=", 7 ) == 0 ) {
+            config.workUs = atoi ( argv[i] + 7 );
+        } else if ( strncmp ( argv[i], "size=", 5 ) == 0 ) {
+            config.size = atoi ( argv[i] + 5 );
+        } else if ( strncmp ( argv[i], "load=", 5 ) == 0 ) {
+            config.load = atoi ( argv[i] + 5 );
+        } else {
+            printf ( "Unknown argument '%s'\n", argv[i] );
+            exit ( 1 );
+        }
+    }
+    if ( config.workers < 1 || config.workers > MAX_WORKERS || config.batch < 1 || config.batch > MAX_BATCH ||
+         config.batchMs < 1 || config.size < 0 ||
+         ( strcmp ( mode_p, "pull" ) != 0 && strcmp ( mode_p, "handoff" ) != 0 && strcmp ( mode_p, "both" ) != 0 ) ) {
+        printf ( "Invalid arguments: workers 1..%d, batch 1..%d, batchMs >= 1, mode pull, handoff or both\n",
+                 MAX_WORKERS, MAX_BATCH );
+        exit ( 1 );
+    }
+
+    /*************************************************************************
+     * Initialize the API and setup logging level
+     *************************************************************************/
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, NULL ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+        goto notInitialized;
+    }
+
+    common_printCCSMPversion (  );
+
+    solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, commandOpts.logLevel );
+
+    OS_MUTEX_INIT ( &countLock );
+    os_eventInit ( &finished );
+
+    /*************************************************************************
+     * Create a Context, and a Session on it
+     *************************************************************************/
+    if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                           &context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        goto cleanup;
+    }
+
+    if ( ( rc = common_createAndConnectSession ( context_p,
+                                                 &session_p,
+                                                 common_messageReceivePerfCallback,
+                                                 loadEventCallback, NULL, &commandOpts ) ) != SOLCLIENT_OK ) {
+        goto cleanup;
+    }
+
+    if ( !solClient_session_isCapable ( session_p, SOLCLIENT_SESSION_CAPABILITY_TRANSACTED_SESSION ) ) {
+        printf ( "Transacted Sessions are not supported by this broker.\n" );
+        goto sessionConnected;
+    }
+    if ( provisionQueue ( session_p, config.queue_p ) != SOLCLIENT_OK ) {
+        goto sessionConnected;
+    }
+
+    /*************************************************************************
+     * Run each mode on the same load
+     *************************************************************************/
+    printf ( "Queue '%s', %d messages of %d bytes, batch %d or %d ms, %d us of work per message\n",
+             config.queue_p, commandOpts.numMsgsToSend, config.size, config.batch, config.batchMs, config.workUs );
+    if ( strcmp ( mode_p, "handoff" ) != 0 ) {
+        if ( !config.load || loadQueue ( session_p, &config, commandOpts.numMsgsToSend ) == SOLCLIENT_OK ) {
+            runMode ( session_p, &config, MODE_PULL, commandOpts.numMsgsToSend );
+        }
+    }
+    if ( strcmp ( mode_p, "pull" ) != 0 ) {
+        if ( !config.load || loadQueue ( session_p, &config, commandOpts.numMsgsToSend ) == SOLCLIENT_OK ) {
+            runMode ( session_p, &config, MODE_HANDOFF, commandOpts.numMsgsToSend );
+        }
+    }
+
+    /*************************************************************************
+     * CLEANUP
+     *************************************************************************/
+  sessionConnected:
+    if ( ( rc = solClient_session_disconnect ( session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+
+  cleanup:
+    os_eventDestroy ( &finished );
+    OS_MUTEX_DESTROY ( &countLock );
+    if ( ( rc = solClient_cleanup (  ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_cleanup()" );
+    }
+
+  notInitialized:
+    return 0;
+}
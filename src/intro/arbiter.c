@@ -0,0 +1,260 @@
+
+/** example Intro/arbiter.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * First-arrival arbitration of two feeds by sender ID and sequence number.
+ * See arbiter.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "arbiter.h"
+
+#define ARBITER_SLOT_EMPTY          0
+#define ARBITER_SLOT_FIRST          1
+#define ARBITER_SLOT_PAIRED         2
+
+
+/*****************************************************************************
+ * arbiter_roundUp
+ *****************************************************************************/
+static          solClient_uint32_t
+arbiter_roundUp ( solClient_uint32_t value )
+{
+    solClient_uint32_t power = 1;
+
+    while ( power < value && power < 0x80000000u ) {
+        power <<= 1;
+    }
+    return power;
+}
+
+/*****************************************************************************
+ * arbiter_findSender
+ *
+ * Open addressing over the sender table. Returns NULL if the sender is new
+ * and the table is full. Must be called with the lock held.
+ *****************************************************************************/
+static struct arbiterSender *
+arbiter_findSender ( struct arbiter *arb_p, solClient_uint64_t hash )
+{
+    solClient_uint32_t mask = arb_p->maxSenders - 1;
+    solClient_uint32_t i = ( solClient_uint32_t ) hash & mask;
+    struct arbiterSender *sender_p;
+
+    for ( ;; ) {
+        sender_p = &arb_p->senders_p[i];
+        if ( sender_p->hash == hash ) {
+            return sender_p;
+        }
+        if ( sender_p->hash == 0 ) {
+            /* Keep one entry free so that lookups of new senders end. */
+            if ( arb_p->numSenders + 1 >= arb_p->maxSenders ) {
+                return NULL;
+            }
+            sender_p->hash = hash;
+            sender_p->highSeq = 0;
+            arb_p->numSenders++;
+            return sender_p;
+        }
+        i = ( i + 1 ) & mask;
+    }
+}
+
+
+/*****************************************************************************
+ * arbiter_init
+ *****************************************************************************/
+solClient_returnCode_t
+arbiter_init ( struct arbiter *arb_p, solClient_uint32_t maxSenders, solClient_uint32_t window )
+{
+    solClient_uint32_t i;
+
+    memset ( arb_p, 0, sizeof ( *arb_p ) );
+    /* One table entry stays free. */
+    arb_p->maxSenders = arbiter_roundUp ( ( ( maxSenders != 0 ) ? maxSenders : ARBITER_DEFAULT_MAX_SENDERS ) + 1 );
+    arb_p->window = arbiter_roundUp ( ( window != 0 ) ? window : ARBITER_DEFAULT_WINDOW );
+
+    arb_p->senders_p = ( struct arbiterSender * ) calloc ( arb_p->maxSenders, sizeof ( struct arbiterSender ) );
+    arb_p->slots_p = ( struct arbiterSlot * ) calloc ( ( size_t ) arb_p->maxSenders * arb_p->window,
+                                                       sizeof ( struct arbiterSlot ) );
+    if ( arb_p->senders_p == NULL || arb_p->slots_p == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "arbiter_init() could not allocate %u x %u slots",
+                        arb_p->maxSenders, arb_p->window );
+        free ( arb_p->senders_p );
+        free ( arb_p->slots_p );
+        arb_p->senders_p = NULL;
+        arb_p->slots_p = NULL;
+        return SOLCLIENT_FAIL;
+    }
+    for ( i = 0; i < arb_p->maxSenders; i++ ) {
+        arb_p->senders_p[i].slots_p = arb_p->slots_p + ( size_t ) i * arb_p->window;
+    }
+    OS_MUTEX_INIT ( &arb_p->lock );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * arbiter_offer
+ *****************************************************************************/
+int
+arbiter_offer ( struct arbiter *arb_p, int feed, solClient_uint64_t senderHash, solClient_uint64_t seq,
+                solClient_uint64_t nowNs )
+{
+    struct arbiterSender *sender_p;
+    struct arbiterSlot *slot_p;
+    struct arbiterFeedStats *winner_p;
+    solClient_uint64_t leadNs;
+    int             verdict = ARBITER_FORWARD;
+
+    OS_MUTEX_LOCK ( &arb_p->lock );
+    arb_p->stats.feeds[feed].offered++;
+    if ( ( sender_p = arbiter_findSender ( arb_p, senderHash ) ) == NULL ) {
+        arb_p->stats.senderOverflow++;
+        goto forward;
+    }
+    slot_p = &sender_p->slots_p[seq & ( arb_p->window - 1 )];
+
+    if ( slot_p->state != ARBITER_SLOT_EMPTY && slot_p->seq == seq ) {
+        verdict = ARBITER_DROP;
+        arb_p->stats.duplicates++;
+        if ( slot_p->state == ARBITER_SLOT_FIRST && slot_p->feed != feed ) {
+            slot_p->state = ARBITER_SLOT_PAIRED;
+            winner_p = &arb_p->stats.feeds[slot_p->feed];
+            leadNs = ( nowNs > slot_p->firstNs ) ? nowNs - slot_p->firstNs : 0;
+            winner_p->won++;
+            common_histogramAdd ( &winner_p->leadNs, leadNs );
+        }
+        goto done;
+    }
+    if ( sender_p->highSeq >= arb_p->window && seq <= sender_p->highSeq - arb_p->window ) {
+        if ( seq >= arb_p->window ) {
+            verdict = ARBITER_DROP;
+            arb_p->stats.stale++;
+            goto done;
+        }
+        /* A small sequence number far behind is taken as a sender restart. */
+        memset ( sender_p->slots_p, 0, sizeof ( struct arbiterSlot ) * arb_p->window );
+        sender_p->highSeq = 0;
+        arb_p->stats.restarts++;
+    }
+
+    /* First copy; the slot's previous message, if never paired, was one-sided. */
+    if ( slot_p->state == ARBITER_SLOT_FIRST ) {
+        arb_p->stats.feeds[slot_p->feed].only++;
+    }
+    slot_p->seq = seq;
+    slot_p->firstNs = nowNs;
+    slot_p->feed = ( unsigned char ) feed;
+    slot_p->state = ARBITER_SLOT_FIRST;
+    if ( seq > sender_p->highSeq ) {
+        sender_p->highSeq = seq;
+    }
+
+  forward:
+    arb_p->stats.forwarded++;
+  done:
+    OS_MUTEX_UNLOCK ( &arb_p->lock );
+    return verdict;
+}
+
+/*****************************************************************************
+ * arbiter_offerMsg
+ *****************************************************************************/
+int
+arbiter_offerMsg ( struct arbiter *arb_p, int feed, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_int64_t seq;
+    const char     *senderId_p;
+
+    if ( solClient_msg_getSequenceNumber ( msg_p, &seq ) != SOLCLIENT_OK ||
+         solClient_msg_getSenderId ( msg_p, &senderId_p ) != SOLCLIENT_OK ) {
+        OS_MUTEX_LOCK ( &arb_p->lock );
+        arb_p->stats.feeds[feed].offered++;
+        arb_p->stats.unarbitrated++;
+        arb_p->stats.forwarded++;
+        OS_MUTEX_UNLOCK ( &arb_p->lock );
+        return ARBITER_FORWARD;
+    }
+    return arbiter_offer ( arb_p, feed, arbiter_hashSender ( senderId_p ), ( solClient_uint64_t ) seq, os_getTimeNs (  ) );
+}
+
+/*****************************************************************************
+ * arbiter_hashSender
+ *****************************************************************************/
+solClient_uint64_t
+arbiter_hashSender ( const char *senderId_p )
+{
+    solClient_uint64_t hash = 14695981039346656037ULL;
+
+    while ( *senderId_p != ( char ) 0 ) {
+        hash ^= ( unsigned char ) *senderId_p++;
+        hash *= 1099511628211ULL;
+    }
+    return ( hash != 0 ) ? hash : 1;
+}
+
+/*****************************************************************************
+ * arbiter_getStats
+ *****************************************************************************/
+void
+arbiter_getStats ( struct arbiter *arb_p, struct arbiterStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &arb_p->lock );
+    *stats_p = arb_p->stats;
+    OS_MUTEX_UNLOCK ( &arb_p->lock );
+}
+
+/*****************************************************************************
+ * arbiter_printStats
+ *****************************************************************************/
+void
+arbiter_printStats ( const struct arbiterStats *stats_p )
+{
+    const struct arbiterFeedStats *feed_p;
+    solClient_uint64_t pairs = stats_p->feeds[ARBITER_FEED_A].won + stats_p->feeds[ARBITER_FEED_B].won;
+    int             feed;
+
+    printf ( "forwarded %llu, duplicates dropped %llu, stale dropped %llu, unarbitrated %llu, "
+             "sender overflow %llu, restarts %llu\n",
+             ( unsigned long long ) stats_p->forwarded, ( unsigned long long ) stats_p->duplicates,
+             ( unsigned long long ) stats_p->stale, ( unsigned long long ) stats_p->unarbitrated,
+             ( unsigned long long ) stats_p->senderOverflow, ( unsigned long long ) stats_p->restarts );
+    for ( feed = 0; feed < ARBITER_NUM_FEEDS; feed++ ) {
+        feed_p = &stats_p->feeds[feed];
+        printf ( "  feed %c: offered %llu, won %llu (%.1f%%), only %llu, lead mean %.1f us, p50 %.1f us, "
+                 "p99 %.1f us, max %.1f us\n",
+                 'A' + feed, ( unsigned long long ) feed_p->offered, ( unsigned long long ) feed_p->won,
+                 ( pairs != 0 ) ? 100.0 * ( double ) feed_p->won / ( double ) pairs : 0.0,
+                 ( unsigned long long ) feed_p->only,
+                 common_histogramMean ( &feed_p->leadNs ) / 1000.0,
+                 ( double ) common_histogramPercentile ( &feed_p->leadNs, 50.0 ) / 1000.0,
+                 ( double ) common_histogramPercentile ( &feed_p->leadNs, 99.0 ) / 1000.0,
+                 ( double ) feed_p->leadNs.max / 1000.0 );
+    }
+}
+
+/*****************************************************************************
+ * arbiter_destroy
+ *****************************************************************************/
+void
+arbiter_destroy ( struct arbiter *arb_p )
+{
+    OS_MUTEX_DESTROY ( &arb_p->lock );
+    free ( arb_p->senders_p );
+    free ( arb_p->slots_p );
+    arb_p->senders_p = NULL;
+    arb_p->slots_p = NULL;
+}
@@ -0,0 +1,157 @@
+/** example Intro/arbiter.h
+ */
+
+/**
+ *
+ * file arbiter.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides first-arrival arbitration between two feeds
+ * (A and B) carrying the same Direct messages over separate paths. A message
+ * is identified by its sender ID and sequence number; the first copy to
+ * arrive is forwarded and the later copy is dropped.
+ *
+ * Memory is fixed at arbiter_init(): a table of up to maxSenders senders,
+ * each with a ring of the last `window` sequence numbers seen. For every
+ * pair the arbiter records which feed won and by how long it led. A copy
+ * that arrives more than `window` sequence numbers behind its sender's
+ * newest message is dropped as stale, as its twin can no longer be told
+ * apart, unless its sequence number is below `window`, which is taken as the
+ * sender restarting. A message seen on only one feed is counted when its
+ * slot is reused.
+ *
+ * arbiter_offer() may be called from both feeds' Context threads at once;
+ * the arbiter serializes them with a mutex.
+ */
+
+#ifndef ARBITER_H_
+#define ARBITER_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+
+#define ARBITER_FEED_A              0
+#define ARBITER_FEED_B              1
+#define ARBITER_NUM_FEEDS           2
+#define ARBITER_DEFAULT_MAX_SENDERS 64
+#define ARBITER_DEFAULT_WINDOW      4096    /**< Sequence numbers per sender, a power of two. */
+
+#define ARBITER_FORWARD             1       /**< First arrival; process the message. */
+#define ARBITER_DROP                0       /**< Later copy or stale; discard it. */
+
+/**
+ * @struct arbiterFeedStats
+ * What one feed contributed.
+ */
+struct arbiterFeedStats
+{
+    solClient_uint64_t offered;
+    solClient_uint64_t won;             /**< Pairs where this feed's copy came first. */
+    solClient_uint64_t only;            /**< Messages seen on this feed alone. */
+    struct commonHistogram leadNs;      /**< The leads of won pairs. */
+};
+
+/**
+ * @struct arbiterStats
+ * Counters of an arbiter.
+ */
+struct arbiterStats
+{
+    solClient_uint64_t forwarded;
+    solClient_uint64_t duplicates;      /**< Later copies dropped. */
+    solClient_uint64_t stale;           /**< Copies too far behind to arbitrate, dropped. */
+    solClient_uint64_t unarbitrated;    /**< Forwarded without a sender ID or sequence number. */
+    solClient_uint64_t senderOverflow;  /**< Forwarded because the sender table was full. */
+    solClient_uint64_t restarts;        /**< Senders whose sequence numbers started over. */
+    struct arbiterFeedStats feeds[ARBITER_NUM_FEEDS];
+};
+
+struct arbiterSlot
+{
+    solClient_uint64_t seq;
+    solClient_uint64_t firstNs;         /**< Arrival time of the first copy. */
+    unsigned char   feed;               /**< Feed of the first copy. */
+    unsigned char   state;              /**< Empty, first copy seen, or paired. */
+    unsigned char   reserved[6];
+};
+
+struct arbiterSender
+{
+    solClient_uint64_t hash;            /**< 0 for an unused entry. */
+    solClient_uint64_t highSeq;         /**< Newest sequence number seen. */
+    struct arbiterSlot *slots_p;        /**< window slots, indexed by seq % window. */
+};
+
+/**
+ * @struct arbiter
+ */
+struct arbiter
+{
+    OS_MUTEX        lock;
+    struct arbiterSender *senders_p;
+    struct arbiterSlot *slots_p;
+    solClient_uint32_t maxSenders;      /**< A power of two. */
+    solClient_uint32_t window;
+    solClient_uint32_t numSenders;
+    struct arbiterStats stats;
+};
+
+
+/**
+ * Allocate an arbiter's tables.
+ * @param arb_p The arbiter to initialize.
+ * @param maxSenders Senders to track, rounded up to a power of two; 0 for the default.
+ * @param window Sequence numbers per sender, rounded up to a power of two; 0 for the default.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    arbiter_init ( struct arbiter *arb_p, solClient_uint32_t maxSenders, solClient_uint32_t window );
+
+/**
+ * Arbitrate one copy of a message.
+ * @param arb_p The arbiter.
+ * @param feed ::ARBITER_FEED_A or ::ARBITER_FEED_B.
+ * @param senderHash A non-zero hash of the sender ID (arbiter_hashSender()).
+ * @param seq The sender's sequence number.
+ * @param nowNs Arrival time, os_getTimeNs() or any common clock.
+ * @return ::ARBITER_FORWARD or ::ARBITER_DROP.
+ */
+int
+    arbiter_offer ( struct arbiter *arb_p, int feed, solClient_uint64_t senderHash, solClient_uint64_t seq,
+                    solClient_uint64_t nowNs );
+
+/**
+ * Arbitrate a received message by its sender ID and sequence number.
+ * Messages without either are forwarded.
+ */
+int
+    arbiter_offerMsg ( struct arbiter *arb_p, int feed, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * FNV-1a hash of a sender ID, never 0.
+ */
+solClient_uint64_t
+    arbiter_hashSender ( const char *senderId_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    arbiter_getStats ( struct arbiter *arb_p, struct arbiterStats *stats_p );
+
+/**
+ * Print the counters and the lead of each feed.
+ */
+void
+    arbiter_printStats ( const struct arbiterStats *stats_p );
+
+/**
+ * Free an arbiter's tables.
+ */
+void
+    arbiter_destroy ( struct arbiter *arb_p );
+
+#endif /* ARBITER_H_ */
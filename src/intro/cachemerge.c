@@ -0,0 +1,455 @@
+
+/** example Intro/cachemerge.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Cache snapshot plus live subscriber. See cachemerge.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "solclient/solCache.h"
+#include "cachemerge.h"
+
+#define CACHEMERGE_LIST_INITIAL 4
+
+/*****************************************************************************
+ * cachemerge_hash
+ *****************************************************************************/
+static          solClient_uint64_t
+cachemerge_hash ( const char *topic_p )
+{
+    solClient_uint64_t hash = 14695981039346656037ULL;
+
+    while ( *topic_p != ( char ) 0 ) {
+        hash ^= ( unsigned char ) *topic_p++;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/*****************************************************************************
+ * cachemerge_findSlot
+ *
+ * The table slot of a topic, or the free slot where it would go.
+ *****************************************************************************/
+static          solClient_uint32_t
+cachemerge_findSlot ( struct cachemerge *merge_p, const char *topic_p, solClient_uint64_t hash )
+{
+    solClient_uint32_t slot = ( solClient_uint32_t ) hash & merge_p->tableMask;
+    struct cachemergeTopic *topic_p2;
+
+    while ( merge_p->table_p[slot] != 0 ) {
+        topic_p2 = &merge_p->topics_p[merge_p->table_p[slot] - 1];
+        if ( topic_p2->hash == hash && strcmp ( topic_p2->name_p, topic_p ) == 0 ) {
+            break;
+        }
+        slot = ( slot + 1 ) & merge_p->tableMask;
+    }
+    return slot;
+}
+
+/*****************************************************************************
+ * cachemerge_append
+ *
+ * Keeps a message for a pending topic. Must be called with the lock held.
+ *****************************************************************************/
+static          solClient_returnCode_t
+cachemerge_append ( struct cachemerge *merge_p, struct cachemergeList *list_p, solClient_opaqueMsg_pt msg_p,
+                    solClient_int64_t key )
+{
+    struct cachemergeEntry *entries_p;
+    solClient_uint32_t capacity;
+
+    if ( list_p->count == list_p->capacity ) {
+        capacity = ( list_p->capacity == 0 ) ? CACHEMERGE_LIST_INITIAL : list_p->capacity * 2;
+        if ( ( entries_p = ( struct cachemergeEntry * ) realloc ( list_p->entries_p,
+                                                                  capacity * sizeof ( *entries_p ) ) ) == NULL ) {
+            return SOLCLIENT_FAIL;
+        }
+        list_p->entries_p = entries_p;
+        list_p->capacity = capacity;
+    }
+    list_p->entries_p[list_p->count].msg_p = msg_p;
+    list_p->entries_p[list_p->count].key = key;
+    list_p->count++;
+    if ( ++merge_p->pending > merge_p->stats.maxPending ) {
+        merge_p->stats.maxPending = merge_p->pending;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * cachemerge_sortList
+ *
+ * Insertion sort: messages mostly arrive in key order already.
+ *****************************************************************************/
+static void
+cachemerge_sortList ( struct cachemergeList *list_p )
+{
+    struct cachemergeEntry entry;
+    solClient_uint32_t i;
+    solClient_uint32_t j;
+
+    for ( i = 1; i < list_p->count; i++ ) {
+        entry = list_p->entries_p[i];
+        for ( j = i; j > 0 && list_p->entries_p[j - 1].key > entry.key; j-- ) {
+            list_p->entries_p[j] = list_p->entries_p[j - 1];
+        }
+        list_p->entries_p[j] = entry;
+    }
+}
+
+/*****************************************************************************
+ * cachemerge_isNewer
+ *
+ * Whether a key may be released after the last one released for the topic.
+ *****************************************************************************/
+static int
+cachemerge_isNewer ( struct cachemerge *merge_p, struct cachemergeTopic *topic_p, solClient_int64_t key )
+{
+    if ( !topic_p->haveLastKey ) {
+        return 1;
+    }
+    return ( merge_p->keyMode == CACHEMERGE_BY_TIME ) ? key >= topic_p->lastKey : key > topic_p->lastKey;
+}
+
+/*****************************************************************************
+ * cachemerge_release
+ *
+ * Delivers a message unless it is older than the last one released. Must be
+ * called with the lock held. Returns whether it was delivered.
+ *****************************************************************************/
+static int
+cachemerge_release ( struct cachemerge *merge_p, solClient_uint32_t topic, solClient_opaqueMsg_pt msg_p,
+                     solClient_int64_t key, int source )
+{
+    struct cachemergeTopic *topic_p = &merge_p->topics_p[topic];
+
+    if ( !cachemerge_isNewer ( merge_p, topic_p, key ) ) {
+        merge_p->stats.duplicates++;
+        return 0;
+    }
+    merge_p->deliver_p ( msg_p, topic, key, source, merge_p->user_p );
+    topic_p->lastKey = key;
+    topic_p->haveLastKey = 1;
+    return 1;
+}
+
+/*****************************************************************************
+ * cachemerge_freeList
+ *****************************************************************************/
+static void
+cachemerge_freeList ( struct cachemerge *merge_p, struct cachemergeList *list_p )
+{
+    solClient_uint32_t i;
+
+    for ( i = 0; i < list_p->count; i++ ) {
+        solClient_msg_free ( &list_p->entries_p[i].msg_p );
+    }
+    merge_p->pending -= list_p->count;
+    free ( list_p->entries_p );
+    memset ( list_p, 0, sizeof ( *list_p ) );
+}
+
+/*****************************************************************************
+ * cachemerge_keep
+ *
+ * Keeps a message of a pending topic, or if that fails delivers it as it
+ * came. Must be called with the lock held.
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+cachemerge_keep ( struct cachemerge *merge_p, solClient_uint32_t topic, struct cachemergeList *list_p,
+                  solClient_opaqueMsg_pt msg_p, solClient_int64_t key, int source )
+{
+    if ( cachemerge_append ( merge_p, list_p, msg_p, key ) != SOLCLIENT_OK ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "Could not keep a message for '%s'", merge_p->topics_p[topic].name_p );
+        merge_p->deliver_p ( msg_p, topic, key, source, merge_p->user_p );
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    return SOLCLIENT_CALLBACK_TAKE_MSG;
+}
+
+
+/*****************************************************************************
+ * cachemerge_init
+ *****************************************************************************/
+solClient_returnCode_t
+cachemerge_init ( struct cachemerge *merge_p, solClient_uint32_t maxTopics, int keyMode,
+                  cachemerge_deliverFunc_t deliver_p, void *user_p )
+{
+    solClient_uint32_t tableSize = 2;
+
+    memset ( merge_p, 0, sizeof ( *merge_p ) );
+    while ( tableSize < maxTopics * 2 ) {
+        tableSize *= 2;
+    }
+    merge_p->topics_p = ( struct cachemergeTopic * ) calloc ( maxTopics, sizeof ( struct cachemergeTopic ) );
+    merge_p->table_p = ( solClient_uint32_t * ) calloc ( tableSize, sizeof ( solClient_uint32_t ) );
+    if ( maxTopics == 0 || merge_p->topics_p == NULL || merge_p->table_p == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate %u topics", maxTopics );
+        free ( merge_p->topics_p );
+        free ( merge_p->table_p );
+        return SOLCLIENT_FAIL;
+    }
+    OS_MUTEX_INIT ( &merge_p->lock );
+    merge_p->maxTopics = maxTopics;
+    merge_p->tableMask = tableSize - 1;
+    merge_p->keyMode = keyMode;
+    merge_p->deliver_p = deliver_p;
+    merge_p->user_p = user_p;
+    merge_p->stats.startNs = os_getTimeNs (  );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * cachemerge_addTopic
+ *****************************************************************************/
+solClient_returnCode_t
+cachemerge_addTopic ( struct cachemerge *merge_p, const char *topic_p, solClient_uint32_t *index_p )
+{
+    solClient_uint64_t hash = cachemerge_hash ( topic_p );
+    struct cachemergeTopic *entry_p;
+    solClient_uint32_t slot;
+    solClient_returnCode_t rc = SOLCLIENT_FAIL;
+
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    slot = cachemerge_findSlot ( merge_p, topic_p, hash );
+    if ( merge_p->table_p[slot] != 0 || merge_p->stats.topics == merge_p->maxTopics ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Cannot add topic '%s'", topic_p );
+        goto done;
+    }
+    entry_p = &merge_p->topics_p[merge_p->stats.topics];
+    if ( ( entry_p->name_p = ( char * ) malloc ( strlen ( topic_p ) + 1 ) ) == NULL ) {
+        goto done;
+    }
+    strcpy ( entry_p->name_p, topic_p );
+    entry_p->hash = hash;
+    entry_p->state = CACHEMERGE_PENDING;
+    *index_p = merge_p->stats.topics++;
+    merge_p->table_p[slot] = *index_p + 1;
+    merge_p->stats.consistentNs = 0;
+    rc = SOLCLIENT_OK;
+
+  done:
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+    return rc;
+}
+
+/*****************************************************************************
+ * cachemerge_getKey
+ *****************************************************************************/
+solClient_returnCode_t
+cachemerge_getKey ( struct cachemerge *merge_p, solClient_opaqueMsg_pt msg_p, solClient_int64_t *key_p )
+{
+    solClient_returnCode_t rc;
+
+    if ( merge_p->keyMode == CACHEMERGE_BY_TIME ) {
+        rc = solClient_msg_getSenderTimestamp ( msg_p, key_p );
+    } else {
+        rc = solClient_msg_getTopicSequenceNumber ( msg_p, key_p );
+    }
+    return ( rc == SOLCLIENT_OK ) ? SOLCLIENT_OK : SOLCLIENT_NOT_FOUND;
+}
+
+/*****************************************************************************
+ * cachemerge_rxCallback
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+cachemerge_rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct cachemerge *merge_p = ( struct cachemerge * ) user_p;
+    solClient_destination_t destination;
+    solClient_uint64_t requestId;
+    solClient_int64_t key;
+    int             haveKey = ( cachemerge_getKey ( merge_p, msg_p, &key ) == SOLCLIENT_OK );
+    int             isCached = ( solClient_msg_isCacheMsg ( msg_p ) != SOLCLIENT_CACHE_LIVE_MESSAGE );
+
+    if ( isCached && solClient_msg_getCacheRequestId ( msg_p, &requestId ) == SOLCLIENT_OK &&
+         requestId < merge_p->maxTopics && haveKey ) {
+        return cachemerge_cacheMsg ( merge_p, ( solClient_uint32_t ) requestId, msg_p, key );
+    }
+    if ( !isCached && solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) == SOLCLIENT_OK &&
+         haveKey ) {
+        return cachemerge_liveMsg ( merge_p, destination.dest, msg_p, key );
+    }
+
+    /* Nowhere to place it. */
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    merge_p->stats.noKey++;
+    merge_p->deliver_p ( msg_p, 0, 0, isCached ? CACHEMERGE_CACHE : CACHEMERGE_LIVE, merge_p->user_p );
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * cachemerge_liveMsg
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+cachemerge_liveMsg ( struct cachemerge *merge_p, const char *topic_p, solClient_opaqueMsg_pt msg_p,
+                     solClient_int64_t key )
+{
+    solClient_uint64_t hash = cachemerge_hash ( topic_p );
+    solClient_rxMsgCallback_returnCode_t callbackRc = SOLCLIENT_CALLBACK_OK;
+    solClient_uint32_t slot;
+    solClient_uint32_t topic;
+
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    slot = cachemerge_findSlot ( merge_p, topic_p, hash );
+    if ( merge_p->table_p[slot] == 0 ) {
+        merge_p->stats.unknownTopic++;
+        goto done;
+    }
+    topic = merge_p->table_p[slot] - 1;
+    if ( merge_p->topics_p[topic].state == CACHEMERGE_PENDING ) {
+        merge_p->stats.buffered++;
+        callbackRc = cachemerge_keep ( merge_p, topic, &merge_p->topics_p[topic].live, msg_p, key, CACHEMERGE_LIVE );
+    } else if ( cachemerge_release ( merge_p, topic, msg_p, key, CACHEMERGE_LIVE ) ) {
+        merge_p->stats.live++;
+    }
+
+  done:
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+    return callbackRc;
+}
+
+/*****************************************************************************
+ * cachemerge_cacheMsg
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+cachemerge_cacheMsg ( struct cachemerge *merge_p, solClient_uint32_t topic, solClient_opaqueMsg_pt msg_p,
+                      solClient_int64_t key )
+{
+    solClient_rxMsgCallback_returnCode_t callbackRc = SOLCLIENT_CALLBACK_OK;
+
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    merge_p->stats.cached++;
+    if ( topic >= merge_p->stats.topics ) {
+        merge_p->stats.unknownTopic++;
+    } else if ( merge_p->topics_p[topic].state == CACHEMERGE_PENDING ) {
+        callbackRc = cachemerge_keep ( merge_p, topic, &merge_p->topics_p[topic].cached, msg_p, key, CACHEMERGE_CACHE );
+    } else {
+        /* A late cached message: only useful if newer than what was released. */
+        cachemerge_release ( merge_p, topic, msg_p, key, CACHEMERGE_CACHE );
+    }
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+    return callbackRc;
+}
+
+/*****************************************************************************
+ * cachemerge_cacheDone
+ *****************************************************************************/
+void
+cachemerge_cacheDone ( struct cachemerge *merge_p, solClient_uint32_t topic, solClient_returnCode_t rc )
+{
+    struct cachemergeTopic *topic_p;
+    struct cachemergeList *cached_p;
+    struct cachemergeList *live_p;
+    struct cachemergeEntry *entry_p;
+    solClient_uint32_t c = 0;
+    solClient_uint32_t l = 0;
+
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    if ( topic >= merge_p->stats.topics || merge_p->topics_p[topic].state != CACHEMERGE_PENDING ) {
+        OS_MUTEX_UNLOCK ( &merge_p->lock );
+        return;
+    }
+    topic_p = &merge_p->topics_p[topic];
+    cached_p = &topic_p->cached;
+    live_p = &topic_p->live;
+    if ( rc == SOLCLIENT_FAIL ) {
+        merge_p->stats.requestsFailed++;
+    }
+    cachemerge_sortList ( cached_p );
+    cachemerge_sortList ( live_p );
+
+    /* Merge the two by key, live first on a tie. */
+    while ( c < cached_p->count || l < live_p->count ) {
+        if ( c < cached_p->count && ( l == live_p->count || cached_p->entries_p[c].key < live_p->entries_p[l].key ) ) {
+            entry_p = &cached_p->entries_p[c++];
+            if ( live_p->count > 0 && entry_p->key < live_p->entries_p[live_p->count - 1].key ) {
+                merge_p->stats.staleCached++;
+            }
+            if ( cachemerge_release ( merge_p, topic, entry_p->msg_p, entry_p->key, CACHEMERGE_CACHE ) ) {
+                merge_p->stats.released++;
+            }
+        } else {
+            entry_p = &live_p->entries_p[l++];
+            if ( cachemerge_release ( merge_p, topic, entry_p->msg_p, entry_p->key, CACHEMERGE_LIVE ) ) {
+                merge_p->stats.released++;
+            }
+        }
+    }
+    cachemerge_freeList ( merge_p, cached_p );
+    cachemerge_freeList ( merge_p, live_p );
+
+    topic_p->state = CACHEMERGE_CONSISTENT;
+    if ( ++merge_p->stats.consistent == merge_p->stats.topics ) {
+        merge_p->stats.consistentNs = os_getTimeNs (  );
+    }
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+}
+
+/*****************************************************************************
+ * cachemerge_cacheEventCallback
+ *****************************************************************************/
+void
+cachemerge_cacheEventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                                solCache_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct cachemerge *merge_p = ( struct cachemerge * ) user_p;
+
+    if ( eventInfo_p->cacheEvent != SOLCACHE_EVENT_REQUEST_COMPLETED_NOTICE ) {
+        return;
+    }
+    if ( eventInfo_p->rc == SOLCLIENT_FAIL ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "Cache request for '%s' failed: %s", eventInfo_p->topic,
+                        solClient_subCodeToString ( eventInfo_p->subCode ) );
+    }
+    if ( eventInfo_p->cacheRequestId < merge_p->maxTopics ) {
+        cachemerge_cacheDone ( merge_p, ( solClient_uint32_t ) eventInfo_p->cacheRequestId, eventInfo_p->rc );
+    }
+}
+
+/*****************************************************************************
+ * cachemerge_getStats
+ *****************************************************************************/
+void
+cachemerge_getStats ( struct cachemerge *merge_p, struct cachemergeStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &merge_p->lock );
+    *stats_p = merge_p->stats;
+    OS_MUTEX_UNLOCK ( &merge_p->lock );
+}
+
+/*****************************************************************************
+ * cachemerge_destroy
+ *****************************************************************************/
+void
+cachemerge_destroy ( struct cachemerge *merge_p )
+{
+    solClient_uint32_t topic;
+
+    if ( merge_p->topics_p == NULL ) {
+        return;
+    }
+    for ( topic = 0; topic < merge_p->stats.topics; topic++ ) {
+        cachemerge_freeList ( merge_p, &merge_p->topics_p[topic].cached );
+        cachemerge_freeList ( merge_p, &merge_p->topics_p[topic].live );
+        free ( merge_p->topics_p[topic].name_p );
+    }
+    free ( merge_p->topics_p );
+    free ( merge_p->table_p );
+    merge_p->topics_p = NULL;
+    OS_MUTEX_DESTROY ( &merge_p->lock );
+}
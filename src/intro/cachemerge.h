@@ -0,0 +1,232 @@
+/** example Intro/cachemerge.h
+ */
+
+/**
+ *
+ * file cachemerge.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a subscriber that starts from a solCache
+ * snapshot and carries on live, so that after startup it neither misses an
+ * update nor shows a stale value.
+ *
+ * The application subscribes live first, then sends a cache request per
+ * topic, concurrently (::SOLCLIENT_CACHEREQUEST_FLAGS_NOWAIT_REPLY and
+ * ::SOLCLIENT_CACHEREQUEST_FLAGS_LIVEDATA_FLOWTHRU), with the topic index
+ * as the cache request ID. Until its request completes, a topic is
+ * pending: live messages for it are kept, and so are the cached messages
+ * that come back. On completion the two are merged by key, the topic
+ * sequence number or the sender timestamp of each message. They are
+ * released in key order, live first on a tie, dropping any that is not
+ * newer than the one released before (in timestamp mode, only older ones,
+ * as timestamps repeat). The snapshot, taken after the live subscription,
+ * overlaps the live messages kept rather than leaving a gap before them;
+ * the overlap is dropped, and a cached value older than a live one
+ * received is never shown after it. The latter are counted as stale: a
+ * subscriber delivering both as they come would have shown them last.
+ *
+ * The topic is then consistent: live messages go straight through, except
+ * those older than the last released. Messages without a key cannot be
+ * placed and are delivered as they come.
+ *
+ * Topics are looked up by name in an open-addressing table sized for the
+ * number given to cachemerge_init().
+ */
+
+#ifndef CACHEMERGE_H_
+#define CACHEMERGE_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "solclient/solCache.h"
+
+#define CACHEMERGE_BY_SEQ       0       /**< Order by topic sequence number. */
+#define CACHEMERGE_BY_TIME      1       /**< Order by sender timestamp. */
+
+#define CACHEMERGE_PENDING      0
+#define CACHEMERGE_CONSISTENT   1
+
+#define CACHEMERGE_CACHE        0
+#define CACHEMERGE_LIVE         1
+
+/**
+ * Called for every message released, with the lock held: it must not call
+ * into the subscriber. The message belongs to the caller.
+ * @param msg_p The message.
+ * @param topic The topic index.
+ * @param key Its topic sequence number or sender timestamp.
+ * @param source ::CACHEMERGE_CACHE or ::CACHEMERGE_LIVE.
+ * @param user_p The user pointer given to cachemerge_init().
+ */
+typedef void    ( *cachemerge_deliverFunc_t ) ( solClient_opaqueMsg_pt msg_p, solClient_uint32_t topic,
+                                                solClient_int64_t key, int source, void *user_p );
+
+/**
+ * @struct cachemergeEntry
+ */
+struct cachemergeEntry
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_int64_t key;
+};
+
+/**
+ * @struct cachemergeList
+ * Messages kept for a pending topic.
+ */
+struct cachemergeList
+{
+    struct cachemergeEntry *entries_p;
+    solClient_uint32_t count;
+    solClient_uint32_t capacity;
+};
+
+/**
+ * @struct cachemergeTopic
+ */
+struct cachemergeTopic
+{
+    char           *name_p;
+    solClient_uint64_t hash;
+    int             state;              /**< ::CACHEMERGE_PENDING or ::CACHEMERGE_CONSISTENT. */
+    int             haveLastKey;
+    solClient_int64_t lastKey;          /**< Of the last message released. */
+    struct cachemergeList cached;
+    struct cachemergeList live;
+};
+
+/**
+ * @struct cachemergeStats
+ */
+struct cachemergeStats
+{
+    solClient_uint32_t topics;
+    solClient_uint32_t consistent;
+    solClient_uint32_t requestsFailed;  /**< Completed with an error: merged with what came. */
+    solClient_uint64_t cached;          /**< Cached messages received. */
+    solClient_uint64_t staleCached;     /**< Older than a live one received before them. */
+    solClient_uint64_t buffered;        /**< Live messages kept while pending. */
+    solClient_uint64_t released;        /**< Delivered by a merge. */
+    solClient_uint64_t live;            /**< Delivered live once consistent. */
+    solClient_uint64_t duplicates;      /**< Dropped as not newer than the last released. */
+    solClient_uint64_t noKey;           /**< Delivered as they came. */
+    solClient_uint64_t unknownTopic;    /**< Live messages for topics not added. */
+    solClient_uint64_t maxPending;      /**< Most messages kept at once. */
+    solClient_uint64_t startNs;         /**< cachemerge_init(), on the os_getTimeNs() clock. */
+    solClient_uint64_t consistentNs;    /**< When the last topic became consistent, 0 before. */
+};
+
+/**
+ * @struct cachemerge
+ */
+struct cachemerge
+{
+    OS_MUTEX        lock;
+    struct cachemergeTopic *topics_p;
+    solClient_uint32_t maxTopics;
+    solClient_uint32_t *table_p;        /**< Topic index + 1, 0 for free. */
+    solClient_uint32_t tableMask;
+    int             keyMode;            /**< ::CACHEMERGE_BY_SEQ or ::CACHEMERGE_BY_TIME. */
+    cachemerge_deliverFunc_t deliver_p;
+    void           *user_p;
+    solClient_uint64_t pending;         /**< Messages kept. */
+    struct cachemergeStats stats;
+};
+
+
+/**
+ * Initialize a subscriber.
+ * @param merge_p The subscriber to initialize.
+ * @param maxTopics Most topics that can be added.
+ * @param keyMode ::CACHEMERGE_BY_SEQ or ::CACHEMERGE_BY_TIME.
+ * @param deliver_p Called for each message released.
+ * @param user_p Passed to deliver_p.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    cachemerge_init ( struct cachemerge *merge_p, solClient_uint32_t maxTopics, int keyMode,
+                      cachemerge_deliverFunc_t deliver_p, void *user_p );
+
+/**
+ * Add a pending topic, before its cache request is sent.
+ * @param merge_p The subscriber.
+ * @param topic_p The topic, without wildcards.
+ * @param index_p Its index, to use as the cache request ID.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when full or added before.
+ */
+solClient_returnCode_t
+    cachemerge_addTopic ( struct cachemerge *merge_p, const char *topic_p, solClient_uint32_t *index_p );
+
+/**
+ * The key of a message, as chosen by keyMode.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_NOT_FOUND when the message has none.
+ */
+solClient_returnCode_t
+    cachemerge_getKey ( struct cachemerge *merge_p, solClient_opaqueMsg_pt msg_p, solClient_int64_t *key_p );
+
+/**
+ * The Session receive callback, with the subscriber as user pointer: hands
+ * cached messages to cachemerge_cacheMsg() by their cache request ID, and
+ * live ones to cachemerge_liveMsg() by their destination.
+ */
+solClient_rxMsgCallback_returnCode_t
+    cachemerge_rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p );
+
+/**
+ * A live message.
+ * @param merge_p The subscriber.
+ * @param topic_p Its topic.
+ * @param msg_p The message.
+ * @param key Its key.
+ * @return ::SOLCLIENT_CALLBACK_TAKE_MSG when the message was kept, which is
+ * then freed by the subscriber; ::SOLCLIENT_CALLBACK_OK otherwise.
+ */
+solClient_rxMsgCallback_returnCode_t
+    cachemerge_liveMsg ( struct cachemerge *merge_p, const char *topic_p, solClient_opaqueMsg_pt msg_p,
+                         solClient_int64_t key );
+
+/**
+ * A cached message.
+ * @param merge_p The subscriber.
+ * @param topic The topic index, from the cache request ID.
+ * @param msg_p The message.
+ * @param key Its key.
+ * @return As cachemerge_liveMsg().
+ */
+solClient_rxMsgCallback_returnCode_t
+    cachemerge_cacheMsg ( struct cachemerge *merge_p, solClient_uint32_t topic, solClient_opaqueMsg_pt msg_p,
+                          solClient_int64_t key );
+
+/**
+ * The cache request for a topic completed: merge and release.
+ * @param merge_p The subscriber.
+ * @param topic The topic index.
+ * @param rc The request status; on ::SOLCLIENT_FAIL whatever was cached
+ * is merged all the same, and the topic goes on live.
+ */
+void
+    cachemerge_cacheDone ( struct cachemerge *merge_p, solClient_uint32_t topic, solClient_returnCode_t rc );
+
+/**
+ * The cache event callback, with the subscriber as user pointer: calls
+ * cachemerge_cacheDone() on ::SOLCACHE_EVENT_REQUEST_COMPLETED_NOTICE.
+ */
+void
+    cachemerge_cacheEventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                                    solCache_eventCallbackInfo_pt eventInfo_p, void *user_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    cachemerge_getStats ( struct cachemerge *merge_p, struct cachemergeStats *stats_p );
+
+/**
+ * Free the kept messages and the topics.
+ */
+void
+    cachemerge_destroy ( struct cachemerge *merge_p );
+
+#endif /* CACHEMERGE_H_ */
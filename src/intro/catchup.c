@@ -0,0 +1,232 @@
+
+/** example Intro/catchup.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Replay-to-live catch-up consumer. See catchup.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "catchup.h"
+
+/*****************************************************************************
+ * catchup_isAtOrBefore
+ *
+ * Whether a is at or before b. IDs that cannot be compared are neither.
+ *****************************************************************************/
+static int
+catchup_isAtOrBefore ( struct catchup *catchup_p, solClient_replicationGroupMessageId_pt a_p,
+                       solClient_replicationGroupMessageId_pt b_p )
+{
+    int             compare;
+
+    if ( solClient_replicationGroupMessageId_compare ( a_p, b_p, &compare ) != SOLCLIENT_OK ) {
+        catchup_p->stats.notComparable++;
+        return 0;
+    }
+    return compare <= 0;
+}
+
+/*****************************************************************************
+ * catchup_deliver
+ *****************************************************************************/
+static void
+catchup_deliver ( struct catchup *catchup_p, solClient_opaqueMsg_pt msg_p,
+                  solClient_replicationGroupMessageId_pt rgmid_p, int source )
+{
+    catchup_p->deliver_p ( msg_p, source, catchup_p->user_p );
+    catchup_p->last = *rgmid_p;
+    catchup_p->haveLast = 1;
+}
+
+/*****************************************************************************
+ * catchup_switch
+ *
+ * Delivers what the replay has not covered from the ring, and goes live.
+ * Called with the lock held.
+ *****************************************************************************/
+static void
+catchup_switch ( struct catchup *catchup_p )
+{
+    struct catchupEntry *entry_p;
+
+    catchup_p->stats.switchNs = os_getTimeNs (  );
+    if ( catchup_p->count > 0 ) {
+        catchup_p->stats.switchLagNs = catchup_p->stats.switchNs - catchup_p->ring_p[catchup_p->head].rxNs;
+    }
+    while ( catchup_p->count > 0 ) {
+        entry_p = &catchup_p->ring_p[catchup_p->head];
+        if ( catchup_p->haveLast && catchup_isAtOrBefore ( catchup_p, &entry_p->rgmid, &catchup_p->last ) ) {
+            catchup_p->stats.overlapped++;
+        } else {
+            catchup_deliver ( catchup_p, entry_p->msg_p, &entry_p->rgmid, CATCHUP_LIVE );
+            catchup_p->stats.drained++;
+        }
+        solClient_msg_free ( &entry_p->msg_p );
+        catchup_p->head = ( catchup_p->head + 1 ) % catchup_p->capacity;
+        catchup_p->count--;
+    }
+    catchup_p->stats.state = CATCHUP_LIVE;
+    catchup_p->stats.switchDurationNs = os_getTimeNs (  ) - catchup_p->stats.switchNs;
+}
+
+
+/*****************************************************************************
+ * catchup_init
+ *****************************************************************************/
+solClient_returnCode_t
+catchup_init ( struct catchup *catchup_p, solClient_uint32_t capacity, catchup_deliverFunc_t deliver_p, void *user_p )
+{
+    memset ( catchup_p, 0, sizeof ( *catchup_p ) );
+    if ( capacity == 0 ) {
+        capacity = CATCHUP_DEFAULT_RING;
+    }
+    if ( ( catchup_p->ring_p = ( struct catchupEntry * ) malloc ( capacity * sizeof ( struct catchupEntry ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate a catch-up ring of %u messages", capacity );
+        return SOLCLIENT_FAIL;
+    }
+    OS_MUTEX_INIT ( &catchup_p->lock );
+    catchup_p->capacity = capacity;
+    catchup_p->deliver_p = deliver_p;
+    catchup_p->user_p = user_p;
+    catchup_p->stats.state = CATCHUP_REPLAY;
+    catchup_p->stats.startNs = os_getTimeNs (  );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * catchup_replayMsg
+ *****************************************************************************/
+void
+catchup_replayMsg ( struct catchup *catchup_p, solClient_opaqueMsg_pt msg_p, solClient_replicationGroupMessageId_pt rgmid_p )
+{
+    OS_MUTEX_LOCK ( &catchup_p->lock );
+    if ( catchup_p->stats.state == CATCHUP_LIVE ) {
+        /* The live stream has it, or will. */
+        catchup_p->stats.duplicates++;
+        OS_MUTEX_UNLOCK ( &catchup_p->lock );
+        return;
+    }
+    catchup_deliver ( catchup_p, msg_p, rgmid_p, CATCHUP_REPLAY );
+    catchup_p->stats.replayed++;
+    if ( catchup_p->count > 0 &&
+         catchup_isAtOrBefore ( catchup_p, &catchup_p->ring_p[catchup_p->head].rgmid, rgmid_p ) ) {
+        catchup_switch ( catchup_p );
+    }
+    OS_MUTEX_UNLOCK ( &catchup_p->lock );
+}
+
+/*****************************************************************************
+ * catchup_liveMsg
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+catchup_liveMsg ( struct catchup *catchup_p, solClient_opaqueMsg_pt msg_p, solClient_replicationGroupMessageId_pt rgmid_p )
+{
+    struct catchupEntry *entry_p;
+
+    OS_MUTEX_LOCK ( &catchup_p->lock );
+    if ( catchup_p->stats.state == CATCHUP_LIVE ) {
+        if ( catchup_p->haveLast && catchup_isAtOrBefore ( catchup_p, rgmid_p, &catchup_p->last ) ) {
+            catchup_p->stats.duplicates++;
+        } else {
+            catchup_deliver ( catchup_p, msg_p, rgmid_p, CATCHUP_LIVE );
+            catchup_p->stats.live++;
+        }
+        OS_MUTEX_UNLOCK ( &catchup_p->lock );
+        return SOLCLIENT_CALLBACK_OK;
+    }
+
+    if ( catchup_p->count == catchup_p->capacity ) {
+        /* The replay delivers the oldest one before it can overlap the next. */
+        solClient_msg_free ( &catchup_p->ring_p[catchup_p->head].msg_p );
+        catchup_p->head = ( catchup_p->head + 1 ) % catchup_p->capacity;
+        catchup_p->count--;
+        catchup_p->stats.overflowed++;
+    }
+    entry_p = &catchup_p->ring_p[( catchup_p->head + catchup_p->count ) % catchup_p->capacity];
+    entry_p->msg_p = msg_p;
+    entry_p->rgmid = *rgmid_p;
+    entry_p->rxNs = os_getTimeNs (  );
+    catchup_p->count++;
+    catchup_p->stats.buffered++;
+    if ( catchup_p->count > catchup_p->stats.ringHighWater ) {
+        catchup_p->stats.ringHighWater = catchup_p->count;
+    }
+    OS_MUTEX_UNLOCK ( &catchup_p->lock );
+    return SOLCLIENT_CALLBACK_TAKE_MSG;
+}
+
+/*****************************************************************************
+ * catchup_replayIdle
+ *****************************************************************************/
+int
+catchup_replayIdle ( struct catchup *catchup_p )
+{
+    int             live;
+
+    OS_MUTEX_LOCK ( &catchup_p->lock );
+    if ( catchup_p->stats.state == CATCHUP_REPLAY && catchup_p->count == 0 ) {
+        catchup_switch ( catchup_p );
+    }
+    live = ( catchup_p->stats.state == CATCHUP_LIVE );
+    OS_MUTEX_UNLOCK ( &catchup_p->lock );
+    return live;
+}
+
+/*****************************************************************************
+ * catchup_getStats
+ *****************************************************************************/
+void
+catchup_getStats ( struct catchup *catchup_p, struct catchupStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &catchup_p->lock );
+    *stats_p = catchup_p->stats;
+    OS_MUTEX_UNLOCK ( &catchup_p->lock );
+}
+
+/*****************************************************************************
+ * catchup_getLastId
+ *****************************************************************************/
+solClient_returnCode_t
+catchup_getLastId ( struct catchup *catchup_p, solClient_replicationGroupMessageId_pt rgmid_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_NOT_FOUND;
+
+    OS_MUTEX_LOCK ( &catchup_p->lock );
+    if ( catchup_p->haveLast ) {
+        *rgmid_p = catchup_p->last;
+        rc = SOLCLIENT_OK;
+    }
+    OS_MUTEX_UNLOCK ( &catchup_p->lock );
+    return rc;
+}
+
+/*****************************************************************************
+ * catchup_destroy
+ *****************************************************************************/
+void
+catchup_destroy ( struct catchup *catchup_p )
+{
+    if ( catchup_p->ring_p == NULL ) {
+        return;
+    }
+    while ( catchup_p->count > 0 ) {
+        solClient_msg_free ( &catchup_p->ring_p[catchup_p->head].msg_p );
+        catchup_p->head = ( catchup_p->head + 1 ) % catchup_p->capacity;
+        catchup_p->count--;
+    }
+    free ( catchup_p->ring_p );
+    catchup_p->ring_p = NULL;
+    OS_MUTEX_DESTROY ( &catchup_p->lock );
+}
@@ -0,0 +1,175 @@
+/** example Intro/catchup.h
+ */
+
+/**
+ *
+ * file catchup.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a replay-to-live catch-up consumer: history is
+ * replayed from a start location while a live subscription is already
+ * receiving, and the consumer switches from the replay to the live stream
+ * at the point where they meet, with no gap and no duplicate.
+ *
+ * While replaying, live messages are kept (the receive callback returns
+ * ::SOLCLIENT_CALLBACK_TAKE_MSG) in a bounded ring together with their
+ * replication group message ID. Replayed messages are delivered as they
+ * come. Once a replayed message reaches the oldest live message in the
+ * ring, the two streams overlap: under the catch-up lock, the live
+ * messages the replay already delivered are dropped, the rest of the ring
+ * is delivered, and the consumer goes live. Because the switch holds the
+ * same lock as catchup_liveMsg(), a live message arriving meanwhile is
+ * either in the ring before the switch or delivered after it, never both.
+ * The application then destroys the replay Flow; replayed messages that
+ * still arrive are dropped.
+ *
+ * When the ring is full, its oldest live message is dropped. That opens no
+ * gap: the replay delivers it before it reaches the new oldest one, and
+ * the overlap is only looked for there. The ring bounds memory, not
+ * correctness, as long as the replay outruns the live rate. When no live
+ * message arrives during the replay, there is nothing to overlap with;
+ * the application calls catchup_replayIdle() once the replay stops
+ * delivering, and any live message the replay did deliver is recognized by
+ * its ID from then on.
+ *
+ * IDs that cannot be compared (e.g. from different replication groups)
+ * never end the replay; once live, such a message is delivered, as a
+ * duplicate is preferred to a gap.
+ */
+
+#ifndef CATCHUP_H_
+#define CATCHUP_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define CATCHUP_REPLAY          0
+#define CATCHUP_LIVE            1
+
+#define CATCHUP_DEFAULT_RING    65536   /**< Live messages kept while replaying. */
+
+/**
+ * Called for every message delivered, in order, with the catch-up lock
+ * held: it must not call into the catch-up consumer. The message belongs
+ * to the caller; copy what is needed.
+ * @param msg_p The message.
+ * @param source ::CATCHUP_REPLAY or ::CATCHUP_LIVE.
+ * @param user_p The user pointer given to catchup_init().
+ */
+typedef void    ( *catchup_deliverFunc_t ) ( solClient_opaqueMsg_pt msg_p, int source, void *user_p );
+
+/**
+ * @struct catchupEntry
+ * A live message kept while replaying.
+ */
+struct catchupEntry
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_replicationGroupMessageId_t rgmid;
+    solClient_uint64_t rxNs;
+};
+
+/**
+ * @struct catchupStats
+ */
+struct catchupStats
+{
+    solClient_uint64_t replayed;        /**< Delivered from the replay. */
+    solClient_uint64_t buffered;        /**< Live messages put in the ring. */
+    solClient_uint64_t overflowed;      /**< Dropped from the full ring, for the replay to deliver. */
+    solClient_uint64_t overlapped;      /**< Dropped from the ring at the switch, already replayed. */
+    solClient_uint64_t drained;         /**< Delivered from the ring at the switch. */
+    solClient_uint64_t live;            /**< Delivered live after the switch. */
+    solClient_uint64_t duplicates;      /**< Dropped after the switch, replayed or live already. */
+    solClient_uint64_t notComparable;   /**< IDs that could not be compared. */
+    solClient_uint64_t ringHighWater;
+    solClient_uint64_t startNs;         /**< catchup_init(), on the os_getTimeNs() clock. */
+    solClient_uint64_t switchNs;        /**< Start of the switch, 0 while replaying. */
+    solClient_uint64_t switchDurationNs;    /**< Ring drained and live. */
+    solClient_uint64_t switchLagNs;     /**< Age of the oldest live message drained. */
+    int             state;              /**< ::CATCHUP_REPLAY or ::CATCHUP_LIVE. */
+};
+
+/**
+ * @struct catchup
+ */
+struct catchup
+{
+    OS_MUTEX        lock;
+    struct catchupEntry *ring_p;
+    solClient_uint32_t capacity;
+    solClient_uint32_t head;            /**< Oldest entry. */
+    solClient_uint32_t count;
+    catchup_deliverFunc_t deliver_p;
+    void           *user_p;
+    solClient_replicationGroupMessageId_t last;     /**< Last delivered. */
+    int             haveLast;
+    struct catchupStats stats;
+};
+
+
+/**
+ * Initialize a catch-up consumer, in the replaying state.
+ * @param catchup_p The consumer to initialize.
+ * @param capacity Live messages kept while replaying, 0 for ::CATCHUP_DEFAULT_RING.
+ * @param deliver_p Called for each message delivered.
+ * @param user_p Passed to deliver_p.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    catchup_init ( struct catchup *catchup_p, solClient_uint32_t capacity, catchup_deliverFunc_t deliver_p,
+                   void *user_p );
+
+/**
+ * A message from the replay Flow. Delivers it unless live already, and
+ * switches to live when it reaches the ring.
+ * @param catchup_p The consumer.
+ * @param msg_p The message; it stays with the caller.
+ * @param rgmid_p Its replication group message ID.
+ */
+void
+    catchup_replayMsg ( struct catchup *catchup_p, solClient_opaqueMsg_pt msg_p,
+                        solClient_replicationGroupMessageId_pt rgmid_p );
+
+/**
+ * A message from the live subscription.
+ * @param catchup_p The consumer.
+ * @param msg_p The message.
+ * @param rgmid_p Its replication group message ID.
+ * @return ::SOLCLIENT_CALLBACK_TAKE_MSG when the message was kept in the
+ * ring, which then frees it; ::SOLCLIENT_CALLBACK_OK otherwise.
+ */
+solClient_rxMsgCallback_returnCode_t
+    catchup_liveMsg ( struct catchup *catchup_p, solClient_opaqueMsg_pt msg_p,
+                      solClient_replicationGroupMessageId_pt rgmid_p );
+
+/**
+ * The replay has stopped delivering. Switches to live when the ring is
+ * empty; otherwise the replay is still behind the live stream.
+ * @return 1 when live, 0 otherwise.
+ */
+int
+    catchup_replayIdle ( struct catchup *catchup_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    catchup_getStats ( struct catchup *catchup_p, struct catchupStats *stats_p );
+
+/**
+ * The ID of the last message delivered, to restart a replay from.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_NOT_FOUND before the first one.
+ */
+solClient_returnCode_t
+    catchup_getLastId ( struct catchup *catchup_p, solClient_replicationGroupMessageId_pt rgmid_p );
+
+/**
+ * Free the messages still in the ring, and the ring.
+ */
+void
+    catchup_destroy ( struct catchup *catchup_p );
+
+#endif /* CATCHUP_H_ */
@@ -23,6 +23,38 @@
 #include "RRcommon.h"
 #include "getopt.h"
 
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+/* The calls made on the application's behalf; see common_setSolClientApi(). */
+static const struct common_solClientApi common_libSolClientApi = {
+    solClient_context_create,
+    solClient_context_destroy,
+    solClient_context_startTimer,
+    solClient_context_stopTimer,
+    solClient_session_create,
+    solClient_session_destroy,
+    solClient_session_getContext,
+    solClient_session_connect,
+    solClient_session_disconnect,
+    solClient_session_isCapable,
+    solClient_session_sendMsg,
+    solClient_session_sendMultipleMsg,
+    solClient_session_sendRequest,
+    solClient_session_sendReply,
+    solClient_session_topicSubscribeExt,
+    solClient_session_topicUnsubscribeExt,
+    solClient_session_endpointProvision,
+    solClient_session_endpointDeprovision,
+    solClient_session_createFlow,
+    solClient_flow_destroy,
+    solClient_flow_getSession,
+    solClient_flow_sendAck,
+    solClient_msg_getMsgId
+};
+static const struct common_solClientApi *common_api_p = &common_libSolClientApi;
+
 /*****************************************************************************
  * common_printCCSMPversion
  *****************************************************************************/
@@ -108,6 +140,7 @@ common_initCommandOptions ( struct commonOptions *commonOpt,
         commonOpt->usingDurable = 0; //FALSE
         commonOpt->enableCompression = 0; //FALSE
         commonOpt->useGSS = 0; //FALSE
+        commonOpt->perfCounters = 0; //FALSE
         commonOpt->requiredFields = requiredParams;
         commonOpt->optionalFields = optionals;
     }
@@ -119,7 +152,7 @@ common_initCommandOptions ( struct commonOptions *commonOpt,
 int
 common_parseCommandOptions ( int argc, char **argv, struct commonOptions *commonOpt, const char *positionalDesc )
 {
-    static char    *optstring = "a:c:dgl:m:n:p:r:s:t:u:w:zR:";
+    static char    *optstring = "a:c:dgl:m:n:p:r:s:t:u:w:zR:P";
     static struct option longopts[] = {
         {"cache", 1, NULL, 'a'},
         {"cip", 1, NULL, 'c'},
@@ -134,6 +167,7 @@ common_parseCommandOptions ( int argc, char **argv, struct commonOptions *common
         {"win", 1, NULL, 'w'},
         {"zip", 0, NULL, 'z'},
         {"replay", 1, NULL, 'R'},
+        {"perf", 0, NULL, 'P'},
         {0, 0, 0, 0}
     };
     int             c;
@@ -157,6 +191,9 @@ common_parseCommandOptions ( int argc, char **argv, struct commonOptions *common
             case 'z':
                 commonOpt->enableCompression = 1; //TRUE
                 break;
+            case 'P':
+                commonOpt->perfCounters = 1; //TRUE
+                break;
             case 'R':
                 strncpy ( commonOpt->replayStartLocation, optarg, sizeof ( commonOpt->replayStartLocation ) );
                 break;
@@ -245,7 +282,7 @@ common_parseCommandOptions ( int argc, char **argv, struct commonOptions *common
         }
         printf (
             "Where PARAMETERS are:\n%s%s%s%s%s"
-            "Where OPTIONS are:\n%s%s%s%s%s%s%s%s%s%s%s%s%s\n",
+            "Where OPTIONS are:\n%s%s%s%s%s%s%s%s%s%s%s%s%s%s\n",
             ( commonOpt->requiredFields & HOST_PARAM_MASK ) ? HOST_PARAM_STRING : "",
             ( commonOpt->requiredFields & USER_PARAM_MASK ) ? USER_PARAM_STRING : "",
             ( commonOpt->requiredFields & DEST_PARAM_MASK ) ? DEST_PARAM_STRING : "",
@@ -263,7 +300,8 @@ common_parseCommandOptions ( int argc, char **argv, struct commonOptions *common
             ( commonOpt->optionalFields & LOG_LEVEL_MASK ) ? LOG_LEVEL_STRING : "",
             ( commonOpt->optionalFields & USE_GSS_MASK ) ? USE_GSS_STRING : "",
             ( commonOpt->optionalFields & ZIP_LEVEL_MASK ) ? ZIP_LEVEL_STRING : "",
-            ( commonOpt->optionalFields & REPLAY_START_MASK ) ? REPLAY_START_STRING : ""
+            ( commonOpt->optionalFields & REPLAY_START_MASK ) ? REPLAY_START_STRING : "",
+            ( commonOpt->optionalFields & PERF_COUNTERS_MASK ) ? PERF_COUNTERS_STRING : ""
            );
         if (positionalDesc != NULL) {
             printf (
@@ -285,6 +323,21 @@ common_createAndConnectSession ( solClient_opaqueContext_pt context_p,
                                  solClient_session_rxMsgCallbackFunc_t msgCallback_p,
                                  solClient_session_eventCallbackFunc_t eventCallback_p,
                                  void *user_p, struct commonOptions * commonOpts )
+{
+    return common_createAndConnectSessionExt ( context_p, session_p, msgCallback_p, eventCallback_p, user_p,
+                                               commonOpts, NULL );
+}
+
+/*****************************************************************************
+ * common_createAndConnectSessionExt
+ *****************************************************************************/
+solClient_returnCode_t
+common_createAndConnectSessionExt ( solClient_opaqueContext_pt context_p,
+                                    solClient_opaqueSession_pt * session_p,
+                                    solClient_session_rxMsgCallbackFunc_t msgCallback_p,
+                                    solClient_session_eventCallbackFunc_t eventCallback_p,
+                                    void *user_p, struct commonOptions * commonOpts,
+                                    const char *const *extraProps_p )
 {
     /* Return code */
     solClient_returnCode_t rc = SOLCLIENT_OK;
@@ -295,6 +348,8 @@ common_createAndConnectSession ( solClient_opaqueContext_pt context_p,
     /* Session Properties */
     const char     *sessionProps[50] = {0, };
     int             propIndex = 0;
+    int             numExtra;
+    int             i;
 
 
     /*************************************************************************
@@ -378,12 +433,26 @@ common_createAndConnectSession ( solClient_opaqueContext_pt context_p,
         sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_AUTHENTICATION_SCHEME_GSS_KRB;
     }
 
+    /* The extra properties are all set or the Session is not created. */
+    numExtra = 0;
+    while ( extraProps_p != NULL && extraProps_p[numExtra] != NULL ) {
+        numExtra++;
+    }
+    if ( numExtra % 2 != 0 || propIndex + numExtra >= ( int ) ( sizeof ( sessionProps ) / sizeof ( sessionProps[0] ) ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "common_createAndConnectSessionExt(): %d extra property entries do not fit "
+                        "after %d, or are not in pairs", numExtra, propIndex );
+        return SOLCLIENT_FAIL;
+    }
+    for ( i = 0; i < numExtra; i++ ) {
+        sessionProps[propIndex++] = extraProps_p[i];
+    }
+
     /*************************************************************************
      * Create the Session
      *************************************************************************/
-    if ( ( rc = solClient_session_create ( (char **) sessionProps,
-                                           context_p,
-                                           session_p, &sessionFuncInfo, sizeof ( sessionFuncInfo ) ) ) != SOLCLIENT_OK ) {
+    if ( ( rc = common_api_p->session_create ( (char **) sessionProps,
+                                               context_p,
+                                               session_p, &sessionFuncInfo, sizeof ( sessionFuncInfo ) ) ) != SOLCLIENT_OK ) {
         common_handleError ( rc, "solClient_session_create()" );
         return rc;
     }
@@ -391,7 +460,7 @@ common_createAndConnectSession ( solClient_opaqueContext_pt context_p,
     /*************************************************************************
      * Connect the Session
      *************************************************************************/
-    if ( ( rc = solClient_session_connect ( *session_p ) ) != SOLCLIENT_OK ) {
+    if ( ( rc = common_api_p->session_connect ( *session_p ) ) != SOLCLIENT_OK ) {
         common_handleError ( rc, "solClient_session_connect()" );
         return rc;
     }
@@ -420,9 +489,9 @@ common_createQueue ( solClient_opaqueSession_pt session_p, const char *queueName
     props[propIndex++] = "100";
 
 
-    if ( ( rc = solClient_session_endpointProvision ( (char**) props, session_p, ( SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM | SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS ), NULL, /* correlationTag pointer */
-                                                      NULL,
-                                                      0 ) ) == SOLCLIENT_FAIL ) {
+    if ( ( rc = common_api_p->session_endpointProvision ( (char**) props, session_p, ( SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM | SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS ), NULL, /* correlationTag pointer */
+                                                          NULL,
+                                                          0 ) ) == SOLCLIENT_FAIL ) {
         common_handleError ( rc, "solClient_session_endpointProvision()" );
         return rc;
     }
@@ -446,7 +515,7 @@ common_deleteQueue ( solClient_opaqueSession_pt session_p, const char *queueName
     props[propIndex++] = queueName_p;
     props[propIndex] = NULL;
 
-    if ( ( rc = solClient_session_endpointDeprovision ( (char**)props, session_p, ( SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM | SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS ), NULL        /* correlationTag pointer */
+    if ( ( rc = common_api_p->session_endpointDeprovision ( (char**)props, session_p, ( SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM | SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS ), NULL        /* correlationTag pointer */
             ) ) == SOLCLIENT_FAIL ) {
         common_handleError ( rc, "solClient_session_endpointDeprovision()" );
         return rc;
@@ -465,14 +534,16 @@ common_publishMessage ( solClient_opaqueSession_pt session_p, char *topic_p, sol
     solClient_returnCode_t rcFreeMsg = SOLCLIENT_OK;
     solClient_opaqueMsg_pt msg_p = NULL;
     solClient_destination_t destination;
-    const char *text_p = COMMON_ATTACHMENT_TEXT;
-
+    char            text[sizeof ( COMMON_ATTACHMENT_TEXT ) - 1 + COMMON_INTEGRITY_TRAILER_LEN] = COMMON_ATTACHMENT_TEXT;
+    solClient_uint32_t textLen = ( solClient_uint32_t ) ( sizeof ( COMMON_ATTACHMENT_TEXT ) - 1 );
+    COMMON_PROBE_BEGIN ( probe, "tx.publishMessage" );
 
     solClient_log ( SOLCLIENT_LOG_DEBUG, "common_publishMessage() called.\n" );
 
     /* Allocate memory for the message to be sent. */
     if ( ( rc = solClient_msg_alloc ( &msg_p ) ) != SOLCLIENT_OK ) {
         common_handleError ( rc, "solClient_msg_alloc()" );
+        COMMON_PROBE_END ( probe );
         return rc;
     }
 
@@ -483,8 +554,8 @@ common_publishMessage ( solClient_opaqueSession_pt session_p, char *topic_p, sol
     }
 
     /* attach a payload */
-    if ( ( rc = solClient_msg_setBinaryAttachment ( msg_p, text_p, ( solClient_uint32_t ) strlen ( (char *)text_p ) ) ) != SOLCLIENT_OK ) {
-        common_handleError ( rc, "solClient_msg_setBinaryAttachment()" );
+    if ( ( rc = common_integritySetPayload ( msg_p, text, textLen ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "common_integritySetPayload()" );
         goto freeMessage;
     }
 
@@ -497,16 +568,18 @@ common_publishMessage ( solClient_opaqueSession_pt session_p, char *topic_p, sol
     }
 
     /* Send the message. */
-    if ( ( rc = solClient_session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
+    if ( ( rc = common_api_p->session_sendMsg ( session_p, msg_p ) ) != SOLCLIENT_OK ) {
         common_handleError ( rc, "solClient_session_sendMsg()" );
         goto freeMessage;
     }
+    common_topicsRecordTopic ( COMMON_TOPICS_TX, topic_p, textLen );
 
   freeMessage:
     if ( ( rcFreeMsg = solClient_msg_free ( &msg_p ) ) != SOLCLIENT_OK ) {
         common_handleError ( rcFreeMsg, "solClient_msg_free()" );
     }
 
+    COMMON_PROBE_END ( probe );
     return rc;
 }
 
@@ -638,11 +711,15 @@ common_flowMessageReceiveCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solCli
 {
     solClient_msgId_t msgId;
     int            *counter_p;
+    COMMON_PROBE_BEGIN ( probe, "rx.flow" );
+
+    common_topicsRecord ( COMMON_TOPICS_RX, msg_p );
+    common_integrityCheck ( msg_p, NULL, NULL );
 
     if ( user_p == NULL ) {
         /* Note: solClient_msg_getMsgId will fail on Direct messages, but 
          * it should not get as the callback is for a Flow. */
-        if ( solClient_msg_getMsgId ( msg_p, &msgId ) == SOLCLIENT_OK ) {
+        if ( common_api_p->msg_getMsgId ( msg_p, &msgId ) == SOLCLIENT_OK ) {
             printf ( "Received message on flow. (Message ID: %lld).\n", msgId );
         } else {
             printf ( "Received message on flow.\n" );
@@ -652,6 +729,7 @@ common_flowMessageReceiveCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solCli
         ( *counter_p )++;
     }
 
+    COMMON_PROBE_END ( probe );
     /* 
      * Returning SOLCLIENT_CALLBACK_OK causes the API to free the memory 
      * used by the message. This is important to avoid leaks.
@@ -666,17 +744,22 @@ solClient_rxMsgCallback_returnCode_t
 common_flowMessageReceiveAckCallback ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, void *user_p )
 {
     solClient_msgId_t msgId;
+    COMMON_PROBE_BEGIN ( probe, "rx.flowAck" );
+
+    common_topicsRecord ( COMMON_TOPICS_RX, msg_p );
+    common_integrityCheck ( msg_p, NULL, NULL );
 
     /* Note: solClient_msg_getMsgId will fail on Direct messages, but 
      * it should not get as the callback is for a Flow. */
-    if ( solClient_msg_getMsgId ( msg_p, &msgId ) == SOLCLIENT_OK ) {
+    if ( common_api_p->msg_getMsgId ( msg_p, &msgId ) == SOLCLIENT_OK ) {
         printf ( "Acknowledging message Id: %lld.\n", msgId );
-        solClient_flow_sendAck ( opaqueFlow_p, msgId );
+        common_api_p->flow_sendAck ( opaqueFlow_p, msgId );
       
     } else {
         printf ( "Received message on flow.\n" );
     }
 
+    COMMON_PROBE_END ( probe );
     /* 
      * Returning SOLCLIENT_CALLBACK_OK causes the API to free the memory 
      * used by the message. This is important to avoid leaks.
@@ -726,9 +809,9 @@ common_flowMessageReceivePrintMsgAndAckCallback ( solClient_opaqueFlow_pt opaque
     printf ( "\n" );
 
     /* Acknowledge the message after processing it. */
-    if ( solClient_msg_getMsgId ( msg_p, &msgId )  == SOLCLIENT_OK ) {
+    if ( common_api_p->msg_getMsgId ( msg_p, &msgId )  == SOLCLIENT_OK ) {
         printf ( "Acknowledging message Id: %lld.\n", msgId );
-        solClient_flow_sendAck ( opaqueFlow_p, msgId );
+        common_api_p->flow_sendAck ( opaqueFlow_p, msgId );
     }
 
     /* 
@@ -749,6 +832,10 @@ common_messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solC
 
     solClient_int64_t rxSeqNum;
     const char     *senderId_p;
+    COMMON_PROBE_BEGIN ( probe, "rx.messageReceive" );
+
+    common_topicsRecord ( COMMON_TOPICS_RX, msg_p );
+    common_integrityCheck ( msg_p, NULL, NULL );
 
     /* 
      * Get the message sequence number and sender ID. Check to see if the 
@@ -760,6 +847,7 @@ common_messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solC
             rxSeqNum = 0;
         } else {
             common_handleError ( rc, "solClient_msg_getSequenceNumber()" );
+            COMMON_PROBE_END ( probe );
             return SOLCLIENT_CALLBACK_OK;
         }
     }
@@ -769,6 +857,7 @@ common_messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solC
             senderId_p = "";
         } else {
             common_handleError ( rc, "solClient_msg_getSenderId()" );
+            COMMON_PROBE_END ( probe );
             return SOLCLIENT_CALLBACK_OK;
         }
     }
@@ -779,6 +868,7 @@ common_messageReceiveCallback ( solClient_opaqueSession_pt opaqueSession_p, solC
         printf ( "Received message from '%s' (seq# %llu)\n", senderId_p, rxSeqNum );
     }
 
+    COMMON_PROBE_END ( probe );
     /* 
      * Returning SOLCLIENT_CALLBACK_OK causes the API to free the memory 
      * used by the message. This is important to avoid leaks.
@@ -822,6 +912,9 @@ common_messageReceivePrintMsgCallback ( solClient_opaqueSession_pt opaqueSession
 solClient_rxMsgCallback_returnCode_t
 common_messageReceivePerfCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
 {
+    common_topicsRecord ( COMMON_TOPICS_RX, msg_p );
+    common_integrityCheck ( msg_p, NULL, NULL );
+
     /* 
      * Returning SOLCLIENT_CALLBACK_OK causes the API to free the memory 
      * used by the message. This is important to avoid leaks.
@@ -855,3 +948,1428 @@ RR_operationToString ( RR_operation_t operation )
     }
 }
 
+
+/*****************************************************************************
+ * common_setSolClientApi
+ *****************************************************************************/
+void
+common_setSolClientApi ( const struct common_solClientApi *api_p )
+{
+    common_api_p = ( api_p != NULL ) ? api_p : &common_libSolClientApi;
+}
+
+
+/*****************************************************************************
+ * common_getSolClientApi
+ *****************************************************************************/
+const struct common_solClientApi *
+common_getSolClientApi ( void )
+{
+    return common_api_p;
+}
+
+
+
+/*****************************************************************************
+ * common_random
+ *****************************************************************************/
+solClient_uint64_t
+common_random ( solClient_uint64_t *state_p )
+{
+    solClient_uint64_t x = *state_p;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state_p = x;
+    return x;
+}
+
+/*****************************************************************************
+ * common_randomSeed
+ *****************************************************************************/
+solClient_uint64_t
+common_randomSeed ( solClient_uint64_t salt )
+{
+    solClient_uint64_t seed = COMMON_RANDOM_SEED ^ ( salt << 16 ) ^ os_getTimeNs (  );
+
+    return ( seed != 0 ) ? seed : COMMON_RANDOM_SEED;
+}
+
+
+
+/*****************************************************************************
+ * Traffic classes
+ *****************************************************************************/
+static const struct commonClassConfig common_classDefaults[COMMON_NUM_CLASSES] = {
+    {NULL, NULL, NULL, NULL, 200},
+    {NULL, NULL, NULL, NULL, 100},
+    {NULL, NULL, NULL, NULL, 0}
+};
+
+/*****************************************************************************
+ * common_classRouterCreate
+ *****************************************************************************/
+solClient_returnCode_t
+common_classRouterCreate ( struct commonClassRouter *router_p, struct commonOptions *commonOpts,
+                           const struct commonClassConfig *configs_p, int isolate,
+                           solClient_session_rxMsgCallbackFunc_t msgCallback_p,
+                           solClient_session_eventCallbackFunc_t eventCallback_p, void *user_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    const struct commonClassConfig *config_p;
+    const char     *contextProps[2 * 2 + 1];      /* Thread creation and affinity. */
+    const char     *sessionProps[3 * 2 + 1];      /* The three buffer sizes. */
+    int             propIndex;
+    int             i;
+
+    memset ( router_p, 0, sizeof ( *router_p ) );
+    memcpy ( router_p->configs, ( configs_p != NULL ) ? configs_p : common_classDefaults, sizeof ( router_p->configs ) );
+    router_p->numSessions = isolate ? COMMON_NUM_CLASSES : 1;
+
+    for ( i = 0; i < router_p->numSessions; i++ ) {
+        config_p = &router_p->configs[isolate ? i : COMMON_CLASS_NORMAL];
+
+        propIndex = 0;
+        contextProps[propIndex++] = SOLCLIENT_CONTEXT_PROP_CREATE_THREAD;
+        contextProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+        if ( config_p->cpuList_p != NULL ) {
+            contextProps[propIndex++] = SOLCLIENT_CONTEXT_PROP_THREAD_AFFINITY_CPU_LIST;
+            contextProps[propIndex++] = config_p->cpuList_p;
+        }
+        contextProps[propIndex] = NULL;
+        if ( ( rc = common_api_p->context_create ( ( char ** ) contextProps, &router_p->contexts[i],
+                                                   &contextFuncInfo, sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_create()" );
+            goto fail;
+        }
+
+        propIndex = 0;
+        if ( config_p->sendBufSize_p != NULL ) {
+            sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_SOCKET_SEND_BUF_SIZE;
+            sessionProps[propIndex++] = config_p->sendBufSize_p;
+        }
+        if ( config_p->rcvBufSize_p != NULL ) {
+            sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_SOCKET_RCV_BUF_SIZE;
+            sessionProps[propIndex++] = config_p->rcvBufSize_p;
+        }
+        if ( config_p->bufferSize_p != NULL ) {
+            sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_BUFFER_SIZE;
+            sessionProps[propIndex++] = config_p->bufferSize_p;
+        }
+        sessionProps[propIndex] = NULL;
+        if ( ( rc = common_createAndConnectSessionExt ( router_p->contexts[i], &router_p->sessions[i], msgCallback_p,
+                                                        eventCallback_p, user_p, commonOpts,
+                                                        sessionProps ) ) != SOLCLIENT_OK ) {
+            goto fail;
+        }
+    }
+    for ( ; i < COMMON_NUM_CLASSES; i++ ) {
+        router_p->sessions[i] = router_p->sessions[0];
+    }
+    return SOLCLIENT_OK;
+
+  fail:
+    common_classRouterDestroy ( router_p );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * common_classAddRoute
+ *****************************************************************************/
+solClient_returnCode_t
+common_classAddRoute ( struct commonClassRouter *router_p, const char *prefix_p, int trafficClass )
+{
+    struct commonClassRoute *route_p;
+
+    if ( router_p->numRoutes == COMMON_CLASS_MAX_ROUTES || trafficClass < 0 || trafficClass >= COMMON_NUM_CLASSES ||
+         strlen ( prefix_p ) > SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Cannot route '%s' to class %d", prefix_p, trafficClass );
+        return SOLCLIENT_FAIL;
+    }
+    route_p = &router_p->routes[router_p->numRoutes++];
+    strcpy ( route_p->prefix, prefix_p );
+    route_p->length = strlen ( prefix_p );
+    route_p->trafficClass = trafficClass;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * common_classOf
+ *****************************************************************************/
+int
+common_classOf ( struct commonClassRouter *router_p, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_destination_t destination;
+    solClient_int32_t priority = -1;
+    size_t          longest = 0;
+    int             trafficClass = COMMON_CLASS_NORMAL;
+    int             i;
+
+    if ( solClient_msg_getPriority ( msg_p, &priority ) == SOLCLIENT_OK && priority >= 0 ) {
+        for ( i = 0; i < COMMON_NUM_CLASSES; i++ ) {
+            if ( router_p->configs[i].minPriority >= 0 && priority >= router_p->configs[i].minPriority ) {
+                return i;
+            }
+        }
+    }
+    if ( router_p->numRoutes == 0 ||
+         solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) != SOLCLIENT_OK ) {
+        return trafficClass;
+    }
+    for ( i = 0; i < router_p->numRoutes; i++ ) {
+        if ( router_p->routes[i].length >= longest &&
+             strncmp ( destination.dest, router_p->routes[i].prefix, router_p->routes[i].length ) == 0 ) {
+            longest = router_p->routes[i].length;
+            trafficClass = router_p->routes[i].trafficClass;
+        }
+    }
+    return trafficClass;
+}
+
+/*****************************************************************************
+ * common_classSend
+ *****************************************************************************/
+solClient_returnCode_t
+common_classSend ( struct commonClassRouter *router_p, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_returnCode_t rc;
+    int             trafficClass = common_classOf ( router_p, msg_p );
+
+    if ( ( rc = common_api_p->session_sendMsg ( router_p->sessions[trafficClass], msg_p ) ) == SOLCLIENT_OK ) {
+        router_p->sent[trafficClass]++;
+        common_topicsRecord ( COMMON_TOPICS_TX, msg_p );
+    } else {
+        router_p->failed[trafficClass]++;
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * common_classSession
+ *****************************************************************************/
+solClient_opaqueSession_pt
+common_classSession ( struct commonClassRouter *router_p, int trafficClass )
+{
+    return router_p->sessions[trafficClass];
+}
+
+/*****************************************************************************
+ * common_classRouterDestroy
+ *****************************************************************************/
+void
+common_classRouterDestroy ( struct commonClassRouter *router_p )
+{
+    solClient_returnCode_t rc;
+    int             i;
+
+    for ( i = 0; i < router_p->numSessions; i++ ) {
+        if ( router_p->sessions[i] != NULL ) {
+            if ( ( rc = common_api_p->session_disconnect ( router_p->sessions[i] ) ) != SOLCLIENT_OK ) {
+                common_handleError ( rc, "solClient_session_disconnect()" );
+            }
+            if ( ( rc = common_api_p->session_destroy ( &router_p->sessions[i] ) ) != SOLCLIENT_OK ) {
+                common_handleError ( rc, "solClient_session_destroy()" );
+            }
+        }
+        if ( router_p->contexts[i] != NULL &&
+             ( rc = common_api_p->context_destroy ( &router_p->contexts[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_destroy()" );
+        }
+    }
+    memset ( router_p->sessions, 0, sizeof ( router_p->sessions ) );
+    memset ( router_p->contexts, 0, sizeof ( router_p->contexts ) );
+    router_p->numSessions = 0;
+}
+
+
+
+/*****************************************************************************
+ * common_histogramAdd
+ *****************************************************************************/
+void
+common_histogramAdd ( struct commonHistogram *hist_p, solClient_uint64_t value )
+{
+    int             bucket = 0;
+
+    hist_p->count++;
+    hist_p->sum += value;
+    if ( value > hist_p->max ) {
+        hist_p->max = value;
+    }
+    while ( value != 0 && bucket < COMMON_HISTOGRAM_BUCKETS - 1 ) {
+        value >>= 1;
+        bucket++;
+    }
+    hist_p->buckets[bucket]++;
+}
+
+/*****************************************************************************
+ * common_histogramMerge
+ *****************************************************************************/
+void
+common_histogramMerge ( struct commonHistogram *total_p, const struct commonHistogram *hist_p )
+{
+    int             bucket;
+
+    total_p->count += hist_p->count;
+    total_p->sum += hist_p->sum;
+    if ( hist_p->max > total_p->max ) {
+        total_p->max = hist_p->max;
+    }
+    for ( bucket = 0; bucket < COMMON_HISTOGRAM_BUCKETS; bucket++ ) {
+        total_p->buckets[bucket] += hist_p->buckets[bucket];
+    }
+}
+
+/*****************************************************************************
+ * common_histogramPercentile
+ *****************************************************************************/
+solClient_uint64_t
+common_histogramPercentile ( const struct commonHistogram *hist_p, double percentile )
+{
+    solClient_uint64_t rank = ( solClient_uint64_t ) ( percentile / 100.0 * ( double ) hist_p->count );
+    solClient_uint64_t seen = 0;
+    solClient_uint64_t bound;
+    int             bucket;
+
+    for ( bucket = 0; bucket < COMMON_HISTOGRAM_BUCKETS; bucket++ ) {
+        seen += hist_p->buckets[bucket];
+        if ( seen > rank ) {
+            bound = ( bucket == 0 ) ? 0 : ( ( solClient_uint64_t ) 1 << bucket ) - 1;
+            return ( bound < hist_p->max ) ? bound : hist_p->max;
+        }
+    }
+    return hist_p->max;
+}
+
+/*****************************************************************************
+ * common_histogramMean
+ *****************************************************************************/
+double
+common_histogramMean ( const struct commonHistogram *hist_p )
+{
+    return ( hist_p->count != 0 ) ? ( double ) hist_p->sum / ( double ) hist_p->count : 0.0;
+}
+
+
+/*****************************************************************************
+ * Hot-path probes
+ *
+ * Each thread that records gets its own histograms on first use, so
+ * common_probeRecord() never takes a lock. The blocks are kept after a
+ * thread exits so that its records still show up in common_probeDump().
+ *****************************************************************************/
+struct commonProbeThread
+{
+    struct commonHistogram sites[COMMON_PROBE_MAX_SITES];
+};
+
+static OS_STATIC_MUTEX common_probeLock = OS_STATIC_MUTEX_INITIALIZER;
+static const char *common_probeNames[COMMON_PROBE_MAX_SITES];
+static int      common_probeNumSites = 0;
+static struct commonProbeThread *common_probeThreads[COMMON_PROBE_MAX_THREADS];
+static int      common_probeNumThreads = 0;
+static solClient_uint64_t common_probeStartTicks;
+static unsigned long long common_probeStartNs;
+static OS_THREAD_LOCAL struct commonProbeThread *common_probeThread_p = NULL;
+static OS_THREAD_LOCAL int common_probeThreadRefused = 0;
+
+/*****************************************************************************
+ * common_probeRegister
+ *****************************************************************************/
+int
+common_probeRegister ( const char *name_p )
+{
+    int             site;
+
+    OS_STATIC_MUTEX_LOCK ( &common_probeLock );
+    for ( site = 0; site < common_probeNumSites; site++ ) {
+        if ( strcmp ( common_probeNames[site], name_p ) == 0 ) {
+            goto done;
+        }
+    }
+    if ( common_probeNumSites == COMMON_PROBE_MAX_SITES ) {
+        site = -1;
+        goto done;
+    }
+    if ( common_probeNumSites == 0 ) {
+        /* The start of the tick to nanosecond calibration. */
+        common_probeStartNs = os_getTimeNs (  );
+        common_probeStartTicks = COMMON_PROBE_TICKS (  );
+    }
+    common_probeNames[common_probeNumSites] = name_p;
+    site = common_probeNumSites++;
+
+  done:
+    OS_STATIC_MUTEX_UNLOCK ( &common_probeLock );
+    return site;
+}
+
+/*****************************************************************************
+ * common_probeAttachThread
+ *****************************************************************************/
+static struct commonProbeThread *
+common_probeAttachThread ( void )
+{
+    struct commonProbeThread *thread_p;
+
+    if ( common_probeThreadRefused ||
+         ( thread_p = ( struct commonProbeThread * ) calloc ( 1, sizeof ( struct commonProbeThread ) ) ) == NULL ) {
+        common_probeThreadRefused = 1;
+        return NULL;
+    }
+    OS_STATIC_MUTEX_LOCK ( &common_probeLock );
+    if ( common_probeNumThreads == COMMON_PROBE_MAX_THREADS ) {
+        OS_STATIC_MUTEX_UNLOCK ( &common_probeLock );
+        free ( thread_p );
+        common_probeThreadRefused = 1;
+        return NULL;
+    }
+    common_probeThreads[common_probeNumThreads++] = thread_p;
+    OS_STATIC_MUTEX_UNLOCK ( &common_probeLock );
+
+    common_probeThread_p = thread_p;
+    return thread_p;
+}
+
+/*****************************************************************************
+ * common_probeRecord
+ *****************************************************************************/
+void
+common_probeRecord ( int site, solClient_uint64_t ticks )
+{
+    struct commonProbeThread *thread_p = common_probeThread_p;
+
+    if ( site < 0 || ( thread_p == NULL && ( thread_p = common_probeAttachThread (  ) ) == NULL ) ) {
+        return;
+    }
+    common_histogramAdd ( &thread_p->sites[site], ticks );
+}
+
+/*****************************************************************************
+ * common_probeDump
+ *****************************************************************************/
+void
+common_probeDump ( void )
+{
+    struct commonHistogram total;
+    const struct commonHistogram *counters_p;
+    unsigned long long elapsedNs;
+    double          nsPerTick = 1.0;
+    int             numSites;
+    int             numThreads;
+    int             threadsSeen;
+    int             site;
+    int             t;
+
+    OS_STATIC_MUTEX_LOCK ( &common_probeLock );
+    numSites = common_probeNumSites;
+    numThreads = common_probeNumThreads;
+    OS_STATIC_MUTEX_UNLOCK ( &common_probeLock );
+    if ( numSites == 0 ) {
+        return;
+    }
+    elapsedNs = os_getTimeNs (  ) - common_probeStartNs;
+    if ( COMMON_PROBE_TICKS (  ) > common_probeStartTicks && elapsedNs > 0 ) {
+        nsPerTick = ( double ) elapsedNs / ( double ) ( COMMON_PROBE_TICKS (  ) - common_probeStartTicks );
+    }
+
+    printf ( "%-24s %12s %10s %10s %10s %10s %10s %8s\n",
+             "probe", "count", "mean ns", "p50 ns", "p99 ns", "p99.9 ns", "max ns", "threads" );
+    for ( site = 0; site < numSites; site++ ) {
+        memset ( &total, 0, sizeof ( total ) );
+        threadsSeen = 0;
+        for ( t = 0; t < numThreads; t++ ) {
+            counters_p = &common_probeThreads[t]->sites[site];
+            if ( counters_p->count == 0 ) {
+                continue;
+            }
+            threadsSeen++;
+            common_histogramMerge ( &total, counters_p );
+        }
+        if ( total.count == 0 ) {
+            printf ( "%-24s %12d\n", common_probeNames[site], 0 );
+            continue;
+        }
+        printf ( "%-24s %12llu %10.1f %10.0f %10.0f %10.0f %10.0f %8d\n", common_probeNames[site],
+                 ( unsigned long long ) total.count, common_histogramMean ( &total ) * nsPerTick,
+                 ( double ) common_histogramPercentile ( &total, 50.0 ) * nsPerTick,
+                 ( double ) common_histogramPercentile ( &total, 99.0 ) * nsPerTick,
+                 ( double ) common_histogramPercentile ( &total, 99.9 ) * nsPerTick,
+                 ( double ) total.max * nsPerTick, threadsSeen );
+    }
+}
+
+
+/*****************************************************************************
+ * Heavy-hitter topics
+ *
+ * A table belongs to one thread and one direction, and only that thread
+ * touches its sketch and heaps; the last report is copied out under the
+ * table's lock at the end of each interval. Tables are kept after their
+ * thread exits, like the probe blocks.
+ *****************************************************************************/
+struct commonTopicsCell
+{
+    solClient_uint64_t msgs;
+    solClient_uint64_t bytes;
+};
+
+/* A min-heap on value, the hashes apart so that the lookup scans them alone. */
+struct commonTopicsHeap
+{
+    solClient_uint64_t hashes[COMMON_TOPICS_TOP_K];
+    solClient_uint64_t values[COMMON_TOPICS_TOP_K];
+    struct commonTopicCount entries[COMMON_TOPICS_TOP_K];
+    int             count;
+};
+
+struct commonTopicsTable
+{
+    struct commonTopicsCell cells[COMMON_TOPICS_DEPTH][COMMON_TOPICS_WIDTH];
+    struct commonTopicsHeap byMsgs;
+    struct commonTopicsHeap byBytes;
+    int             direction;
+    solClient_uint64_t records;         /* Sampled. */
+    solClient_uint64_t weight;          /* The sampling rate the thread's skip was drawn at. */
+    solClient_uint64_t random;
+    solClient_uint64_t totalMsgs;
+    solClient_uint64_t totalBytes;
+    solClient_uint64_t startNs;
+    OS_MUTEX        lock;               /* For last. */
+    struct commonTopicsReport last;
+};
+
+static OS_STATIC_MUTEX common_topicsLock = OS_STATIC_MUTEX_INITIALIZER;
+static struct commonTopicsTable *common_topicsTables[COMMON_TOPICS_MAX_TABLES];
+static int      common_topicsNumTables = 0;
+static volatile solClient_uint64_t common_topicsIntervalNs = 0;
+static volatile int common_topicsSampling = COMMON_TOPICS_SAMPLE_DEFAULT;
+static volatile solClient_uint64_t common_topicsRefused = 0;     /* Records with no table; counted loosely. */
+static OS_THREAD_LOCAL struct commonTopicsTable *common_topicsTable_p[COMMON_TOPICS_NUM_DIRECTIONS];
+static OS_THREAD_LOCAL solClient_uint64_t common_topicsSkip[COMMON_TOPICS_NUM_DIRECTIONS];     /* To the next sampled. */
+static OS_THREAD_LOCAL int common_topicsThreadRefused = 0;
+
+/*****************************************************************************
+ * common_topicsEnable
+ *****************************************************************************/
+void
+common_topicsEnable ( int intervalMs )
+{
+    common_topicsIntervalNs = ( intervalMs > 0 ) ? ( solClient_uint64_t ) intervalMs * 1000000ULL : 0;
+}
+
+/*****************************************************************************
+ * common_topicsSetSampling
+ *****************************************************************************/
+void
+common_topicsSetSampling ( int oneIn )
+{
+    common_topicsSampling = ( oneIn > 1 ) ? oneIn : 1;
+}
+
+/*****************************************************************************
+ * common_topicsDrawSkip
+ *
+ * The gap to the next message sampled, uniform in [1, 2 * rate - 1] so
+ * that it averages the rate without locking onto a period in the traffic.
+ *****************************************************************************/
+static void
+common_topicsDrawSkip ( struct commonTopicsTable *table_p )
+{
+    solClient_uint64_t oneIn = ( solClient_uint64_t ) common_topicsSampling;
+
+    table_p->weight = oneIn;
+    common_topicsSkip[table_p->direction] = ( oneIn == 1 ) ? 1 : 1 + common_random ( &table_p->random ) % ( 2 * oneIn - 1 );
+}
+
+/*****************************************************************************
+ * common_topicsAttach
+ *****************************************************************************/
+static struct commonTopicsTable *
+common_topicsAttach ( int direction )
+{
+    struct commonTopicsTable *table_p;
+
+    if ( common_topicsThreadRefused ||
+         ( table_p = ( struct commonTopicsTable * ) calloc ( 1, sizeof ( struct commonTopicsTable ) ) ) == NULL ) {
+        common_topicsThreadRefused = 1;
+        return NULL;
+    }
+    OS_STATIC_MUTEX_LOCK ( &common_topicsLock );
+    if ( common_topicsNumTables == COMMON_TOPICS_MAX_TABLES ) {
+        OS_STATIC_MUTEX_UNLOCK ( &common_topicsLock );
+        free ( table_p );
+        common_topicsThreadRefused = 1;
+        solClient_log ( SOLCLIENT_LOG_WARNING, "common_topicsAttach(): all %d tables in use, thread not recorded",
+                        COMMON_TOPICS_MAX_TABLES );
+        return NULL;
+    }
+    table_p->direction = direction;
+    table_p->startNs = os_getTimeNs (  );
+    table_p->random = common_randomSeed ( ( solClient_uint64_t ) ( size_t ) table_p );
+    table_p->weight = 1;
+    OS_MUTEX_INIT ( &table_p->lock );
+    common_topicsTables[common_topicsNumTables++] = table_p;
+    OS_STATIC_MUTEX_UNLOCK ( &common_topicsLock );
+
+    common_topicsTable_p[direction] = table_p;
+    return table_p;
+}
+
+/*****************************************************************************
+ * common_topicsSwap
+ *****************************************************************************/
+static void
+common_topicsSwap ( struct commonTopicsHeap *heap_p, int a, int b )
+{
+    solClient_uint64_t hash = heap_p->hashes[a];
+    solClient_uint64_t value = heap_p->values[a];
+    struct commonTopicCount entry = heap_p->entries[a];
+
+    heap_p->hashes[a] = heap_p->hashes[b];
+    heap_p->values[a] = heap_p->values[b];
+    heap_p->entries[a] = heap_p->entries[b];
+    heap_p->hashes[b] = hash;
+    heap_p->values[b] = value;
+    heap_p->entries[b] = entry;
+}
+
+/*****************************************************************************
+ * common_topicsSiftDown
+ *****************************************************************************/
+static void
+common_topicsSiftDown ( struct commonTopicsHeap *heap_p, int i )
+{
+    int             least;
+    int             child;
+
+    for ( ;; ) {
+        least = i;
+        child = 2 * i + 1;
+        if ( child < heap_p->count && heap_p->values[child] < heap_p->values[least] ) {
+            least = child;
+        }
+        if ( child + 1 < heap_p->count && heap_p->values[child + 1] < heap_p->values[least] ) {
+            least = child + 1;
+        }
+        if ( least == i ) {
+            return;
+        }
+        common_topicsSwap ( heap_p, i, least );
+        i = least;
+    }
+}
+
+/*****************************************************************************
+ * common_topicsOffer
+ *
+ * Keep the topic if its estimate is among the K highest of the interval.
+ * Estimates only grow, so a topic already held only moves down.
+ *****************************************************************************/
+static void
+common_topicsOffer ( struct commonTopicsHeap *heap_p, solClient_uint64_t hash, const char *topic_p,
+                     solClient_uint32_t len, solClient_uint64_t msgs, solClient_uint64_t bytes,
+                     solClient_uint64_t value )
+{
+    struct commonTopicCount *entry_p;
+    int             i;
+
+    if ( heap_p->count == COMMON_TOPICS_TOP_K && value <= heap_p->values[0] ) {
+        return;
+    }
+    for ( i = 0; i < heap_p->count; i++ ) {
+        if ( heap_p->hashes[i] == hash ) {
+            heap_p->values[i] = value;
+            heap_p->entries[i].msgs = msgs;
+            heap_p->entries[i].bytes = bytes;
+            common_topicsSiftDown ( heap_p, i );
+            return;
+        }
+    }
+
+    /* A new topic: appended while there is room, else in place of the least. */
+    i = ( heap_p->count < COMMON_TOPICS_TOP_K ) ? heap_p->count++ : 0;
+    heap_p->hashes[i] = hash;
+    heap_p->values[i] = value;
+    entry_p = &heap_p->entries[i];
+    entry_p->hash = hash;
+    entry_p->msgs = msgs;
+    entry_p->bytes = bytes;
+    if ( len >= COMMON_TOPICS_NAME_LEN ) {
+        len = COMMON_TOPICS_NAME_LEN - 1;
+    }
+    memcpy ( entry_p->topic, topic_p, len );
+    entry_p->topic[len] = '\0';
+    if ( i == 0 ) {
+        common_topicsSiftDown ( heap_p, 0 );
+        return;
+    }
+    while ( i > 0 && heap_p->values[( i - 1 ) / 2] > heap_p->values[i] ) {
+        common_topicsSwap ( heap_p, i, ( i - 1 ) / 2 );
+        i = ( i - 1 ) / 2;
+    }
+}
+
+/*****************************************************************************
+ * common_topicsCompareMsgs, common_topicsCompareBytes
+ *
+ * Highest first, for qsort().
+ *****************************************************************************/
+static int
+common_topicsCompareMsgs ( const void *a_p, const void *b_p )
+{
+    const struct commonTopicCount *a = ( const struct commonTopicCount * ) a_p;
+    const struct commonTopicCount *b = ( const struct commonTopicCount * ) b_p;
+
+    return ( a->msgs < b->msgs ) ? 1 : ( a->msgs > b->msgs ) ? -1 : 0;
+}
+
+static int
+common_topicsCompareBytes ( const void *a_p, const void *b_p )
+{
+    const struct commonTopicCount *a = ( const struct commonTopicCount * ) a_p;
+    const struct commonTopicCount *b = ( const struct commonTopicCount * ) b_p;
+
+    return ( a->bytes < b->bytes ) ? 1 : ( a->bytes > b->bytes ) ? -1 : 0;
+}
+
+/*****************************************************************************
+ * common_topicsRotate
+ *
+ * End the interval: keep the heaps as the last report and start from zero.
+ *****************************************************************************/
+static void
+common_topicsRotate ( struct commonTopicsTable *table_p, solClient_uint64_t nowNs )
+{
+    struct commonTopicsReport *last_p = &table_p->last;
+
+    OS_MUTEX_LOCK ( &table_p->lock );
+    last_p->startNs = table_p->startNs;
+    last_p->endNs = nowNs;
+    last_p->totalMsgs = table_p->totalMsgs;
+    last_p->totalBytes = table_p->totalBytes;
+    last_p->numTables = 1;
+    last_p->numByMsgs = table_p->byMsgs.count;
+    last_p->numByBytes = table_p->byBytes.count;
+    memcpy ( last_p->byMsgs, table_p->byMsgs.entries, sizeof ( struct commonTopicCount ) * table_p->byMsgs.count );
+    memcpy ( last_p->byBytes, table_p->byBytes.entries, sizeof ( struct commonTopicCount ) * table_p->byBytes.count );
+    qsort ( last_p->byMsgs, last_p->numByMsgs, sizeof ( struct commonTopicCount ), common_topicsCompareMsgs );
+    qsort ( last_p->byBytes, last_p->numByBytes, sizeof ( struct commonTopicCount ), common_topicsCompareBytes );
+    OS_MUTEX_UNLOCK ( &table_p->lock );
+
+    memset ( table_p->cells, 0, sizeof ( table_p->cells ) );
+    table_p->byMsgs.count = 0;
+    table_p->byBytes.count = 0;
+    table_p->totalMsgs = 0;
+    table_p->totalBytes = 0;
+    table_p->startNs = nowNs;
+}
+
+/*****************************************************************************
+ * common_topicsGetTable
+ *
+ * The calling thread's table, attached on its first message sampled.
+ *****************************************************************************/
+static struct commonTopicsTable *
+common_topicsGetTable ( int direction )
+{
+    struct commonTopicsTable *table_p;
+
+    if ( ( table_p = common_topicsTable_p[direction] ) == NULL &&
+         ( table_p = common_topicsAttach ( direction ) ) == NULL ) {
+        common_topicsRefused++;
+        return NULL;
+    }
+    return table_p;
+}
+
+/*****************************************************************************
+ * common_topicsAdd
+ *
+ * Record a message sampled, weighted by the rate it was sampled at.
+ *****************************************************************************/
+static void
+common_topicsAdd ( struct commonTopicsTable *table_p, const char *topic_p, solClient_uint32_t bytes )
+{
+    struct commonTopicsCell *cell_p;
+    solClient_uint64_t weight = table_p->weight;
+    solClient_uint64_t weightedBytes = weight * bytes;
+    solClient_uint64_t hash = 14695981039346656037ULL;
+    solClient_uint64_t minMsgs = ~( solClient_uint64_t ) 0;
+    solClient_uint64_t minBytes = ~( solClient_uint64_t ) 0;
+    solClient_uint64_t nowNs;
+    solClient_uint64_t slice;
+    const char     *c_p;
+    int             row;
+
+    common_topicsDrawSkip ( table_p );
+    if ( ( ++table_p->records & 63 ) == 0 ) {
+        nowNs = os_getTimeNs (  );
+        if ( nowNs - table_p->startNs >= common_topicsIntervalNs ) {
+            common_topicsRotate ( table_p, nowNs );
+        }
+    }
+
+    /*
+     * FNV-1a over the topic, mixed so that every bit depends on all of
+     * them; each row takes its own slice of the bits, so that two topics
+     * share all their counters only when the hashes agree on all slices.
+     */
+    for ( c_p = topic_p; *c_p != '\0'; c_p++ ) {
+        hash = ( hash ^ ( unsigned char ) *c_p ) * 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    for ( row = 0, slice = hash; row < COMMON_TOPICS_DEPTH; row++, slice >>= COMMON_TOPICS_WIDTH_BITS ) {
+        cell_p = &table_p->cells[row][slice & ( COMMON_TOPICS_WIDTH - 1 )];
+        cell_p->msgs += weight;
+        cell_p->bytes += weightedBytes;
+        if ( cell_p->msgs < minMsgs ) {
+            minMsgs = cell_p->msgs;
+        }
+        if ( cell_p->bytes < minBytes ) {
+            minBytes = cell_p->bytes;
+        }
+    }
+    table_p->totalMsgs += weight;
+    table_p->totalBytes += weightedBytes;
+
+    common_topicsOffer ( &table_p->byMsgs, hash, topic_p, ( solClient_uint32_t ) ( c_p - topic_p ),
+                         minMsgs, minBytes, minMsgs );
+    common_topicsOffer ( &table_p->byBytes, hash, topic_p, ( solClient_uint32_t ) ( c_p - topic_p ),
+                         minMsgs, minBytes, minBytes );
+}
+
+/*****************************************************************************
+ * common_topicsRecordTopic
+ *
+ * A message not sampled costs the countdown alone, written out here and in
+ * common_topicsRecord() rather than called.
+ *****************************************************************************/
+void
+common_topicsRecordTopic ( int direction, const char *topic_p, solClient_uint32_t bytes )
+{
+    struct commonTopicsTable *table_p;
+
+    if ( common_topicsIntervalNs == 0 || topic_p == NULL ) {
+        return;
+    }
+    if ( common_topicsSkip[direction] > 1 ) {
+        common_topicsSkip[direction]--;
+        return;
+    }
+    if ( ( table_p = common_topicsGetTable ( direction ) ) != NULL ) {
+        common_topicsAdd ( table_p, topic_p, bytes );
+    }
+}
+
+/*****************************************************************************
+ * common_topicsRecord
+ *
+ * The message is only read when it is the one sampled.
+ *****************************************************************************/
+void
+common_topicsRecord ( int direction, solClient_opaqueMsg_pt msg_p )
+{
+    struct commonTopicsTable *table_p;
+    solClient_destination_t destination;
+    void           *data_p = NULL;
+    solClient_uint32_t size = 0;
+
+    if ( common_topicsIntervalNs == 0 ) {
+        return;
+    }
+    if ( common_topicsSkip[direction] > 1 ) {
+        common_topicsSkip[direction]--;
+        return;
+    }
+    if ( ( table_p = common_topicsGetTable ( direction ) ) == NULL ) {
+        return;
+    }
+    if ( solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) != SOLCLIENT_OK ) {
+        /* Not a topic: sampled again at the next message. */
+        common_topicsSkip[direction] = 1;
+        return;
+    }
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &data_p, &size ) != SOLCLIENT_OK ) {
+        size = 0;
+    }
+    common_topicsAdd ( table_p, destination.dest, size );
+}
+
+/*****************************************************************************
+ * common_topicsFlush
+ *****************************************************************************/
+void
+common_topicsFlush ( void )
+{
+    solClient_uint64_t nowNs = os_getTimeNs (  );
+    int             direction;
+
+    for ( direction = 0; direction < COMMON_TOPICS_NUM_DIRECTIONS; direction++ ) {
+        if ( common_topicsTable_p[direction] != NULL ) {
+            common_topicsRotate ( common_topicsTable_p[direction], nowNs );
+        }
+    }
+}
+
+/*****************************************************************************
+ * common_topicsMerge
+ *
+ * Add a thread's list to a merged one, summing the topics both hold.
+ *****************************************************************************/
+static int
+common_topicsMerge ( struct commonTopicCount *merged_p, int numMerged, const struct commonTopicCount *list_p, int count )
+{
+    int             i;
+    int             j;
+
+    for ( i = 0; i < count; i++ ) {
+        for ( j = 0; j < numMerged; j++ ) {
+            if ( merged_p[j].hash == list_p[i].hash ) {
+                merged_p[j].msgs += list_p[i].msgs;
+                merged_p[j].bytes += list_p[i].bytes;
+                break;
+            }
+        }
+        if ( j == numMerged ) {
+            merged_p[numMerged++] = list_p[i];
+        }
+    }
+    return numMerged;
+}
+
+/*****************************************************************************
+ * common_topicsGetReport
+ *****************************************************************************/
+solClient_returnCode_t
+common_topicsGetReport ( int direction, struct commonTopicsReport *report_p )
+{
+    struct commonTopicCount *byMsgs_p;
+    struct commonTopicCount *byBytes_p;
+    struct commonTopicsTable *table_p;
+    solClient_uint64_t nowNs = os_getTimeNs (  );
+    solClient_uint64_t staleNs = 2 * common_topicsIntervalNs;
+    int             numByMsgs = 0;
+    int             numByBytes = 0;
+    int             numTables;
+    int             t;
+
+    memset ( report_p, 0, sizeof ( *report_p ) );
+    byMsgs_p = ( struct commonTopicCount * ) malloc ( 2 * sizeof ( struct commonTopicCount ) *
+                                                      COMMON_TOPICS_MAX_TABLES * COMMON_TOPICS_TOP_K );
+    if ( byMsgs_p == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    byBytes_p = byMsgs_p + COMMON_TOPICS_MAX_TABLES * COMMON_TOPICS_TOP_K;
+
+    OS_STATIC_MUTEX_LOCK ( &common_topicsLock );
+    numTables = common_topicsNumTables;
+    OS_STATIC_MUTEX_UNLOCK ( &common_topicsLock );
+    for ( t = 0; t < numTables; t++ ) {
+        table_p = common_topicsTables[t];
+        if ( table_p->direction != direction ) {
+            continue;
+        }
+        OS_MUTEX_LOCK ( &table_p->lock );
+        if ( table_p->last.endNs != 0 && ( staleNs == 0 || nowNs - table_p->last.endNs < staleNs ) ) {
+            if ( report_p->numTables == 0 || table_p->last.startNs < report_p->startNs ) {
+                report_p->startNs = table_p->last.startNs;
+            }
+            if ( table_p->last.endNs > report_p->endNs ) {
+                report_p->endNs = table_p->last.endNs;
+            }
+            report_p->totalMsgs += table_p->last.totalMsgs;
+            report_p->totalBytes += table_p->last.totalBytes;
+            report_p->numTables++;
+            numByMsgs = common_topicsMerge ( byMsgs_p, numByMsgs, table_p->last.byMsgs, table_p->last.numByMsgs );
+            numByBytes = common_topicsMerge ( byBytes_p, numByBytes, table_p->last.byBytes, table_p->last.numByBytes );
+        }
+        OS_MUTEX_UNLOCK ( &table_p->lock );
+    }
+
+    qsort ( byMsgs_p, numByMsgs, sizeof ( struct commonTopicCount ), common_topicsCompareMsgs );
+    qsort ( byBytes_p, numByBytes, sizeof ( struct commonTopicCount ), common_topicsCompareBytes );
+    report_p->numByMsgs = ( numByMsgs < COMMON_TOPICS_TOP_K ) ? numByMsgs : COMMON_TOPICS_TOP_K;
+    report_p->numByBytes = ( numByBytes < COMMON_TOPICS_TOP_K ) ? numByBytes : COMMON_TOPICS_TOP_K;
+    memcpy ( report_p->byMsgs, byMsgs_p, sizeof ( struct commonTopicCount ) * report_p->numByMsgs );
+    memcpy ( report_p->byBytes, byBytes_p, sizeof ( struct commonTopicCount ) * report_p->numByBytes );
+    free ( byMsgs_p );
+
+    return ( report_p->numTables == 0 ) ? SOLCLIENT_NOT_FOUND : SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * common_topicsDump
+ *****************************************************************************/
+void
+common_topicsDump ( int top )
+{
+    static const char *names[COMMON_TOPICS_NUM_DIRECTIONS] = { "rx", "tx" };
+    struct commonTopicsReport report;
+    const struct commonTopicCount *count_p;
+    double          seconds;
+    int             direction;
+    int             i;
+
+    if ( top > COMMON_TOPICS_TOP_K ) {
+        top = COMMON_TOPICS_TOP_K;
+    }
+    for ( direction = 0; direction < COMMON_TOPICS_NUM_DIRECTIONS; direction++ ) {
+        if ( common_topicsGetReport ( direction, &report ) != SOLCLIENT_OK ) {
+            continue;
+        }
+        seconds = ( double ) ( report.endNs - report.startNs ) / 1e9;
+        printf ( "topics %s: %llu msgs, %llu bytes in %.1f s, %d thread(s)\n", names[direction],
+                 ( unsigned long long ) report.totalMsgs, ( unsigned long long ) report.totalBytes, seconds,
+                 report.numTables );
+        if ( report.totalMsgs == 0 ) {
+            continue;
+        }
+        printf ( "  %-40s %12s %8s %10s\n", "by messages", "msgs", "share", "msgs/s" );
+        for ( i = 0; i < report.numByMsgs && i < top; i++ ) {
+            count_p = &report.byMsgs[i];
+            printf ( "  %-40s %12llu %7.2f%% %10.0f\n", count_p->topic, ( unsigned long long ) count_p->msgs,
+                     100.0 * ( double ) count_p->msgs / ( double ) report.totalMsgs,
+                     ( seconds > 0 ) ? ( double ) count_p->msgs / seconds : 0.0 );
+        }
+        if ( report.totalBytes == 0 ) {
+            continue;
+        }
+        printf ( "  %-40s %12s %8s %10s\n", "by bytes", "bytes", "share", "bytes/s" );
+        for ( i = 0; i < report.numByBytes && i < top; i++ ) {
+            count_p = &report.byBytes[i];
+            printf ( "  %-40s %12llu %7.2f%% %10.0f\n", count_p->topic, ( unsigned long long ) count_p->bytes,
+                     100.0 * ( double ) count_p->bytes / ( double ) report.totalBytes,
+                     ( seconds > 0 ) ? ( double ) count_p->bytes / seconds : 0.0 );
+        }
+    }
+    if ( common_topicsRefused != 0 ) {
+        printf ( "topics: %llu records from threads without a table\n", ( unsigned long long ) common_topicsRefused );
+    }
+}
+
+
+/*****************************************************************************
+ * Payload integrity
+ *
+ * CRC32C with the reflected polynomial 0x82f63b78, initial value and final
+ * XOR all ones. The software tables are built on first use; each thread
+ * takes the lock once to see them built.
+ *
+ * Each thread counts in a block of its own, registered on its first count
+ * like the probe threads, so the counts take no lock. They are read
+ * without one, so a total may lag by the messages in flight. A reset
+ * records the totals as a base instead of clearing the blocks under their
+ * owners.
+ *****************************************************************************/
+#define COMMON_INTEGRITY_SEALED     0
+#define COMMON_INTEGRITY_CHECKED    1
+#define COMMON_INTEGRITY_CORRUPT    2
+#define COMMON_INTEGRITY_MISSING    3
+#define COMMON_INTEGRITY_NUM_COUNTS 4
+
+struct commonIntegrityThread
+{
+    solClient_uint64_t counts[COMMON_INTEGRITY_NUM_COUNTS];
+};
+
+static OS_STATIC_MUTEX common_integrityLock = OS_STATIC_MUTEX_INITIALIZER;
+static volatile int common_integrityOn = 0;
+static struct commonIntegrityThread *common_integrityThreads[COMMON_INTEGRITY_MAX_THREADS];
+static int      common_integrityNumThreads = 0;
+static struct commonIntegrityThread common_integrityShared;     /* Threads past the limit, under the lock. */
+static solClient_uint64_t common_integrityBase[COMMON_INTEGRITY_NUM_COUNTS];    /* The totals at the last reset. */
+static solClient_int64_t common_integrityLastCorruptSeq = -1;
+static char     common_integrityLastCorruptTopic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+static OS_THREAD_LOCAL struct commonIntegrityThread *common_integrityThread_p = NULL;
+static OS_THREAD_LOCAL int common_integrityThreadRefused = 0;
+static solClient_uint32_t common_crc32cTable[8][256];
+static int      common_crc32cTableBuilt = 0;
+static OS_THREAD_LOCAL int common_crc32cTableSeen = 0;
+static int      common_crc32cHardware = -1;     /* Not yet known. */
+
+/*****************************************************************************
+ * common_crc32cBuildTable
+ *****************************************************************************/
+static void
+common_crc32cBuildTable ( void )
+{
+    solClient_uint32_t crc;
+    int             i;
+    int             bit;
+    int             slice;
+
+    OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+    if ( !common_crc32cTableBuilt ) {
+        for ( i = 0; i < 256; i++ ) {
+            crc = ( solClient_uint32_t ) i;
+            for ( bit = 0; bit < 8; bit++ ) {
+                crc = ( crc >> 1 ) ^ ( ( crc & 1 ) ? 0x82f63b78U : 0 );
+            }
+            common_crc32cTable[0][i] = crc;
+        }
+        for ( i = 0; i < 256; i++ ) {
+            for ( slice = 1; slice < 8; slice++ ) {
+                crc = common_crc32cTable[slice - 1][i];
+                common_crc32cTable[slice][i] = ( crc >> 8 ) ^ common_crc32cTable[0][crc & 0xff];
+            }
+        }
+        common_crc32cTableBuilt = 1;
+    }
+    OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+    common_crc32cTableSeen = 1;
+}
+
+/*****************************************************************************
+ * common_crc32cSoftware
+ *
+ * Slicing by 8: eight table lookups per eight bytes.
+ *****************************************************************************/
+solClient_uint32_t
+common_crc32cSoftware ( solClient_uint32_t crc, const void *data_p, size_t size )
+{
+    const unsigned char *p = ( const unsigned char * ) data_p;
+    solClient_uint32_t lo;
+    solClient_uint32_t hi;
+
+    if ( !common_crc32cTableSeen ) {
+        common_crc32cBuildTable (  );
+    }
+    crc = ~crc;
+    while ( size >= 8 ) {
+        lo = crc ^ ( ( solClient_uint32_t ) p[0] | ( ( solClient_uint32_t ) p[1] << 8 ) |
+                     ( ( solClient_uint32_t ) p[2] << 16 ) | ( ( solClient_uint32_t ) p[3] << 24 ) );
+        hi = ( solClient_uint32_t ) p[4] | ( ( solClient_uint32_t ) p[5] << 8 ) |
+            ( ( solClient_uint32_t ) p[6] << 16 ) | ( ( solClient_uint32_t ) p[7] << 24 );
+        crc = common_crc32cTable[7][lo & 0xff] ^ common_crc32cTable[6][( lo >> 8 ) & 0xff] ^
+            common_crc32cTable[5][( lo >> 16 ) & 0xff] ^ common_crc32cTable[4][lo >> 24] ^
+            common_crc32cTable[3][hi & 0xff] ^ common_crc32cTable[2][( hi >> 8 ) & 0xff] ^
+            common_crc32cTable[1][( hi >> 16 ) & 0xff] ^ common_crc32cTable[0][hi >> 24];
+        p += 8;
+        size -= 8;
+    }
+    while ( size-- > 0 ) {
+        crc = ( crc >> 8 ) ^ common_crc32cTable[0][( crc ^ *p++ ) & 0xff];
+    }
+    return ~crc;
+}
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+/*****************************************************************************
+ * common_crc32cSse42
+ *
+ * Compiled for SSE4.2 whatever the build's target; only called when the
+ * CPU has it.
+ *****************************************************************************/
+__attribute__ ( ( target ( "sse4.2" ) ) )
+static          solClient_uint32_t
+common_crc32cSse42 ( solClient_uint32_t crc, const void *data_p, size_t size )
+{
+    const unsigned char *p = ( const unsigned char * ) data_p;
+#ifdef __x86_64__
+    const unsigned long long *words_p;
+    size_t          wordSize = 8;
+#else
+    const unsigned int *words_p;
+    size_t          wordSize = 4;
+#endif
+
+    crc = ~crc;
+    while ( size > 0 && ( ( size_t ) p & ( wordSize - 1 ) ) != 0 ) {
+        crc = __builtin_ia32_crc32qi ( crc, *p++ );
+        size--;
+    }
+    /* Aligned from here. */
+    for ( words_p = ( const void * ) p; size >= wordSize; size -= wordSize ) {
+#ifdef __x86_64__
+        crc = ( solClient_uint32_t ) __builtin_ia32_crc32di ( crc, *words_p++ );
+#else
+        crc = __builtin_ia32_crc32si ( crc, *words_p++ );
+#endif
+    }
+    p = ( const unsigned char * ) words_p;
+    while ( size-- > 0 ) {
+        crc = __builtin_ia32_crc32qi ( crc, *p++ );
+    }
+    return ~crc;
+}
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+/*****************************************************************************
+ * common_crc32cArm
+ *****************************************************************************/
+static          solClient_uint32_t
+common_crc32cArm ( solClient_uint32_t crc, const void *data_p, size_t size )
+{
+    const unsigned char *p = ( const unsigned char * ) data_p;
+    const solClient_uint64_t *words_p;
+
+    crc = ~crc;
+    while ( size > 0 && ( ( size_t ) p & 7 ) != 0 ) {
+        crc = __crc32cb ( crc, *p++ );
+        size--;
+    }
+    /* Aligned from here. */
+    for ( words_p = ( const void * ) p; size >= 8; size -= 8 ) {
+        crc = __crc32cd ( crc, *words_p++ );
+    }
+    p = ( const unsigned char * ) words_p;
+    while ( size-- > 0 ) {
+        crc = __crc32cb ( crc, *p++ );
+    }
+    return ~crc;
+}
+#endif
+
+/*****************************************************************************
+ * common_crc32cImplementation
+ *****************************************************************************/
+const char     *
+common_crc32cImplementation ( void )
+{
+    if ( common_crc32cHardware < 0 ) {
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+        common_crc32cHardware = __builtin_cpu_supports ( "sse4.2" ) ? 1 : 0;
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+        common_crc32cHardware = 1;
+#else
+        common_crc32cHardware = 0;
+#endif
+    }
+    if ( !common_crc32cHardware ) {
+        return "software";
+    }
+#if defined(__aarch64__)
+    return "armv8-crc";
+#else
+    return "sse4.2";
+#endif
+}
+
+/*****************************************************************************
+ * common_crc32c
+ *****************************************************************************/
+solClient_uint32_t
+common_crc32c ( solClient_uint32_t crc, const void *data_p, size_t size )
+{
+    if ( common_crc32cHardware < 0 ) {
+        common_crc32cImplementation (  );
+    }
+    if ( common_crc32cHardware ) {
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+        return common_crc32cSse42 ( crc, data_p, size );
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+        return common_crc32cArm ( crc, data_p, size );
+#endif
+    }
+    return common_crc32cSoftware ( crc, data_p, size );
+}
+
+/*****************************************************************************
+ * common_integrityAttachThread
+ *****************************************************************************/
+static struct commonIntegrityThread *
+common_integrityAttachThread ( void )
+{
+    struct commonIntegrityThread *thread_p;
+
+    if ( common_integrityThreadRefused ||
+         ( thread_p = ( struct commonIntegrityThread * ) calloc ( 1, sizeof ( struct commonIntegrityThread ) ) ) == NULL ) {
+        common_integrityThreadRefused = 1;
+        return NULL;
+    }
+    OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+    if ( common_integrityNumThreads == COMMON_INTEGRITY_MAX_THREADS ) {
+        OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+        free ( thread_p );
+        common_integrityThreadRefused = 1;
+        return NULL;
+    }
+    common_integrityThreads[common_integrityNumThreads++] = thread_p;
+    OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+
+    common_integrityThread_p = thread_p;
+    return thread_p;
+}
+
+/*****************************************************************************
+ * common_integrityCount
+ *****************************************************************************/
+static void
+common_integrityCount ( int counter )
+{
+    struct commonIntegrityThread *thread_p = common_integrityThread_p;
+
+    if ( thread_p == NULL && ( thread_p = common_integrityAttachThread (  ) ) == NULL ) {
+        OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+        common_integrityShared.counts[counter]++;
+        OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+        return;
+    }
+    thread_p->counts[counter]++;
+}
+
+/*****************************************************************************
+ * common_integrityTotals
+ *
+ * Called with the lock held.
+ *****************************************************************************/
+static void
+common_integrityTotals ( solClient_uint64_t * totals_p )
+{
+    int             counter;
+    int             t;
+
+    for ( counter = 0; counter < COMMON_INTEGRITY_NUM_COUNTS; counter++ ) {
+        totals_p[counter] = common_integrityShared.counts[counter];
+        for ( t = 0; t < common_integrityNumThreads; t++ ) {
+            totals_p[counter] += common_integrityThreads[t]->counts[counter];
+        }
+    }
+}
+
+/*****************************************************************************
+ * common_integrityEnable
+ *****************************************************************************/
+void
+common_integrityEnable ( int enable )
+{
+    common_integrityOn = enable;
+}
+
+/*****************************************************************************
+ * common_integrityEnabled
+ *****************************************************************************/
+int
+common_integrityEnabled ( void )
+{
+    return common_integrityOn;
+}
+
+/*****************************************************************************
+ * common_integritySetPayload
+ *****************************************************************************/
+solClient_returnCode_t
+common_integritySetPayload ( solClient_opaqueMsg_pt msg_p, void *buf_p, solClient_uint32_t size )
+{
+    solClient_returnCode_t rc;
+    unsigned char  *trailer_p = ( unsigned char * ) buf_p + size;
+    solClient_uint32_t crc;
+
+    if ( !common_integrityOn ) {
+        return solClient_msg_setBinaryAttachment ( msg_p, buf_p, size );
+    }
+    crc = common_crc32c ( 0, buf_p, size );
+    trailer_p[0] = ( unsigned char ) crc;
+    trailer_p[1] = ( unsigned char ) ( crc >> 8 );
+    trailer_p[2] = ( unsigned char ) ( crc >> 16 );
+    trailer_p[3] = ( unsigned char ) ( crc >> 24 );
+    if ( ( rc = solClient_msg_setBinaryAttachment ( msg_p, buf_p, size + COMMON_INTEGRITY_TRAILER_LEN ) ) == SOLCLIENT_OK ) {
+        common_integrityCount ( COMMON_INTEGRITY_SEALED );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * common_integrityCheck
+ *****************************************************************************/
+solClient_returnCode_t
+common_integrityCheck ( solClient_opaqueMsg_pt msg_p, void **data_p, solClient_uint32_t * size_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_destination_t destination;
+    solClient_int64_t seq;
+    void           *ptr_p = NULL;
+    const unsigned char *trailer_p;
+    solClient_uint32_t size = 0;
+    solClient_uint32_t crc;
+
+    if ( !common_integrityOn && data_p == NULL && size_p == NULL ) {
+        return SOLCLIENT_OK;
+    }
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &ptr_p, &size ) != SOLCLIENT_OK ) {
+        ptr_p = NULL;
+        size = 0;
+    }
+    if ( !common_integrityOn ) {
+        goto done;
+    }
+    if ( size < COMMON_INTEGRITY_TRAILER_LEN ) {
+        common_integrityCount ( COMMON_INTEGRITY_MISSING );
+        rc = SOLCLIENT_NOT_FOUND;
+        goto done;
+    }
+    size -= COMMON_INTEGRITY_TRAILER_LEN;
+    trailer_p = ( const unsigned char * ) ptr_p + size;
+    crc = common_crc32c ( 0, ptr_p, size );
+    if ( crc == ( ( solClient_uint32_t ) trailer_p[0] | ( ( solClient_uint32_t ) trailer_p[1] << 8 ) |
+                  ( ( solClient_uint32_t ) trailer_p[2] << 16 ) | ( ( solClient_uint32_t ) trailer_p[3] << 24 ) ) ) {
+        common_integrityCount ( COMMON_INTEGRITY_CHECKED );
+        goto done;
+    }
+
+    if ( solClient_msg_getSequenceNumber ( msg_p, &seq ) != SOLCLIENT_OK ) {
+        seq = -1;
+    }
+    if ( solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) != SOLCLIENT_OK ) {
+        destination.dest = "";
+    }
+    common_integrityCount ( COMMON_INTEGRITY_CORRUPT );
+    OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+    common_integrityLastCorruptSeq = seq;
+    strncpy ( common_integrityLastCorruptTopic, destination.dest, SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE );
+    common_integrityLastCorruptTopic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE] = '\0';
+    OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+    solClient_log ( SOLCLIENT_LOG_WARNING, "common_integrityCheck(): corrupt payload of %u bytes, sequence number %lld, topic '%s'",
+                    size, ( long long ) seq, destination.dest );
+    rc = SOLCLIENT_FAIL;
+
+  done:
+    if ( data_p != NULL ) {
+        *data_p = ptr_p;
+    }
+    if ( size_p != NULL ) {
+        *size_p = size;
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * common_integrityGetStats
+ *****************************************************************************/
+void
+common_integrityGetStats ( struct commonIntegrityStats *stats_p )
+{
+    solClient_uint64_t totals[COMMON_INTEGRITY_NUM_COUNTS];
+
+    OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+    common_integrityTotals ( totals );
+    stats_p->sealed = totals[COMMON_INTEGRITY_SEALED] - common_integrityBase[COMMON_INTEGRITY_SEALED];
+    stats_p->checked = totals[COMMON_INTEGRITY_CHECKED] - common_integrityBase[COMMON_INTEGRITY_CHECKED];
+    stats_p->corrupt = totals[COMMON_INTEGRITY_CORRUPT] - common_integrityBase[COMMON_INTEGRITY_CORRUPT];
+    stats_p->missing = totals[COMMON_INTEGRITY_MISSING] - common_integrityBase[COMMON_INTEGRITY_MISSING];
+    stats_p->lastCorruptSeq = common_integrityLastCorruptSeq;
+    memcpy ( stats_p->lastCorruptTopic, common_integrityLastCorruptTopic, sizeof ( stats_p->lastCorruptTopic ) );
+    OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+}
+
+/*****************************************************************************
+ * common_integrityResetStats
+ *****************************************************************************/
+void
+common_integrityResetStats ( void )
+{
+    OS_STATIC_MUTEX_LOCK ( &common_integrityLock );
+    common_integrityTotals ( common_integrityBase );
+    common_integrityLastCorruptSeq = -1;
+    common_integrityLastCorruptTopic[0] = '\0';
+    OS_STATIC_MUTEX_UNLOCK ( &common_integrityLock );
+}
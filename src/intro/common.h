@@ -84,6 +84,7 @@ enum flowMode
 #define USE_GSS_MASK           0x0400      /**< Enable Kerberos option. */
 #define ZIP_LEVEL_MASK         0x0800      /**< Zip Compression Level option. */
 #define REPLAY_START_MASK      0x1000      /**< Replay Start Location option. */
+#define PERF_COUNTERS_MASK     0x2000      /**< Performance Counters option. */
 
 /*@}*/
 
@@ -110,6 +111,7 @@ enum flowMode
 #define USE_GSS_STRING           "\t-g, --gss           Use GSS (Kerberos) authentication. When specified the '--cu' option is ignored.\n"
 #define ZIP_LEVEL_STRING         "\t-z, --zip           Enable compression (set compress level=9 for SolOS-TR appliances only).\n"
 #define REPLAY_START_STRING      "\t-R, --replay=replay Replay Start Location String (BEGINNING or RFC3339 time stamp).\n"
+#define PERF_COUNTERS_STRING     "\t-P, --perf          Report hardware performance counters per message (Linux only).\n"
 
 /*@}*/
 
@@ -138,6 +140,7 @@ struct commonOptions
     int             usingDurable;
     int             enableCompression;
     int             useGSS;
+    int             perfCounters;
 };
 
 
@@ -210,6 +213,21 @@ solClient_returnCode_t
                                  solClient_session_eventCallbackFunc_t eventCallback_p,
                                  void *user_p, struct commonOptions *commonOpts );
 
+/**
+ * As common_createAndConnectSession(), with more Session properties.
+ * @param extraProps_p NULL-terminated name and value pairs, set after the
+ * sample's own and so overriding them, or NULL for none.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL, also when the extra properties
+ * do not all fit; none are dropped.
+ */
+solClient_returnCode_t
+    common_createAndConnectSessionExt ( solClient_opaqueContext_pt context_p,
+                                        solClient_opaqueSession_pt * session_p,
+                                        solClient_session_rxMsgCallbackFunc_t msgCallback_p,
+                                        solClient_session_eventCallbackFunc_t eventCallback_p,
+                                        void *user_p, struct commonOptions *commonOpts,
+                                        const char *const *extraProps_p );
+
 
 /*****************************************************************************
  * common_createQueue
@@ -417,4 +435,612 @@ solClient_rxMsgCallback_returnCode_t
 solClient_rxMsgCallback_returnCode_t
     common_messageReceivePerfCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p );
 
+
+/**
+ * @struct common_solClientApi
+ * The Context, Session and Flow calls that common.c and connmgr.c make on
+ * the application's behalf, and that an application may make itself through
+ * common_getSolClientApi(). By default they are libsolclient's own; an
+ * offline driver such as solClientMock.c installs a table of its own with
+ * common_setSolClientApi(), so the samples' callbacks run against it
+ * unchanged without anything replacing the library's symbols.
+ */
+struct common_solClientApi
+{
+    solClient_returnCode_t ( *context_create ) ( solClient_propertyArray_pt props,
+                                                 solClient_opaqueContext_pt * opaqueContext_p,
+                                                 solClient_context_createFuncInfo_t * funcInfo_p, size_t funcInfoSize );
+    solClient_returnCode_t ( *context_destroy ) ( solClient_opaqueContext_pt * opaqueContext_p );
+    solClient_returnCode_t ( *context_startTimer ) ( solClient_opaqueContext_pt opaqueContext_p,
+                                                     solClient_context_timerMode_t timerMode,
+                                                     solClient_uint32_t durationMs,
+                                                     solClient_context_timerCallbackFunc_t callback_p, void *user_p,
+                                                     solClient_context_timerId_t * timerId_p );
+    solClient_returnCode_t ( *context_stopTimer ) ( solClient_opaqueContext_pt opaqueContext_p,
+                                                    solClient_context_timerId_t * timerId_p );
+    solClient_returnCode_t ( *session_create ) ( solClient_propertyArray_pt props,
+                                                 solClient_opaqueContext_pt opaqueContext_p,
+                                                 solClient_opaqueSession_pt * opaqueSession_p,
+                                                 solClient_session_createFuncInfo_t * funcInfo_p, size_t funcInfoSize );
+    solClient_returnCode_t ( *session_destroy ) ( solClient_opaqueSession_pt * opaqueSession_p );
+    solClient_returnCode_t ( *session_getContext ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                     solClient_opaqueContext_pt * opaqueContext_p );
+    solClient_returnCode_t ( *session_connect ) ( solClient_opaqueSession_pt opaqueSession_p );
+    solClient_returnCode_t ( *session_disconnect ) ( solClient_opaqueSession_pt opaqueSession_p );
+    solClient_bool_t ( *session_isCapable ) ( solClient_opaqueSession_pt opaqueSession_p, const char *capabilityName_p );
+    solClient_returnCode_t ( *session_sendMsg ) ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p );
+    solClient_returnCode_t ( *session_sendMultipleMsg ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                          solClient_opaqueMsg_pt * msgArray_p,
+                                                          solClient_uint32_t numberOfMessages,
+                                                          solClient_uint32_t * numberOfMessagesWritten );
+    solClient_returnCode_t ( *session_sendRequest ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                      solClient_opaqueMsg_pt msg_p,
+                                                      solClient_opaqueMsg_pt * replyMsg_p, solClient_uint32_t timeout );
+    solClient_returnCode_t ( *session_sendReply ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                    solClient_opaqueMsg_pt rxmsg_p, solClient_opaqueMsg_pt replyMsg_p );
+    solClient_returnCode_t ( *session_topicSubscribeExt ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                            solClient_subscribeFlags_t flags,
+                                                            const char *topicSubscription_p );
+    solClient_returnCode_t ( *session_topicUnsubscribeExt ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                              solClient_subscribeFlags_t flags,
+                                                              const char *topicSubscription_p );
+    solClient_returnCode_t ( *session_endpointProvision ) ( solClient_propertyArray_pt props,
+                                                            solClient_opaqueSession_pt opaqueSession_p,
+                                                            solClient_uint32_t provisionFlags,
+                                                            void *correlationTag, char *queueNetworkName, size_t qnnSize );
+    solClient_returnCode_t ( *session_endpointDeprovision ) ( solClient_propertyArray_pt props,
+                                                              solClient_opaqueSession_pt opaqueSession_p,
+                                                              solClient_uint32_t provisionFlags, void *correlationTag );
+    solClient_returnCode_t ( *session_createFlow ) ( solClient_propertyArray_pt props,
+                                                     solClient_opaqueSession_pt opaqueSession_p,
+                                                     solClient_opaqueFlow_pt * opaqueFlow_p,
+                                                     solClient_flow_createFuncInfo_t * funcInfo_p, size_t funcInfoSize );
+    solClient_returnCode_t ( *flow_destroy ) ( solClient_opaqueFlow_pt * opaqueFlow_p );
+    solClient_returnCode_t ( *flow_getSession ) ( solClient_opaqueFlow_pt opaqueFlow_p,
+                                                  solClient_opaqueSession_pt * opaqueSession_p );
+    solClient_returnCode_t ( *flow_sendAck ) ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_msgId_t msgId );
+    solClient_returnCode_t ( *msg_getMsgId ) ( solClient_opaqueMsg_pt msg_p, solClient_msgId_t * msgId_p );
+};
+
+/**
+ * Route the calls of ::common_solClientApi to another implementation.
+ * Install it before creating any Context and keep it until every Context
+ * is destroyed.
+ * @param api_p The table, which must outlive its use; NULL restores libsolclient.
+ */
+void
+    common_setSolClientApi ( const struct common_solClientApi *api_p );
+
+/**
+ * The installed ::common_solClientApi.
+ * @return libsolclient's table unless common_setSolClientApi() replaced it.
+ */
+const struct common_solClientApi *
+    common_getSolClientApi ( void );
+
+
+/**
+ * @anchor random
+ * @name Random numbers
+ * A xorshift64 generator (Marsaglia) for the samples' simulations, jitter
+ * and test data: fast and repeatable, not for cryptography. Each user
+ * keeps its own state, so no lock is taken; seed it with
+ * ::COMMON_RANDOM_SEED for the same sequence every run, or with
+ * common_randomSeed() for a different one.
+ */
+
+/*@{*/
+
+#define COMMON_RANDOM_SEED         88172645463325252ULL    /**< A seed for a repeatable sequence. */
+
+/*@}*/
+
+/**
+ * The next number of a generator.
+ * @param state_p The generator's state, never 0; updated.
+ * @return A uniformly distributed 64-bit number.
+ */
+solClient_uint64_t
+    common_random ( solClient_uint64_t *state_p );
+
+/**
+ * A seed that differs from run to run, from the clock.
+ * @param salt A value of the caller's own, such as its address, so that
+ * generators seeded at the same time differ.
+ * @return A seed, never 0.
+ */
+solClient_uint64_t
+    common_randomSeed ( solClient_uint64_t salt );
+
+/**
+ * @anchor trafficclasses
+ * @name Traffic classes
+ * A router that publishes each message on the Session of its traffic
+ * class, each Session with its own Context thread, socket and buffer
+ * sizes and CPU pinning, so that a burst of large bulk messages queued in
+ * one TCP connection does not hold back small urgent ones in another.
+ *
+ * A message goes to the first class, from ::COMMON_CLASS_URGENT down,
+ * whose minPriority its priority (solClient_msg_setPriority()) reaches;
+ * without a priority, to the class of the longest topic prefix given to
+ * common_classAddRoute(); else to ::COMMON_CLASS_NORMAL. With isolation
+ * off all classes share one Session, for comparison.
+ *
+ * common_classSend() may be called from any thread once the router is
+ * created; the per-class counters are exact when one thread publishes.
+ */
+
+/*@{*/
+
+#define COMMON_CLASS_URGENT        0
+#define COMMON_CLASS_NORMAL        1
+#define COMMON_CLASS_BULK          2
+#define COMMON_NUM_CLASSES         3
+#define COMMON_CLASS_MAX_ROUTES    64
+
+/*@}*/
+
+/**
+ * @struct commonClassConfig
+ * How to set up the Session of a class; NULL strings leave the default.
+ */
+struct commonClassConfig
+{
+    const char     *sendBufSize_p;      /**< ::SOLCLIENT_SESSION_PROP_SOCKET_SEND_BUF_SIZE */
+    const char     *rcvBufSize_p;       /**< ::SOLCLIENT_SESSION_PROP_SOCKET_RCV_BUF_SIZE */
+    const char     *bufferSize_p;       /**< ::SOLCLIENT_SESSION_PROP_BUFFER_SIZE */
+    const char     *cpuList_p;          /**< ::SOLCLIENT_CONTEXT_PROP_THREAD_AFFINITY_CPU_LIST */
+    solClient_int32_t minPriority;      /**< Least message priority for the class, -1 for none. */
+};
+
+/**
+ * @struct commonClassRoute
+ */
+struct commonClassRoute
+{
+    char            prefix[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+    size_t          length;
+    int             trafficClass;
+};
+
+/**
+ * @struct commonClassRouter
+ */
+struct commonClassRouter
+{
+    solClient_opaqueContext_pt contexts[COMMON_NUM_CLASSES];
+    solClient_opaqueSession_pt sessions[COMMON_NUM_CLASSES];
+    int             numSessions;        /**< COMMON_NUM_CLASSES, or 1 when shared. */
+    struct commonClassConfig configs[COMMON_NUM_CLASSES];
+    struct commonClassRoute routes[COMMON_CLASS_MAX_ROUTES];
+    int             numRoutes;
+    solClient_uint64_t sent[COMMON_NUM_CLASSES];
+    solClient_uint64_t failed[COMMON_NUM_CLASSES];
+};
+
+/**
+ * Create and connect the Sessions of a router, each on its own Context.
+ * @param router_p The router to create.
+ * @param commonOpts A pointer to the sample's commonOptions struct.
+ * @param configs_p ::COMMON_NUM_CLASSES configurations, or NULL for the
+ * defaults: priorities from 200 urgent, from 100 normal, else bulk.
+ * @param isolate 0 to share one Session, with the ::COMMON_CLASS_NORMAL
+ * configuration, between all classes.
+ * @param msgCallback_p The message callback of each Session.
+ * @param eventCallback_p The event callback of each Session.
+ * @param user_p Passed to both.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    common_classRouterCreate ( struct commonClassRouter *router_p, struct commonOptions *commonOpts,
+                               const struct commonClassConfig *configs_p, int isolate,
+                               solClient_session_rxMsgCallbackFunc_t msgCallback_p,
+                               solClient_session_eventCallbackFunc_t eventCallback_p, void *user_p );
+
+/**
+ * Route a topic prefix to a class; call before publishing.
+ * @param router_p The router.
+ * @param prefix_p The topic prefix, e.g. "market/snapshot/".
+ * @param trafficClass ::COMMON_CLASS_URGENT, ::COMMON_CLASS_NORMAL or ::COMMON_CLASS_BULK.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when full or invalid.
+ */
+solClient_returnCode_t
+    common_classAddRoute ( struct commonClassRouter *router_p, const char *prefix_p, int trafficClass );
+
+/**
+ * The class of a message.
+ */
+int
+    common_classOf ( struct commonClassRouter *router_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Publish a message, with its destination set, on the Session of its class.
+ * @return As solClient_session_sendMsg().
+ */
+solClient_returnCode_t
+    common_classSend ( struct commonClassRouter *router_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * The Session of a class, to subscribe on or to send other than messages.
+ */
+solClient_opaqueSession_pt
+    common_classSession ( struct commonClassRouter *router_p, int trafficClass );
+
+/**
+ * Disconnect and destroy the Sessions and Contexts of a router.
+ */
+void
+    common_classRouterDestroy ( struct commonClassRouter *router_p );
+
+
+/**
+ * @anchor histograms
+ * @name Histograms
+ * A log2-bucketed histogram of non-negative values, typically durations,
+ * with their count, sum and maximum: adding a value costs a few shifts, in
+ * fixed memory, and a percentile is read to within a factor of two. It
+ * takes no lock; the owner records from one thread or serializes.
+ */
+
+/*@{*/
+
+#define COMMON_HISTOGRAM_BUCKETS   64      /**< Bucket i counts values in [2^(i-1), 2^i); bucket 0 counts 0. */
+
+/*@}*/
+
+/**
+ * @struct commonHistogram
+ */
+struct commonHistogram
+{
+    solClient_uint64_t count;
+    solClient_uint64_t sum;
+    solClient_uint64_t max;
+    solClient_uint64_t buckets[COMMON_HISTOGRAM_BUCKETS];
+};
+
+/**
+ * Count one value.
+ * @param hist_p The histogram, zeroed to start.
+ * @param value The value.
+ */
+void
+    common_histogramAdd ( struct commonHistogram *hist_p, solClient_uint64_t value );
+
+/**
+ * Add the values of one histogram to another.
+ * @param total_p The histogram added to.
+ * @param hist_p The histogram added.
+ */
+void
+    common_histogramMerge ( struct commonHistogram *total_p, const struct commonHistogram *hist_p );
+
+/**
+ * @param hist_p The histogram.
+ * @param percentile From 0 to 100.
+ * @return The upper bound of the bucket holding the percentile, at most the
+ * maximum; 0 when empty.
+ */
+solClient_uint64_t
+    common_histogramPercentile ( const struct commonHistogram *hist_p, double percentile );
+
+/**
+ * @param hist_p The histogram.
+ * @return The mean of the values, 0 when empty.
+ */
+double
+    common_histogramMean ( const struct commonHistogram *hist_p );
+
+/**
+ * @anchor probes
+ * @name Hot-path probes
+ * Scoped timers for code on the message path, compiled in only when the
+ * samples are built with COMMON_PROBES defined (for example
+ * COMPILEFLAG=-DCOMMON_PROBES in the environment of make); otherwise every
+ * macro expands to nothing.
+ *
+ * A probe site is a COMMON_PROBE_BEGIN()/COMMON_PROBE_END() pair in one
+ * function. The pair measures the ticks in between (rdtsc on x86, else the
+ * monotonic clock) and records them in a @ref histograms "histogram" that
+ * belongs to the calling thread, so recording takes no lock.
+ * COMMON_PROBE_END() must be reached on every path out of the scope.
+ * COMMON_PROBE_DUMP() prints a snapshot merged over all threads.
+ */
+
+/*@{*/
+
+#define COMMON_PROBE_MAX_SITES     32      /**< Probe sites per process. */
+#define COMMON_PROBE_MAX_THREADS   64      /**< Threads that may record. */
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define COMMON_PROBE_TICKS()       ( ( solClient_uint64_t ) __builtin_ia32_rdtsc (  ) )
+#else
+#define COMMON_PROBE_TICKS()       ( ( solClient_uint64_t ) os_getTimeNs (  ) )
+#endif
+
+#ifdef COMMON_PROBES
+
+#define COMMON_PROBE_BEGIN(var, name) \
+    static int var##_site = -1; \
+    solClient_uint64_t var##_start = ( ( var##_site < 0 ) ? ( var##_site = common_probeRegister ( name ) ) : 0, COMMON_PROBE_TICKS (  ) )
+#define COMMON_PROBE_END(var)      common_probeRecord ( var##_site, COMMON_PROBE_TICKS (  ) - var##_start )
+#define COMMON_PROBE_DUMP()        common_probeDump (  )
+
+#else
+
+#define COMMON_PROBE_BEGIN(var, name)  do { } while ( 0 )
+#define COMMON_PROBE_END(var)      do { } while ( 0 )
+#define COMMON_PROBE_DUMP()        do { } while ( 0 )
+
+#endif
+
+/*@}*/
+
+/**
+ * Register a probe site, once per site; used by COMMON_PROBE_BEGIN().
+ * @param name_p The site name; it must outlive the process.
+ * @return The site index, or -1 if all sites are in use.
+ */
+int
+    common_probeRegister ( const char *name_p );
+
+/**
+ * Record one duration for the calling thread; used by COMMON_PROBE_END().
+ * @param site The index from common_probeRegister().
+ * @param ticks The duration in ticks.
+ */
+void
+    common_probeRecord ( int site, solClient_uint64_t ticks );
+
+/**
+ * Print each probe site's count, mean, percentiles and maximum in
+ * nanoseconds, merged over all threads, to STDOUT. Counters are read while
+ * other threads may be recording, so a snapshot can be off by the records
+ * in flight.
+ */
+void
+    common_probeDump ( void );
+
+/**
+ * @anchor topics
+ * @name Heavy-hitter topics
+ * Per-topic traffic accounting on the receive and publish paths, in fixed
+ * memory whatever the number of topics. Off until common_topicsEnable();
+ * then common_publishMessage(), common_classSend() and the common receive
+ * callbacks record each message, and an application records its own with
+ * common_topicsRecord().
+ *
+ * Each thread that records gets a table per direction on first use, so
+ * recording takes no lock: a count-min sketch of ::COMMON_TOPICS_DEPTH
+ * rows of ::COMMON_TOPICS_WIDTH counters of messages and bytes, and two
+ * min-heaps of the ::COMMON_TOPICS_TOP_K topics with the highest
+ * estimates, by messages and by bytes. A topic's estimate is the least of
+ * its counters, never under the truth and over it by at most
+ * e / ::COMMON_TOPICS_WIDTH of the interval's total with probability
+ * 1 - e^-::COMMON_TOPICS_DEPTH. The bytes are those of the binary
+ * attachment.
+ *
+ * To keep the cost per message to a few nanoseconds, only one message in
+ * common_topicsSetSampling() (default ::COMMON_TOPICS_SAMPLE_DEFAULT), at
+ * random gaps averaging that, is read, hashed and counted, its messages
+ * and bytes weighted by the rate; the others cost a countdown. A topic's estimate then also varies by about the square
+ * root of rate times its count, which matters only for the light topics;
+ * with a rate of 1 every message is counted as it is.
+ *
+ * Every interval the recording thread keeps its heaps as the last report
+ * and starts again from zero; it looks at the clock every 64 sampled
+ * messages, so a thread with no traffic keeps its last report. common_topicsDump(), the
+ * stats output, prints the last reports of every thread merged; reports
+ * older than two intervals are left out.
+ */
+
+/*@{*/
+
+#define COMMON_TOPICS_RX           0
+#define COMMON_TOPICS_TX           1
+#define COMMON_TOPICS_NUM_DIRECTIONS 2
+#define COMMON_TOPICS_WIDTH_BITS   11
+#define COMMON_TOPICS_WIDTH        ( 1 << COMMON_TOPICS_WIDTH_BITS )   /**< Counters per sketch row. */
+#define COMMON_TOPICS_DEPTH        4       /**< Sketch rows; DEPTH * WIDTH_BITS at most 64. */
+#define COMMON_TOPICS_TOP_K        16      /**< Topics kept by messages, and by bytes. */
+#define COMMON_TOPICS_NAME_LEN     96      /**< Longer topics are kept truncated. */
+#define COMMON_TOPICS_MAX_TABLES   16      /**< Tables per process: threads times directions. */
+#define COMMON_TOPICS_SAMPLE_DEFAULT 64    /**< Messages per message counted, on average. */
+
+/*@}*/
+
+/**
+ * @struct commonTopicCount
+ */
+struct commonTopicCount
+{
+    char            topic[COMMON_TOPICS_NAME_LEN];
+    solClient_uint64_t hash;
+    solClient_uint64_t msgs;            /**< Estimates: upper bounds. */
+    solClient_uint64_t bytes;
+};
+
+/**
+ * @struct commonTopicsReport
+ * The heaviest topics of an interval, highest first.
+ */
+struct commonTopicsReport
+{
+    solClient_uint64_t startNs;
+    solClient_uint64_t endNs;
+    solClient_uint64_t totalMsgs;       /**< Estimates when sampling. */
+    solClient_uint64_t totalBytes;
+    int             numTables;          /**< Threads merged. */
+    int             numByMsgs;
+    int             numByBytes;
+    struct commonTopicCount byMsgs[COMMON_TOPICS_TOP_K];
+    struct commonTopicCount byBytes[COMMON_TOPICS_TOP_K];
+};
+
+/**
+ * Start accounting, or change the interval.
+ * @param intervalMs The reporting interval, 0 to stop recording.
+ */
+void
+    common_topicsEnable ( int intervalMs );
+
+/**
+ * Set how many messages, on average, go to each one counted. Any thread;
+ * a thread's tables follow from their next message counted.
+ * @param oneIn The sampling rate, 1 to count every message.
+ */
+void
+    common_topicsSetSampling ( int oneIn );
+
+/**
+ * Record a message sent or received, by its destination.
+ * @param direction ::COMMON_TOPICS_RX or ::COMMON_TOPICS_TX.
+ * @param msg_p The message.
+ */
+void
+    common_topicsRecord ( int direction, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Record a message by its topic and size.
+ * @param direction ::COMMON_TOPICS_RX or ::COMMON_TOPICS_TX.
+ * @param topic_p The topic.
+ * @param bytes The payload size.
+ */
+void
+    common_topicsRecordTopic ( int direction, const char *topic_p, solClient_uint32_t bytes );
+
+/**
+ * End the calling thread's intervals now, for a thread that records in
+ * bursts or is about to exit.
+ */
+void
+    common_topicsFlush ( void );
+
+/**
+ * The last interval's report, merged over all threads. Any thread.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_NOT_FOUND when nothing was recorded
+ * in the last two intervals.
+ */
+solClient_returnCode_t
+    common_topicsGetReport ( int direction, struct commonTopicsReport *report_p );
+
+/**
+ * Print the last interval's report of each direction to STDOUT.
+ * @param top Topics printed by messages and by bytes, at most ::COMMON_TOPICS_TOP_K.
+ */
+void
+    common_topicsDump ( int top );
+
+/**
+ * @anchor integrity
+ * @name Payload integrity
+ * End-to-end checks that payloads arrive intact. Off until
+ * common_integrityEnable(); then common_publishMessage() appends to the
+ * binary attachment a ::COMMON_INTEGRITY_TRAILER_LEN byte trailer, the
+ * CRC32C (Castagnoli) of the payload before it, least significant byte
+ * first, and the common receive callbacks verify it. An application seals
+ * its own messages with common_integritySetPayload() and checks them with
+ * common_integrityCheck().
+ *
+ * The CRC is computed with the SSE4.2 crc32 instruction where the CPU has
+ * it (gcc or clang on x86), with the ARMv8 CRC32 instructions when built
+ * for them (__ARM_FEATURE_CRC32), and otherwise in software, eight bytes
+ * at a time from tables. Each corrupt message is logged at WARNING with
+ * its sequence number and topic, the last one kept in the counters. Each
+ * thread counts in a block of its own, so sealing and checking take no
+ * lock; common_integrityGetStats() adds the blocks up.
+ */
+
+/*@{*/
+
+#define COMMON_INTEGRITY_TRAILER_LEN 4
+#define COMMON_INTEGRITY_MAX_THREADS 64    /**< Threads counted on their own; the rest share a locked block. */
+
+/*@}*/
+
+/**
+ * @struct commonIntegrityStats
+ */
+struct commonIntegrityStats
+{
+    solClient_uint64_t sealed;          /**< Payloads given a trailer. */
+    solClient_uint64_t checked;         /**< Payloads verified intact. */
+    solClient_uint64_t corrupt;         /**< Payloads that did not match their trailer. */
+    solClient_uint64_t missing;         /**< Messages with no room for a trailer. */
+    solClient_int64_t lastCorruptSeq;   /**< Sequence number of the last corrupt message, -1 if none. */
+    char            lastCorruptTopic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+};
+
+/**
+ * Turn the integrity mode on or off.
+ * @param enable 1 to seal and verify payloads.
+ */
+void
+    common_integrityEnable ( int enable );
+
+/**
+ * @return 1 when the integrity mode is on.
+ */
+int
+    common_integrityEnabled ( void );
+
+/**
+ * Extend a CRC32C over more data; start from 0.
+ * @param crc The CRC so far.
+ * @param data_p The data.
+ * @param size Its size.
+ * @return The CRC including the data.
+ */
+solClient_uint32_t
+    common_crc32c ( solClient_uint32_t crc, const void *data_p, size_t size );
+
+/**
+ * common_crc32c() in software whatever the CPU.
+ */
+solClient_uint32_t
+    common_crc32cSoftware ( solClient_uint32_t crc, const void *data_p, size_t size );
+
+/**
+ * @return The instructions common_crc32c() uses: "sse4.2", "armv8-crc" or "software".
+ */
+const char     *
+    common_crc32cImplementation ( void );
+
+/**
+ * Set a message's binary attachment, with the trailer when the integrity
+ * mode is on. The trailer is written into the caller's buffer, after the
+ * payload, and the whole is copied once, as by
+ * solClient_msg_setBinaryAttachment().
+ * @param msg_p The message.
+ * @param buf_p The payload, followed by ::COMMON_INTEGRITY_TRAILER_LEN bytes
+ * of room for the trailer.
+ * @param size The payload's size, without the room.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    common_integritySetPayload ( solClient_opaqueMsg_pt msg_p, void *buf_p, solClient_uint32_t size );
+
+/**
+ * Verify a received message's trailer, when the integrity mode is on.
+ * @param msg_p The message.
+ * @param data_p Set to the payload, if not NULL.
+ * @param size_p Set to its size without the trailer, if not NULL.
+ * @return ::SOLCLIENT_OK when intact or when the mode is off,
+ * ::SOLCLIENT_FAIL when corrupt, ::SOLCLIENT_NOT_FOUND when too short to hold a trailer.
+ */
+solClient_returnCode_t
+    common_integrityCheck ( solClient_opaqueMsg_pt msg_p, void **data_p, solClient_uint32_t * size_p );
+
+/**
+ * Copy the counters. Any thread.
+ */
+void
+    common_integrityGetStats ( struct commonIntegrityStats *stats_p );
+
+/**
+ * Zero the counters.
+ */
+void
+    common_integrityResetStats ( void );
+
 #endif /* COMMON_H_ */
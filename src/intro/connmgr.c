@@ -0,0 +1,450 @@
+
+/** example Intro/connmgr.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Reconnects with decorrelated-jitter backoff, a reconnect token bucket and
+ * staged subscription reapplication. See connmgr.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "connmgr.h"
+
+#define CONNMGR_TOKEN               1000    /* tokens holds thousandths of an attempt. */
+
+
+/*****************************************************************************
+ * connmgr_backoff
+ *
+ * Schedules the client's next attempt. Must be called with the lock held.
+ *****************************************************************************/
+static void
+connmgr_backoff ( struct connmgr *mgr_p, struct connmgrClient *client_p )
+{
+    solClient_uint64_t upperMs;
+    solClient_uint64_t waitMs = mgr_p->config.baseMs;
+
+    if ( mgr_p->config.jitter ) {
+        upperMs = 3ULL * ( ( client_p->backoffMs != 0 ) ? client_p->backoffMs : mgr_p->config.baseMs );
+        waitMs += common_random ( &mgr_p->random ) % ( upperMs - mgr_p->config.baseMs + 1 );
+        if ( waitMs > mgr_p->config.capMs ) {
+            waitMs = mgr_p->config.capMs;
+        }
+    }
+    client_p->backoffMs = ( solClient_uint32_t ) waitMs;
+    client_p->nextAttemptMs = mgr_p->stats.nowMs + waitMs;
+    client_p->state = CONNMGR_STATE_WAITING;
+}
+
+/*****************************************************************************
+ * connmgr_recovered
+ *
+ * Must be called with the lock held.
+ *****************************************************************************/
+static void
+connmgr_recovered ( struct connmgr *mgr_p, struct connmgrClient *client_p )
+{
+    solClient_uint64_t recoveryMs = mgr_p->stats.nowMs - client_p->downSinceMs;
+
+    client_p->state = CONNMGR_STATE_UP;
+    client_p->backoffMs = 0;
+    mgr_p->stats.clientsUp++;
+    mgr_p->stats.recoveries++;
+    mgr_p->stats.recoveryMs += recoveryMs;
+    if ( recoveryMs > mgr_p->stats.maxRecoveryMs ) {
+        mgr_p->stats.maxRecoveryMs = recoveryMs;
+    }
+}
+
+/*****************************************************************************
+ * connmgr_eventCallback
+ *****************************************************************************/
+static void
+connmgr_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                        solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct connmgrClient *client_p = ( struct connmgrClient * ) user_p;
+    struct connmgr *mgr_p = client_p->mgr_p;
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    switch ( eventInfo_p->sessionEvent ) {
+        case SOLCLIENT_SESSION_EVENT_UP_NOTICE:
+            client_p->state = CONNMGR_STATE_REAPPLYING;
+            client_p->nextSub = 0;
+            if ( client_p->numSubs == 0 ) {
+                connmgr_recovered ( mgr_p, client_p );
+            }
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_DOWN_ERROR:
+        case SOLCLIENT_SESSION_EVENT_CONNECT_FAILED_ERROR:
+            if ( client_p->state == CONNMGR_STATE_UP ) {
+                mgr_p->stats.clientsUp--;
+            }
+            if ( client_p->state == CONNMGR_STATE_UP || client_p->state == CONNMGR_STATE_REAPPLYING ) {
+                client_p->downSinceMs = mgr_p->stats.nowMs;
+                client_p->backoffMs = 0;
+            }
+            mgr_p->stats.failures++;
+            connmgr_backoff ( mgr_p, client_p );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_ERROR:
+            solClient_log ( SOLCLIENT_LOG_WARNING, "connmgr: subscription failed, responseCode %d, %s",
+                            eventInfo_p->responseCode, eventInfo_p->info_p );
+            /* The confirm of the last subscription still ends the reapplication. */
+        case SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_OK:
+            if ( client_p->state == CONNMGR_STATE_REAPPLYING && client_p->nextSub == client_p->numSubs ) {
+                connmgr_recovered ( mgr_p, client_p );
+            }
+            break;
+
+        default:
+            break;
+    }
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+}
+
+/*****************************************************************************
+ * connmgr_timerCallback
+ *
+ * One tick: refill the bucket, start the attempts that are due and have a
+ * token, and reapply up to subsPerTick subscriptions.
+ *****************************************************************************/
+static void
+connmgr_timerCallback ( solClient_opaqueContext_pt opaqueContext_p, void *user_p )
+{
+    struct connmgr *mgr_p = ( struct connmgr * ) user_p;
+    struct connmgrConfig *config_p = &mgr_p->config;
+    struct connmgrClient *client_p;
+    solClient_returnCode_t rc;
+    solClient_uint32_t subBudget = ( config_p->subsPerTick != 0 ) ? config_p->subsPerTick : 0xffffffffu;
+    solClient_uint32_t numClients;
+    solClient_uint32_t i;
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    mgr_p->stats.nowMs += config_p->tickMs;
+    if ( config_p->connectsPerSec != 0 ) {
+        mgr_p->tokens += config_p->connectsPerSec * config_p->tickMs;
+        if ( mgr_p->tokens > config_p->connectBurst * CONNMGR_TOKEN ) {
+            mgr_p->tokens = config_p->connectBurst * CONNMGR_TOKEN;
+        }
+    }
+
+    numClients = mgr_p->stats.clients;
+    for ( i = 0; i < numClients; i++ ) {
+        client_p = &mgr_p->clients_p[( mgr_p->scanStart + i ) % numClients];
+
+        if ( client_p->state == CONNMGR_STATE_WAITING && client_p->nextAttemptMs <= mgr_p->stats.nowMs ) {
+            if ( config_p->connectsPerSec != 0 ) {
+                if ( mgr_p->tokens < CONNMGR_TOKEN ) {
+                    mgr_p->stats.tokenWaits++;
+                    continue;
+                }
+                mgr_p->tokens -= CONNMGR_TOKEN;
+            }
+            mgr_p->stats.attempts++;
+            client_p->state = CONNMGR_STATE_CONNECTING;
+            rc = mgr_p->api_p->session_connect ( client_p->session_p );
+            if ( rc != SOLCLIENT_OK && rc != SOLCLIENT_IN_PROGRESS ) {
+                mgr_p->stats.failures++;
+                connmgr_backoff ( mgr_p, client_p );
+            }
+        } else if ( client_p->state == CONNMGR_STATE_REAPPLYING ) {
+            while ( client_p->nextSub < client_p->numSubs && subBudget != 0 ) {
+                /* Only the last subscription is confirmed; the Session is recovered once it is. */
+                rc = mgr_p->api_p->session_topicSubscribeExt ( client_p->session_p,
+                                                               ( client_p->nextSub + 1 == client_p->numSubs ) ?
+                                                               SOLCLIENT_SUBSCRIBE_FLAGS_REQUEST_CONFIRM : 0,
+                                                               client_p->subs_p[client_p->nextSub] );
+                if ( rc != SOLCLIENT_OK && rc != SOLCLIENT_IN_PROGRESS ) {
+                    /* Most likely WOULD_BLOCK; try again next tick. */
+                    subBudget = 0;
+                    break;
+                }
+                client_p->nextSub++;
+                subBudget--;
+                mgr_p->stats.subsApplied++;
+            }
+        }
+    }
+    if ( numClients != 0 ) {
+        mgr_p->scanStart = ( mgr_p->scanStart + 1 ) % numClients;
+    }
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+}
+
+
+/*****************************************************************************
+ * connmgr_init
+ *****************************************************************************/
+solClient_returnCode_t
+connmgr_init ( struct connmgr *mgr_p, solClient_opaqueContext_pt context_p, solClient_uint32_t maxClients,
+               const struct connmgrConfig *config_p )
+{
+    static const struct connmgrConfig defaultConfig = CONNMGR_CONFIG_DEFAULT;
+
+    memset ( mgr_p, 0, sizeof ( *mgr_p ) );
+    mgr_p->config = ( config_p != NULL ) ? *config_p : defaultConfig;
+    if ( mgr_p->config.tickMs == 0 || mgr_p->config.baseMs == 0 || mgr_p->config.capMs < mgr_p->config.baseMs ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "connmgr_init() needs tickMs > 0 and 0 < baseMs <= capMs" );
+        return SOLCLIENT_FAIL;
+    }
+    if ( ( mgr_p->clients_p = ( struct connmgrClient * ) calloc ( maxClients, sizeof ( struct connmgrClient ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "connmgr_init() could not allocate %u clients", maxClients );
+        return SOLCLIENT_FAIL;
+    }
+    OS_MUTEX_INIT ( &mgr_p->lock );
+    mgr_p->api_p = common_getSolClientApi (  );
+    mgr_p->context_p = context_p;
+    mgr_p->maxClients = maxClients;
+    mgr_p->timerId = SOLCLIENT_CONTEXT_TIMER_ID_INVALID;
+    mgr_p->tokens = mgr_p->config.connectBurst * CONNMGR_TOKEN;
+    mgr_p->random = common_randomSeed ( ( solClient_uint64_t ) ( size_t ) mgr_p );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * connmgr_addClient
+ *****************************************************************************/
+solClient_returnCode_t
+connmgr_addClient ( struct connmgr *mgr_p, struct commonOptions *commonOpts,
+                    solClient_session_rxMsgCallbackFunc_t msgCallback_p, void *user_p,
+                    struct connmgrClient **client_pp )
+{
+    solClient_returnCode_t rc;
+    solClient_session_createFuncInfo_t sessionFuncInfo = SOLCLIENT_SESSION_CREATEFUNC_INITIALIZER;
+    struct connmgrClient *client_p;
+    const char     *sessionProps[50] = {0, };
+    int             propIndex = 0;
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    if ( mgr_p->stats.clients == mgr_p->maxClients ) {
+        OS_MUTEX_UNLOCK ( &mgr_p->lock );
+        solClient_log ( SOLCLIENT_LOG_ERROR, "connmgr_addClient() has no room past %u clients", mgr_p->maxClients );
+        return SOLCLIENT_FAIL;
+    }
+    client_p = &mgr_p->clients_p[mgr_p->stats.clients];
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+
+    sessionFuncInfo.rxMsgInfo.callback_p = msgCallback_p;
+    sessionFuncInfo.rxMsgInfo.user_p = user_p;
+    sessionFuncInfo.eventInfo.callback_p = connmgr_eventCallback;
+    sessionFuncInfo.eventInfo.user_p = client_p;
+
+    if ( commonOpts->targetHost[0] ) {
+        sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_HOST;
+        sessionProps[propIndex++] = commonOpts->targetHost;
+    }
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_COMPRESSION_LEVEL;
+    sessionProps[propIndex++] = ( commonOpts->enableCompression ) ? "9" : "0";
+
+    /* The manager does the retrying, and reapplies subscriptions itself. */
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_CONNECT_RETRIES;
+    sessionProps[propIndex++] = "0";
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_RECONNECT_RETRIES;
+    sessionProps[propIndex++] = "0";
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_REAPPLY_SUBSCRIPTIONS;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    /* Connects and subscriptions are started from the Context thread, so they must not block. */
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_CONNECT_BLOCKING;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_SUBSCRIBE_BLOCKING;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_SEND_BLOCKING;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_GENERATE_SEND_TIMESTAMPS;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_GENERATE_SENDER_ID;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_GENERATE_SEQUENCE_NUMBER;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_ENABLE_VAL;
+
+    if ( commonOpts->vpn[0] ) {
+        sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_VPN_NAME;
+        sessionProps[propIndex++] = commonOpts->vpn;
+    }
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_SSL_VALIDATE_CERTIFICATE;
+    sessionProps[propIndex++] = SOLCLIENT_PROP_DISABLE_VAL;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_USERNAME;
+    sessionProps[propIndex++] = commonOpts->username;
+    sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_PASSWORD;
+    sessionProps[propIndex++] = commonOpts->password;
+    if ( commonOpts->useGSS ) {
+        sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_AUTHENTICATION_SCHEME;
+        sessionProps[propIndex++] = SOLCLIENT_SESSION_PROP_AUTHENTICATION_SCHEME_GSS_KRB;
+    }
+
+    if ( ( rc = mgr_p->api_p->session_create ( ( char ** ) sessionProps,
+                                               mgr_p->context_p,
+                                               &client_p->session_p, &sessionFuncInfo, sizeof ( sessionFuncInfo ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_create()" );
+        return rc;
+    }
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    client_p->mgr_p = mgr_p;
+    client_p->downSinceMs = mgr_p->stats.nowMs;
+    client_p->state = CONNMGR_STATE_WAITING;
+    client_p->nextAttemptMs = mgr_p->stats.nowMs +
+        ( mgr_p->config.jitter ? common_random ( &mgr_p->random ) % ( mgr_p->config.baseMs + 1 ) : 0 );
+    mgr_p->stats.clients++;
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+    *client_pp = client_p;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * connmgr_subscribe
+ *****************************************************************************/
+solClient_returnCode_t
+connmgr_subscribe ( struct connmgrClient *client_p, const char *topic_p )
+{
+    struct connmgr *mgr_p = client_p->mgr_p;
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    char          **subs_p;
+    char           *topicCopy_p;
+    solClient_uint32_t maxSubs;
+
+    if ( ( topicCopy_p = ( char * ) malloc ( strlen ( topic_p ) + 1 ) ) == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    strcpy ( topicCopy_p, topic_p );
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    if ( client_p->numSubs == client_p->maxSubs ) {
+        maxSubs = ( client_p->maxSubs != 0 ) ? 2 * client_p->maxSubs : 8;
+        if ( ( subs_p = ( char ** ) realloc ( client_p->subs_p, maxSubs * sizeof ( char * ) ) ) == NULL ) {
+            OS_MUTEX_UNLOCK ( &mgr_p->lock );
+            free ( topicCopy_p );
+            return SOLCLIENT_FAIL;
+        }
+        client_p->subs_p = subs_p;
+        client_p->maxSubs = maxSubs;
+    }
+    client_p->subs_p[client_p->numSubs++] = topicCopy_p;
+    /* Otherwise it is applied with the others when the Session comes up. */
+    if ( client_p->state == CONNMGR_STATE_UP ) {
+        client_p->nextSub = client_p->numSubs;
+        rc = mgr_p->api_p->session_topicSubscribeExt ( client_p->session_p, 0, topicCopy_p );
+        rc = ( rc == SOLCLIENT_IN_PROGRESS ) ? SOLCLIENT_OK : rc;
+    }
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+    return rc;
+}
+
+/*****************************************************************************
+ * connmgr_reconnect
+ *****************************************************************************/
+solClient_returnCode_t
+connmgr_reconnect ( struct connmgrClient *client_p )
+{
+    struct connmgr *mgr_p = client_p->mgr_p;
+    solClient_returnCode_t rc;
+
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    if ( client_p->state != CONNMGR_STATE_UP && client_p->state != CONNMGR_STATE_REAPPLYING ) {
+        OS_MUTEX_UNLOCK ( &mgr_p->lock );
+        return SOLCLIENT_OK;
+    }
+    if ( client_p->state == CONNMGR_STATE_UP ) {
+        mgr_p->stats.clientsUp--;
+    }
+    client_p->downSinceMs = mgr_p->stats.nowMs;
+    client_p->backoffMs = 0;
+    connmgr_backoff ( mgr_p, client_p );
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+
+    /* Outside the lock: disconnecting may wait for the Context thread. The
+     * backoff keeps the manager from reconnecting before this returns. */
+    if ( ( rc = mgr_p->api_p->session_disconnect ( client_p->session_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_session_disconnect()" );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * connmgr_start
+ *****************************************************************************/
+solClient_returnCode_t
+connmgr_start ( struct connmgr *mgr_p )
+{
+    solClient_returnCode_t rc;
+
+    if ( ( rc = mgr_p->api_p->context_startTimer ( mgr_p->context_p, SOLCLIENT_CONTEXT_TIMER_REPEAT, mgr_p->config.tickMs,
+                                                   connmgr_timerCallback, mgr_p, &mgr_p->timerId ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_startTimer()" );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * connmgr_getStats
+ *****************************************************************************/
+void
+connmgr_getStats ( struct connmgr *mgr_p, struct connmgrStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &mgr_p->lock );
+    *stats_p = mgr_p->stats;
+    OS_MUTEX_UNLOCK ( &mgr_p->lock );
+}
+
+/*****************************************************************************
+ * connmgr_destroy
+ *****************************************************************************/
+void
+connmgr_destroy ( struct connmgr *mgr_p )
+{
+    struct connmgrClient *client_p;
+    solClient_uint32_t i;
+    solClient_uint32_t sub;
+
+    if ( mgr_p->timerId != SOLCLIENT_CONTEXT_TIMER_ID_INVALID ) {
+        mgr_p->api_p->context_stopTimer ( mgr_p->context_p, &mgr_p->timerId );
+    }
+    for ( i = 0; i < mgr_p->stats.clients; i++ ) {
+        client_p = &mgr_p->clients_p[i];
+        mgr_p->api_p->session_disconnect ( client_p->session_p );
+        mgr_p->api_p->session_destroy ( &client_p->session_p );
+        for ( sub = 0; sub < client_p->numSubs; sub++ ) {
+            free ( client_p->subs_p[sub] );
+        }
+        free ( client_p->subs_p );
+    }
+    OS_MUTEX_DESTROY ( &mgr_p->lock );
+    free ( mgr_p->clients_p );
+    mgr_p->clients_p = NULL;
+}
+
+/*****************************************************************************
+ * connmgr_stateToString
+ *****************************************************************************/
+const char     *
+connmgr_stateToString ( int state )
+{
+    switch ( state ) {
+        case CONNMGR_STATE_WAITING:
+            return "WAITING";
+        case CONNMGR_STATE_CONNECTING:
+            return "CONNECTING";
+        case CONNMGR_STATE_REAPPLYING:
+            return "REAPPLYING";
+        case CONNMGR_STATE_UP:
+            return "UP";
+        default:
+            return "UNKNOWN";
+    }
+}
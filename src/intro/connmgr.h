@@ -0,0 +1,192 @@
+/** example Intro/connmgr.h
+ */
+
+/**
+ *
+ * file connmgr.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a connection manager that reconnects many
+ * Sessions of one Context without the whole fleet acting in lockstep when a
+ * broker restarts. The manager's Sessions are created with the API's own
+ * connect and reconnect retries and subscription reapplication turned off;
+ * instead:
+ *
+ *   - A failed or lost Session waits a decorrelated-jitter backoff before
+ *     each attempt: min(capMs, random between baseMs and 3 x the previous
+ *     wait).
+ *   - Attempts also take a token from a bucket shared by the Context's
+ *     Sessions, refilled at connectsPerSec up to connectBurst.
+ *   - Once up, a Session's subscriptions are reapplied by the manager, at
+ *     most subsPerTick per tick across all its Sessions, the last one with
+ *     a confirm. The Session counts as recovered when that confirm arrives.
+ *
+ * All of this runs on the Context thread from one repeating timer of tickMs
+ * and the Sessions' event callbacks, so there is one manager per Context.
+ * For the same reason the Sessions do not block on connects, subscriptions
+ * or sends: a send may return ::SOLCLIENT_WOULD_BLOCK.
+ * Its clock is the tick count, which also makes it run unchanged on the
+ * virtual clock of solClientMock; its Session and timer calls go through
+ * the ::common_solClientApi installed when connmgr_init() is called.
+ *
+ * With jitter 0, connectsPerSec 0 and subsPerTick 0, the manager instead
+ * retries every baseMs and reapplies every subscription at once, as the
+ * API's defaults do.
+ */
+
+#ifndef CONNMGR_H_
+#define CONNMGR_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+
+#define CONNMGR_STATE_WAITING       0   /**< Backing off before the next attempt. */
+#define CONNMGR_STATE_CONNECTING    1
+#define CONNMGR_STATE_REAPPLYING    2   /**< Connected, subscriptions being reapplied. */
+#define CONNMGR_STATE_UP            3
+
+/**
+ * @struct connmgrConfig
+ */
+struct connmgrConfig
+{
+    solClient_uint32_t tickMs;
+    solClient_uint32_t baseMs;          /**< Shortest backoff. */
+    solClient_uint32_t capMs;           /**< Longest backoff. */
+    int             jitter;             /**< 0 to wait baseMs every time. */
+    solClient_uint32_t connectsPerSec;  /**< Attempts per second for the Context, 0 for no limit. */
+    solClient_uint32_t connectBurst;
+    solClient_uint32_t subsPerTick;     /**< Subscriptions reapplied per tick, 0 for no limit. */
+};
+
+#define CONNMGR_CONFIG_DEFAULT { 10, 100, 30000, 1, 100, 20, 50 }
+
+/**
+ * @struct connmgrStats
+ */
+struct connmgrStats
+{
+    solClient_uint32_t clients;
+    solClient_uint32_t clientsUp;
+    solClient_uint64_t attempts;
+    solClient_uint64_t failures;        /**< Attempts that failed, and Sessions that went down. */
+    solClient_uint64_t tokenWaits;      /**< Ticks an attempt was due but the bucket was empty. */
+    solClient_uint64_t subsApplied;
+    solClient_uint64_t recoveries;      /**< Sessions that came back with all subscriptions. */
+    solClient_uint64_t recoveryMs;      /**< Sum of their times from down to recovered. */
+    solClient_uint64_t maxRecoveryMs;
+    solClient_uint64_t nowMs;
+};
+
+struct connmgr;
+
+/**
+ * @struct connmgrClient
+ * One managed Session.
+ */
+struct connmgrClient
+{
+    struct connmgr *mgr_p;
+    solClient_opaqueSession_pt session_p;
+    int             state;
+    solClient_uint64_t nextAttemptMs;
+    solClient_uint32_t backoffMs;       /**< The previous wait. */
+    solClient_uint64_t downSinceMs;
+    char          **subs_p;
+    solClient_uint32_t numSubs;
+    solClient_uint32_t maxSubs;
+    solClient_uint32_t nextSub;         /**< Next subscription to reapply. */
+};
+
+/**
+ * @struct connmgr
+ */
+struct connmgr
+{
+    OS_MUTEX        lock;
+    const struct common_solClientApi *api_p;       /**< The calls in use when the manager was set up. */
+    solClient_opaqueContext_pt context_p;
+    struct connmgrConfig config;
+    solClient_context_timerId_t timerId;
+    struct connmgrClient *clients_p;
+    solClient_uint32_t maxClients;
+    solClient_uint32_t scanStart;       /**< Rotates so that no Session is always first. */
+    solClient_uint32_t tokens;          /**< In thousandths of an attempt. */
+    solClient_uint64_t random;
+    struct connmgrStats stats;
+};
+
+
+/**
+ * Set up a manager for Sessions on a Context.
+ * @param mgr_p The manager to initialize.
+ * @param context_p The Context whose timer and thread the manager uses.
+ * @param maxClients Sessions to make room for.
+ * @param config_p The configuration, or NULL for ::CONNMGR_CONFIG_DEFAULT.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    connmgr_init ( struct connmgr *mgr_p, solClient_opaqueContext_pt context_p, solClient_uint32_t maxClients,
+                   const struct connmgrConfig *config_p );
+
+/**
+ * Create a Session as common_createAndConnectSession() does, but with the
+ * manager's retry settings, and leave connecting it to the manager. The
+ * first attempt is also jittered, up to baseMs.
+ * @param mgr_p The manager.
+ * @param commonOpts The host, credentials and other Session options.
+ * @param msgCallback_p The Session's receive callback.
+ * @param user_p The receive callback's user pointer.
+ * @param client_pp Receives the managed Session.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    connmgr_addClient ( struct connmgr *mgr_p, struct commonOptions *commonOpts,
+                        solClient_session_rxMsgCallbackFunc_t msgCallback_p, void *user_p,
+                        struct connmgrClient **client_pp );
+
+/**
+ * Add a subscription to a managed Session. It is applied once the Session
+ * is up and reapplied after every reconnect.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    connmgr_subscribe ( struct connmgrClient *client_p, const char *topic_p );
+
+/**
+ * Disconnect a Session that is up and let the manager reconnect it, after a
+ * backoff, as if it had been dropped. Call it from an application thread.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    connmgr_reconnect ( struct connmgrClient *client_p );
+
+/**
+ * Start the manager's timer. Sessions are connected from the next tick.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    connmgr_start ( struct connmgr *mgr_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    connmgr_getStats ( struct connmgr *mgr_p, struct connmgrStats *stats_p );
+
+/**
+ * Stop the timer, destroy the Sessions and free the manager.
+ */
+void
+    connmgr_destroy ( struct connmgr *mgr_p );
+
+/**
+ * The name of a client state.
+ */
+const char     *
+    connmgr_stateToString ( int state );
+
+#endif /* CONNMGR_H_ */
@@ -0,0 +1,444 @@
+
+/** example Intro/envelope.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Packs many small logical messages for one topic into a single Solace
+ * message, and iterates them in place on receipt. See envelope.h for the
+ * envelope layout.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "envelope.h"
+
+
+/*****************************************************************************
+ * envelope_sealLocked
+ *
+ * Writes the header and end offset table around the pending records, and
+ * swaps the buffers so that the sealed envelope is in sendBuf_p and new
+ * records go to the other. Must be called with the publisher lock held, and
+ * with no sealed envelope waiting.
+ *****************************************************************************/
+static void
+envelope_sealLocked ( struct envelopePublisher *env_p )
+{
+    unsigned char  *p;
+    unsigned char  *buf_p;
+    solClient_uint32_t i;
+    int             wide;
+
+    wide = ( env_p->used > 0xffff );
+
+    env_p->buf_p[0] = 'E';
+    env_p->buf_p[1] = 'N';
+    env_p->buf_p[2] = ENVELOPE_VERSION;
+    env_p->buf_p[3] = wide ? ENVELOPE_FLAG_WIDE_OFFSETS : 0;
+    env_p->buf_p[4] = ( unsigned char ) ( env_p->count >> 24 );
+    env_p->buf_p[5] = ( unsigned char ) ( env_p->count >> 16 );
+    env_p->buf_p[6] = ( unsigned char ) ( env_p->count >> 8 );
+    env_p->buf_p[7] = ( unsigned char ) ( env_p->count );
+
+    /* The end offset table follows the records directly. */
+    p = env_p->buf_p + ENVELOPE_HEADER_SIZE + env_p->used;
+    for ( i = 0; i < env_p->count; i++ ) {
+        if ( wide ) {
+            *p++ = ( unsigned char ) ( env_p->ends_p[i] >> 24 );
+            *p++ = ( unsigned char ) ( env_p->ends_p[i] >> 16 );
+        }
+        *p++ = ( unsigned char ) ( env_p->ends_p[i] >> 8 );
+        *p++ = ( unsigned char ) ( env_p->ends_p[i] );
+    }
+
+    env_p->sendSize = ( solClient_uint32_t ) ( p - env_p->buf_p );
+    env_p->sendCount = env_p->count;
+    buf_p = env_p->sendBuf_p;
+    env_p->sendBuf_p = env_p->buf_p;
+    env_p->buf_p = buf_p;
+    env_p->count = 0;
+    env_p->used = 0;
+}
+
+
+/*****************************************************************************
+ * envelope_flushLocked
+ *
+ * Sends the envelope held back, if any, then seals and sends the pending
+ * records. Must be called with the publisher lock held, which is released
+ * around each send. Off the Context thread, waits for a send in progress on
+ * another thread; on it, leaves the records to the next flush instead.
+ *****************************************************************************/
+static solClient_returnCode_t
+envelope_flushLocked ( struct envelopePublisher *env_p, int inContext )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    for ( ;; ) {
+        if ( env_p->sending ) {
+            if ( inContext ) {
+                return SOLCLIENT_OK;
+            }
+            OS_MUTEX_UNLOCK ( &env_p->lock );
+            os_eventWait ( &env_p->sent, ENVELOPE_SEND_WAIT_MS );
+            OS_MUTEX_LOCK ( &env_p->lock );
+            continue;
+        }
+
+        if ( env_p->sendSize != 0 ) {
+            /*
+             * sendBuf_p and msg_p belong to the sending thread until it
+             * clears sending. The attachment is referenced rather than
+             * copied into the message; solClient_session_sendMsg() has
+             * finished with the buffer when it returns.
+             */
+            env_p->sending = 1;
+            OS_MUTEX_UNLOCK ( &env_p->lock );
+            if ( ( rc = solClient_msg_setBinaryAttachmentPtr ( env_p->msg_p, env_p->sendBuf_p,
+                                                                env_p->sendSize ) ) != SOLCLIENT_OK ) {
+                common_handleError ( rc, "solClient_msg_setBinaryAttachmentPtr()" );
+            } else if ( ( rc = solClient_session_sendMsg ( env_p->session_p, env_p->msg_p ) ) != SOLCLIENT_OK &&
+                        rc != SOLCLIENT_WOULD_BLOCK ) {
+                common_handleError ( rc, "solClient_session_sendMsg()" );
+            }
+            OS_MUTEX_LOCK ( &env_p->lock );
+            env_p->sending = 0;
+            if ( rc == SOLCLIENT_OK ) {
+                env_p->stats.envelopesSent++;
+                env_p->stats.recordsSent += env_p->sendCount;
+            } else if ( rc != SOLCLIENT_WOULD_BLOCK ) {
+                env_p->stats.sendErrors++;
+            }
+            if ( rc != SOLCLIENT_WOULD_BLOCK ) {
+                env_p->sendSize = 0;
+            }
+            os_eventSignal ( &env_p->sent );
+            if ( rc != SOLCLIENT_OK ) {
+                return rc;
+            }
+            continue;
+        }
+
+        if ( env_p->count == 0 ) {
+            return SOLCLIENT_OK;
+        }
+        envelope_sealLocked ( env_p );
+    }
+}
+
+
+/*****************************************************************************
+ * envelope_timerCallback
+ *
+ * Runs on the Context thread. Sends whatever is pending so no logical
+ * message waits longer than roughly one timer period.
+ *****************************************************************************/
+static void
+envelope_timerCallback ( solClient_opaqueContext_pt opaqueContext_p, void *user_p )
+{
+    struct envelopePublisher *env_p = ( struct envelopePublisher * ) user_p;
+
+    OS_MUTEX_LOCK ( &env_p->lock );
+    if ( !env_p->stopping && ( env_p->count != 0 || env_p->sendSize != 0 ) ) {
+        env_p->stats.flushByTimer++;
+        envelope_flushLocked ( env_p, 1 );
+    }
+    OS_MUTEX_UNLOCK ( &env_p->lock );
+}
+
+
+/*****************************************************************************
+ * envelope_stoppedCallback
+ *
+ * A one-shot timer started once the flush timer is stopped. Timer callbacks
+ * run one at a time on the Context thread, so when this one runs, no flush
+ * timer callback is running or still to come.
+ *****************************************************************************/
+static void
+envelope_stoppedCallback ( solClient_opaqueContext_pt opaqueContext_p, void *user_p )
+{
+    os_eventSignal ( &( ( struct envelopePublisher * ) user_p )->stopped );
+}
+
+
+/*****************************************************************************
+ * envelope_publisherInit
+ *****************************************************************************/
+solClient_returnCode_t
+envelope_publisherInit ( struct envelopePublisher *env_p,
+                         solClient_opaqueContext_pt context_p,
+                         solClient_opaqueSession_pt session_p,
+                         const char *topic_p,
+                         solClient_uint32_t deliveryMode,
+                         solClient_uint32_t maxBytes, solClient_uint32_t maxRecords, solClient_uint32_t flushMs )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    size_t          bufSize;
+
+    memset ( env_p, 0, sizeof ( *env_p ) );
+    env_p->session_p = session_p;
+    env_p->context_p = context_p;
+    env_p->deliveryMode = deliveryMode;
+    env_p->maxBytes = ( maxBytes != 0 ) ? maxBytes : ENVELOPE_DEFAULT_MAX_BYTES;
+    env_p->maxRecords = ( maxRecords != 0 ) ? maxRecords : ENVELOPE_DEFAULT_MAX_RECORDS;
+    env_p->timerId = SOLCLIENT_CONTEXT_TIMER_ID_INVALID;
+    strncpy ( env_p->topic, topic_p, sizeof ( env_p->topic ) - 1 );
+
+    /* Worst case the offset table is four bytes per record. */
+    bufSize = ENVELOPE_HEADER_SIZE + env_p->maxBytes + 4 * env_p->maxRecords;
+    env_p->buf_p = ( unsigned char * ) malloc ( bufSize );
+    env_p->sendBuf_p = ( unsigned char * ) malloc ( bufSize );
+    env_p->ends_p = ( solClient_uint32_t * ) malloc ( sizeof ( solClient_uint32_t ) * env_p->maxRecords );
+    if ( env_p->buf_p == NULL || env_p->sendBuf_p == NULL || env_p->ends_p == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "envelope_publisherInit() could not allocate buffers" );
+        rc = SOLCLIENT_FAIL;
+        goto freeBuffers;
+    }
+
+    /* One message is reused for every envelope. */
+    if ( ( rc = solClient_msg_alloc ( &env_p->msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_alloc()" );
+        goto freeBuffers;
+    }
+    if ( ( rc = solClient_msg_setDeliveryMode ( env_p->msg_p, deliveryMode ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDeliveryMode()" );
+        goto freeMsg;
+    }
+    env_p->destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    env_p->destination.dest = env_p->topic;
+    if ( ( rc = solClient_msg_setDestination ( env_p->msg_p, &env_p->destination, sizeof ( env_p->destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDestination()" );
+        goto freeMsg;
+    }
+
+    OS_MUTEX_INIT ( &env_p->lock );
+    if ( os_eventInit ( &env_p->sent ) != 0 ) {
+        rc = SOLCLIENT_FAIL;
+        goto destroyLock;
+    }
+    if ( os_eventInit ( &env_p->stopped ) != 0 ) {
+        rc = SOLCLIENT_FAIL;
+        goto destroySent;
+    }
+
+    if ( flushMs != 0 ) {
+        if ( ( rc = solClient_context_startTimer ( context_p, SOLCLIENT_CONTEXT_TIMER_REPEAT, flushMs,
+                                                   envelope_timerCallback, env_p, &env_p->timerId ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_startTimer()" );
+            os_eventDestroy ( &env_p->stopped );
+            goto destroySent;
+        }
+    }
+    return SOLCLIENT_OK;
+
+  destroySent:
+    os_eventDestroy ( &env_p->sent );
+  destroyLock:
+    OS_MUTEX_DESTROY ( &env_p->lock );
+  freeMsg:
+    solClient_msg_free ( &env_p->msg_p );
+  freeBuffers:
+    free ( env_p->buf_p );
+    free ( env_p->sendBuf_p );
+    free ( env_p->ends_p );
+    env_p->buf_p = NULL;
+    env_p->sendBuf_p = NULL;
+    env_p->ends_p = NULL;
+    return rc;
+}
+
+
+/*****************************************************************************
+ * envelope_add
+ *****************************************************************************/
+solClient_returnCode_t
+envelope_add ( struct envelopePublisher *env_p, const void *data_p, solClient_uint32_t size )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    if ( size > env_p->maxBytes ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "envelope_add() record of %u bytes exceeds envelope size %u",
+                        size, env_p->maxBytes );
+        return SOLCLIENT_FAIL;
+    }
+
+    OS_MUTEX_LOCK ( &env_p->lock );
+    if ( env_p->used + size > env_p->maxBytes || env_p->count == env_p->maxRecords ) {
+        env_p->stats.flushBySize++;
+        rc = envelope_flushLocked ( env_p, 0 );
+        if ( env_p->used + size > env_p->maxBytes || env_p->count == env_p->maxRecords ) {
+            /* Both buffers are full: an envelope is held back by the transport. */
+            OS_MUTEX_UNLOCK ( &env_p->lock );
+            return rc;
+        }
+    }
+    memcpy ( env_p->buf_p + ENVELOPE_HEADER_SIZE + env_p->used, data_p, size );
+    env_p->used += size;
+    env_p->ends_p[env_p->count++] = env_p->used;
+    if ( env_p->count == env_p->maxRecords ) {
+        env_p->stats.flushBySize++;
+        rc = envelope_flushLocked ( env_p, 0 );
+    }
+    OS_MUTEX_UNLOCK ( &env_p->lock );
+
+    /* Added; an envelope held back goes out with the next flush. */
+    return ( rc == SOLCLIENT_WOULD_BLOCK ) ? SOLCLIENT_OK : rc;
+}
+
+
+/*****************************************************************************
+ * envelope_flush
+ *****************************************************************************/
+solClient_returnCode_t
+envelope_flush ( struct envelopePublisher *env_p )
+{
+    solClient_returnCode_t rc;
+
+    OS_MUTEX_LOCK ( &env_p->lock );
+    rc = envelope_flushLocked ( env_p, 0 );
+    OS_MUTEX_UNLOCK ( &env_p->lock );
+    return rc;
+}
+
+
+/*****************************************************************************
+ * envelope_publisherDestroy
+ *****************************************************************************/
+void
+envelope_publisherDestroy ( struct envelopePublisher *env_p )
+{
+    solClient_context_timerId_t barrierId = SOLCLIENT_CONTEXT_TIMER_ID_INVALID;
+    solClient_returnCode_t rc;
+
+    OS_MUTEX_LOCK ( &env_p->lock );
+    env_p->stopping = 1;
+    OS_MUTEX_UNLOCK ( &env_p->lock );
+
+    if ( env_p->timerId != SOLCLIENT_CONTEXT_TIMER_ID_INVALID ) {
+        solClient_context_stopTimer ( env_p->context_p, &env_p->timerId );
+
+        /* A callback already dispatched may still be running, or about to lock. */
+        if ( ( rc = solClient_context_startTimer ( env_p->context_p, SOLCLIENT_CONTEXT_TIMER_ONE_SHOT, 1,
+                                                   envelope_stoppedCallback, env_p, &barrierId ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_startTimer()" );
+        } else {
+            while ( os_eventWait ( &env_p->stopped, 1000 ) != 0 ) {
+                solClient_log ( SOLCLIENT_LOG_WARNING, "envelope_publisherDestroy() waiting for the Context thread" );
+            }
+        }
+    }
+
+    OS_MUTEX_LOCK ( &env_p->lock );
+    if ( envelope_flushLocked ( env_p, 0 ) == SOLCLIENT_WOULD_BLOCK ) {
+        /* Still held back by a full transport: dropped. */
+        env_p->stats.sendErrors++;
+    }
+    OS_MUTEX_UNLOCK ( &env_p->lock );
+
+    solClient_msg_free ( &env_p->msg_p );
+    free ( env_p->buf_p );
+    free ( env_p->sendBuf_p );
+    free ( env_p->ends_p );
+    env_p->buf_p = NULL;
+    env_p->sendBuf_p = NULL;
+    env_p->ends_p = NULL;
+    os_eventDestroy ( &env_p->stopped );
+    os_eventDestroy ( &env_p->sent );
+    OS_MUTEX_DESTROY ( &env_p->lock );
+}
+
+
+/*****************************************************************************
+ * envelope_readerInit
+ *****************************************************************************/
+solClient_returnCode_t
+envelope_readerInit ( struct envelopeReader *reader_p, solClient_opaqueMsg_pt msg_p )
+{
+    const unsigned char *buf_p;
+    solClient_uint32_t size;
+    solClient_uint32_t tableSize;
+    solClient_uint32_t recordsSize;
+    solClient_uint32_t lastEnd;
+
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, ( solClient_opaquePointer_pt ) & buf_p, &size ) != SOLCLIENT_OK ) {
+        return SOLCLIENT_NOT_FOUND;
+    }
+    if ( size < ENVELOPE_HEADER_SIZE || buf_p[0] != 'E' || buf_p[1] != 'N' || buf_p[2] != ENVELOPE_VERSION ) {
+        return SOLCLIENT_NOT_FOUND;
+    }
+
+    reader_p->wide = ( buf_p[3] & ENVELOPE_FLAG_WIDE_OFFSETS ) != 0;
+    reader_p->count = ( ( solClient_uint32_t ) buf_p[4] << 24 ) | ( ( solClient_uint32_t ) buf_p[5] << 16 ) |
+        ( ( solClient_uint32_t ) buf_p[6] << 8 ) | ( solClient_uint32_t ) buf_p[7];
+    reader_p->index = 0;
+    reader_p->start = 0;
+
+    /* Validate the table against the attachment so envelope_next() need not. */
+    tableSize = reader_p->count * ( reader_p->wide ? 4 : 2 );
+    if ( reader_p->count > size || tableSize > size - ENVELOPE_HEADER_SIZE ) {
+        return SOLCLIENT_NOT_FOUND;
+    }
+    recordsSize = size - ENVELOPE_HEADER_SIZE - tableSize;
+    reader_p->recordsSize = recordsSize;
+    reader_p->records_p = buf_p + ENVELOPE_HEADER_SIZE;
+    reader_p->table_p = reader_p->records_p + recordsSize;
+
+    if ( reader_p->count != 0 ) {
+        const unsigned char *e_p = reader_p->table_p + tableSize - ( reader_p->wide ? 4 : 2 );
+        lastEnd = reader_p->wide ?
+            ( ( solClient_uint32_t ) e_p[0] << 24 ) | ( ( solClient_uint32_t ) e_p[1] << 16 ) |
+            ( ( solClient_uint32_t ) e_p[2] << 8 ) | ( solClient_uint32_t ) e_p[3] :
+            ( ( solClient_uint32_t ) e_p[0] << 8 ) | ( solClient_uint32_t ) e_p[1];
+        if ( lastEnd != recordsSize ) {
+            return SOLCLIENT_NOT_FOUND;
+        }
+    }
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * envelope_next
+ *****************************************************************************/
+solClient_returnCode_t
+envelope_next ( struct envelopeReader *reader_p, const void **data_pp, solClient_uint32_t *size_p )
+{
+    const unsigned char *e_p;
+    solClient_uint32_t end;
+
+    if ( reader_p->index >= reader_p->count ) {
+        return SOLCLIENT_EOS;
+    }
+
+    if ( reader_p->wide ) {
+        e_p = reader_p->table_p + 4 * reader_p->index;
+        end = ( ( solClient_uint32_t ) e_p[0] << 24 ) | ( ( solClient_uint32_t ) e_p[1] << 16 ) |
+            ( ( solClient_uint32_t ) e_p[2] << 8 ) | ( solClient_uint32_t ) e_p[3];
+    } else {
+        e_p = reader_p->table_p + 2 * reader_p->index;
+        end = ( ( solClient_uint32_t ) e_p[0] << 8 ) | ( solClient_uint32_t ) e_p[1];
+    }
+
+    /* Offsets must be non-decreasing and in range; a corrupt table ends the iteration. */
+    if ( end < reader_p->start || end > reader_p->recordsSize ) {
+        reader_p->index = reader_p->count;
+        return SOLCLIENT_EOS;
+    }
+
+    *data_pp = reader_p->records_p + reader_p->start;
+    *size_p = end - reader_p->start;
+    reader_p->start = end;
+    reader_p->index++;
+    return SOLCLIENT_OK;
+}
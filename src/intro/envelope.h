@@ -0,0 +1,192 @@
+/** example Intro/envelope.h
+ */
+
+/**
+ *
+ * file envelope.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides an application-level envelope that packs many
+ * small logical messages for the same topic into the binary attachment of a
+ * single Solace message.
+ *
+ * Envelope layout (all integers in network byte order):
+ *
+ *  +-------+-------+-------+-------+------------------+-----------+------------------+
+ *  | 'E'   | 'N'   | ver   | flags | record count (4) | records.. | end offset table |
+ *  +-------+-------+-------+-------+------------------+-----------+------------------+
+ *
+ * The end offset table holds one entry per record, giving the end of that
+ * record relative to the start of the record area. Entries are 2 bytes wide
+ * when the record area fits in 64 KB, and 4 bytes wide otherwise
+ * (::ENVELOPE_FLAG_WIDE_OFFSETS).
+ */
+
+#ifndef ENVELOPE_H_
+#define ENVELOPE_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define ENVELOPE_VERSION            1       /**< Envelope format version. */
+#define ENVELOPE_HEADER_SIZE        8       /**< Size of the fixed envelope header. */
+#define ENVELOPE_FLAG_WIDE_OFFSETS  0x01    /**< End offset table entries are 4 bytes wide. */
+
+#define ENVELOPE_DEFAULT_MAX_BYTES  8192    /**< Default record area size that triggers a flush. */
+#define ENVELOPE_DEFAULT_MAX_RECORDS 256    /**< Default record count that triggers a flush. */
+#define ENVELOPE_DEFAULT_FLUSH_MS   10      /**< Default flush timer period. */
+#define ENVELOPE_SEND_WAIT_MS       10      /**< Poll for a send in progress on another thread. */
+
+/**
+ * @struct envelopeStats
+ * Counters maintained by an envelope publisher.
+ */
+struct envelopeStats
+{
+    solClient_uint64_t envelopesSent;     /**< Solace messages sent. */
+    solClient_uint64_t recordsSent;       /**< Logical messages sent. */
+    solClient_uint64_t flushBySize;       /**< Flushes caused by the size or count limit. */
+    solClient_uint64_t flushByTimer;      /**< Flushes caused by the flush timer. */
+    solClient_uint64_t sendErrors;        /**< Failed envelope sends (records are dropped). */
+};
+
+/**
+ * @struct envelopePublisher
+ * Packs logical messages for one topic and flushes them as a single message
+ * once the size or count limit is reached, or when the flush timer expires.
+ * envelope_add() may be called from any one application thread; the flush
+ * timer runs on the Context thread, so the two are serialized by a mutex.
+ *
+ * The mutex is never held while sending: a flush seals the pending records
+ * into an envelope, swaps in the second buffer for new records and sends
+ * the envelope with the mutex released, so that a send blocked on a full
+ * transport leaves the Context thread free to drain it. One envelope is
+ * sent at a time, in order. The timer does not wait for a send in progress,
+ * and when the transport is full the API does not block it on the Context
+ * thread: the envelope is held back and sent first by the next flush.
+ *
+ * The publisher must stay in place, and its Context and Session alive,
+ * until envelope_publisherDestroy() returns; that waits for a timer
+ * callback in progress, so the publisher may then be freed or go out of
+ * scope. Neither envelope_add(), envelope_flush() nor
+ * envelope_publisherDestroy() may be called from a callback on the
+ * Context thread.
+ */
+struct envelopePublisher
+{
+    solClient_opaqueSession_pt session_p;
+    solClient_opaqueContext_pt context_p;
+    solClient_opaqueMsg_pt msg_p;
+    solClient_destination_t destination;
+    char            topic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+    solClient_uint32_t deliveryMode;
+    unsigned char  *buf_p;              /**< Header, record area and room for the offset table. */
+    unsigned char  *sendBuf_p;          /**< The other buffer, holding the envelope being sent. */
+    solClient_uint32_t *ends_p;         /**< End offset of each pending record. */
+    solClient_uint32_t maxBytes;
+    solClient_uint32_t maxRecords;
+    solClient_uint32_t used;            /**< Bytes used in the record area. */
+    solClient_uint32_t count;           /**< Pending records. */
+    solClient_uint32_t sendSize;        /**< Size of the sealed envelope in sendBuf_p, 0 when none. */
+    solClient_uint32_t sendCount;       /**< Its records. */
+    int             sending;            /**< A thread is sending sendBuf_p without the lock. */
+    int             stopping;           /**< Set by envelope_publisherDestroy(). */
+    solClient_context_timerId_t timerId;
+    OS_MUTEX        lock;
+    OS_EVENT        sent;               /**< Signalled when a send ends. */
+    OS_EVENT        stopped;            /**< Signalled once no timer callback can run. */
+    struct envelopeStats stats;
+};
+
+/**
+ * @struct envelopeReader
+ * Iterates the logical messages of a received envelope in place. The reader
+ * points into the message's binary attachment and must not outlive it.
+ */
+struct envelopeReader
+{
+    const unsigned char *records_p;
+    const unsigned char *table_p;
+    solClient_uint32_t count;
+    solClient_uint32_t index;
+    solClient_uint32_t start;
+    solClient_uint32_t recordsSize;
+    int             wide;
+};
+
+
+/**
+ * Initialize an envelope publisher and start its flush timer.
+ * @param env_p A pointer to the envelopePublisher to initialize.
+ * @param context_p The Context used for the flush timer.
+ * @param session_p The Session on which envelopes are sent.
+ * @param topic_p The Topic that every envelope is published on.
+ * @param deliveryMode The delivery mode of the envelopes.
+ * @param maxBytes Record area size that triggers a flush.
+ * @param maxRecords Record count that triggers a flush.
+ * @param flushMs Flush timer period in milliseconds, 0 to flush by size only.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    envelope_publisherInit ( struct envelopePublisher *env_p,
+                             solClient_opaqueContext_pt context_p,
+                             solClient_opaqueSession_pt session_p,
+                             const char *topic_p,
+                             solClient_uint32_t deliveryMode,
+                             solClient_uint32_t maxBytes, solClient_uint32_t maxRecords, solClient_uint32_t flushMs );
+
+/**
+ * Append a logical message to the pending envelope, flushing first if it
+ * does not fit.
+ * @param env_p A pointer to the envelopePublisher.
+ * @param data_p The logical message.
+ * @param size The size of the logical message; must not exceed maxBytes.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL, or ::SOLCLIENT_WOULD_BLOCK when
+ * the envelope is full and the transport too (with a non-blocking Session);
+ * the logical message was not added.
+ */
+solClient_returnCode_t
+    envelope_add ( struct envelopePublisher *env_p, const void *data_p, solClient_uint32_t size );
+
+/**
+ * Send any pending logical messages now.
+ * @param env_p A pointer to the envelopePublisher.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL, or ::SOLCLIENT_WOULD_BLOCK when
+ * the transport is full (with a non-blocking Session); the envelope is held
+ * back for the next flush.
+ */
+solClient_returnCode_t
+    envelope_flush ( struct envelopePublisher *env_p );
+
+/**
+ * Stop the flush timer and wait until its callback can no longer run, send
+ * any pending logical messages and free all resources held by the envelope
+ * publisher. Call it before destroying the Session or the Context.
+ * @param env_p A pointer to the envelopePublisher.
+ */
+void
+    envelope_publisherDestroy ( struct envelopePublisher *env_p );
+
+/**
+ * Prepare to iterate the logical messages of a received message.
+ * @param reader_p A pointer to the envelopeReader to initialize.
+ * @param msg_p The received message.
+ * @return ::SOLCLIENT_OK, or ::SOLCLIENT_NOT_FOUND if the message is not a
+ * well-formed envelope.
+ */
+solClient_returnCode_t
+    envelope_readerInit ( struct envelopeReader *reader_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Get the next logical message of an envelope. No data is copied.
+ * @param reader_p A pointer to the envelopeReader.
+ * @param data_pp Set to point at the logical message inside the attachment.
+ * @param size_p Set to the size of the logical message.
+ * @return ::SOLCLIENT_OK, or ::SOLCLIENT_EOS when all records have been read.
+ */
+solClient_returnCode_t
+    envelope_next ( struct envelopeReader *reader_p, const void **data_pp, solClient_uint32_t *size_p );
+
+#endif /* ENVELOPE_H_ */
@@ -0,0 +1,339 @@
+
+/** example Intro/fleet.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Thousands of scripted Sessions over a few Contexts. See fleet.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "fleet.h"
+
+
+/*****************************************************************************
+ * fleet_rxCallback
+ *****************************************************************************/
+static          solClient_rxMsgCallback_returnCode_t
+fleet_rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    struct fleetSession *session_p = ( struct fleetSession * ) user_p;
+    struct fleetStats *stats_p = &session_p->fleetContext_p->stats[session_p->profile];
+    void           *payload_p;
+    solClient_uint32_t size = 0;
+
+    stats_p->msgsReceived++;
+    if ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &payload_p, &size ) == SOLCLIENT_OK ) {
+        stats_p->bytesReceived += size;
+    }
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * fleet_timerCallback
+ *
+ * Sends what each up Session of the Context is due, open loop.
+ *****************************************************************************/
+static void
+fleet_timerCallback ( solClient_opaqueContext_pt opaqueContext_p, void *user_p )
+{
+    struct fleetContext *fleetContext_p = ( struct fleetContext * ) user_p;
+    struct fleet   *fleet_p = fleetContext_p->fleet_p;
+    struct fleetSession *session_p;
+    struct fleetProfile *profile_p;
+    struct fleetStats *stats_p;
+    solClient_destination_t destination;
+    solClient_returnCode_t rc;
+    int             i;
+
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    for ( i = fleetContext_p->index; i < fleet_p->numSessions; i += fleet_p->numContexts ) {
+        session_p = &fleet_p->sessions_p[i];
+        if ( session_p->client_p->state != CONNMGR_STATE_UP ) {
+            session_p->credit = 0.0;
+            continue;
+        }
+        profile_p = &fleet_p->profiles[session_p->profile];
+        stats_p = &fleetContext_p->stats[session_p->profile];
+        session_p->credit += profile_p->msgRate * FLEET_TICK_MS / 1000.0;
+        while ( session_p->credit >= 1.0 ) {
+            session_p->credit -= 1.0;
+            destination.dest = session_p->topic;
+            solClient_msg_setDestination ( fleetContext_p->msg_p, &destination, sizeof ( destination ) );
+            solClient_msg_setBinaryAttachmentPtr ( fleetContext_p->msg_p, fleet_p->payload_p,
+                                                   ( solClient_uint32_t ) profile_p->payloadSize );
+            rc = solClient_session_sendMsg ( session_p->client_p->session_p, fleetContext_p->msg_p );
+            if ( rc == SOLCLIENT_OK ) {
+                stats_p->msgsSent++;
+                stats_p->bytesSent += ( solClient_uint64_t ) profile_p->payloadSize;
+                continue;
+            }
+            if ( rc == SOLCLIENT_WOULD_BLOCK ) {
+                stats_p->sendsBlocked++;
+            } else {
+                stats_p->sendsFailed++;
+            }
+            session_p->credit = 0.0;
+        }
+    }
+}
+
+
+/*****************************************************************************
+ * fleet_parseProfile
+ *****************************************************************************/
+solClient_returnCode_t
+fleet_parseProfile ( const char *spec_p, struct fleetProfile *profile_p )
+{
+    const char     *colon_p = strchr ( spec_p, ':' );
+    size_t          nameLen;
+    int             fields;
+
+    memset ( profile_p, 0, sizeof ( *profile_p ) );
+    if ( colon_p == NULL || ( nameLen = ( size_t ) ( colon_p - spec_p ) ) == 0 || nameLen >= FLEET_MAX_NAME ) {
+        return SOLCLIENT_FAIL;
+    }
+    memcpy ( profile_p->name, spec_p, nameLen );
+    fields = sscanf ( colon_p + 1, "%d:%d:%lf:%d:%d", &profile_p->numSessions, &profile_p->numSubs,
+                      &profile_p->msgRate, &profile_p->payloadSize, &profile_p->churnSec );
+    if ( fields < 4 || profile_p->numSessions < 1 || profile_p->numSubs < 0 ||
+         ( profile_p->numSubs != 0 && profile_p->numSubs >= profile_p->numSessions ) ||
+         profile_p->msgRate < 0.0 || profile_p->payloadSize < 0 || profile_p->churnSec < 0 ) {
+        return SOLCLIENT_FAIL;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * fleet_init
+ *****************************************************************************/
+solClient_returnCode_t
+fleet_init ( struct fleet *fleet_p, const struct fleetProfile *profiles_p, int numProfiles, int numContexts,
+             struct commonOptions *commonOpts )
+{
+    solClient_returnCode_t rc;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    struct fleetContext *fleetContext_p;
+    struct fleetSession *session_p;
+    const struct fleetProfile *profile_p;
+    char            topic[FLEET_MAX_NAME + 24];
+    int             maxSessions = 0;
+    int             maxPayload = 0;
+    int             profile;
+    int             n;
+    int             sub;
+    int             i;
+
+    memset ( fleet_p, 0, sizeof ( *fleet_p ) );
+    if ( numProfiles < 1 || numProfiles > FLEET_MAX_PROFILES || numContexts < 1 || numContexts > FLEET_MAX_CONTEXTS ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "fleet_init() needs 1..%d profiles and 1..%d Contexts",
+                        FLEET_MAX_PROFILES, FLEET_MAX_CONTEXTS );
+        return SOLCLIENT_FAIL;
+    }
+    memcpy ( fleet_p->profiles, profiles_p, numProfiles * sizeof ( struct fleetProfile ) );
+    fleet_p->numProfiles = numProfiles;
+    for ( profile = 0; profile < numProfiles; profile++ ) {
+        maxSessions += profiles_p[profile].numSessions;
+        if ( profiles_p[profile].payloadSize > maxPayload ) {
+            maxPayload = profiles_p[profile].payloadSize;
+        }
+    }
+
+    if ( ( fleet_p->contexts_p = ( struct fleetContext * ) calloc ( numContexts, sizeof ( struct fleetContext ) ) ) == NULL ||
+         ( fleet_p->sessions_p = ( struct fleetSession * ) calloc ( maxSessions, sizeof ( struct fleetSession ) ) ) == NULL ||
+         ( fleet_p->payload_p = ( char * ) calloc ( 1, maxPayload + 1 ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "fleet_init() could not allocate %d Sessions", maxSessions );
+        goto fail;
+    }
+
+    /*************************************************************************
+     * A Context, connection manager and message per Context
+     *************************************************************************/
+    for ( i = 0; i < numContexts; i++ ) {
+        fleetContext_p = &fleet_p->contexts_p[i];
+        fleetContext_p->fleet_p = fleet_p;
+        fleetContext_p->index = i;
+        fleetContext_p->timerId = SOLCLIENT_CONTEXT_TIMER_ID_INVALID;
+        if ( ( rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                               &fleetContext_p->context_p, &contextFuncInfo,
+                                               sizeof ( contextFuncInfo ) ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_create()" );
+            goto fail;
+        }
+        fleet_p->numContexts++;
+        if ( connmgr_init ( &fleetContext_p->mgr, fleetContext_p->context_p,
+                            ( solClient_uint32_t ) ( ( maxSessions + numContexts - 1 ) / numContexts ), NULL ) != SOLCLIENT_OK ) {
+            goto fail;
+        }
+        fleetContext_p->mgrInitialized = 1;
+        if ( ( rc = solClient_msg_alloc ( &fleetContext_p->msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_alloc()" );
+            goto fail;
+        }
+        if ( ( rc = solClient_msg_setDeliveryMode ( fleetContext_p->msg_p, SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_setDeliveryMode()" );
+            goto fail;
+        }
+    }
+
+    /*************************************************************************
+     * The Sessions of every profile, dealt out over the Contexts
+     *************************************************************************/
+    for ( profile = 0; profile < numProfiles; profile++ ) {
+        profile_p = &profiles_p[profile];
+        for ( n = 0; n < profile_p->numSessions; n++ ) {
+            session_p = &fleet_p->sessions_p[fleet_p->numSessions];
+            fleetContext_p = &fleet_p->contexts_p[fleet_p->numSessions % numContexts];
+            session_p->fleetContext_p = fleetContext_p;
+            session_p->profile = profile;
+            sprintf ( session_p->topic, "fleet/%s/%d", profile_p->name, n );
+            if ( connmgr_addClient ( &fleetContext_p->mgr, commonOpts, fleet_rxCallback, session_p,
+                                     &session_p->client_p ) != SOLCLIENT_OK ) {
+                goto fail;
+            }
+            fleet_p->numSessions++;
+            fleetContext_p->stats[profile].sessions++;
+            for ( sub = 1; sub <= profile_p->numSubs; sub++ ) {
+                sprintf ( topic, "fleet/%s/%d", profile_p->name, ( n + sub ) % profile_p->numSessions );
+                if ( connmgr_subscribe ( session_p->client_p, topic ) != SOLCLIENT_OK ) {
+                    goto fail;
+                }
+            }
+        }
+    }
+    return SOLCLIENT_OK;
+
+  fail:
+    fleet_destroy ( fleet_p );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * fleet_start
+ *****************************************************************************/
+solClient_returnCode_t
+fleet_start ( struct fleet *fleet_p )
+{
+    solClient_returnCode_t rc;
+    struct fleetContext *fleetContext_p;
+    struct fleetSession *session_p;
+    unsigned long long nowNs = os_getTimeNs (  );
+    int             i;
+
+    /* Spread the scripted reconnects over the first interval. */
+    for ( i = 0; i < fleet_p->numSessions; i++ ) {
+        session_p = &fleet_p->sessions_p[i];
+        session_p->nextChurnNs = nowNs + ( unsigned long long ) fleet_p->profiles[session_p->profile].churnSec *
+            1000000000ULL * ( unsigned long long ) ( i % 1000 + 1 ) / 1000ULL;
+    }
+    for ( i = 0; i < fleet_p->numContexts; i++ ) {
+        fleetContext_p = &fleet_p->contexts_p[i];
+        if ( ( rc = connmgr_start ( &fleetContext_p->mgr ) ) != SOLCLIENT_OK ) {
+            return rc;
+        }
+        if ( ( rc = solClient_context_startTimer ( fleetContext_p->context_p, SOLCLIENT_CONTEXT_TIMER_REPEAT,
+                                                   FLEET_TICK_MS, fleet_timerCallback, fleetContext_p,
+                                                   &fleetContext_p->timerId ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_context_startTimer()" );
+            return rc;
+        }
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * fleet_churn
+ *****************************************************************************/
+void
+fleet_churn ( struct fleet *fleet_p )
+{
+    struct fleetSession *session_p;
+    unsigned long long churnNs;
+    unsigned long long nowNs = os_getTimeNs (  );
+    int             i;
+
+    for ( i = 0; i < fleet_p->numSessions; i++ ) {
+        session_p = &fleet_p->sessions_p[i];
+        churnNs = ( unsigned long long ) fleet_p->profiles[session_p->profile].churnSec * 1000000000ULL;
+        if ( churnNs == 0 || nowNs < session_p->nextChurnNs ) {
+            continue;
+        }
+        session_p->nextChurnNs = nowNs + churnNs;
+        if ( session_p->client_p->state == CONNMGR_STATE_UP ) {
+            connmgr_reconnect ( session_p->client_p );
+            fleet_p->churns[session_p->profile]++;
+        }
+    }
+}
+
+/*****************************************************************************
+ * fleet_getStats
+ *****************************************************************************/
+void
+fleet_getStats ( struct fleet *fleet_p, int profile, struct fleetStats *stats_p )
+{
+    const struct fleetStats *contextStats_p;
+    int             i;
+
+    memset ( stats_p, 0, sizeof ( *stats_p ) );
+    /* Read while the Context threads write; a total may be a tick behind. */
+    for ( i = 0; i < fleet_p->numContexts; i++ ) {
+        contextStats_p = &fleet_p->contexts_p[i].stats[profile];
+        stats_p->sessions += contextStats_p->sessions;
+        stats_p->msgsSent += contextStats_p->msgsSent;
+        stats_p->bytesSent += contextStats_p->bytesSent;
+        stats_p->sendsBlocked += contextStats_p->sendsBlocked;
+        stats_p->sendsFailed += contextStats_p->sendsFailed;
+        stats_p->msgsReceived += contextStats_p->msgsReceived;
+        stats_p->bytesReceived += contextStats_p->bytesReceived;
+    }
+    for ( i = 0; i < fleet_p->numSessions; i++ ) {
+        if ( fleet_p->sessions_p[i].profile == profile && fleet_p->sessions_p[i].client_p->state == CONNMGR_STATE_UP ) {
+            stats_p->sessionsUp++;
+        }
+    }
+    stats_p->churns = fleet_p->churns[profile];
+}
+
+/*****************************************************************************
+ * fleet_destroy
+ *****************************************************************************/
+void
+fleet_destroy ( struct fleet *fleet_p )
+{
+    struct fleetContext *fleetContext_p;
+    int             i;
+
+    /* Stop publishing everywhere before any Session goes away. */
+    for ( i = 0; i < fleet_p->numContexts; i++ ) {
+        fleetContext_p = &fleet_p->contexts_p[i];
+        if ( fleetContext_p->timerId != SOLCLIENT_CONTEXT_TIMER_ID_INVALID ) {
+            solClient_context_stopTimer ( fleetContext_p->context_p, &fleetContext_p->timerId );
+        }
+    }
+    for ( i = 0; i < fleet_p->numContexts; i++ ) {
+        fleetContext_p = &fleet_p->contexts_p[i];
+        if ( fleetContext_p->mgrInitialized ) {
+            connmgr_destroy ( &fleetContext_p->mgr );
+        }
+        if ( fleetContext_p->msg_p != NULL ) {
+            solClient_msg_free ( &fleetContext_p->msg_p );
+        }
+        solClient_context_destroy ( &fleetContext_p->context_p );
+    }
+    free ( fleet_p->contexts_p );
+    free ( fleet_p->sessions_p );
+    free ( fleet_p->payload_p );
+    memset ( fleet_p, 0, sizeof ( *fleet_p ) );
+}
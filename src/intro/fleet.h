@@ -0,0 +1,167 @@
+/** example Intro/fleet.h
+ */
+
+/**
+ *
+ * file fleet.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a client fleet: thousands of lightweight
+ * Sessions in one process, dealt out over a few Contexts, each following a
+ * scripted profile:
+ *
+ *   NAME:SESSIONS:SUBS:RATE:SIZE[:CHURN]
+ *
+ * SESSIONS Sessions of the profile each publish RATE Direct messages per
+ * second of SIZE bytes to fleet/NAME/<n>, and subscribe to the topics of the
+ * SUBS Sessions of the profile that follow them, so every message reaches
+ * SUBS subscribers. A Session that is dropped is reconnected by the
+ * Context's connection manager (see connmgr.h); with CHURN, it is also
+ * disconnected and reconnected every CHURN seconds.
+ *
+ * Publishing is open loop from one timer per Context: a message that would
+ * block is counted and dropped, not queued. The traffic counters are kept
+ * per Context and profile, written by the Context thread only, and summed
+ * on demand.
+ */
+
+#ifndef FLEET_H_
+#define FLEET_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "connmgr.h"
+
+#define FLEET_MAX_PROFILES      16
+#define FLEET_MAX_CONTEXTS      64
+#define FLEET_MAX_NAME          32
+#define FLEET_TICK_MS           10
+
+/**
+ * @struct fleetProfile
+ */
+struct fleetProfile
+{
+    char            name[FLEET_MAX_NAME];
+    int             numSessions;
+    int             numSubs;
+    double          msgRate;            /**< Messages per second per Session. */
+    int             payloadSize;
+    int             churnSec;           /**< Reconnect every churnSec seconds, 0 for never. */
+};
+
+/**
+ * @struct fleetStats
+ * Counters of one profile.
+ */
+struct fleetStats
+{
+    solClient_uint32_t sessions;
+    solClient_uint32_t sessionsUp;
+    solClient_uint64_t msgsSent;
+    solClient_uint64_t bytesSent;
+    solClient_uint64_t sendsBlocked;    /**< Dropped for ::SOLCLIENT_WOULD_BLOCK. */
+    solClient_uint64_t sendsFailed;
+    solClient_uint64_t msgsReceived;
+    solClient_uint64_t bytesReceived;
+    solClient_uint64_t churns;          /**< Scripted reconnects. */
+};
+
+struct fleet;
+struct fleetContext;
+
+/**
+ * @struct fleetSession
+ */
+struct fleetSession
+{
+    struct fleetContext *fleetContext_p;
+    struct connmgrClient *client_p;
+    int             profile;
+    char            topic[FLEET_MAX_NAME + 24];
+    double          credit;             /**< Messages due but not yet sent. */
+    unsigned long long nextChurnNs;
+};
+
+/**
+ * @struct fleetContext
+ */
+struct fleetContext
+{
+    struct fleet   *fleet_p;
+    int             index;
+    solClient_opaqueContext_pt context_p;
+    struct connmgr  mgr;
+    int             mgrInitialized;
+    solClient_context_timerId_t timerId;
+    solClient_opaqueMsg_pt msg_p;       /**< Reused for every send of the Context. */
+    struct fleetStats stats[FLEET_MAX_PROFILES];
+};
+
+/**
+ * @struct fleet
+ */
+struct fleet
+{
+    struct fleetProfile profiles[FLEET_MAX_PROFILES];
+    int             numProfiles;
+    struct fleetContext *contexts_p;
+    int             numContexts;
+    struct fleetSession *sessions_p;    /**< Session i is on Context i % numContexts. */
+    int             numSessions;
+    char           *payload_p;
+    solClient_uint64_t churns[FLEET_MAX_PROFILES];      /**< Counted by fleet_churn(). */
+};
+
+
+/**
+ * Parse a profile, NAME:SESSIONS:SUBS:RATE:SIZE[:CHURN].
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    fleet_parseProfile ( const char *spec_p, struct fleetProfile *profile_p );
+
+/**
+ * Create the Contexts, their connection managers and the Sessions of every
+ * profile, with their subscriptions. Nothing is connected yet.
+ * @param fleet_p The fleet to initialize.
+ * @param profiles_p The profiles.
+ * @param numProfiles Number of profiles, up to ::FLEET_MAX_PROFILES.
+ * @param numContexts Number of Contexts, up to ::FLEET_MAX_CONTEXTS.
+ * @param commonOpts The host, credentials and other Session options.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    fleet_init ( struct fleet *fleet_p, const struct fleetProfile *profiles_p, int numProfiles, int numContexts,
+                 struct commonOptions *commonOpts );
+
+/**
+ * Connect the fleet and start publishing.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    fleet_start ( struct fleet *fleet_p );
+
+/**
+ * Reconnect the Sessions whose churn interval has passed. Call it from an
+ * application thread, about once a second.
+ */
+void
+    fleet_churn ( struct fleet *fleet_p );
+
+/**
+ * Sum the counters of a profile over the Contexts.
+ */
+void
+    fleet_getStats ( struct fleet *fleet_p, int profile, struct fleetStats *stats_p );
+
+/**
+ * Destroy the Sessions and Contexts and free the fleet.
+ */
+void
+    fleet_destroy ( struct fleet *fleet_p );
+
+#endif /* FLEET_H_ */
@@ -0,0 +1,374 @@
+
+/** example Intro/hedge.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Hedged Direct requests with a percentile delay and a hedge budget. See
+ * hedge.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "hedge.h"
+
+#define HEDGE_SLOT_FREE             0
+#define HEDGE_SLOT_WAITING          1
+#define HEDGE_SLOT_DONE             2
+
+#define HEDGE_CORRELATION_PREFIX    "hedge/"
+
+
+/*****************************************************************************
+ * hedge_compareNs
+ *****************************************************************************/
+static int
+hedge_compareNs ( const void *a_p, const void *b_p )
+{
+    unsigned long long a = *( const unsigned long long * ) a_p;
+    unsigned long long b = *( const unsigned long long * ) b_p;
+
+    return ( a < b ) ? -1 : ( a > b ) ? 1 : 0;
+}
+
+/*****************************************************************************
+ * hedge_policyInit
+ *****************************************************************************/
+void
+hedge_policyInit ( struct hedgePolicy *policy_p )
+{
+    memset ( policy_p, 0, sizeof ( *policy_p ) );
+    policy_p->percentile = HEDGE_DEFAULT_PERCENTILE;
+    policy_p->budgetPercent = HEDGE_DEFAULT_BUDGET_PERCENT;
+    policy_p->minDelayNs = HEDGE_DEFAULT_MIN_DELAY_US * 1000ULL;
+}
+
+/*****************************************************************************
+ * hedge_policyOnRequest
+ *****************************************************************************/
+void
+hedge_policyOnRequest ( struct hedgePolicy *policy_p )
+{
+    policy_p->credit += policy_p->budgetPercent;
+    if ( policy_p->credit > HEDGE_BUDGET_BURST * 100 ) {
+        policy_p->credit = HEDGE_BUDGET_BURST * 100;
+    }
+}
+
+/*****************************************************************************
+ * hedge_policyTryHedge
+ *****************************************************************************/
+int
+hedge_policyTryHedge ( struct hedgePolicy *policy_p )
+{
+    if ( policy_p->credit < 100 ) {
+        return 0;
+    }
+    policy_p->credit -= 100;
+    return 1;
+}
+
+/*****************************************************************************
+ * hedge_policyRecord
+ *
+ * The latency of a hedged request is that of the first reply, so a slow
+ * primary is only seen up to the delay plus the alternate's latency; the
+ * budget bounds how far that can pull the delay down.
+ *****************************************************************************/
+void
+hedge_policyRecord ( struct hedgePolicy *policy_p, unsigned long long latencyNs )
+{
+    unsigned long long sorted[HEDGE_LATENCY_SAMPLES];
+    unsigned int    rank;
+
+    policy_p->samples[policy_p->nextSample] = latencyNs;
+    policy_p->nextSample = ( policy_p->nextSample + 1 ) % HEDGE_LATENCY_SAMPLES;
+    if ( policy_p->numSamples < HEDGE_LATENCY_SAMPLES ) {
+        policy_p->numSamples++;
+    }
+    if ( ++policy_p->sinceUpdate < HEDGE_UPDATE_INTERVAL ) {
+        return;
+    }
+    policy_p->sinceUpdate = 0;
+
+    memcpy ( sorted, policy_p->samples, policy_p->numSamples * sizeof ( sorted[0] ) );
+    qsort ( sorted, policy_p->numSamples, sizeof ( sorted[0] ), hedge_compareNs );
+    rank = policy_p->numSamples * policy_p->percentile / 100;
+    if ( rank >= policy_p->numSamples ) {
+        rank = policy_p->numSamples - 1;
+    }
+    policy_p->delayNs = ( sorted[rank] > policy_p->minDelayNs ) ? sorted[rank] : policy_p->minDelayNs;
+}
+
+
+/*****************************************************************************
+ * hedge_send
+ *
+ * Sends one copy of a request, tagged with its slot, id and whether it is
+ * the hedge.
+ *****************************************************************************/
+static          solClient_returnCode_t
+hedge_send ( struct hedgeRequestor *req_p, solClient_opaqueMsg_pt msg_p, unsigned int slot, solClient_uint64_t id,
+             const char *topic_p, char kind )
+{
+    solClient_returnCode_t rc;
+    solClient_destination_t destination;
+    char            correlationId[64];
+
+    sprintf ( correlationId, HEDGE_CORRELATION_PREFIX "%u/%llu/%c", slot, ( unsigned long long ) id, kind );
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = topic_p;
+    if ( ( rc = solClient_msg_setDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setDestination()" );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_setCorrelationId ( msg_p, correlationId ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setCorrelationId()" );
+        return rc;
+    }
+    /* A zero timeout sends without waiting; the reply comes to the receive callback. */
+    rc = solClient_session_sendRequest ( req_p->session_p, msg_p, NULL, 0 );
+    return ( rc == SOLCLIENT_IN_PROGRESS ) ? SOLCLIENT_OK : rc;
+}
+
+/*****************************************************************************
+ * hedge_wait
+ *
+ * Waits until the slot is answered or the deadline passes.
+ *****************************************************************************/
+static void
+hedge_wait ( struct hedgeRequestor *req_p, struct hedgeSlot *slot_p, unsigned long long deadlineNs )
+{
+    unsigned long long nowNs;
+    int             state;
+
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &req_p->lock );
+        state = slot_p->state;
+        OS_MUTEX_UNLOCK ( &req_p->lock );
+        nowNs = os_getTimeNs (  );
+        if ( state == HEDGE_SLOT_DONE || nowNs >= deadlineNs ) {
+            return;
+        }
+        os_eventWaitUs ( &slot_p->done, ( deadlineNs - nowNs + 999ULL ) / 1000ULL );
+    }
+}
+
+
+/*****************************************************************************
+ * hedge_init
+ *****************************************************************************/
+solClient_returnCode_t
+hedge_init ( struct hedgeRequestor *req_p, solClient_opaqueSession_pt session_p,
+             const char *primaryTopic_p, const char *alternateTopic_p, unsigned int maxOutstanding )
+{
+    unsigned int    i;
+
+    memset ( req_p, 0, sizeof ( *req_p ) );
+    req_p->maxOutstanding = ( maxOutstanding != 0 ) ? maxOutstanding : HEDGE_DEFAULT_MAX_OUTSTANDING;
+    if ( ( req_p->slots_p = ( struct hedgeSlot * ) calloc ( req_p->maxOutstanding, sizeof ( struct hedgeSlot ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "hedge_init() could not allocate %u slots", req_p->maxOutstanding );
+        return SOLCLIENT_FAIL;
+    }
+    for ( i = 0; i < req_p->maxOutstanding; i++ ) {
+        if ( os_eventInit ( &req_p->slots_p[i].done ) != 0 ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "hedge_init() could not create an event" );
+            while ( i-- > 0 ) {
+                os_eventDestroy ( &req_p->slots_p[i].done );
+            }
+            free ( req_p->slots_p );
+            req_p->slots_p = NULL;
+            return SOLCLIENT_FAIL;
+        }
+    }
+    OS_MUTEX_INIT ( &req_p->lock );
+    req_p->session_p = session_p;
+    req_p->primaryTopic_p = primaryTopic_p;
+    req_p->alternateTopic_p = alternateTopic_p;
+    hedge_policyInit ( &req_p->policy );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * hedge_request
+ *****************************************************************************/
+solClient_returnCode_t
+hedge_request ( struct hedgeRequestor *req_p, solClient_opaqueMsg_pt msg_p, solClient_uint32_t timeoutMs,
+                solClient_opaqueMsg_pt * replyMsg_pp )
+{
+    solClient_returnCode_t rc;
+    struct hedgeSlot *slot_p = NULL;
+    solClient_uint64_t id;
+    unsigned long long delayNs;
+    unsigned long long deadlineNs;
+    unsigned int    slot;
+    int             hedge = 0;
+
+    *replyMsg_pp = NULL;
+    OS_MUTEX_LOCK ( &req_p->lock );
+    for ( slot = 0; slot < req_p->maxOutstanding; slot++ ) {
+        if ( req_p->slots_p[slot].state == HEDGE_SLOT_FREE ) {
+            slot_p = &req_p->slots_p[slot];
+            break;
+        }
+    }
+    if ( slot_p == NULL ) {
+        OS_MUTEX_UNLOCK ( &req_p->lock );
+        return SOLCLIENT_WOULD_BLOCK;
+    }
+    id = ++req_p->nextId;
+    slot_p->id = id;
+    slot_p->state = HEDGE_SLOT_WAITING;
+    slot_p->hedgeWon = 0;
+    slot_p->reply_p = NULL;
+    req_p->stats.requests++;
+    hedge_policyOnRequest ( &req_p->policy );
+    delayNs = ( req_p->alternateTopic_p != NULL ) ? req_p->policy.delayNs : 0;
+    OS_MUTEX_UNLOCK ( &req_p->lock );
+    /* Clear a signal left over from a reply to the slot's previous request. */
+    os_eventWait ( &slot_p->done, 0 );
+
+    slot_p->sentNs = os_getTimeNs (  );
+    deadlineNs = slot_p->sentNs + ( unsigned long long ) timeoutMs * 1000000ULL;
+    if ( ( rc = hedge_send ( req_p, msg_p, slot, id, req_p->primaryTopic_p, 'p' ) ) != SOLCLIENT_OK ) {
+        OS_MUTEX_LOCK ( &req_p->lock );
+        req_p->stats.errors++;
+        slot_p->state = HEDGE_SLOT_FREE;
+        OS_MUTEX_UNLOCK ( &req_p->lock );
+        return rc;
+    }
+
+    if ( delayNs != 0 && slot_p->sentNs + delayNs < deadlineNs ) {
+        hedge_wait ( req_p, slot_p, slot_p->sentNs + delayNs );
+        OS_MUTEX_LOCK ( &req_p->lock );
+        if ( slot_p->state == HEDGE_SLOT_WAITING ) {
+            if ( hedge_policyTryHedge ( &req_p->policy ) ) {
+                hedge = 1;
+                req_p->stats.hedged++;
+            } else {
+                req_p->stats.budgetDenied++;
+            }
+        }
+        OS_MUTEX_UNLOCK ( &req_p->lock );
+        /* A failed hedge leaves the primary to answer. */
+        if ( hedge && hedge_send ( req_p, msg_p, slot, id, req_p->alternateTopic_p, 'h' ) != SOLCLIENT_OK ) {
+            OS_MUTEX_LOCK ( &req_p->lock );
+            req_p->stats.errors++;
+            OS_MUTEX_UNLOCK ( &req_p->lock );
+        }
+    }
+    hedge_wait ( req_p, slot_p, deadlineNs );
+
+    OS_MUTEX_LOCK ( &req_p->lock );
+    if ( slot_p->state == HEDGE_SLOT_DONE ) {
+        *replyMsg_pp = slot_p->reply_p;
+        hedge_policyRecord ( &req_p->policy, os_getTimeNs (  ) - slot_p->sentNs );
+        if ( slot_p->hedgeWon ) {
+            req_p->stats.hedgeWins++;
+        }
+        rc = SOLCLIENT_OK;
+    } else {
+        req_p->stats.timeouts++;
+        rc = SOLCLIENT_INCOMPLETE;
+    }
+    slot_p->state = HEDGE_SLOT_FREE;
+    slot_p->reply_p = NULL;
+    OS_MUTEX_UNLOCK ( &req_p->lock );
+    return rc;
+}
+
+/*****************************************************************************
+ * hedge_handleReply
+ *****************************************************************************/
+int
+hedge_handleReply ( struct hedgeRequestor *req_p, solClient_opaqueMsg_pt msg_p )
+{
+    const char     *correlationId_p;
+    char           *end_p;
+    struct hedgeSlot *slot_p;
+    unsigned long   slot;
+    unsigned long long id;
+    int             verdict = HEDGE_REPLY_SUPPRESSED;
+
+    if ( !solClient_msg_isReplyMsg ( msg_p ) ||
+         solClient_msg_getCorrelationId ( msg_p, &correlationId_p ) != SOLCLIENT_OK ||
+         strncmp ( correlationId_p, HEDGE_CORRELATION_PREFIX, sizeof ( HEDGE_CORRELATION_PREFIX ) - 1 ) != 0 ) {
+        return HEDGE_REPLY_OTHER;
+    }
+    slot = strtoul ( correlationId_p + sizeof ( HEDGE_CORRELATION_PREFIX ) - 1, &end_p, 10 );
+    if ( *end_p != '/' ) {
+        return HEDGE_REPLY_OTHER;
+    }
+    id = strtoull ( end_p + 1, &end_p, 10 );
+    if ( *end_p != '/' || slot >= req_p->maxOutstanding ) {
+        return HEDGE_REPLY_OTHER;
+    }
+
+    slot_p = &req_p->slots_p[slot];
+    OS_MUTEX_LOCK ( &req_p->lock );
+    if ( slot_p->state == HEDGE_SLOT_WAITING && slot_p->id == id ) {
+        slot_p->state = HEDGE_SLOT_DONE;
+        slot_p->reply_p = msg_p;
+        slot_p->hedgeWon = ( end_p[1] == 'h' );
+        verdict = HEDGE_REPLY_TAKEN;
+    } else {
+        req_p->stats.suppressed++;
+    }
+    OS_MUTEX_UNLOCK ( &req_p->lock );
+    if ( verdict == HEDGE_REPLY_TAKEN ) {
+        os_eventSignal ( &slot_p->done );
+    }
+    return verdict;
+}
+
+/*****************************************************************************
+ * hedge_rxCallback
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+hedge_rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p )
+{
+    if ( hedge_handleReply ( ( struct hedgeRequestor * ) user_p, msg_p ) == HEDGE_REPLY_TAKEN ) {
+        return SOLCLIENT_CALLBACK_TAKE_MSG;
+    }
+    return SOLCLIENT_CALLBACK_OK;
+}
+
+/*****************************************************************************
+ * hedge_getStats
+ *****************************************************************************/
+void
+hedge_getStats ( struct hedgeRequestor *req_p, struct hedgeStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &req_p->lock );
+    *stats_p = req_p->stats;
+    OS_MUTEX_UNLOCK ( &req_p->lock );
+}
+
+/*****************************************************************************
+ * hedge_destroy
+ *****************************************************************************/
+void
+hedge_destroy ( struct hedgeRequestor *req_p )
+{
+    unsigned int    i;
+
+    for ( i = 0; i < req_p->maxOutstanding; i++ ) {
+        if ( req_p->slots_p[i].reply_p != NULL ) {
+            solClient_msg_free ( &req_p->slots_p[i].reply_p );
+        }
+        os_eventDestroy ( &req_p->slots_p[i].done );
+    }
+    OS_MUTEX_DESTROY ( &req_p->lock );
+    free ( req_p->slots_p );
+    req_p->slots_p = NULL;
+}
@@ -0,0 +1,185 @@
+/** example Intro/hedge.h
+ */
+
+/**
+ *
+ * file hedge.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a hedging requestor for Direct request/reply.
+ * hedge_request() sends a request to the primary topic and, if no reply has
+ * arrived after a delay taken from a percentile of recent reply latencies,
+ * sends the same request to an alternate topic served by other repliers.
+ * The first reply is returned; the other one is recognized by its
+ * correlation ID and dropped.
+ *
+ * Hedges are budgeted: every request earns budgetPercent hundredths of a
+ * hedge, at most HEDGE_BUDGET_BURST hedges are saved up, and a request
+ * without credit waits for its primary reply only. Hedging starts once
+ * HEDGE_UPDATE_INTERVAL latencies have been measured.
+ *
+ * The delay and budget are kept in a struct hedgePolicy, which can also be
+ * driven on its own with simulated latencies.
+ */
+
+#ifndef HEDGE_H_
+#define HEDGE_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define HEDGE_LATENCY_SAMPLES           1024    /**< Recent latencies the delay is taken from. */
+#define HEDGE_UPDATE_INTERVAL           64      /**< Latencies between recomputations of the delay. */
+#define HEDGE_BUDGET_BURST              10      /**< Hedges that can be saved up. */
+#define HEDGE_DEFAULT_PERCENTILE        95
+#define HEDGE_DEFAULT_BUDGET_PERCENT    5
+#define HEDGE_DEFAULT_MIN_DELAY_US      100
+#define HEDGE_DEFAULT_MAX_OUTSTANDING   64
+
+#define HEDGE_REPLY_OTHER               0       /**< Not a reply to a hedged request. */
+#define HEDGE_REPLY_TAKEN               1       /**< Handed to the waiting request; keep the message. */
+#define HEDGE_REPLY_SUPPRESSED          2       /**< The slower copy, or too late; dropped. */
+
+/**
+ * @struct hedgeStats
+ */
+struct hedgeStats
+{
+    solClient_uint64_t requests;
+    solClient_uint64_t hedged;          /**< Requests also sent to the alternate topic. */
+    solClient_uint64_t hedgeWins;       /**< Hedged requests answered first by the alternate. */
+    solClient_uint64_t budgetDenied;    /**< Requests past the delay that had no credit to hedge. */
+    solClient_uint64_t suppressed;      /**< Replies dropped as late or duplicate. */
+    solClient_uint64_t timeouts;
+    solClient_uint64_t errors;
+};
+
+/**
+ * @struct hedgePolicy
+ * When to hedge. Not locked; a hedgeRequestor holds its lock around it.
+ */
+struct hedgePolicy
+{
+    unsigned int    percentile;         /**< Of recent latencies, 1 to 99. */
+    unsigned int    budgetPercent;      /**< Hedges per 100 requests, 0 to disable. */
+    unsigned long long minDelayNs;      /**< Never hedge sooner than this. */
+    unsigned long long delayNs;         /**< Current delay, 0 until enough latencies are known. */
+    unsigned long long samples[HEDGE_LATENCY_SAMPLES];
+    unsigned int    numSamples;
+    unsigned int    nextSample;
+    unsigned int    sinceUpdate;
+    unsigned int    credit;             /**< In hundredths of a hedge. */
+};
+
+struct hedgeSlot
+{
+    solClient_uint64_t id;
+    int             state;
+    int             hedgeWon;
+    unsigned long long sentNs;
+    solClient_opaqueMsg_pt reply_p;
+    OS_EVENT        done;
+};
+
+/**
+ * @struct hedgeRequestor
+ */
+struct hedgeRequestor
+{
+    OS_MUTEX        lock;
+    solClient_opaqueSession_pt session_p;
+    const char     *primaryTopic_p;
+    const char     *alternateTopic_p;   /**< NULL to never hedge. */
+    struct hedgeSlot *slots_p;
+    unsigned int    maxOutstanding;
+    solClient_uint64_t nextId;
+    struct hedgePolicy policy;
+    struct hedgeStats stats;
+};
+
+
+/**
+ * Set a policy to its defaults, with no latencies known.
+ */
+void
+    hedge_policyInit ( struct hedgePolicy *policy_p );
+
+/**
+ * Count a request towards the hedge budget.
+ */
+void
+    hedge_policyOnRequest ( struct hedgePolicy *policy_p );
+
+/**
+ * Spend credit for one hedge.
+ * @return 1 if the request may be hedged, 0 if the budget is spent.
+ */
+int
+    hedge_policyTryHedge ( struct hedgePolicy *policy_p );
+
+/**
+ * Record the latency of an answered request, measured from its first send,
+ * and recompute the delay every HEDGE_UPDATE_INTERVAL latencies.
+ */
+void
+    hedge_policyRecord ( struct hedgePolicy *policy_p, unsigned long long latencyNs );
+
+/**
+ * Set up a requestor. The Session's receive callback must pass replies to
+ * hedge_handleReply(), or be hedge_rxCallback() with the requestor as user_p.
+ * @param req_p The requestor to initialize.
+ * @param session_p A connected Session.
+ * @param primaryTopic_p The topic every request is sent to first.
+ * @param alternateTopic_p The topic hedges are sent to, NULL for none.
+ * @param maxOutstanding Concurrent hedge_request() calls, 0 for the default.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    hedge_init ( struct hedgeRequestor *req_p, solClient_opaqueSession_pt session_p,
+                 const char *primaryTopic_p, const char *alternateTopic_p, unsigned int maxOutstanding );
+
+/**
+ * Send a request and wait for the first reply, hedging as the policy allows.
+ * The message's destination and correlation ID are overwritten. Call from
+ * application threads, never from a Context callback.
+ * @param req_p The requestor.
+ * @param msg_p The request message.
+ * @param timeoutMs Time to wait for a reply.
+ * @param replyMsg_pp Receives the reply, which the caller frees with solClient_msg_free().
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_INCOMPLETE on timeout, ::SOLCLIENT_WOULD_BLOCK when
+ * maxOutstanding requests are in progress, or the error of the send.
+ */
+solClient_returnCode_t
+    hedge_request ( struct hedgeRequestor *req_p, solClient_opaqueMsg_pt msg_p, solClient_uint32_t timeoutMs,
+                    solClient_opaqueMsg_pt * replyMsg_pp );
+
+/**
+ * Match a received message against the requests in progress.
+ * @return ::HEDGE_REPLY_OTHER, ::HEDGE_REPLY_TAKEN (the receive callback must
+ * return ::SOLCLIENT_CALLBACK_TAKE_MSG) or ::HEDGE_REPLY_SUPPRESSED.
+ */
+int
+    hedge_handleReply ( struct hedgeRequestor *req_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * A receive callback for a requestor's Session, with the requestor as
+ * user_p. Other messages are dropped.
+ */
+solClient_rxMsgCallback_returnCode_t
+    hedge_rxCallback ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p, void *user_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    hedge_getStats ( struct hedgeRequestor *req_p, struct hedgeStats *stats_p );
+
+/**
+ * Free a requestor once its Session can no longer deliver replies.
+ */
+void
+    hedge_destroy ( struct hedgeRequestor *req_p );
+
+#endif /* HEDGE_H_ */
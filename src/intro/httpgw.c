@@ -0,0 +1,1087 @@
+
+/** example Intro/httpgw.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * HTTP/1.1 ingestion gateway. See httpgw.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "httpgw.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <strings.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define HTTPGW_TAG_LISTEN       0xffffffffU
+#define HTTPGW_TAG_WAKE         0xfffffffeU
+#define HTTPGW_IN_SIZE          65536
+#define HTTPGW_OUT_SIZE         4096
+#define HTTPGW_MAX_EVENTS       256
+#define HTTPGW_MAX_FIELD        128     /* Content-Type and Content-Encoding. */
+
+/*****************************************************************************
+ * httpgw_statusText
+ *****************************************************************************/
+static const char *
+httpgw_statusText ( int status )
+{
+    switch ( status ) {
+        case 200:
+            return "OK";
+        case 202:
+            return "Accepted";
+        case 400:
+            return "Bad Request";
+        case 404:
+            return "Not Found";
+        case 405:
+            return "Method Not Allowed";
+        case 411:
+            return "Length Required";
+        case 413:
+            return "Payload Too Large";
+        case 502:
+            return "Bad Gateway";
+        default:
+            return "Service Unavailable";
+    }
+}
+
+/*****************************************************************************
+ * httpgw_sessionSend
+ *****************************************************************************/
+static          solClient_returnCode_t
+httpgw_sessionSend ( solClient_opaqueMsg_pt * msgs_p, solClient_uint32_t count, solClient_uint32_t * sent_p,
+                     void *user_p )
+{
+    return solClient_session_sendMultipleMsg ( ( solClient_opaqueSession_pt ) user_p, msgs_p, count, sent_p );
+}
+
+/*****************************************************************************
+ * httpgw_touch
+ *****************************************************************************/
+static void
+httpgw_touch ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    if ( !gw_p->conns_p[conn].touched ) {
+        gw_p->conns_p[conn].touched = 1;
+        gw_p->touched_p[gw_p->touchedCount++] = conn;
+    }
+}
+
+/*****************************************************************************
+ * httpgw_allocRequest
+ *****************************************************************************/
+static          solClient_uint32_t
+httpgw_allocRequest ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    struct httpgwRequest *request_p;
+    solClient_uint32_t index = gw_p->freeRequest;
+
+    if ( index == HTTPGW_NONE ) {
+        return HTTPGW_NONE;
+    }
+    request_p = &gw_p->requests_p[index];
+    gw_p->freeRequest = request_p->next;
+    request_p->conn = conn;
+    request_p->status = 0;
+    request_p->close = 0;
+    request_p->next = HTTPGW_NONE;
+    if ( conn_p->tail == HTTPGW_NONE ) {
+        conn_p->head = index;
+    } else {
+        gw_p->requests_p[conn_p->tail].next = index;
+    }
+    conn_p->tail = index;
+    if ( ++gw_p->stats.inFlight > gw_p->stats.maxInFlightSeen ) {
+        gw_p->stats.maxInFlightSeen = gw_p->stats.inFlight;
+    }
+    return index;
+}
+
+/*****************************************************************************
+ * httpgw_freeRequest
+ *****************************************************************************/
+static void
+httpgw_freeRequest ( struct httpgw *gw_p, solClient_uint32_t index )
+{
+    gw_p->requests_p[index].conn = HTTPGW_NONE;
+    gw_p->requests_p[index].next = gw_p->freeRequest;
+    gw_p->freeRequest = index;
+    gw_p->stats.inFlight--;
+}
+
+/*****************************************************************************
+ * httpgw_setEvents
+ *
+ * Reading unless closing, writing while output is pending.
+ *****************************************************************************/
+static void
+httpgw_setEvents ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    struct epoll_event event;
+
+    event.events = ( conn_p->closing ? 0 : EPOLLIN ) | ( ( conn_p->outStart < conn_p->outEnd ) ? EPOLLOUT : 0 );
+    event.data.u32 = conn;
+    if ( event.events != conn_p->events ) {
+        epoll_ctl ( gw_p->epollFd, EPOLL_CTL_MOD, conn_p->fd, &event );
+        conn_p->events = event.events;
+    }
+}
+
+/*****************************************************************************
+ * httpgw_flush
+ *
+ * Send the batch. Persistent messages sent wait for their acknowledgement.
+ *****************************************************************************/
+static void
+httpgw_flush ( struct httpgw *gw_p )
+{
+    solClient_returnCode_t rc;
+    struct httpgwRequest *request_p;
+    solClient_uint32_t sent = 0;
+    solClient_uint32_t i;
+
+    if ( gw_p->batchCount == 0 ) {
+        return;
+    }
+    if ( ( rc = gw_p->send_p ( gw_p->batch, gw_p->batchCount, &sent, gw_p->sendUser_p ) ) != SOLCLIENT_OK ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "Sent %u of %u messages, rc %s", sent, gw_p->batchCount,
+                        solClient_returnCodeToString ( rc ) );
+    }
+    gw_p->stats.batches++;
+    gw_p->stats.sent += sent;
+    for ( i = 0; i < gw_p->batchCount; i++ ) {
+        request_p = &gw_p->requests_p[gw_p->batchRequests[i]];
+        gw_p->conns_p[request_p->conn].batched = 0;
+        if ( i >= sent ) {
+            request_p->status = 503;
+            gw_p->stats.sendFailed++;
+        } else if ( !gw_p->persistent ) {
+            request_p->status = 202;
+        } else {
+            continue;
+        }
+        httpgw_touch ( gw_p, request_p->conn );
+    }
+    gw_p->batchCount = 0;
+}
+
+/*****************************************************************************
+ * httpgw_close
+ *****************************************************************************/
+static void
+httpgw_close ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    solClient_uint32_t index;
+    solClient_uint32_t next;
+
+    if ( conn_p->batched ) {
+        httpgw_flush ( gw_p );
+    }
+    epoll_ctl ( gw_p->epollFd, EPOLL_CTL_DEL, conn_p->fd, NULL );
+    close ( conn_p->fd );
+    conn_p->fd = -1;
+    for ( index = conn_p->head; index != HTTPGW_NONE; index = next ) {
+        next = gw_p->requests_p[index].next;
+        if ( gw_p->requests_p[index].status == 0 ) {
+            /* Freed when its acknowledgement comes. */
+            gw_p->requests_p[index].conn = HTTPGW_NONE;
+        } else {
+            httpgw_freeRequest ( gw_p, index );
+        }
+    }
+    if ( conn_p->stalled ) {
+        gw_p->stalledCount--;
+    }
+    conn_p->head = conn_p->tail = HTTPGW_NONE;
+    conn_p->inStart = conn_p->inEnd = conn_p->outStart = conn_p->outEnd = 0;
+    conn_p->events = 0;
+    conn_p->closing = conn_p->ended = conn_p->continued = conn_p->stalled = 0;
+}
+
+/*****************************************************************************
+ * httpgw_append
+ *****************************************************************************/
+static          solClient_returnCode_t
+httpgw_append ( struct httpgwConn *conn_p, const char *text_p, solClient_uint32_t len )
+{
+    char           *out_p;
+    solClient_uint32_t size = conn_p->outSize;
+
+    if ( conn_p->outStart == conn_p->outEnd ) {
+        conn_p->outStart = conn_p->outEnd = 0;
+    }
+    if ( conn_p->outEnd + len > conn_p->outSize ) {
+        while ( conn_p->outEnd + len > size ) {
+            size *= 2;
+        }
+        if ( ( out_p = ( char * ) realloc ( conn_p->out_p, size ) ) == NULL ) {
+            return SOLCLIENT_FAIL;
+        }
+        conn_p->out_p = out_p;
+        conn_p->outSize = size;
+    }
+    memcpy ( conn_p->out_p + conn_p->outEnd, text_p, len );
+    conn_p->outEnd += len;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * httpgw_write
+ *
+ * Write what is pending; close once a closing connection has nothing left.
+ *****************************************************************************/
+static void
+httpgw_write ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    ssize_t         n;
+
+    while ( conn_p->outStart < conn_p->outEnd ) {
+        n = send ( conn_p->fd, conn_p->out_p + conn_p->outStart, conn_p->outEnd - conn_p->outStart, MSG_NOSIGNAL );
+        if ( n > 0 ) {
+            conn_p->outStart += ( solClient_uint32_t ) n;
+        } else if ( n < 0 && errno == EINTR ) {
+            continue;
+        } else if ( n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) ) {
+            break;
+        } else {
+            httpgw_close ( gw_p, conn );
+            return;
+        }
+    }
+    if ( conn_p->closing && conn_p->head == HTTPGW_NONE && conn_p->outStart == conn_p->outEnd &&
+         conn_p->inStart == conn_p->inEnd ) {
+        httpgw_close ( gw_p, conn );
+        return;
+    }
+    httpgw_setEvents ( gw_p, conn );
+}
+
+/*****************************************************************************
+ * httpgw_answer
+ *
+ * Answer the requests at the head of the queue that have their status.
+ *****************************************************************************/
+static void
+httpgw_answer ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    struct httpgwRequest *request_p;
+    solClient_uint32_t index;
+    char            text[128];
+    int             len;
+
+    while ( ( index = conn_p->head ) != HTTPGW_NONE && ( request_p = &gw_p->requests_p[index] )->status != 0 ) {
+        len = sprintf ( text, "HTTP/1.1 %d %s\r\nContent-Length: 0\r\n%s\r\n", request_p->status,
+                        httpgw_statusText ( request_p->status ), request_p->close ? "Connection: close\r\n" : "" );
+        if ( httpgw_append ( conn_p, text, ( solClient_uint32_t ) len ) != SOLCLIENT_OK ) {
+            httpgw_close ( gw_p, conn );
+            return;
+        }
+        if ( ( conn_p->head = request_p->next ) == HTTPGW_NONE ) {
+            conn_p->tail = HTTPGW_NONE;
+        }
+        httpgw_freeRequest ( gw_p, index );
+        gw_p->stats.answered++;
+    }
+    httpgw_write ( gw_p, conn );
+}
+
+/*****************************************************************************
+ * httpgw_drainAcks
+ *****************************************************************************/
+static void
+httpgw_drainAcks ( struct httpgw *gw_p )
+{
+    struct httpgwAck acks[256];
+    struct httpgwRequest *request_p;
+    solClient_uint64_t value;
+    solClient_uint32_t count;
+    solClient_uint32_t i;
+
+    if ( read ( gw_p->wakeFd, &value, sizeof ( value ) ) < 0 ) {
+        /* Nothing written since the last drain. */
+    }
+    do {
+        OS_MUTEX_LOCK ( &gw_p->lock );
+        for ( count = 0; count < 256 && gw_p->ackCount > 0; count++ ) {
+            acks[count] = gw_p->acks_p[gw_p->ackHead];
+            gw_p->ackHead = ( gw_p->ackHead + 1 ) % gw_p->maxInFlight;
+            gw_p->ackCount--;
+        }
+        OS_MUTEX_UNLOCK ( &gw_p->lock );
+
+        for ( i = 0; i < count; i++ ) {
+            request_p = &gw_p->requests_p[acks[i].request];
+            if ( acks[i].status == 200 ) {
+                gw_p->stats.acked++;
+            } else {
+                gw_p->stats.rejected++;
+            }
+            if ( request_p->conn == HTTPGW_NONE ) {
+                gw_p->stats.orphaned++;
+                httpgw_freeRequest ( gw_p, acks[i].request );
+                continue;
+            }
+            request_p->status = acks[i].status;
+            httpgw_touch ( gw_p, request_p->conn );
+        }
+    } while ( count == 256 );
+}
+
+/*****************************************************************************
+ * httpgw_findRoute
+ *
+ * The longest route prefix ending at a path segment.
+ *****************************************************************************/
+static struct httpgwRoute *
+httpgw_findRoute ( struct httpgw *gw_p, const char *path_p, solClient_uint32_t pathLen )
+{
+    struct httpgwRoute *best_p = NULL;
+    struct httpgwRoute *route_p;
+    solClient_uint32_t i;
+
+    for ( i = 0; i < gw_p->numRoutes; i++ ) {
+        route_p = &gw_p->routes[i];
+        if ( route_p->pathLen <= pathLen && memcmp ( route_p->path, path_p, route_p->pathLen ) == 0 &&
+             ( route_p->pathLen == pathLen || path_p[route_p->pathLen] == '/' ||
+               route_p->path[route_p->pathLen - 1] == '/' ) &&
+             ( best_p == NULL || route_p->pathLen > best_p->pathLen ) ) {
+            best_p = route_p;
+        }
+    }
+    return best_p;
+}
+
+/*****************************************************************************
+ * httpgw_buildMsg
+ *****************************************************************************/
+static          solClient_returnCode_t
+httpgw_buildMsg ( struct httpgw *gw_p, struct httpgwRequest *request_p, const char *topic_p,
+                  const char *body_p, solClient_uint32_t bodyLen, const char *type_p, const char *encoding_p )
+{
+    solClient_returnCode_t rc;
+    solClient_destination_t destination;
+
+    if ( request_p->msg_p == NULL ) {
+        if ( ( rc = solClient_msg_alloc ( &request_p->msg_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_alloc()" );
+            return rc;
+        }
+    } else if ( ( rc = solClient_msg_reset ( request_p->msg_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_reset()" );
+        return rc;
+    }
+    destination.destType = SOLCLIENT_TOPIC_DESTINATION;
+    destination.dest = topic_p;
+    if ( ( rc = solClient_msg_setDeliveryMode ( request_p->msg_p, gw_p->persistent ?
+                                                SOLCLIENT_DELIVERY_MODE_PERSISTENT :
+                                                SOLCLIENT_DELIVERY_MODE_DIRECT ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setDestination ( request_p->msg_p, &destination,
+                                               sizeof ( destination ) ) ) != SOLCLIENT_OK ||
+         ( bodyLen > 0 && ( rc = solClient_msg_setBinaryAttachmentPtr ( request_p->msg_p, ( void * ) body_p,
+                                                                        bodyLen ) ) != SOLCLIENT_OK ) ||
+         ( type_p[0] != '\0' && ( rc = solClient_msg_setHttpContentType ( request_p->msg_p, type_p ) ) != SOLCLIENT_OK ) ||
+         ( encoding_p[0] != '\0' &&
+           ( rc = solClient_msg_setHttpContentEncoding ( request_p->msg_p, encoding_p ) ) != SOLCLIENT_OK ) ||
+         ( rc = solClient_msg_setCorrelationTagPtr ( request_p->msg_p, request_p,
+                                                     sizeof ( *request_p ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_set...()" );
+        return rc;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * httpgw_copyField
+ *****************************************************************************/
+static void
+httpgw_copyField ( char *field_p, const char *value_p, solClient_uint32_t len )
+{
+    if ( len >= HTTPGW_MAX_FIELD ) {
+        len = 0;
+    }
+    memcpy ( field_p, value_p, len );
+    field_p[len] = '\0';
+}
+
+/*****************************************************************************
+ * httpgw_parse
+ *
+ * Take every complete request in the receive buffer.
+ *****************************************************************************/
+static void
+httpgw_parse ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    struct httpgwRequest *request_p;
+    struct httpgwRoute *route_p;
+    const char     *data_p;
+    const char     *line_p;
+    const char     *end_p;
+    const char     *colon_p;
+    const char     *value_p;
+    const char     *path_p;
+    char            topic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+    char            type[HTTPGW_MAX_FIELD];
+    char            encoding[HTTPGW_MAX_FIELD];
+    char           *in_p;
+    solClient_uint32_t avail;
+    solClient_uint32_t headerLen;
+    solClient_uint32_t bodyLen;
+    solClient_uint32_t pathLen;
+    solClient_uint32_t valueLen;
+    solClient_uint32_t index;
+    solClient_uint32_t size;
+    solClient_uint32_t i;
+    int             status;
+    int             keepAlive;
+    int             haveLength;
+    int             chunked;
+    int             expect;
+
+    while ( !conn_p->ended && conn_p->inStart < conn_p->inEnd ) {
+        if ( gw_p->freeRequest == HTTPGW_NONE ) {
+            if ( !conn_p->stalled ) {
+                conn_p->stalled = 1;
+                gw_p->stalledCount++;
+                gw_p->stats.stalls++;
+            }
+            return;
+        }
+        data_p = conn_p->in_p + conn_p->inStart;
+        avail = conn_p->inEnd - conn_p->inStart;
+
+        /* The header, up to the blank line. */
+        for ( headerLen = 0, i = 3; i < avail; i++ ) {
+            if ( data_p[i] == '\n' && data_p[i - 1] == '\r' && data_p[i - 2] == '\n' && data_p[i - 3] == '\r' ) {
+                headerLen = i + 1;
+                break;
+            }
+        }
+        status = 0;
+        keepAlive = 1;
+        haveLength = chunked = expect = 0;
+        bodyLen = 0;
+        type[0] = encoding[0] = '\0';
+        path_p = NULL;
+        pathLen = 0;
+        if ( headerLen == 0 ) {
+            if ( avail < HTTPGW_MAX_HEADER ) {
+                return;
+            }
+            status = 400;
+            goto answer;
+        }
+
+        /* The request line: METHOD SP target SP HTTP/1.x CRLF */
+        end_p = ( const char * ) memchr ( data_p, '\r', headerLen );
+        if ( ( line_p = ( const char * ) memchr ( data_p, ' ', end_p - data_p ) ) == NULL ||
+             ( value_p = ( const char * ) memchr ( line_p + 1, ' ', end_p - line_p - 1 ) ) == NULL ||
+             end_p - value_p != 9 || memcmp ( value_p + 1, "HTTP/1.", 7 ) != 0 || line_p[1] != '/' ) {
+            status = 400;
+            goto answer;
+        }
+        keepAlive = ( value_p[8] == '1' );
+        path_p = line_p + 1;
+        for ( pathLen = 0; path_p + pathLen < value_p && path_p[pathLen] != '?'; pathLen++ ) {
+        }
+        if ( line_p - data_p != 4 || memcmp ( data_p, "POST", 4 ) != 0 ) {
+            status = 405;
+        }
+
+        /* The header fields. */
+        for ( line_p = end_p + 2; line_p < data_p + headerLen - 2; line_p = end_p + 2 ) {
+            end_p = ( const char * ) memchr ( line_p, '\r', data_p + headerLen - line_p );
+            if ( ( colon_p = ( const char * ) memchr ( line_p, ':', end_p - line_p ) ) == NULL ) {
+                status = 400;
+                goto answer;
+            }
+            for ( value_p = colon_p + 1; value_p < end_p && ( *value_p == ' ' || *value_p == '\t' ); value_p++ ) {
+            }
+            valueLen = ( solClient_uint32_t ) ( end_p - value_p );
+            while ( valueLen > 0 && ( value_p[valueLen - 1] == ' ' || value_p[valueLen - 1] == '\t' ) ) {
+                valueLen--;
+            }
+            if ( colon_p - line_p == 14 && strncasecmp ( line_p, "Content-Length", 14 ) == 0 ) {
+                haveLength = 1;
+                for ( i = 0; i < valueLen; i++ ) {
+                    if ( value_p[i] < '0' || value_p[i] > '9' || bodyLen > ( HTTPGW_NONE - 9 ) / 10 ) {
+                        status = 400;
+                        goto answer;
+                    }
+                    bodyLen = bodyLen * 10 + ( solClient_uint32_t ) ( value_p[i] - '0' );
+                }
+            } else if ( colon_p - line_p == 17 && strncasecmp ( line_p, "Transfer-Encoding", 17 ) == 0 ) {
+                chunked = 1;
+            } else if ( colon_p - line_p == 10 && strncasecmp ( line_p, "Connection", 10 ) == 0 ) {
+                if ( valueLen == 5 && strncasecmp ( value_p, "close", 5 ) == 0 ) {
+                    keepAlive = 0;
+                } else if ( valueLen == 10 && strncasecmp ( value_p, "keep-alive", 10 ) == 0 ) {
+                    keepAlive = 1;
+                }
+            } else if ( colon_p - line_p == 12 && strncasecmp ( line_p, "Content-Type", 12 ) == 0 ) {
+                httpgw_copyField ( type, value_p, valueLen );
+            } else if ( colon_p - line_p == 16 && strncasecmp ( line_p, "Content-Encoding", 16 ) == 0 ) {
+                httpgw_copyField ( encoding, value_p, valueLen );
+            } else if ( colon_p - line_p == 6 && strncasecmp ( line_p, "Expect", 6 ) == 0 ) {
+                expect = ( valueLen == 12 && strncasecmp ( value_p, "100-continue", 12 ) == 0 );
+            }
+        }
+        if ( chunked ) {
+            /* Its end cannot be found without decoding it. */
+            status = 411;
+            goto answer;
+        }
+        if ( bodyLen > gw_p->maxBody ) {
+            status = 413;
+            goto answer;
+        }
+        if ( status == 0 && !haveLength ) {
+            status = 411;
+        }
+
+        /* The body, all of it in the buffer. */
+        if ( avail < headerLen + bodyLen ) {
+            if ( expect && !conn_p->continued && conn_p->head == HTTPGW_NONE && status == 0 ) {
+                conn_p->continued = 1;
+                httpgw_append ( conn_p, "HTTP/1.1 100 Continue\r\n\r\n", 25 );
+                httpgw_touch ( gw_p, conn );
+            }
+            if ( headerLen + bodyLen > conn_p->inSize - conn_p->inStart ) {
+                if ( conn_p->batched ) {
+                    httpgw_flush ( gw_p );
+                }
+                memmove ( conn_p->in_p, conn_p->in_p + conn_p->inStart, avail );
+                conn_p->inEnd = avail;
+                conn_p->inStart = 0;
+                for ( size = conn_p->inSize; size < headerLen + bodyLen; size *= 2 ) {
+                }
+                if ( size != conn_p->inSize ) {
+                    if ( ( in_p = ( char * ) realloc ( conn_p->in_p, size ) ) == NULL ) {
+                        status = 413;
+                        goto answer;
+                    }
+                    conn_p->in_p = in_p;
+                    conn_p->inSize = size;
+                }
+            }
+            return;
+        }
+
+        if ( status == 0 ) {
+            if ( ( route_p = httpgw_findRoute ( gw_p, path_p, pathLen ) ) == NULL ) {
+                status = 404;
+            } else {
+                /* The rest of the path, joined to the topic by one '/'. */
+                line_p = path_p + route_p->pathLen;
+                i = pathLen - route_p->pathLen;
+                if ( i > 0 && *line_p == '/' ) {
+                    line_p++;
+                    i--;
+                }
+                valueLen = route_p->topicLen;
+                if ( valueLen + 1 + i >= sizeof ( topic ) ) {
+                    status = 400;
+                } else {
+                    memcpy ( topic, route_p->topic, valueLen );
+                    if ( i > 0 ) {
+                        if ( topic[valueLen - 1] != '/' ) {
+                            topic[valueLen++] = '/';
+                        }
+                        memcpy ( topic + valueLen, line_p, i );
+                        valueLen += i;
+                    }
+                    topic[valueLen] = '\0';
+                }
+            }
+        }
+
+      answer:
+        /* A request that cannot be delimited ends the connection. */
+        if ( status == 400 || status == 413 || chunked ) {
+            keepAlive = 0;
+            bodyLen = 0;
+            headerLen = avail;
+        }
+        index = httpgw_allocRequest ( gw_p, conn );
+        request_p = &gw_p->requests_p[index];
+        request_p->close = !keepAlive;
+        gw_p->stats.requests++;
+        if ( status == 0 && httpgw_buildMsg ( gw_p, request_p, topic, data_p + headerLen, bodyLen, type,
+                                              encoding ) != SOLCLIENT_OK ) {
+            status = 503;
+        }
+        if ( status != 0 ) {
+            request_p->status = status;
+            if ( status < 500 ) {
+                gw_p->stats.refused++;
+            } else {
+                gw_p->stats.sendFailed++;
+            }
+            httpgw_touch ( gw_p, conn );
+        } else {
+            gw_p->stats.bodyBytes += bodyLen;
+            gw_p->batch[gw_p->batchCount] = request_p->msg_p;
+            gw_p->batchRequests[gw_p->batchCount++] = index;
+            conn_p->batched++;
+        }
+        conn_p->inStart += headerLen + bodyLen;
+        conn_p->continued = 0;
+        if ( !keepAlive ) {
+            conn_p->ended = conn_p->closing = 1;
+        }
+        if ( gw_p->batchCount == gw_p->batchMax ) {
+            httpgw_flush ( gw_p );
+        }
+    }
+}
+
+/*****************************************************************************
+ * httpgw_take
+ *
+ * Parse; once closing, what is left after the last whole request is dropped.
+ *****************************************************************************/
+static void
+httpgw_take ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+
+    httpgw_parse ( gw_p, conn );
+    if ( conn_p->closing && !conn_p->stalled ) {
+        conn_p->inStart = conn_p->inEnd;
+        httpgw_touch ( gw_p, conn );
+    }
+}
+
+/*****************************************************************************
+ * httpgw_read
+ *
+ * Read what the connection has, then take the requests in it.
+ *****************************************************************************/
+static void
+httpgw_read ( struct httpgw *gw_p, solClient_uint32_t conn )
+{
+    struct httpgwConn *conn_p = &gw_p->conns_p[conn];
+    ssize_t         n;
+    int             eof = 0;
+
+    /* Bodies in the batch stay where they are until sent. */
+    if ( conn_p->inStart == conn_p->inEnd && conn_p->inStart > 0 && !conn_p->batched ) {
+        conn_p->inStart = conn_p->inEnd = 0;
+    } else if ( conn_p->inEnd == conn_p->inSize && conn_p->inStart > 0 ) {
+        if ( conn_p->batched ) {
+            httpgw_flush ( gw_p );
+        }
+        memmove ( conn_p->in_p, conn_p->in_p + conn_p->inStart, conn_p->inEnd - conn_p->inStart );
+        conn_p->inEnd -= conn_p->inStart;
+        conn_p->inStart = 0;
+    }
+    while ( conn_p->inEnd < conn_p->inSize ) {
+        n = recv ( conn_p->fd, conn_p->in_p + conn_p->inEnd, conn_p->inSize - conn_p->inEnd, 0 );
+        if ( n > 0 ) {
+            conn_p->inEnd += ( solClient_uint32_t ) n;
+        } else if ( n == 0 ) {
+            eof = 1;
+            break;
+        } else if ( errno == EINTR ) {
+            continue;
+        } else if ( errno == EAGAIN || errno == EWOULDBLOCK ) {
+            break;
+        } else {
+            httpgw_close ( gw_p, conn );
+            return;
+        }
+    }
+    if ( eof ) {
+        /* Answer what was read, then close. */
+        conn_p->closing = 1;
+    }
+    httpgw_take ( gw_p, conn );
+}
+
+/*****************************************************************************
+ * httpgw_accept
+ *****************************************************************************/
+static void
+httpgw_accept ( struct httpgw *gw_p )
+{
+    struct httpgwConn *conn_p;
+    struct epoll_event event;
+    solClient_uint32_t conn;
+    int             fd;
+    int             one = 1;
+
+    while ( ( fd = accept ( gw_p->listenFd, NULL, NULL ) ) >= 0 ) {
+        fcntl ( fd, F_SETFL, fcntl ( fd, F_GETFL ) | O_NONBLOCK );
+        for ( conn = 0; conn < gw_p->maxConns && gw_p->conns_p[conn].fd != -1; conn++ ) {
+        }
+        if ( conn == gw_p->maxConns ) {
+            solClient_log ( SOLCLIENT_LOG_WARNING, "Refused a connection: %u open", gw_p->maxConns );
+            close ( fd );
+            continue;
+        }
+        conn_p = &gw_p->conns_p[conn];
+        if ( conn_p->in_p == NULL ) {
+            conn_p->in_p = ( char * ) malloc ( HTTPGW_IN_SIZE );
+            conn_p->out_p = ( char * ) malloc ( HTTPGW_OUT_SIZE );
+            if ( conn_p->in_p == NULL || conn_p->out_p == NULL ) {
+                free ( conn_p->in_p );
+                free ( conn_p->out_p );
+                conn_p->in_p = conn_p->out_p = NULL;
+                close ( fd );
+                continue;
+            }
+            conn_p->inSize = HTTPGW_IN_SIZE;
+            conn_p->outSize = HTTPGW_OUT_SIZE;
+        }
+        setsockopt ( fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof ( one ) );
+        event.events = EPOLLIN;
+        event.data.u32 = conn;
+        if ( epoll_ctl ( gw_p->epollFd, EPOLL_CTL_ADD, fd, &event ) != 0 ) {
+            close ( fd );
+            continue;
+        }
+        conn_p->fd = fd;
+        conn_p->events = EPOLLIN;
+        gw_p->stats.connections++;
+    }
+}
+
+
+/*****************************************************************************
+ * httpgw_init
+ *****************************************************************************/
+solClient_returnCode_t
+httpgw_init ( struct httpgw *gw_p, const char *address_p, int port, solClient_uint32_t maxConns,
+              solClient_uint32_t maxInFlight, solClient_uint32_t batchMax, int persistent )
+{
+    struct sockaddr_in addr;
+    socklen_t       addrLen = sizeof ( addr );
+    struct epoll_event event;
+    solClient_uint32_t i;
+    int             one = 1;
+
+    memset ( gw_p, 0, sizeof ( *gw_p ) );
+    gw_p->listenFd = gw_p->epollFd = gw_p->wakeFd = -1;
+    gw_p->maxConns = ( maxConns != 0 ) ? maxConns : HTTPGW_DEFAULT_MAX_CONNS;
+    gw_p->maxInFlight = ( maxInFlight != 0 ) ? maxInFlight : HTTPGW_DEFAULT_MAX_IN_FLIGHT;
+    gw_p->batchMax = ( batchMax == 0 || batchMax > SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT ) ?
+        SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT : batchMax;
+    gw_p->maxBody = HTTPGW_DEFAULT_MAX_BODY;
+    gw_p->persistent = persistent;
+    OS_MUTEX_INIT ( &gw_p->lock );
+
+    gw_p->conns_p = ( struct httpgwConn * ) calloc ( gw_p->maxConns, sizeof ( struct httpgwConn ) );
+    gw_p->touched_p = ( solClient_uint32_t * ) calloc ( gw_p->maxConns, sizeof ( solClient_uint32_t ) );
+    gw_p->requests_p = ( struct httpgwRequest * ) calloc ( gw_p->maxInFlight, sizeof ( struct httpgwRequest ) );
+    gw_p->acks_p = ( struct httpgwAck * ) calloc ( gw_p->maxInFlight, sizeof ( struct httpgwAck ) );
+    if ( gw_p->conns_p == NULL || gw_p->touched_p == NULL || gw_p->requests_p == NULL || gw_p->acks_p == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate a gateway of %u connections, %u requests",
+                        gw_p->maxConns, gw_p->maxInFlight );
+        goto fail;
+    }
+    for ( i = 0; i < gw_p->maxConns; i++ ) {
+        gw_p->conns_p[i].fd = -1;
+        gw_p->conns_p[i].head = gw_p->conns_p[i].tail = HTTPGW_NONE;
+    }
+    for ( i = 0; i < gw_p->maxInFlight; i++ ) {
+        gw_p->requests_p[i].conn = HTTPGW_NONE;
+        gw_p->requests_p[i].next = ( i + 1 < gw_p->maxInFlight ) ? i + 1 : HTTPGW_NONE;
+    }
+
+    memset ( &addr, 0, sizeof ( addr ) );
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons ( ( unsigned short ) port );
+    if ( inet_pton ( AF_INET, address_p, &addr.sin_addr ) != 1 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Invalid listen address '%s'", address_p );
+        goto fail;
+    }
+    if ( ( gw_p->listenFd = socket ( AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 ) ) < 0 ||
+         setsockopt ( gw_p->listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof ( one ) ) != 0 ||
+         bind ( gw_p->listenFd, ( struct sockaddr * ) &addr, sizeof ( addr ) ) != 0 ||
+         listen ( gw_p->listenFd, 1024 ) != 0 ||
+         getsockname ( gw_p->listenFd, ( struct sockaddr * ) &addr, &addrLen ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not listen on %s:%d: %s", address_p, port, strerror ( errno ) );
+        goto fail;
+    }
+    gw_p->port = ntohs ( addr.sin_port );
+
+    if ( ( gw_p->epollFd = epoll_create1 ( EPOLL_CLOEXEC ) ) < 0 ||
+         ( gw_p->wakeFd = eventfd ( 0, EFD_NONBLOCK | EFD_CLOEXEC ) ) < 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not create epoll: %s", strerror ( errno ) );
+        goto fail;
+    }
+    event.events = EPOLLIN;
+    event.data.u32 = HTTPGW_TAG_LISTEN;
+    epoll_ctl ( gw_p->epollFd, EPOLL_CTL_ADD, gw_p->listenFd, &event );
+    event.data.u32 = HTTPGW_TAG_WAKE;
+    epoll_ctl ( gw_p->epollFd, EPOLL_CTL_ADD, gw_p->wakeFd, &event );
+    return SOLCLIENT_OK;
+
+  fail:
+    httpgw_destroy ( gw_p );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * httpgw_setSession
+ *****************************************************************************/
+void
+httpgw_setSession ( struct httpgw *gw_p, solClient_opaqueSession_pt session_p )
+{
+    gw_p->session_p = session_p;
+    httpgw_setSendFunc ( gw_p, httpgw_sessionSend, session_p );
+}
+
+/*****************************************************************************
+ * httpgw_setSendFunc
+ *****************************************************************************/
+void
+httpgw_setSendFunc ( struct httpgw *gw_p, httpgw_sendFunc_t send_p, void *user_p )
+{
+    gw_p->send_p = send_p;
+    gw_p->sendUser_p = user_p;
+}
+
+/*****************************************************************************
+ * httpgw_addRoute
+ *****************************************************************************/
+solClient_returnCode_t
+httpgw_addRoute ( struct httpgw *gw_p, const char *path_p, const char *topic_p )
+{
+    struct httpgwRoute *route_p;
+
+    if ( gw_p->numRoutes == HTTPGW_MAX_ROUTES || path_p[0] != '/' ||
+         strlen ( path_p ) >= sizeof ( route_p->path ) || strlen ( topic_p ) >= sizeof ( route_p->topic ) ||
+         topic_p[0] == '\0' ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not add route '%s' to '%s'", path_p, topic_p );
+        return SOLCLIENT_FAIL;
+    }
+    route_p = &gw_p->routes[gw_p->numRoutes++];
+    strcpy ( route_p->path, path_p );
+    route_p->pathLen = ( solClient_uint32_t ) strlen ( path_p );
+    strcpy ( route_p->topic, topic_p );
+    route_p->topicLen = ( solClient_uint32_t ) strlen ( topic_p );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * httpgw_run
+ *****************************************************************************/
+solClient_returnCode_t
+httpgw_run ( struct httpgw *gw_p, solClient_uint64_t maxAnswered )
+{
+    struct epoll_event events[HTTPGW_MAX_EVENTS];
+    struct pollfd   wake;
+    solClient_uint32_t conn;
+    solClient_uint32_t tag;
+    int             n;
+    int             i;
+
+    if ( gw_p->send_p == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "The gateway has no Session to send on" );
+        return SOLCLIENT_FAIL;
+    }
+    while ( !gw_p->stop && ( maxAnswered == 0 || gw_p->stats.answered < maxAnswered ) ) {
+        /* Connections that stopped at maxInFlight go on first. */
+        if ( gw_p->stalledCount > 0 && gw_p->freeRequest != HTTPGW_NONE ) {
+            for ( conn = 0; conn < gw_p->maxConns && gw_p->stalledCount > 0; conn++ ) {
+                if ( gw_p->conns_p[conn].stalled ) {
+                    gw_p->conns_p[conn].stalled = 0;
+                    gw_p->stalledCount--;
+                    httpgw_take ( gw_p, conn );
+                }
+            }
+        }
+
+        if ( gw_p->freeRequest == HTTPGW_NONE ) {
+            /* Nothing can be read: wait for acknowledgements only. */
+            httpgw_flush ( gw_p );
+            wake.fd = gw_p->wakeFd;
+            wake.events = POLLIN;
+            poll ( &wake, 1, 100 );
+        } else {
+            n = epoll_wait ( gw_p->epollFd, events, HTTPGW_MAX_EVENTS, ( gw_p->batchCount > 0 ) ? 0 : 100 );
+            if ( n < 0 && errno != EINTR ) {
+                solClient_log ( SOLCLIENT_LOG_ERROR, "epoll_wait() failed: %s", strerror ( errno ) );
+                return SOLCLIENT_FAIL;
+            }
+            for ( i = 0; i < n; i++ ) {
+                tag = events[i].data.u32;
+                if ( tag == HTTPGW_TAG_LISTEN ) {
+                    httpgw_accept ( gw_p );
+                } else if ( tag != HTTPGW_TAG_WAKE && gw_p->conns_p[tag].fd != -1 ) {
+                    if ( gw_p->conns_p[tag].closing && ( events[i].events & ( EPOLLERR | EPOLLHUP ) ) ) {
+                        /* Nobody is left to answer. */
+                        httpgw_close ( gw_p, tag );
+                        continue;
+                    }
+                    if ( events[i].events & ( EPOLLIN | EPOLLERR | EPOLLHUP ) ) {
+                        httpgw_read ( gw_p, tag );
+                    }
+                    if ( ( events[i].events & EPOLLOUT ) && gw_p->conns_p[tag].fd != -1 ) {
+                        httpgw_write ( gw_p, tag );
+                    }
+                }
+            }
+            httpgw_flush ( gw_p );
+        }
+
+        httpgw_drainAcks ( gw_p );
+        for ( i = 0; i < ( int ) gw_p->touchedCount; i++ ) {
+            conn = gw_p->touched_p[i];
+            gw_p->conns_p[conn].touched = 0;
+            if ( gw_p->conns_p[conn].fd != -1 ) {
+                httpgw_answer ( gw_p, conn );
+            }
+        }
+        gw_p->touchedCount = 0;
+    }
+    httpgw_flush ( gw_p );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * httpgw_stop
+ *****************************************************************************/
+void
+httpgw_stop ( struct httpgw *gw_p )
+{
+    solClient_uint64_t one = 1;
+
+    gw_p->stop = 1;
+    if ( write ( gw_p->wakeFd, &one, sizeof ( one ) ) < 0 ) {
+        /* Already woken. */
+    }
+}
+
+/*****************************************************************************
+ * httpgw_ack
+ *****************************************************************************/
+void
+httpgw_ack ( struct httpgw *gw_p, void *correlation_p, int accepted )
+{
+    struct httpgwRequest *request_p = ( struct httpgwRequest * ) correlation_p;
+    solClient_uint64_t one = 1;
+
+    if ( request_p < gw_p->requests_p || request_p >= gw_p->requests_p + gw_p->maxInFlight ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "Acknowledgement for an unknown request %p", correlation_p );
+        return;
+    }
+    OS_MUTEX_LOCK ( &gw_p->lock );
+    /* Never full: each request is acknowledged once. */
+    gw_p->acks_p[( gw_p->ackHead + gw_p->ackCount ) % gw_p->maxInFlight].request =
+        ( solClient_uint32_t ) ( request_p - gw_p->requests_p );
+    gw_p->acks_p[( gw_p->ackHead + gw_p->ackCount ) % gw_p->maxInFlight].status = accepted ? 200 : 502;
+    gw_p->ackCount++;
+    OS_MUTEX_UNLOCK ( &gw_p->lock );
+    if ( write ( gw_p->wakeFd, &one, sizeof ( one ) ) < 0 ) {
+        /* Already woken. */
+    }
+}
+
+/*****************************************************************************
+ * httpgw_eventCallback
+ *****************************************************************************/
+void
+httpgw_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                       solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct httpgw  *gw_p = ( struct httpgw * ) user_p;
+
+    switch ( eventInfo_p->sessionEvent ) {
+        case SOLCLIENT_SESSION_EVENT_ACKNOWLEDGEMENT:
+            httpgw_ack ( gw_p, eventInfo_p->correlation_p, 1 );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_REJECTED_MSG_ERROR:
+            solClient_log ( SOLCLIENT_LOG_WARNING, "Message rejected, responseCode %d, %s",
+                            eventInfo_p->responseCode, eventInfo_p->info_p );
+            httpgw_ack ( gw_p, eventInfo_p->correlation_p, 0 );
+            break;
+
+        default:
+            common_eventCallback ( opaqueSession_p, eventInfo_p, NULL );
+            break;
+    }
+}
+
+/*****************************************************************************
+ * httpgw_getStats
+ *****************************************************************************/
+void
+httpgw_getStats ( struct httpgw *gw_p, struct httpgwStats *stats_p )
+{
+    *stats_p = gw_p->stats;
+}
+
+/*****************************************************************************
+ * httpgw_destroy
+ *****************************************************************************/
+void
+httpgw_destroy ( struct httpgw *gw_p )
+{
+    solClient_uint32_t i;
+
+    if ( gw_p->conns_p != NULL ) {
+        for ( i = 0; i < gw_p->maxConns; i++ ) {
+            if ( gw_p->conns_p[i].fd != -1 ) {
+                close ( gw_p->conns_p[i].fd );
+            }
+            free ( gw_p->conns_p[i].in_p );
+            free ( gw_p->conns_p[i].out_p );
+        }
+        free ( gw_p->conns_p );
+        gw_p->conns_p = NULL;
+    }
+    if ( gw_p->requests_p != NULL ) {
+        for ( i = 0; i < gw_p->maxInFlight; i++ ) {
+            if ( gw_p->requests_p[i].msg_p != NULL ) {
+                solClient_msg_free ( &gw_p->requests_p[i].msg_p );
+            }
+        }
+        free ( gw_p->requests_p );
+        gw_p->requests_p = NULL;
+    }
+    free ( gw_p->touched_p );
+    gw_p->touched_p = NULL;
+    free ( gw_p->acks_p );
+    gw_p->acks_p = NULL;
+    if ( gw_p->listenFd >= 0 ) {
+        close ( gw_p->listenFd );
+    }
+    if ( gw_p->epollFd >= 0 ) {
+        close ( gw_p->epollFd );
+    }
+    if ( gw_p->wakeFd >= 0 ) {
+        close ( gw_p->wakeFd );
+    }
+    gw_p->listenFd = gw_p->epollFd = gw_p->wakeFd = -1;
+    OS_MUTEX_DESTROY ( &gw_p->lock );
+}
@@ -0,0 +1,277 @@
+/** example Intro/httpgw.h
+ */
+
+/**
+ *
+ * file httpgw.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides an HTTP/1.1 ingestion gateway in the
+ * publishing process itself, in place of a separate proxy. It accepts
+ * POST requests on a listening socket and publishes each body as a
+ * message, answering the request when the broker has the message.
+ *
+ * One thread runs httpgw_run(): an epoll loop over the listening socket,
+ * the client connections (non-blocking, kept alive, requests pipelined)
+ * and an eventfd that wakes it for acknowledgements. Each request path is
+ * mapped to a topic by the longest matching route prefix, the rest of the
+ * path appended: route "/orders" to "acme/orders" sends
+ * "POST /orders/eu/17" to "acme/orders/eu/17". The message takes the body
+ * by pointer, in place in the connection's receive buffer
+ * (solClient_msg_setBinaryAttachmentPtr()), with the request's
+ * Content-Type and Content-Encoding as its HTTP content type and
+ * encoding. Messages from all connections read in one pass of the loop go
+ * out in one solClient_session_sendMultipleMsg() call, of up to
+ * ::SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT; a receive buffer is not moved
+ * or reused until its messages are sent.
+ *
+ * A Persistent message's request is answered 200 on its ACKNOWLEDGEMENT
+ * event and 502 on REJECTED_MSG_ERROR, by its correlation pointer; pass
+ * httpgw_eventCallback() with the gateway as user pointer, or call
+ * httpgw_ack() from the application's own event callback. A Direct
+ * message's request is answered 202 once sent. Answers go back in request
+ * order on each connection. A request that could not be sent gets 503,
+ * one without a route 404, any method but POST 405, one without
+ * Content-Length 411, a body over the maximum 413, and a malformed one
+ * 400; after 400, 413 or a chunked body the connection is closed.
+ *
+ * At most maxInFlight requests are held between being read and answered;
+ * beyond that, the gateway stops reading until acknowledgements come, and
+ * the clients' TCP windows push back. A connection closed by its client
+ * leaves its unacknowledged messages to complete unanswered.
+ *
+ * Paths are matched as sent, without percent-decoding; chunked bodies are
+ * not accepted. Linux only.
+ */
+
+#ifndef HTTPGW_H_
+#define HTTPGW_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define HTTPGW_DEFAULT_PORT             8080
+#define HTTPGW_DEFAULT_MAX_CONNS        1024
+#define HTTPGW_DEFAULT_MAX_IN_FLIGHT    4096
+#define HTTPGW_DEFAULT_MAX_BODY         ( 1024 * 1024 )
+#define HTTPGW_MAX_HEADER               8192
+#define HTTPGW_MAX_ROUTES               32
+#define HTTPGW_NONE                     0xffffffffU
+
+/**
+ * Sends a batch of messages; solClient_session_sendMultipleMsg() on the
+ * Session given to httpgw_setSession() unless replaced.
+ * @param msgs_p The messages.
+ * @param count How many.
+ * @param sent_p Set to how many were sent, in order.
+ * @param user_p The user pointer given to httpgw_setSendFunc().
+ * @return ::SOLCLIENT_OK, or the error for the first message not sent.
+ */
+typedef         solClient_returnCode_t ( *httpgw_sendFunc_t ) ( solClient_opaqueMsg_pt * msgs_p,
+                                                                solClient_uint32_t count,
+                                                                solClient_uint32_t * sent_p, void *user_p );
+
+/**
+ * @struct httpgwRoute
+ */
+struct httpgwRoute
+{
+    char            path[128];
+    solClient_uint32_t pathLen;
+    char            topic[SOLCLIENT_BUFINFO_MAX_TOPIC_SIZE + 1];
+    solClient_uint32_t topicLen;
+};
+
+/**
+ * @struct httpgwRequest
+ * A request between being read and answered.
+ */
+struct httpgwRequest
+{
+    solClient_opaqueMsg_pt msg_p;       /**< Kept from one request to the next. */
+    solClient_uint32_t conn;            /**< ::HTTPGW_NONE once its connection is gone. */
+    int             status;             /**< The answer, 0 until known. */
+    int             close;              /**< Close the connection after answering. */
+    solClient_uint32_t next;            /**< In the connection's queue, or the free list. */
+};
+
+/**
+ * @struct httpgwConn
+ */
+struct httpgwConn
+{
+    int             fd;                 /**< -1 when free. */
+    char           *in_p;
+    solClient_uint32_t inSize;
+    solClient_uint32_t inStart;         /**< Not yet parsed from here. */
+    solClient_uint32_t inEnd;
+    char           *out_p;
+    solClient_uint32_t outSize;
+    solClient_uint32_t outStart;
+    solClient_uint32_t outEnd;
+    solClient_uint32_t head;            /**< Requests to answer, in order. */
+    solClient_uint32_t tail;
+    solClient_uint32_t events;          /**< Registered with epoll. */
+    solClient_uint32_t batched;         /**< Messages in the batch with bodies in in_p. */
+    int             closing;            /**< Nothing more is read. */
+    int             ended;              /**< A request closes it: no more are parsed. */
+    int             continued;          /**< 100 Continue sent for the request being read. */
+    int             stalled;            /**< Stopped reading at maxInFlight. */
+    int             touched;            /**< Has answers to write after this pass. */
+};
+
+/**
+ * @struct httpgwAck
+ */
+struct httpgwAck
+{
+    solClient_uint32_t request;
+    int             status;
+};
+
+/**
+ * @struct httpgwStats
+ */
+struct httpgwStats
+{
+    solClient_uint64_t connections;     /**< Accepted. */
+    solClient_uint64_t requests;        /**< Read. */
+    solClient_uint64_t bodyBytes;
+    solClient_uint64_t batches;         /**< sendMultipleMsg() calls. */
+    solClient_uint64_t sent;
+    solClient_uint64_t sendFailed;      /**< Answered 503. */
+    solClient_uint64_t acked;           /**< Answered 200. */
+    solClient_uint64_t rejected;        /**< Answered 502. */
+    solClient_uint64_t refused;         /**< Answered 4xx. */
+    solClient_uint64_t orphaned;        /**< Acknowledged after their connection closed. */
+    solClient_uint64_t answered;
+    solClient_uint64_t stalls;          /**< Passes that stopped reading at maxInFlight. */
+    solClient_uint32_t inFlight;
+    solClient_uint32_t maxInFlightSeen;
+};
+
+/**
+ * @struct httpgw
+ */
+struct httpgw
+{
+    int             listenFd;
+    int             epollFd;
+    int             wakeFd;             /**< eventfd, written for acknowledgements. */
+    int             port;               /**< The port listened on. */
+    int             persistent;
+    solClient_uint32_t maxBody;
+    solClient_uint32_t batchMax;
+    struct httpgwConn *conns_p;
+    solClient_uint32_t maxConns;
+    struct httpgwRequest *requests_p;
+    solClient_uint32_t maxInFlight;
+    solClient_uint32_t freeRequest;
+    struct httpgwRoute routes[HTTPGW_MAX_ROUTES];
+    solClient_uint32_t numRoutes;
+    solClient_opaqueMsg_pt batch[SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT];
+    solClient_uint32_t batchRequests[SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT];
+    solClient_uint32_t batchCount;
+    solClient_uint32_t *touched_p;      /**< Connections with answers to write. */
+    solClient_uint32_t touchedCount;
+    solClient_uint32_t stalledCount;
+    httpgw_sendFunc_t send_p;
+    void           *sendUser_p;
+    solClient_opaqueSession_pt session_p;
+    OS_MUTEX        lock;               /**< For the acknowledgements below. */
+    struct httpgwAck *acks_p;           /**< Ring of maxInFlight. */
+    solClient_uint32_t ackHead;
+    solClient_uint32_t ackCount;
+    volatile int    stop;
+    struct httpgwStats stats;
+};
+
+
+/**
+ * Initialize a gateway listening on a port.
+ * @param gw_p The gateway.
+ * @param address_p The address to listen on, as "127.0.0.1" or "0.0.0.0".
+ * @param port The port, 0 for any: see httpgw::port.
+ * @param maxConns Most connections at once, 0 for ::HTTPGW_DEFAULT_MAX_CONNS.
+ * @param maxInFlight Most requests held, 0 for ::HTTPGW_DEFAULT_MAX_IN_FLIGHT.
+ * @param batchMax Most messages per send, up to ::SOLCLIENT_SESSION_SEND_MULTIPLE_LIMIT.
+ * @param persistent Send Persistent messages and answer on acknowledgement,
+ * or Direct ones answered when sent.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    httpgw_init ( struct httpgw *gw_p, const char *address_p, int port, solClient_uint32_t maxConns,
+                  solClient_uint32_t maxInFlight, solClient_uint32_t batchMax, int persistent );
+
+/**
+ * Publish on a Session, with solClient_session_sendMultipleMsg().
+ */
+void
+    httpgw_setSession ( struct httpgw *gw_p, solClient_opaqueSession_pt session_p );
+
+/**
+ * Publish through a function of the application's instead.
+ */
+void
+    httpgw_setSendFunc ( struct httpgw *gw_p, httpgw_sendFunc_t send_p, void *user_p );
+
+/**
+ * Map a path prefix to a topic prefix.
+ * @param gw_p The gateway.
+ * @param path_p The path prefix, starting with '/'.
+ * @param topic_p The topic the rest of the path is appended to.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when full or too long.
+ */
+solClient_returnCode_t
+    httpgw_addRoute ( struct httpgw *gw_p, const char *path_p, const char *topic_p );
+
+/**
+ * Serve until httpgw_stop(), or until maxAnswered requests were answered.
+ * @param gw_p The gateway.
+ * @param maxAnswered 0 for no limit.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when epoll failed.
+ */
+solClient_returnCode_t
+    httpgw_run ( struct httpgw *gw_p, solClient_uint64_t maxAnswered );
+
+/**
+ * Make httpgw_run() return. Any thread.
+ */
+void
+    httpgw_stop ( struct httpgw *gw_p );
+
+/**
+ * A message was acknowledged or rejected. Any thread.
+ * @param gw_p The gateway.
+ * @param correlation_p The message's correlation pointer.
+ * @param accepted Acknowledged rather than rejected.
+ */
+void
+    httpgw_ack ( struct httpgw *gw_p, void *correlation_p, int accepted );
+
+/**
+ * A Session event callback, with the gateway as user pointer: hands
+ * ACKNOWLEDGEMENT and REJECTED_MSG_ERROR to httpgw_ack(), and the rest to
+ * common_eventCallback().
+ */
+void
+    httpgw_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                           solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p );
+
+/**
+ * Copy the counters, from the thread running httpgw_run() or after it
+ * returned.
+ */
+void
+    httpgw_getStats ( struct httpgw *gw_p, struct httpgwStats *stats_p );
+
+/**
+ * Close every connection and free the gateway. Requests still held are
+ * not answered; acknowledgements must no longer come.
+ */
+void
+    httpgw_destroy ( struct httpgw *gw_p );
+
+#endif /* HTTPGW_H_ */
@@ -0,0 +1,618 @@
+
+/** example Intro/jsonpick.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Lazy JSON field extraction. See jsonpick.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "jsonpick.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JSONPICK_SSE2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define JSONPICK_NEON
+#endif
+
+#define JSONPICK_VECTOR         16
+#define JSONPICK_BLOCK          64      /* Four vectors, a bit each in a 64-bit mask. */
+#define JSONPICK_END            0xffffffffU
+
+/*****************************************************************************
+ * jsonpick_lowestBit
+ *****************************************************************************/
+static unsigned int
+jsonpick_lowestBit ( solClient_uint64_t mask )
+{
+#if defined(__GNUC__)
+    return ( unsigned int ) __builtin_ctzll ( mask );
+#else
+    unsigned int    bit = 0;
+
+    while ( ( mask & 1 ) == 0 ) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/*****************************************************************************
+ * jsonpick_bitCount
+ *****************************************************************************/
+static unsigned int
+jsonpick_bitCount ( solClient_uint64_t mask )
+{
+#if defined(__GNUC__)
+    return ( unsigned int ) __builtin_popcountll ( mask );
+#else
+    unsigned int    count = 0;
+
+    for ( ; mask != 0; mask &= mask - 1 ) {
+        count++;
+    }
+    return count;
+#endif
+}
+
+/*****************************************************************************
+ * jsonpick_masks
+ *
+ * Bit i of each mask is set when byte i of the vector is a quote, a
+ * backslash, or one of { } [ ] : ,. '[' and ']' are '{' and '}' with bit
+ * 0x20 clear.
+ *****************************************************************************/
+static void
+jsonpick_masks ( const unsigned char *block_p, int flags, solClient_uint32_t *quote_p, solClient_uint32_t *backslash_p,
+                 solClient_uint32_t *structural_p )
+{
+    int             i;
+
+#if defined(JSONPICK_SSE2)
+    if ( ( flags & JSONPICK_FLAG_SCALAR ) == 0 ) {
+        __m128i         v = _mm_loadu_si128 ( ( const __m128i * ) block_p );
+        __m128i         folded = _mm_or_si128 ( v, _mm_set1_epi8 ( 0x20 ) );
+        __m128i         structural;
+
+        structural = _mm_or_si128 ( _mm_or_si128 ( _mm_cmpeq_epi8 ( folded, _mm_set1_epi8 ( '{' ) ),
+                                                    _mm_cmpeq_epi8 ( folded, _mm_set1_epi8 ( '}' ) ) ),
+                                    _mm_or_si128 ( _mm_cmpeq_epi8 ( v, _mm_set1_epi8 ( ':' ) ),
+                                                   _mm_cmpeq_epi8 ( v, _mm_set1_epi8 ( ',' ) ) ) );
+        *quote_p = ( solClient_uint32_t ) _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( v, _mm_set1_epi8 ( '"' ) ) );
+        *backslash_p = ( solClient_uint32_t ) _mm_movemask_epi8 ( _mm_cmpeq_epi8 ( v, _mm_set1_epi8 ( '\\' ) ) );
+        *structural_p = ( solClient_uint32_t ) _mm_movemask_epi8 ( structural );
+        return;
+    }
+#elif defined(JSONPICK_NEON)
+    if ( ( flags & JSONPICK_FLAG_SCALAR ) == 0 ) {
+        static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        uint8x16_t      w = vld1q_u8 ( weights );
+        uint8x16_t      v = vld1q_u8 ( block_p );
+        uint8x16_t      folded = vorrq_u8 ( v, vdupq_n_u8 ( 0x20 ) );
+        uint8x16_t      m;
+
+#define JSONPICK_NEON_MASK(cmp) \
+        ( m = vandq_u8 ( ( cmp ), w ), \
+          ( solClient_uint32_t ) vaddv_u8 ( vget_low_u8 ( m ) ) | \
+          ( ( solClient_uint32_t ) vaddv_u8 ( vget_high_u8 ( m ) ) << 8 ) )
+        *quote_p = JSONPICK_NEON_MASK ( vceqq_u8 ( v, vdupq_n_u8 ( '"' ) ) );
+        *backslash_p = JSONPICK_NEON_MASK ( vceqq_u8 ( v, vdupq_n_u8 ( '\\' ) ) );
+        *structural_p = JSONPICK_NEON_MASK ( vorrq_u8 ( vorrq_u8 ( vceqq_u8 ( folded, vdupq_n_u8 ( '{' ) ),
+                                                                   vceqq_u8 ( folded, vdupq_n_u8 ( '}' ) ) ),
+                                                        vorrq_u8 ( vceqq_u8 ( v, vdupq_n_u8 ( ':' ) ),
+                                                                   vceqq_u8 ( v, vdupq_n_u8 ( ',' ) ) ) ) );
+#undef JSONPICK_NEON_MASK
+        return;
+    }
+#endif
+    *quote_p = *backslash_p = *structural_p = 0;
+    for ( i = 0; i < JSONPICK_VECTOR; i++ ) {
+        switch ( block_p[i] ) {
+            case '"':
+                *quote_p |= 1U << i;
+                break;
+            case '\\':
+                *backslash_p |= 1U << i;
+                break;
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case ':':
+            case ',':
+                *structural_p |= 1U << i;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/*****************************************************************************
+ * jsonpick_scanBlock
+ *
+ * Index the next block. The last, short one is padded with spaces.
+ *****************************************************************************/
+static          solClient_returnCode_t
+jsonpick_scanBlock ( struct jsonpickDoc *doc_p )
+{
+    unsigned char   tail[JSONPICK_BLOCK];
+    const unsigned char *block_p = ( const unsigned char * ) doc_p->buf_p + doc_p->scanned;
+    solClient_uint32_t n = doc_p->len - doc_p->scanned;
+    solClient_uint32_t vectorQuote;
+    solClient_uint32_t vectorBackslash;
+    solClient_uint32_t vectorStructural;
+    solClient_uint64_t quote = 0;
+    solClient_uint64_t backslash = 0;
+    solClient_uint64_t structural = 0;
+    solClient_uint64_t escaped = 0;
+    solClient_uint64_t inside;
+    solClient_uint64_t bit;
+    solClient_uint32_t *tape_p;
+    int             v;
+
+    if ( n < JSONPICK_BLOCK ) {
+        memset ( tail, ' ', sizeof ( tail ) );
+        memcpy ( tail, block_p, n );
+        block_p = tail;
+    } else {
+        n = JSONPICK_BLOCK;
+    }
+    if ( doc_p->tapeCount + JSONPICK_BLOCK > doc_p->tapeSize ) {
+        solClient_uint32_t size = ( doc_p->tapeSize == 0 ) ? 1024 : doc_p->tapeSize * 2;
+
+        if ( ( tape_p = ( solClient_uint32_t * ) realloc ( doc_p->tape_p, size * sizeof ( *tape_p ) ) ) == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not grow a JSON tape to %u entries", size );
+            return SOLCLIENT_FAIL;
+        }
+        doc_p->tape_p = tape_p;
+        doc_p->tapeSize = size;
+    }
+
+    for ( v = 0; v < JSONPICK_BLOCK / JSONPICK_VECTOR; v++ ) {
+        jsonpick_masks ( block_p + v * JSONPICK_VECTOR, doc_p->flags, &vectorQuote, &vectorBackslash,
+                         &vectorStructural );
+        quote |= ( solClient_uint64_t ) vectorQuote << ( v * JSONPICK_VECTOR );
+        backslash |= ( solClient_uint64_t ) vectorBackslash << ( v * JSONPICK_VECTOR );
+        structural |= ( solClient_uint64_t ) vectorStructural << ( v * JSONPICK_VECTOR );
+    }
+
+    /* A backslash escapes the next byte, unless it is itself escaped. Rare: bit by bit. */
+    if ( doc_p->escaped ) {
+        escaped = 1;
+        backslash &= ~( solClient_uint64_t ) 1;
+        doc_p->escaped = 0;
+    }
+    while ( backslash != 0 ) {
+        bit = backslash & ( ~backslash + 1 );
+        if ( bit == ( solClient_uint64_t ) 1 << ( JSONPICK_BLOCK - 1 ) ) {
+            doc_p->escaped = 1;
+            break;
+        }
+        escaped |= bit << 1;
+        backslash &= ~( bit | ( bit << 1 ) );
+    }
+    quote &= ~escaped;
+
+    /* Prefix XOR: set from an opening quote up to its closing one. */
+    inside = quote ^ ( quote << 1 );
+    inside ^= inside << 2;
+    inside ^= inside << 4;
+    inside ^= inside << 8;
+    inside ^= inside << 16;
+    inside ^= inside << 32;
+    if ( doc_p->inString ) {
+        inside = ~inside;
+    }
+    doc_p->inString = ( solClient_uint32_t ) ( inside >> ( JSONPICK_BLOCK - 1 ) );
+
+    /* In locals: stores through the tape might otherwise alias the counts. */
+    structural = ( structural & ~inside ) | quote;
+    tape_p = doc_p->tape_p + doc_p->tapeCount;
+    doc_p->tapeCount += ( solClient_uint32_t ) jsonpick_bitCount ( structural );
+    while ( structural != 0 ) {
+        *tape_p++ = doc_p->scanned + jsonpick_lowestBit ( structural );
+        structural &= structural - 1;
+    }
+    doc_p->scanned += n;
+    doc_p->blocks++;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * jsonpick_tapeAt
+ *
+ * Tape entry i, indexing as far as needed; JSONPICK_END past the end.
+ *****************************************************************************/
+static          solClient_uint32_t
+jsonpick_tapeAt ( struct jsonpickDoc *doc_p, solClient_uint32_t i )
+{
+    while ( i >= doc_p->tapeCount ) {
+        if ( doc_p->scanned >= doc_p->len || jsonpick_scanBlock ( doc_p ) != SOLCLIENT_OK ) {
+            return JSONPICK_END;
+        }
+    }
+    return doc_p->tape_p[i];
+}
+
+/*****************************************************************************
+ * jsonpick_skipSpace
+ *****************************************************************************/
+static          solClient_uint32_t
+jsonpick_skipSpace ( struct jsonpickDoc *doc_p, solClient_uint32_t pos )
+{
+    while ( pos < doc_p->len && ( doc_p->buf_p[pos] == ' ' || doc_p->buf_p[pos] == '\n' ||
+                                  doc_p->buf_p[pos] == '\r' || doc_p->buf_p[pos] == '\t' ) ) {
+        pos++;
+    }
+    return pos;
+}
+
+/*****************************************************************************
+ * jsonpick_skipValue
+ *
+ * Past the value starting at start, whose first tape entry is *t_p: *t_p
+ * is left on the entry after it, the ',' or closing bracket that follows.
+ *****************************************************************************/
+static          solClient_returnCode_t
+jsonpick_skipValue ( struct jsonpickDoc *doc_p, solClient_uint32_t *t_p, solClient_uint32_t start )
+{
+    solClient_uint32_t pos;
+    int             depth = 0;
+    char            c;
+
+    if ( start >= doc_p->len ) {
+        return SOLCLIENT_FAIL;
+    }
+    c = doc_p->buf_p[start];
+    if ( c != '"' && c != '{' && c != '[' ) {
+        /* A number, true, false or null: nothing on the tape. */
+        return SOLCLIENT_OK;
+    }
+    if ( jsonpick_tapeAt ( doc_p, *t_p ) != start ) {
+        return SOLCLIENT_FAIL;
+    }
+    if ( c == '"' ) {
+        if ( jsonpick_tapeAt ( doc_p, *t_p + 1 ) == JSONPICK_END ) {
+            return SOLCLIENT_FAIL;
+        }
+        *t_p += 2;
+        return SOLCLIENT_OK;
+    }
+    for ( ;; ) {
+        if ( *t_p >= doc_p->tapeCount && jsonpick_tapeAt ( doc_p, *t_p ) == JSONPICK_END ) {
+            return SOLCLIENT_FAIL;
+        }
+        pos = doc_p->tape_p[( *t_p )++];
+        c = doc_p->buf_p[pos];
+        if ( c == '{' || c == '[' ) {
+            depth++;
+        } else if ( ( c == '}' || c == ']' ) && --depth == 0 ) {
+            return SOLCLIENT_OK;
+        }
+    }
+}
+
+/*****************************************************************************
+ * jsonpick_valueAt
+ *****************************************************************************/
+static          solClient_returnCode_t
+jsonpick_valueAt ( struct jsonpickDoc *doc_p, solClient_uint32_t t, solClient_uint32_t start,
+                   struct jsonpickValue *value_p )
+{
+    solClient_uint32_t end;
+    char            c;
+
+    if ( start >= doc_p->len ) {
+        return SOLCLIENT_FAIL;
+    }
+    c = doc_p->buf_p[start];
+    value_p->ptr_p = doc_p->buf_p + start;
+    if ( c == '"' || c == '{' || c == '[' ) {
+        if ( jsonpick_skipValue ( doc_p, &t, start ) != SOLCLIENT_OK ) {
+            return SOLCLIENT_FAIL;
+        }
+        end = doc_p->tape_p[t - 1];
+        if ( c == '"' ) {
+            value_p->type = JSONPICK_STRING;
+            value_p->ptr_p++;
+            value_p->len = end - start - 1;
+        } else {
+            value_p->type = ( c == '{' ) ? JSONPICK_OBJECT : JSONPICK_ARRAY;
+            value_p->len = end - start + 1;
+        }
+        return SOLCLIENT_OK;
+    }
+
+    if ( ( end = jsonpick_tapeAt ( doc_p, t ) ) == JSONPICK_END ) {
+        end = doc_p->len;
+    }
+    while ( end > start && ( doc_p->buf_p[end - 1] == ' ' || doc_p->buf_p[end - 1] == '\n' ||
+                             doc_p->buf_p[end - 1] == '\r' || doc_p->buf_p[end - 1] == '\t' ) ) {
+        end--;
+    }
+    value_p->len = end - start;
+    if ( c == 't' ) {
+        value_p->type = JSONPICK_TRUE;
+    } else if ( c == 'f' ) {
+        value_p->type = JSONPICK_FALSE;
+    } else if ( c == 'n' ) {
+        value_p->type = JSONPICK_NULL;
+    } else if ( c == '-' || ( c >= '0' && c <= '9' ) ) {
+        value_p->type = JSONPICK_NUMBER;
+    } else {
+        return SOLCLIENT_FAIL;
+    }
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * jsonpick_init
+ *****************************************************************************/
+void
+jsonpick_init ( struct jsonpickDoc *doc_p, int flags )
+{
+    memset ( doc_p, 0, sizeof ( *doc_p ) );
+    doc_p->flags = flags;
+}
+
+/*****************************************************************************
+ * jsonpick_compile
+ *****************************************************************************/
+solClient_returnCode_t
+jsonpick_compile ( struct jsonpickPath *path_p, const char *text_p )
+{
+    struct jsonpickStep *step_p;
+    solClient_uint32_t len = ( solClient_uint32_t ) strlen ( text_p );
+    solClient_uint32_t i = 0;
+
+    memset ( path_p, 0, sizeof ( *path_p ) );
+    if ( len >= sizeof ( path_p->text ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "JSON path '%s' is too long", text_p );
+        return SOLCLIENT_FAIL;
+    }
+    strcpy ( path_p->text, text_p );
+
+    while ( i < len ) {
+        if ( path_p->numSteps == JSONPICK_MAX_STEPS ) {
+            goto malformed;
+        }
+        step_p = &path_p->steps[path_p->numSteps++];
+        if ( text_p[i] == '[' ) {
+            step_p->isIndex = 1;
+            if ( ++i == len || text_p[i] < '0' || text_p[i] > '9' ) {
+                goto malformed;
+            }
+            while ( i < len && text_p[i] >= '0' && text_p[i] <= '9' ) {
+                step_p->index = step_p->index * 10 + ( solClient_uint32_t ) ( text_p[i++] - '0' );
+            }
+            if ( i == len || text_p[i++] != ']' ) {
+                goto malformed;
+            }
+        } else {
+            step_p->keyOffset = i;
+            while ( i < len && text_p[i] != '.' && text_p[i] != '[' ) {
+                i++;
+            }
+            if ( ( step_p->keyLen = i - step_p->keyOffset ) == 0 ) {
+                goto malformed;
+            }
+        }
+        if ( i < len && text_p[i] == '.' ) {
+            if ( ++i == len || text_p[i] == '[' ) {
+                goto malformed;
+            }
+        } else if ( i < len && text_p[i] != '[' ) {
+            goto malformed;
+        }
+    }
+    return SOLCLIENT_OK;
+
+  malformed:
+    solClient_log ( SOLCLIENT_LOG_ERROR, "Malformed JSON path '%s' at %u", text_p, i );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * jsonpick_open
+ *****************************************************************************/
+void
+jsonpick_open ( struct jsonpickDoc *doc_p, const char *buf_p, solClient_uint32_t len )
+{
+    doc_p->buf_p = buf_p;
+    doc_p->len = len;
+    doc_p->tapeCount = 0;
+    doc_p->scanned = 0;
+    doc_p->inString = 0;
+    doc_p->escaped = 0;
+}
+
+/*****************************************************************************
+ * jsonpick_openMsg
+ *****************************************************************************/
+solClient_returnCode_t
+jsonpick_openMsg ( struct jsonpickDoc *doc_p, solClient_opaqueMsg_pt msg_p )
+{
+    const char     *string_p;
+    void           *ptr_p;
+    solClient_uint32_t size;
+
+    if ( solClient_msg_getBinaryAttachmentString ( msg_p, &string_p ) == SOLCLIENT_OK ) {
+        jsonpick_open ( doc_p, string_p, ( solClient_uint32_t ) strlen ( string_p ) );
+        return SOLCLIENT_OK;
+    }
+    if ( ( solClient_msg_getBinaryAttachmentPtr ( msg_p, &ptr_p, &size ) == SOLCLIENT_OK && size > 0 ) ||
+         ( solClient_msg_getXmlPtr ( msg_p, &ptr_p, &size ) == SOLCLIENT_OK && size > 0 ) ) {
+        jsonpick_open ( doc_p, ( const char * ) ptr_p, size );
+        return SOLCLIENT_OK;
+    }
+    jsonpick_open ( doc_p, "", 0 );
+    return SOLCLIENT_NOT_FOUND;
+}
+
+/*****************************************************************************
+ * jsonpick_get
+ *
+ * start is where the current value starts, and t its first tape entry, or
+ * for a number, true, false or null the entry after it.
+ *****************************************************************************/
+solClient_returnCode_t
+jsonpick_get ( struct jsonpickDoc *doc_p, const struct jsonpickPath *path_p, struct jsonpickValue *value_p )
+{
+    const struct jsonpickStep *step_p;
+    solClient_uint32_t t = 0;
+    solClient_uint32_t start = jsonpick_skipSpace ( doc_p, 0 );
+    solClient_uint32_t pos;
+    solClient_uint32_t close;
+    solClient_uint32_t colon;
+    solClient_uint32_t s;
+    solClient_uint32_t k;
+    int             match;
+
+    for ( s = 0; s < path_p->numSteps; s++ ) {
+        step_p = &path_p->steps[s];
+        if ( start >= doc_p->len ) {
+            return SOLCLIENT_FAIL;
+        }
+        if ( !step_p->isIndex ) {
+            if ( doc_p->buf_p[start] != '{' ) {
+                return SOLCLIENT_NOT_FOUND;
+            }
+            if ( jsonpick_tapeAt ( doc_p, t++ ) != start ) {
+                return SOLCLIENT_FAIL;
+            }
+            for ( ;; ) {
+                if ( ( pos = jsonpick_tapeAt ( doc_p, t ) ) == JSONPICK_END ) {
+                    return SOLCLIENT_FAIL;
+                }
+                if ( doc_p->buf_p[pos] == '}' ) {
+                    return SOLCLIENT_NOT_FOUND;
+                }
+                if ( doc_p->buf_p[pos] != '"' ||
+                     ( close = jsonpick_tapeAt ( doc_p, t + 1 ) ) == JSONPICK_END ||
+                     ( colon = jsonpick_tapeAt ( doc_p, t + 2 ) ) == JSONPICK_END || doc_p->buf_p[colon] != ':' ) {
+                    return SOLCLIENT_FAIL;
+                }
+                match = ( close - pos - 1 == step_p->keyLen &&
+                          memcmp ( doc_p->buf_p + pos + 1, path_p->text + step_p->keyOffset, step_p->keyLen ) == 0 );
+                t += 3;
+                start = jsonpick_skipSpace ( doc_p, colon + 1 );
+                if ( match ) {
+                    break;
+                }
+                if ( jsonpick_skipValue ( doc_p, &t, start ) != SOLCLIENT_OK ||
+                     ( pos = jsonpick_tapeAt ( doc_p, t ) ) == JSONPICK_END ) {
+                    return SOLCLIENT_FAIL;
+                }
+                if ( doc_p->buf_p[pos] == '}' ) {
+                    return SOLCLIENT_NOT_FOUND;
+                }
+                if ( doc_p->buf_p[pos] != ',' ) {
+                    return SOLCLIENT_FAIL;
+                }
+                t++;
+            }
+        } else {
+            if ( doc_p->buf_p[start] != '[' ) {
+                return SOLCLIENT_NOT_FOUND;
+            }
+            if ( jsonpick_tapeAt ( doc_p, t++ ) != start ) {
+                return SOLCLIENT_FAIL;
+            }
+            start = jsonpick_skipSpace ( doc_p, start + 1 );
+            if ( start < doc_p->len && doc_p->buf_p[start] == ']' ) {
+                return SOLCLIENT_NOT_FOUND;
+            }
+            for ( k = 0; k < step_p->index; k++ ) {
+                if ( jsonpick_skipValue ( doc_p, &t, start ) != SOLCLIENT_OK ||
+                     ( pos = jsonpick_tapeAt ( doc_p, t ) ) == JSONPICK_END ) {
+                    return SOLCLIENT_FAIL;
+                }
+                if ( doc_p->buf_p[pos] == ']' ) {
+                    return SOLCLIENT_NOT_FOUND;
+                }
+                if ( doc_p->buf_p[pos] != ',' ) {
+                    return SOLCLIENT_FAIL;
+                }
+                t++;
+                start = jsonpick_skipSpace ( doc_p, pos + 1 );
+            }
+        }
+    }
+    return jsonpick_valueAt ( doc_p, t, start, value_p );
+}
+
+/*****************************************************************************
+ * jsonpick_toInt64
+ *****************************************************************************/
+solClient_returnCode_t
+jsonpick_toInt64 ( const struct jsonpickValue *value_p, solClient_int64_t *int_p )
+{
+    solClient_uint32_t i = 0;
+    solClient_uint64_t magnitude = 0;
+    int             negative = 0;
+
+    if ( value_p->type != JSONPICK_NUMBER ) {
+        return SOLCLIENT_FAIL;
+    }
+    if ( value_p->ptr_p[0] == '-' ) {
+        negative = 1;
+        i++;
+    }
+    if ( i == value_p->len || value_p->ptr_p[i] < '0' || value_p->ptr_p[i] > '9' ) {
+        return SOLCLIENT_FAIL;
+    }
+    for ( ; i < value_p->len && value_p->ptr_p[i] >= '0' && value_p->ptr_p[i] <= '9'; i++ ) {
+        magnitude = magnitude * 10 + ( solClient_uint64_t ) ( value_p->ptr_p[i] - '0' );
+    }
+    if ( i < value_p->len && value_p->ptr_p[i] == '.' ) {
+        for ( i++; i < value_p->len && value_p->ptr_p[i] >= '0' && value_p->ptr_p[i] <= '9'; i++ ) {
+        }
+    }
+    if ( i != value_p->len ) {
+        return SOLCLIENT_FAIL;
+    }
+    *int_p = negative ? -( solClient_int64_t ) magnitude : ( solClient_int64_t ) magnitude;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * jsonpick_copy
+ *****************************************************************************/
+solClient_returnCode_t
+jsonpick_copy ( const struct jsonpickValue *value_p, char *buf_p, size_t size )
+{
+    if ( ( size_t ) value_p->len + 1 > size ) {
+        return SOLCLIENT_FAIL;
+    }
+    memcpy ( buf_p, value_p->ptr_p, value_p->len );
+    buf_p[value_p->len] = '\0';
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * jsonpick_destroy
+ *****************************************************************************/
+void
+jsonpick_destroy ( struct jsonpickDoc *doc_p )
+{
+    free ( doc_p->tape_p );
+    doc_p->tape_p = NULL;
+    doc_p->tapeSize = 0;
+    doc_p->tapeCount = 0;
+}
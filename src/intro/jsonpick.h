@@ -0,0 +1,173 @@
+/** example Intro/jsonpick.h
+ */
+
+/**
+ *
+ * file jsonpick.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides extraction of a few fields from a JSON
+ * payload without parsing the document. The payload is read in place,
+ * from the binary attachment or the XML part of a received message.
+ *
+ * The payload is indexed 64 bytes at a time, as four 16-byte vectors
+ * compared with SSE2 or NEON where the compiler has them, and a byte loop
+ * otherwise: a block yields 64-bit masks of its quotes, backslashes and
+ * structural characters ({ } [ ] : ,); escaped quotes are dropped, the
+ * quotes' prefix XOR masks what is inside strings, and the positions of
+ * the structural characters and quotes left are appended to a tape. The
+ * index is built lazily, only as far as a lookup has to look: fields near
+ * the start of a large document never cost a scan of the rest.
+ *
+ * A path, compiled once with jsonpick_compile(), is a list of object keys
+ * and array indexes, as in "order.lines[2].sku". A lookup walks the tape
+ * from the root, skipping the values it does not want by counting
+ * brackets on the tape, and returns the value found as a span of the
+ * payload: nothing is copied, unescaped or converted until asked. Keys are
+ * compared as they are written, escapes and all.
+ *
+ * A lookup checks only what it walks through: a malformed document may
+ * give ::SOLCLIENT_FAIL, or a value, but never reads outside the payload.
+ */
+
+#ifndef JSONPICK_H_
+#define JSONPICK_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define JSONPICK_MAX_STEPS      16
+#define JSONPICK_MAX_PATH       256
+
+#define JSONPICK_FLAG_SCALAR    0x01    /**< Index without SIMD, for comparison. */
+
+#define JSONPICK_STRING         1
+#define JSONPICK_NUMBER         2
+#define JSONPICK_OBJECT         3
+#define JSONPICK_ARRAY          4
+#define JSONPICK_TRUE           5
+#define JSONPICK_FALSE          6
+#define JSONPICK_NULL           7
+
+/**
+ * @struct jsonpickStep
+ */
+struct jsonpickStep
+{
+    int             isIndex;
+    solClient_uint32_t index;           /**< The array index, when isIndex. */
+    solClient_uint32_t keyOffset;       /**< In jsonpickPath::text. */
+    solClient_uint32_t keyLen;
+};
+
+/**
+ * @struct jsonpickPath
+ */
+struct jsonpickPath
+{
+    char            text[JSONPICK_MAX_PATH];
+    struct jsonpickStep steps[JSONPICK_MAX_STEPS];
+    solClient_uint32_t numSteps;
+};
+
+/**
+ * @struct jsonpickValue
+ * A value found, within the payload.
+ */
+struct jsonpickValue
+{
+    int             type;               /**< ::JSONPICK_STRING ... ::JSONPICK_NULL. */
+    const char     *ptr_p;              /**< A string without its quotes; an object or array with its brackets. */
+    solClient_uint32_t len;
+};
+
+/**
+ * @struct jsonpickDoc
+ * A payload and its index so far. Reused from one message to the next,
+ * it allocates only when a document needs a longer tape than any before.
+ */
+struct jsonpickDoc
+{
+    const char     *buf_p;
+    solClient_uint32_t len;
+    solClient_uint32_t *tape_p;         /**< Offsets of structural characters and quotes. */
+    solClient_uint32_t tapeCount;
+    solClient_uint32_t tapeSize;
+    solClient_uint32_t scanned;         /**< Bytes indexed. */
+    solClient_uint32_t inString;        /**< Carried from one block to the next. */
+    solClient_uint32_t escaped;
+    int             flags;
+    solClient_uint64_t blocks;          /**< Blocks indexed, over all documents. */
+};
+
+
+/**
+ * Initialize a document.
+ * @param doc_p The document.
+ * @param flags 0 or ::JSONPICK_FLAG_SCALAR.
+ */
+void
+    jsonpick_init ( struct jsonpickDoc *doc_p, int flags );
+
+/**
+ * Compile a path.
+ * @param path_p The path to fill in.
+ * @param text_p Keys separated by '.', and array indexes in brackets:
+ * "a.b[0].c". An empty path is the whole document.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when malformed or too long.
+ */
+solClient_returnCode_t
+    jsonpick_compile ( struct jsonpickPath *path_p, const char *text_p );
+
+/**
+ * Start on a payload. Nothing is read yet.
+ * @param doc_p The document.
+ * @param buf_p The payload, which must stay until the last lookup.
+ * @param len Its length.
+ */
+void
+    jsonpick_open ( struct jsonpickDoc *doc_p, const char *buf_p, solClient_uint32_t len );
+
+/**
+ * Start on a received message: its binary attachment, as a string or as
+ * bytes, or else its XML part.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_NOT_FOUND when it has no payload.
+ */
+solClient_returnCode_t
+    jsonpick_openMsg ( struct jsonpickDoc *doc_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Look up a path.
+ * @param doc_p The document.
+ * @param path_p A compiled path.
+ * @param value_p The value found.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_NOT_FOUND when the document does not
+ * have the path, ::SOLCLIENT_FAIL when it is malformed where walked.
+ */
+solClient_returnCode_t
+    jsonpick_get ( struct jsonpickDoc *doc_p, const struct jsonpickPath *path_p, struct jsonpickValue *value_p );
+
+/**
+ * A number value as an integer; a fraction is truncated.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when not a number, or written
+ * with an exponent.
+ */
+solClient_returnCode_t
+    jsonpick_toInt64 ( const struct jsonpickValue *value_p, solClient_int64_t *int_p );
+
+/**
+ * Copy a value as it is written, escapes included, terminated.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when it does not fit.
+ */
+solClient_returnCode_t
+    jsonpick_copy ( const struct jsonpickValue *value_p, char *buf_p, size_t size );
+
+/**
+ * Free the tape.
+ */
+void
+    jsonpick_destroy ( struct jsonpickDoc *doc_p );
+
+#endif /* JSONPICK_H_ */
@@ -0,0 +1,379 @@
+
+/** example Intro/keyorder.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Ordered-per-key parallel processing. See keyorder.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "keyorder.h"
+
+/*****************************************************************************
+ * keyorder_hash
+ *****************************************************************************/
+static          solClient_uint32_t
+keyorder_hash ( const char *key_p )
+{
+    solClient_uint32_t hash = 2166136261u;
+
+    while ( *key_p != ( char ) 0 ) {
+        hash ^= ( unsigned char ) *key_p++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*****************************************************************************
+ * keyorder_keyHash
+ *
+ * The hash of the key property, or else of the topic.
+ *****************************************************************************/
+static          solClient_uint32_t
+keyorder_keyHash ( struct keyorder *pool_p, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_opaqueContainer_pt map_p;
+    solClient_destination_t destination;
+    const char     *key_p;
+
+    if ( pool_p->keyProp[0] != ( char ) 0 &&
+         solClient_msg_getUserPropertyMap ( msg_p, &map_p ) == SOLCLIENT_OK &&
+         solClient_container_getStringPtr ( map_p, &key_p, pool_p->keyProp ) == SOLCLIENT_OK ) {
+        return keyorder_hash ( key_p );
+    }
+    if ( solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) == SOLCLIENT_OK ) {
+        return keyorder_hash ( destination.dest );
+    }
+    return 0;
+}
+
+/*****************************************************************************
+ * keyorder_ack
+ *****************************************************************************/
+static          solClient_returnCode_t
+keyorder_ack ( solClient_opaqueFlow_pt flow_p, solClient_msgId_t msgId )
+{
+    solClient_returnCode_t rc;
+
+    if ( flow_p == NULL ) {
+        return SOLCLIENT_OK;
+    }
+    if ( ( rc = solClient_flow_sendAck ( flow_p, msgId ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_sendAck()" );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * keyorder_stopFlow
+ *
+ * Stop the Flow if the window is still full. The stops and starts are made
+ * under flowLock, each after checking the window again, so that they take
+ * effect in the order decided.
+ *****************************************************************************/
+static void
+keyorder_stopFlow ( struct keyorder *pool_p, solClient_opaqueFlow_pt flow_p )
+{
+    solClient_returnCode_t rc;
+    int             stop;
+
+    OS_MUTEX_LOCK ( &pool_p->flowLock );
+    OS_MUTEX_LOCK ( &pool_p->lock );
+    stop = ( pool_p->stoppedFlow_p == NULL && pool_p->nextSeq - pool_p->lowSeq >= pool_p->window );
+    if ( stop ) {
+        pool_p->stoppedFlow_p = flow_p;
+        pool_p->stats.flowStops++;
+    }
+    OS_MUTEX_UNLOCK ( &pool_p->lock );
+    if ( stop && ( rc = solClient_flow_stop ( flow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_stop()" );
+        OS_MUTEX_LOCK ( &pool_p->lock );
+        pool_p->stoppedFlow_p = NULL;
+        OS_MUTEX_UNLOCK ( &pool_p->lock );
+    }
+    OS_MUTEX_UNLOCK ( &pool_p->flowLock );
+}
+
+/*****************************************************************************
+ * keyorder_startFlow
+ *
+ * Start the Flow again if it is stopped and the watermark is back within
+ * half the window.
+ *****************************************************************************/
+static void
+keyorder_startFlow ( struct keyorder *pool_p )
+{
+    solClient_returnCode_t rc;
+    solClient_opaqueFlow_pt flow_p = NULL;
+
+    OS_MUTEX_LOCK ( &pool_p->flowLock );
+    OS_MUTEX_LOCK ( &pool_p->lock );
+    if ( pool_p->stoppedFlow_p != NULL && pool_p->nextSeq - pool_p->lowSeq <= pool_p->window / 2 ) {
+        flow_p = pool_p->stoppedFlow_p;
+        pool_p->stoppedFlow_p = NULL;
+    }
+    OS_MUTEX_UNLOCK ( &pool_p->lock );
+    if ( flow_p != NULL && ( rc = solClient_flow_start ( flow_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_start()" );
+    }
+    OS_MUTEX_UNLOCK ( &pool_p->flowLock );
+}
+
+/*****************************************************************************
+ * keyorder_complete
+ *
+ * Mark a message done and raise the watermark over what is done below it.
+ *****************************************************************************/
+static void
+keyorder_complete ( struct keyorder *pool_p, solClient_uint64_t seq, int acked )
+{
+    int             raised = 0;
+    int             restart;
+
+    OS_MUTEX_LOCK ( &pool_p->lock );
+    pool_p->done_p[seq % pool_p->capacity] = 1;
+    pool_p->stats.processed++;
+    if ( acked ) {
+        pool_p->stats.acked++;
+    } else {
+        pool_p->stats.ackFailed++;
+    }
+    while ( pool_p->lowSeq < pool_p->nextSeq && pool_p->done_p[pool_p->lowSeq % pool_p->capacity] ) {
+        pool_p->lowMsgId = pool_p->ids_p[pool_p->lowSeq % pool_p->capacity];
+        pool_p->lowSeq++;
+        raised = 1;
+    }
+    restart = ( pool_p->stoppedFlow_p != NULL && pool_p->nextSeq - pool_p->lowSeq <= pool_p->window / 2 );
+    OS_MUTEX_UNLOCK ( &pool_p->lock );
+    if ( raised ) {
+        os_eventSignal ( &pool_p->room );
+    }
+    if ( restart ) {
+        keyorder_startFlow ( pool_p );
+    }
+}
+
+/*****************************************************************************
+ * keyorder_workerThread
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( keyorder_workerThread, arg_p )
+{
+    struct keyorderWorker *worker_p = ( struct keyorderWorker * ) arg_p;
+    struct keyorder *pool_p = worker_p->pool_p;
+    struct keyorderItem item;
+
+    while ( !pool_p->stop ) {
+        OS_MUTEX_LOCK ( &worker_p->lock );
+        if ( worker_p->count == 0 ) {
+            OS_MUTEX_UNLOCK ( &worker_p->lock );
+            os_eventWait ( &worker_p->ready, 100 );
+            continue;
+        }
+        item = worker_p->items_p[worker_p->head];
+        worker_p->head = ( worker_p->head + 1 ) % pool_p->capacity;
+        worker_p->count--;
+        OS_MUTEX_UNLOCK ( &worker_p->lock );
+
+        pool_p->process_p ( &item, worker_p->index, pool_p->user_p );
+        worker_p->processed++;
+        keyorder_complete ( pool_p, item.seq, keyorder_ack ( item.flow_p, item.msgId ) == SOLCLIENT_OK );
+        solClient_msg_free ( &item.msg_p );
+    }
+    OS_THREAD_RETURN;
+}
+
+
+/*****************************************************************************
+ * keyorder_init
+ *****************************************************************************/
+solClient_returnCode_t
+keyorder_init ( struct keyorder *pool_p, int numWorkers, solClient_uint32_t window, const char *keyProp_p,
+                keyorder_processFunc_t process_p, void *user_p )
+{
+    struct keyorderWorker *worker_p;
+    int             i;
+
+    memset ( pool_p, 0, sizeof ( *pool_p ) );
+    if ( numWorkers < 1 || numWorkers > KEYORDER_MAX_WORKERS ||
+         ( keyProp_p != NULL && strlen ( keyProp_p ) >= sizeof ( pool_p->keyProp ) ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Invalid keyorder_init() arguments: %d workers", numWorkers );
+        return SOLCLIENT_FAIL;
+    }
+    pool_p->numWorkers = numWorkers;
+    pool_p->window = ( window != 0 ) ? window : KEYORDER_DEFAULT_WINDOW;
+    pool_p->capacity = 2 * pool_p->window;
+    if ( keyProp_p != NULL ) {
+        strcpy ( pool_p->keyProp, keyProp_p );
+    }
+    pool_p->process_p = process_p;
+    pool_p->user_p = user_p;
+    OS_MUTEX_INIT ( &pool_p->flowLock );
+    OS_MUTEX_INIT ( &pool_p->lock );
+    os_eventInit ( &pool_p->room );
+
+    pool_p->done_p = ( unsigned char * ) calloc ( pool_p->capacity, 1 );
+    pool_p->ids_p = ( solClient_msgId_t * ) calloc ( pool_p->capacity, sizeof ( solClient_msgId_t ) );
+    pool_p->workers_p = ( struct keyorderWorker * ) calloc ( numWorkers, sizeof ( struct keyorderWorker ) );
+    if ( pool_p->done_p == NULL || pool_p->ids_p == NULL || pool_p->workers_p == NULL ) {
+        goto fail;
+    }
+    for ( i = 0; i < numWorkers; i++ ) {
+        worker_p = &pool_p->workers_p[i];
+        worker_p->pool_p = pool_p;
+        worker_p->index = i;
+        if ( ( worker_p->items_p = ( struct keyorderItem * ) calloc ( pool_p->capacity,
+                                                                      sizeof ( struct keyorderItem ) ) ) == NULL ) {
+            goto fail;
+        }
+        OS_MUTEX_INIT ( &worker_p->lock );
+        os_eventInit ( &worker_p->ready );
+    }
+    for ( pool_p->started = 0; pool_p->started < numWorkers; pool_p->started++ ) {
+        if ( os_threadCreate ( &pool_p->workers_p[pool_p->started].thread, keyorder_workerThread,
+                               &pool_p->workers_p[pool_p->started] ) != 0 ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not start worker %d", pool_p->started );
+            goto fail;
+        }
+    }
+    return SOLCLIENT_OK;
+
+  fail:
+    solClient_log ( SOLCLIENT_LOG_ERROR, "Could not start a pool of %d workers, window %u", numWorkers,
+                    pool_p->window );
+    keyorder_destroy ( pool_p );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * keyorder_put
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+keyorder_put ( struct keyorder *pool_p, solClient_opaqueFlow_pt flow_p, solClient_opaqueMsg_pt msg_p )
+{
+    struct keyorderWorker *worker_p;
+    struct keyorderItem item;
+    solClient_uint64_t limit = ( flow_p != NULL ) ? pool_p->capacity : pool_p->window;
+    int             waited = 0;
+    int             stop;
+
+    item.msg_p = msg_p;
+    item.flow_p = flow_p;
+    item.msgId = 0;
+    if ( flow_p != NULL ) {
+        solClient_msg_getMsgId ( msg_p, &item.msgId );
+    }
+    item.keyHash = keyorder_keyHash ( pool_p, msg_p );
+
+    OS_MUTEX_LOCK ( &pool_p->lock );
+    pool_p->stats.received++;
+    if ( flow_p != NULL && pool_p->lowSeq > 0 && item.msgId <= pool_p->lowMsgId &&
+         solClient_msg_isRedelivered ( msg_p ) ) {
+        /* Processed before the Flow was rebound. */
+        pool_p->stats.skipped++;
+        OS_MUTEX_UNLOCK ( &pool_p->lock );
+        keyorder_ack ( flow_p, item.msgId );
+        return SOLCLIENT_CALLBACK_OK;
+    }
+    /* On a Flow, only the messages delivered after the stop ever fill the capacity. */
+    while ( pool_p->nextSeq - pool_p->lowSeq >= limit ) {
+        if ( pool_p->stop ) {
+            OS_MUTEX_UNLOCK ( &pool_p->lock );
+            return SOLCLIENT_CALLBACK_OK;
+        }
+        if ( !waited ) {
+            waited = 1;
+            pool_p->stats.waits++;
+        }
+        OS_MUTEX_UNLOCK ( &pool_p->lock );
+        os_eventWait ( &pool_p->room, 100 );
+        OS_MUTEX_LOCK ( &pool_p->lock );
+    }
+    item.seq = pool_p->nextSeq++;
+    pool_p->done_p[item.seq % pool_p->capacity] = 0;
+    pool_p->ids_p[item.seq % pool_p->capacity] = item.msgId;
+    if ( pool_p->nextSeq - pool_p->lowSeq > pool_p->stats.maxLag ) {
+        pool_p->stats.maxLag = pool_p->nextSeq - pool_p->lowSeq;
+    }
+    stop = ( flow_p != NULL && pool_p->stoppedFlow_p == NULL && pool_p->nextSeq - pool_p->lowSeq >= pool_p->window );
+    OS_MUTEX_UNLOCK ( &pool_p->lock );
+    if ( stop ) {
+        keyorder_stopFlow ( pool_p, flow_p );
+    }
+
+    /* The capacity bounds every worker's queue: there is always room. */
+    worker_p = &pool_p->workers_p[item.keyHash % ( solClient_uint32_t ) pool_p->numWorkers];
+    OS_MUTEX_LOCK ( &worker_p->lock );
+    worker_p->items_p[( worker_p->head + worker_p->count ) % pool_p->capacity] = item;
+    worker_p->count++;
+    OS_MUTEX_UNLOCK ( &worker_p->lock );
+    os_eventSignal ( &worker_p->ready );
+    return SOLCLIENT_CALLBACK_TAKE_MSG;
+}
+
+/*****************************************************************************
+ * keyorder_getStats
+ *****************************************************************************/
+void
+keyorder_getStats ( struct keyorder *pool_p, struct keyorderStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &pool_p->lock );
+    *stats_p = pool_p->stats;
+    stats_p->lowSeq = pool_p->lowSeq;
+    stats_p->lowMsgId = pool_p->lowMsgId;
+    OS_MUTEX_UNLOCK ( &pool_p->lock );
+}
+
+/*****************************************************************************
+ * keyorder_destroy
+ *****************************************************************************/
+void
+keyorder_destroy ( struct keyorder *pool_p )
+{
+    struct keyorderWorker *worker_p;
+    int             i;
+
+    pool_p->stop = 1;
+    os_eventSignal ( &pool_p->room );
+    if ( pool_p->workers_p != NULL ) {
+        for ( i = 0; i < pool_p->started; i++ ) {
+            os_eventSignal ( &pool_p->workers_p[i].ready );
+            os_threadJoin ( pool_p->workers_p[i].thread );
+        }
+        for ( i = 0; i < pool_p->numWorkers; i++ ) {
+            worker_p = &pool_p->workers_p[i];
+            if ( worker_p->items_p == NULL ) {
+                break;
+            }
+            /* Left unacknowledged, for redelivery. */
+            for ( ; worker_p->count > 0; worker_p->count-- ) {
+                solClient_msg_free ( &worker_p->items_p[worker_p->head].msg_p );
+                worker_p->head = ( worker_p->head + 1 ) % pool_p->capacity;
+            }
+            free ( worker_p->items_p );
+            OS_MUTEX_DESTROY ( &worker_p->lock );
+            os_eventDestroy ( &worker_p->ready );
+        }
+        free ( pool_p->workers_p );
+        pool_p->workers_p = NULL;
+    }
+    free ( pool_p->done_p );
+    pool_p->done_p = NULL;
+    free ( pool_p->ids_p );
+    pool_p->ids_p = NULL;
+    os_eventDestroy ( &pool_p->room );
+    OS_MUTEX_DESTROY ( &pool_p->lock );
+    OS_MUTEX_DESTROY ( &pool_p->flowLock );
+}
@@ -0,0 +1,184 @@
+/** example Intro/keyorder.h
+ */
+
+/**
+ *
+ * file keyorder.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides processing of one Flow's messages on several
+ * worker threads while keeping the order of the messages of each key. The
+ * key is a string user property, or the topic when the message has no
+ * such property or none is named.
+ *
+ * keyorder_put(), called from the receive callback, hashes the key
+ * (FNV-1a) to pick a worker and queues the message to it, so each key is
+ * processed by one worker in the order received; keys on different
+ * workers complete in any order. A worker acknowledges each message with
+ * solClient_flow_sendAck() as soon as the application's process function
+ * returns, without waiting for the messages before it: the Flow must use
+ * ::SOLCLIENT_FLOW_PROP_ACKMODE_CLIENT. A message that fails must be dealt
+ * with by the process function itself, retried or sent elsewhere, as it
+ * is acknowledged when the function returns.
+ *
+ * Each message gets a sequence number as received. The low watermark is
+ * the sequence number below which every message was acknowledged, with
+ * the message ID of the last of them: after the Flow is rebound, a
+ * redelivered message at or below that ID was already processed, and is
+ * acknowledged again without being processed twice. Message IDs are
+ * assumed to increase in delivery order, as they do on one queue. Above
+ * the watermark, completion has holes, and redelivered messages are
+ * processed again.
+ *
+ * When window messages are held between the watermark and the last
+ * received, keyorder_put() stops the Flow with solClient_flow_stop() and
+ * returns at once; the worker that brings the watermark back to half the
+ * window starts it again with solClient_flow_start(). The receive
+ * callback never blocks, and a slow key holds back the others only by the
+ * window. The messages the API delivers after the stop are still taken,
+ * up to twice the window; only beyond that does keyorder_put() wait. The
+ * queue's maximum of delivered unacknowledged messages per Flow should
+ * cover the window. With no Flow, keyorder_put() waits for room at the
+ * window instead, for callers off the Context thread.
+ *
+ * keyorder_put() may be called from one receive callback at a time, as on
+ * one Flow.
+ */
+
+#ifndef KEYORDER_H_
+#define KEYORDER_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define KEYORDER_MAX_WORKERS            64
+#define KEYORDER_DEFAULT_WINDOW         4096
+#define KEYORDER_MAX_KEY_PROP           64
+
+/**
+ * @struct keyorderItem
+ * A message handed to the process function.
+ */
+struct keyorderItem
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_opaqueFlow_pt flow_p;     /**< NULL when there is nothing to acknowledge. */
+    solClient_msgId_t msgId;
+    solClient_uint64_t seq;             /**< In the order received. */
+    solClient_uint32_t keyHash;
+};
+
+/**
+ * Processes a message, on a worker thread. The message is acknowledged
+ * and freed when it returns.
+ * @param item_p The message.
+ * @param worker The worker, from 0.
+ * @param user_p The user pointer given to keyorder_init().
+ */
+typedef void    ( *keyorder_processFunc_t ) ( struct keyorderItem * item_p, int worker, void *user_p );
+
+/**
+ * @struct keyorderStats
+ */
+struct keyorderStats
+{
+    solClient_uint64_t received;        /**< Given to keyorder_put(). */
+    solClient_uint64_t processed;
+    solClient_uint64_t acked;
+    solClient_uint64_t ackFailed;
+    solClient_uint64_t skipped;         /**< Redelivered at or below the watermark. */
+    solClient_uint64_t flowStops;       /**< Times the Flow was stopped at the window. */
+    solClient_uint64_t waits;           /**< keyorder_put() calls that waited for room. */
+    solClient_uint64_t lowSeq;          /**< The watermark: every message below it is done. */
+    solClient_msgId_t lowMsgId;         /**< The ID of the message just below it. */
+    solClient_uint64_t maxLag;          /**< Most messages held above the watermark. */
+};
+
+struct keyorder;
+
+/**
+ * @struct keyorderWorker
+ */
+struct keyorderWorker
+{
+    OS_THREAD       thread;
+    struct keyorder *pool_p;
+    int             index;
+    OS_MUTEX        lock;
+    OS_EVENT        ready;
+    struct keyorderItem *items_p;       /**< A ring of the pool's capacity. */
+    solClient_uint32_t head;
+    solClient_uint32_t count;
+    solClient_uint64_t processed;
+};
+
+/**
+ * @struct keyorder
+ */
+struct keyorder
+{
+    struct keyorderWorker *workers_p;
+    int             numWorkers;
+    int             started;
+    char            keyProp[KEYORDER_MAX_KEY_PROP];     /**< Empty for the topic. */
+    keyorder_processFunc_t process_p;
+    void           *user_p;
+    solClient_uint32_t window;
+    solClient_uint32_t capacity;        /**< Twice the window, for the messages after the stop. */
+    OS_MUTEX        flowLock;           /**< Orders the stops and starts of the Flow; before lock. */
+    OS_MUTEX        lock;               /**< For the watermark and stats below. */
+    OS_EVENT        room;
+    solClient_opaqueFlow_pt stoppedFlow_p;      /**< The Flow stopped at the window, if any. */
+    unsigned char  *done_p;             /**< By sequence number, a ring of capacity. */
+    solClient_msgId_t *ids_p;
+    solClient_uint64_t nextSeq;
+    solClient_uint64_t lowSeq;
+    solClient_msgId_t lowMsgId;
+    volatile int    stop;
+    struct keyorderStats stats;
+};
+
+
+/**
+ * Start the workers.
+ * @param pool_p The pool.
+ * @param numWorkers Worker threads, up to ::KEYORDER_MAX_WORKERS.
+ * @param window Most messages held above the watermark, 0 for ::KEYORDER_DEFAULT_WINDOW.
+ * @param keyProp_p The user property holding the key, NULL or "" for the topic.
+ * @param process_p The process function.
+ * @param user_p Its user pointer.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    keyorder_init ( struct keyorder *pool_p, int numWorkers, solClient_uint32_t window, const char *keyProp_p,
+                    keyorder_processFunc_t process_p, void *user_p );
+
+/**
+ * A received message. Call from the receive callback and return its result.
+ * @param pool_p The pool.
+ * @param flow_p The Flow it came on; NULL when there is nothing to acknowledge.
+ * @param msg_p The message.
+ * @return ::SOLCLIENT_CALLBACK_TAKE_MSG when queued to a worker;
+ * ::SOLCLIENT_CALLBACK_OK when skipped, or when the pool is stopping.
+ * Does not block on a Flow but past twice the window.
+ */
+solClient_rxMsgCallback_returnCode_t
+    keyorder_put ( struct keyorder *pool_p, solClient_opaqueFlow_pt flow_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Copy the counters. Any thread.
+ */
+void
+    keyorder_getStats ( struct keyorder *pool_p, struct keyorderStats *stats_p );
+
+/**
+ * Stop the workers once they finish the message in hand, and free the pool.
+ * Messages still queued are not acknowledged, and are redelivered; the
+ * Flow must be destroyed first, or stopped.
+ */
+void
+    keyorder_destroy ( struct keyorder *pool_p );
+
+#endif /* KEYORDER_H_ */
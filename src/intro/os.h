@@ -24,14 +24,496 @@ extern          "C"
 #include <winsock2.h>
 #include <windows.h>
 #include <winbase.h>
+#include <psapi.h>
+#pragma comment ( lib, "psapi.lib" )
 
 #define SLEEP(sec)  Sleep ( (sec) * 1000 )
+#define OS_SLEEP_US(us)  Sleep ( ( DWORD ) ( ( (us) + 999 ) / 1000 ) )
+#define OS_YIELD()  SwitchToThread (  )
 #define strcasecmp (_stricmp)
 #define strncasecmp (_strnicmp)
+
+#define OS_INLINE   __inline
+#define OS_THREAD_LOCAL __declspec ( thread )
+
+typedef CRITICAL_SECTION OS_MUTEX;
+#define OS_MUTEX_INIT(m)     InitializeCriticalSection ( (m) )
+#define OS_MUTEX_LOCK(m)     EnterCriticalSection ( (m) )
+#define OS_MUTEX_UNLOCK(m)   LeaveCriticalSection ( (m) )
+#define OS_MUTEX_DESTROY(m)  DeleteCriticalSection ( (m) )
+
+/* A lock usable before main(), for rarely taken module-level locks. */
+typedef volatile LONG OS_STATIC_MUTEX;
+#define OS_STATIC_MUTEX_INITIALIZER  0
+#define OS_STATIC_MUTEX_LOCK(m)      while ( InterlockedCompareExchange ( (m), 1, 0 ) != 0 ) Sleep ( 0 )
+#define OS_STATIC_MUTEX_UNLOCK(m)    InterlockedExchange ( (m), 0 )
+
+/* Monotonic time in nanoseconds, for measuring intervals only. */
+static OS_INLINE unsigned long long
+os_getTimeNs ( void )
+{
+    LARGE_INTEGER   freq;
+    LARGE_INTEGER   now;
+
+    QueryPerformanceFrequency ( &freq );
+    QueryPerformanceCounter ( &now );
+    return ( unsigned long long ) ( ( double ) now.QuadPart * 1.0e9 / ( double ) freq.QuadPart );
+}
+
+/* Wall-clock time in nanoseconds since the UNIX epoch, for timestamps. */
+static OS_INLINE unsigned long long
+os_getRealTimeNs ( void )
+{
+    FILETIME        ft;
+    ULARGE_INTEGER  now;
+
+    GetSystemTimeAsFileTime ( &ft );
+    now.LowPart = ft.dwLowDateTime;
+    now.HighPart = ft.dwHighDateTime;
+    return ( unsigned long long ) ( now.QuadPart - 116444736000000000ULL ) * 100ULL;
+}
+
+static OS_INLINE int
+os_getNumCpus ( void )
+{
+    SYSTEM_INFO     info;
+
+    GetSystemInfo ( &info );
+    return ( int ) info.dwNumberOfProcessors;
+}
+
+/* User plus system CPU time of the process in nanoseconds. */
+static OS_INLINE unsigned long long
+os_getCpuTimeNs ( void )
+{
+    FILETIME        created;
+    FILETIME        exited;
+    FILETIME        kernel;
+    FILETIME        user;
+
+    if ( !GetProcessTimes ( GetCurrentProcess (  ), &created, &exited, &kernel, &user ) ) {
+        return 0;
+    }
+    return ( ( ( ( unsigned long long ) kernel.dwHighDateTime << 32 ) | kernel.dwLowDateTime ) +
+             ( ( ( unsigned long long ) user.dwHighDateTime << 32 ) | user.dwLowDateTime ) ) * 100ULL;
+}
+
+/* Resident memory of the process in bytes, 0 if unknown. */
+static OS_INLINE unsigned long long
+os_getResidentBytes ( void )
+{
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if ( !GetProcessMemoryInfo ( GetCurrentProcess (  ), &counters, sizeof ( counters ) ) ) {
+        return 0;
+    }
+    return ( unsigned long long ) counters.WorkingSetSize;
+}
+
+typedef HANDLE OS_THREAD;
+typedef DWORD ( WINAPI * os_threadFunc_t ) ( LPVOID );
+#define OS_THREAD_FUNC(name, arg_p)  DWORD WINAPI name ( LPVOID arg_p )
+#define OS_THREAD_RETURN             return 0
+
+static OS_INLINE int
+os_threadCreate ( OS_THREAD * thread_p, os_threadFunc_t func_p, void *arg_p )
+{
+    *thread_p = CreateThread ( NULL, 0, func_p, arg_p, 0, NULL );
+    return ( *thread_p != NULL ) ? 0 : -1;
+}
+
+static OS_INLINE void
+os_threadJoin ( OS_THREAD thread )
+{
+    WaitForSingleObject ( thread, INFINITE );
+    CloseHandle ( thread );
+}
+
+/* An auto-reset event: a signal wakes one waiter, or the next one to wait. */
+typedef HANDLE OS_EVENT;
+
+static OS_INLINE int
+os_eventInit ( OS_EVENT * event_p )
+{
+    *event_p = CreateEvent ( NULL, FALSE, FALSE, NULL );
+    return ( *event_p != NULL ) ? 0 : -1;
+}
+
+static OS_INLINE void
+os_eventSignal ( OS_EVENT * event_p )
+{
+    SetEvent ( *event_p );
+}
+
+/* Returns 0 when signalled, -1 on timeout. */
+static OS_INLINE int
+os_eventWait ( OS_EVENT * event_p, unsigned int timeoutMs )
+{
+    return ( WaitForSingleObject ( *event_p, timeoutMs ) == WAIT_OBJECT_0 ) ? 0 : -1;
+}
+
+/* As os_eventWait(), rounded up to the millisecond timer resolution. */
+static OS_INLINE int
+os_eventWaitUs ( OS_EVENT * event_p, unsigned long long timeoutUs )
+{
+    return os_eventWait ( event_p, ( unsigned int ) ( ( timeoutUs + 999ULL ) / 1000ULL ) );
+}
+
+static OS_INLINE void
+os_eventDestroy ( OS_EVENT * event_p )
+{
+    CloseHandle ( *event_p );
+}
+
+/* A memory mapping of a whole file; read-only from os_mapFile(). */
+struct os_mappedFile
+{
+    const void     *addr_p;
+    size_t          size;
+    HANDLE          file;
+    HANDLE          mapping;
+};
+
+static OS_INLINE int
+os_mapFile ( const char *path_p, struct os_mappedFile *map_p )
+{
+    DWORD           sizeLow;
+    DWORD           sizeHigh = 0;
+
+    memset ( map_p, 0, sizeof ( *map_p ) );
+    map_p->file = CreateFileA ( path_p, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if ( map_p->file == INVALID_HANDLE_VALUE ) {
+        return -1;
+    }
+    sizeLow = GetFileSize ( map_p->file, &sizeHigh );
+    if ( ( sizeLow == INVALID_FILE_SIZE && GetLastError (  ) != NO_ERROR ) || ( sizeLow == 0 && sizeHigh == 0 ) ||
+         ( map_p->mapping = CreateFileMappingA ( map_p->file, NULL, PAGE_READONLY, 0, 0, NULL ) ) == NULL ) {
+        CloseHandle ( map_p->file );
+        return -1;
+    }
+    map_p->size = ( size_t ) ( ( ( unsigned long long ) sizeHigh << 32 ) | sizeLow );
+    if ( ( map_p->addr_p = MapViewOfFile ( map_p->mapping, FILE_MAP_READ, 0, 0, 0 ) ) == NULL ) {
+        CloseHandle ( map_p->mapping );
+        CloseHandle ( map_p->file );
+        return -1;
+    }
+    return 0;
+}
+
+/* A shared read-write mapping of a file, created or extended to at least size bytes. */
+static OS_INLINE int
+os_mapFileWritable ( const char *path_p, size_t size, struct os_mappedFile *map_p )
+{
+    LARGE_INTEGER   fileSize;
+
+    memset ( map_p, 0, sizeof ( *map_p ) );
+    map_p->file = CreateFileA ( path_p, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( map_p->file == INVALID_HANDLE_VALUE ) {
+        return -1;
+    }
+    if ( !GetFileSizeEx ( map_p->file, &fileSize ) ) {
+        CloseHandle ( map_p->file );
+        return -1;
+    }
+    if ( ( unsigned long long ) fileSize.QuadPart > size ) {
+        size = ( size_t ) fileSize.QuadPart;
+    }
+    if ( ( map_p->mapping = CreateFileMappingA ( map_p->file, NULL, PAGE_READWRITE,
+                                                 ( DWORD ) ( ( unsigned long long ) size >> 32 ), ( DWORD ) size,
+                                                 NULL ) ) == NULL ) {
+        CloseHandle ( map_p->file );
+        return -1;
+    }
+    if ( ( map_p->addr_p = MapViewOfFile ( map_p->mapping, FILE_MAP_WRITE, 0, 0, 0 ) ) == NULL ) {
+        CloseHandle ( map_p->mapping );
+        CloseHandle ( map_p->file );
+        return -1;
+    }
+    map_p->size = size;
+    return 0;
+}
+
+/* Write a range of a writable mapping back to the file, waiting for the disk. */
+static OS_INLINE int
+os_syncMappedFile ( struct os_mappedFile *map_p, size_t offset, size_t len )
+{
+    if ( !FlushViewOfFile ( ( const char * ) map_p->addr_p + offset, len ) ) {
+        return -1;
+    }
+    return FlushFileBuffers ( map_p->file ) ? 0 : -1;
+}
+
+static OS_INLINE void
+os_unmapFile ( struct os_mappedFile *map_p )
+{
+    UnmapViewOfFile ( map_p->addr_p );
+    CloseHandle ( map_p->mapping );
+    CloseHandle ( map_p->file );
+    map_p->addr_p = NULL;
+}
 #else
 #include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
 
 #define SLEEP(sec) sleep ( (sec) )
+#define OS_SLEEP_US(us) usleep ( ( useconds_t ) (us) )
+#define OS_YIELD() sched_yield (  )
+
+#define OS_INLINE   inline
+#define OS_THREAD_LOCAL __thread
+
+typedef pthread_mutex_t OS_MUTEX;
+#define OS_MUTEX_INIT(m)     pthread_mutex_init ( (m), NULL )
+#define OS_MUTEX_LOCK(m)     pthread_mutex_lock ( (m) )
+#define OS_MUTEX_UNLOCK(m)   pthread_mutex_unlock ( (m) )
+#define OS_MUTEX_DESTROY(m)  pthread_mutex_destroy ( (m) )
+
+/* A lock usable before main(), for rarely taken module-level locks. */
+typedef pthread_mutex_t OS_STATIC_MUTEX;
+#define OS_STATIC_MUTEX_INITIALIZER  PTHREAD_MUTEX_INITIALIZER
+#define OS_STATIC_MUTEX_LOCK(m)      pthread_mutex_lock ( (m) )
+#define OS_STATIC_MUTEX_UNLOCK(m)    pthread_mutex_unlock ( (m) )
+
+/* Monotonic time in nanoseconds, for measuring intervals only. */
+static OS_INLINE unsigned long long
+os_getTimeNs ( void )
+{
+    struct timespec ts;
+
+    clock_gettime ( CLOCK_MONOTONIC, &ts );
+    return ( unsigned long long ) ts.tv_sec * 1000000000ULL + ( unsigned long long ) ts.tv_nsec;
+}
+
+/* Wall-clock time in nanoseconds since the UNIX epoch, for timestamps. */
+static OS_INLINE unsigned long long
+os_getRealTimeNs ( void )
+{
+    struct timespec ts;
+
+    clock_gettime ( CLOCK_REALTIME, &ts );
+    return ( unsigned long long ) ts.tv_sec * 1000000000ULL + ( unsigned long long ) ts.tv_nsec;
+}
+
+static OS_INLINE int
+os_getNumCpus ( void )
+{
+    long            n = sysconf ( _SC_NPROCESSORS_ONLN );
+
+    return ( n > 0 ) ? ( int ) n : 1;
+}
+
+/* User plus system CPU time of the process in nanoseconds. */
+static OS_INLINE unsigned long long
+os_getCpuTimeNs ( void )
+{
+    struct rusage   usage;
+
+    if ( getrusage ( RUSAGE_SELF, &usage ) != 0 ) {
+        return 0;
+    }
+    return ( unsigned long long ) ( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) * 1000000000ULL +
+        ( unsigned long long ) ( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec ) * 1000ULL;
+}
+
+/* Resident memory of the process in bytes, 0 if unknown. */
+static OS_INLINE unsigned long long
+os_getResidentBytes ( void )
+{
+#ifdef __linux__
+    unsigned long long pages = 0;
+    unsigned long long resident = 0;
+    FILE           *file_p;
+
+    if ( ( file_p = fopen ( "/proc/self/statm", "r" ) ) == NULL ) {
+        return 0;
+    }
+    if ( fscanf ( file_p, "%llu %llu", &pages, &resident ) != 2 ) {
+        resident = 0;
+    }
+    fclose ( file_p );
+    return resident * ( unsigned long long ) sysconf ( _SC_PAGESIZE );
+#else
+    /* Elsewhere only the peak is at hand; it is in bytes on macOS. */
+    struct rusage   usage;
+
+    if ( getrusage ( RUSAGE_SELF, &usage ) != 0 ) {
+        return 0;
+    }
+    return ( unsigned long long ) usage.ru_maxrss;
+#endif
+}
+
+typedef pthread_t OS_THREAD;
+typedef void   *( *os_threadFunc_t ) ( void * );
+#define OS_THREAD_FUNC(name, arg_p)  void *name ( void *arg_p )
+#define OS_THREAD_RETURN             return NULL
+
+static OS_INLINE int
+os_threadCreate ( OS_THREAD * thread_p, os_threadFunc_t func_p, void *arg_p )
+{
+    return ( pthread_create ( thread_p, NULL, func_p, arg_p ) == 0 ) ? 0 : -1;
+}
+
+static OS_INLINE void
+os_threadJoin ( OS_THREAD thread )
+{
+    pthread_join ( thread, NULL );
+}
+
+/* An auto-reset event: a signal wakes one waiter, or the next one to wait. */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    int             signalled;
+} OS_EVENT;
+
+static OS_INLINE int
+os_eventInit ( OS_EVENT * event_p )
+{
+    event_p->signalled = 0;
+    if ( pthread_mutex_init ( &event_p->lock, NULL ) != 0 ) {
+        return -1;
+    }
+    if ( pthread_cond_init ( &event_p->cond, NULL ) != 0 ) {
+        pthread_mutex_destroy ( &event_p->lock );
+        return -1;
+    }
+    return 0;
+}
+
+static OS_INLINE void
+os_eventSignal ( OS_EVENT * event_p )
+{
+    pthread_mutex_lock ( &event_p->lock );
+    event_p->signalled = 1;
+    pthread_cond_signal ( &event_p->cond );
+    pthread_mutex_unlock ( &event_p->lock );
+}
+
+/* Returns 0 when signalled, -1 on timeout. */
+static OS_INLINE int
+os_eventWaitUs ( OS_EVENT * event_p, unsigned long long timeoutUs )
+{
+    struct timespec deadline;
+    int             rc = 0;
+
+    clock_gettime ( CLOCK_REALTIME, &deadline );
+    deadline.tv_sec += ( time_t ) ( timeoutUs / 1000000ULL );
+    deadline.tv_nsec += ( long ) ( timeoutUs % 1000000ULL ) * 1000L;
+    if ( deadline.tv_nsec >= 1000000000L ) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_mutex_lock ( &event_p->lock );
+    while ( !event_p->signalled && rc == 0 ) {
+        rc = pthread_cond_timedwait ( &event_p->cond, &event_p->lock, &deadline );
+    }
+    rc = event_p->signalled ? 0 : -1;
+    event_p->signalled = 0;
+    pthread_mutex_unlock ( &event_p->lock );
+    return rc;
+}
+
+static OS_INLINE int
+os_eventWait ( OS_EVENT * event_p, unsigned int timeoutMs )
+{
+    return os_eventWaitUs ( event_p, ( unsigned long long ) timeoutMs * 1000ULL );
+}
+
+static OS_INLINE void
+os_eventDestroy ( OS_EVENT * event_p )
+{
+    pthread_cond_destroy ( &event_p->cond );
+    pthread_mutex_destroy ( &event_p->lock );
+}
+
+/* A memory mapping of a whole file; read-only from os_mapFile(). */
+struct os_mappedFile
+{
+    const void     *addr_p;
+    size_t          size;
+};
+
+static OS_INLINE int
+os_mapFile ( const char *path_p, struct os_mappedFile *map_p )
+{
+    struct stat     st;
+    void           *addr_p;
+    int             fd;
+
+    memset ( map_p, 0, sizeof ( *map_p ) );
+    if ( ( fd = open ( path_p, O_RDONLY ) ) < 0 ) {
+        return -1;
+    }
+    if ( fstat ( fd, &st ) != 0 || st.st_size == 0 ||
+         ( addr_p = mmap ( NULL, ( size_t ) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 ) ) == MAP_FAILED ) {
+        close ( fd );
+        return -1;
+    }
+    close ( fd );
+    madvise ( addr_p, ( size_t ) st.st_size, MADV_SEQUENTIAL );
+    map_p->addr_p = addr_p;
+    map_p->size = ( size_t ) st.st_size;
+    return 0;
+}
+
+/* A shared read-write mapping of a file, created or extended to at least size bytes. */
+static OS_INLINE int
+os_mapFileWritable ( const char *path_p, size_t size, struct os_mappedFile *map_p )
+{
+    struct stat     st;
+    void           *addr_p;
+    int             fd;
+
+    memset ( map_p, 0, sizeof ( *map_p ) );
+    if ( ( fd = open ( path_p, O_RDWR | O_CREAT, 0644 ) ) < 0 ) {
+        return -1;
+    }
+    if ( fstat ( fd, &st ) != 0 ) {
+        close ( fd );
+        return -1;
+    }
+    if ( ( size_t ) st.st_size > size ) {
+        size = ( size_t ) st.st_size;
+    } else if ( ( size_t ) st.st_size < size && ftruncate ( fd, ( off_t ) size ) != 0 ) {
+        close ( fd );
+        return -1;
+    }
+    if ( ( addr_p = mmap ( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 ) ) == MAP_FAILED ) {
+        close ( fd );
+        return -1;
+    }
+    close ( fd );
+    map_p->addr_p = addr_p;
+    map_p->size = size;
+    return 0;
+}
+
+/* Write a range of a writable mapping back to the file, waiting for the disk. */
+static OS_INLINE int
+os_syncMappedFile ( struct os_mappedFile *map_p, size_t offset, size_t len )
+{
+    size_t          pageMask = ( size_t ) sysconf ( _SC_PAGESIZE ) - 1;
+
+    len += offset & pageMask;
+    offset &= ~pageMask;
+    return msync ( ( char * ) map_p->addr_p + offset, len, MS_SYNC );
+}
+
+static OS_INLINE void
+os_unmapFile ( struct os_mappedFile *map_p )
+{
+    munmap ( ( void * ) map_p->addr_p, map_p->size );
+    map_p->addr_p = NULL;
+}
 #endif
 
 
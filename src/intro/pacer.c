@@ -0,0 +1,243 @@
+
+/** example Intro/pacer.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Open-loop send pacing with a sleep-then-spin wait. See pacer.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "common.h"
+#include "pacer.h"
+
+#define PACER_CALIBRATION_SLEEPS    20
+#define PACER_CALIBRATION_US        50
+
+
+/*****************************************************************************
+ * pacer_log
+ *
+ * Natural logarithm of x in (0, 1], to about 1e-7, without libm: x is
+ * scaled into [1, 2) and the rest comes from the atanh series.
+ *****************************************************************************/
+static double
+pacer_log ( double x )
+{
+    double          z;
+    double          z2;
+    int             halvings = 0;
+
+    while ( x < 1.0 ) {
+        x *= 2.0;
+        halvings++;
+    }
+    z = ( x - 1.0 ) / ( x + 1.0 );
+    z2 = z * z;
+    return 2.0 * z * ( 1.0 + z2 * ( 1.0 / 3.0 + z2 * ( 1.0 / 5.0 + z2 * ( 1.0 / 7.0 + z2 * ( 1.0 / 9.0 ) ) ) ) ) -
+        ( double ) halvings * 0.69314718055994530942;
+}
+
+/*****************************************************************************
+ * pacer_advance
+ *
+ * Moves nextNs to the following send time of the pattern.
+ *****************************************************************************/
+static void
+pacer_advance ( struct pacer *pacer_p )
+{
+    double          gapNs = 1.0e9 / pacer_p->rate;
+    solClient_uint64_t x;
+
+    switch ( pacer_p->pattern ) {
+        case PACER_POISSON:
+            /* The top 53 bits give a uniform value in (0, 1]. */
+            x = common_random ( &pacer_p->random );
+            pacer_p->nextNs -= gapNs * pacer_log ( ( double ) ( ( x >> 11 ) + 1 ) / 9007199254740992.0 );
+            break;
+        case PACER_BURST:
+            if ( ++pacer_p->inBurst >= pacer_p->burstSize ) {
+                pacer_p->inBurst = 0;
+                pacer_p->nextNs += gapNs * ( double ) pacer_p->burstSize;
+            }
+            break;
+        default:
+            pacer_p->nextNs += gapNs;
+            break;
+    }
+}
+
+
+/*****************************************************************************
+ * pacer_init
+ *****************************************************************************/
+solClient_returnCode_t
+pacer_init ( struct pacer *pacer_p, double rate, int pattern, unsigned int burstSize )
+{
+    unsigned long long beforeNs;
+    unsigned long long overshootNs;
+    unsigned long long maxOvershootNs = 0;
+    int             i;
+
+    memset ( pacer_p, 0, sizeof ( *pacer_p ) );
+    if ( rate <= 0.0 || pattern < PACER_CONSTANT || pattern > PACER_BURST ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "pacer_init() rate %f or pattern %d not valid", rate, pattern );
+        return SOLCLIENT_FAIL;
+    }
+    pacer_p->rate = rate;
+    pacer_p->pattern = pattern;
+    pacer_p->burstSize = ( burstSize != 0 ) ? burstSize : PACER_DEFAULT_BURST_SIZE;
+    pacer_p->random = COMMON_RANDOM_SEED;
+
+    /* Spin for twice the worst wake-up delay seen. */
+    for ( i = 0; i < PACER_CALIBRATION_SLEEPS; i++ ) {
+        beforeNs = os_getTimeNs (  );
+        OS_SLEEP_US ( PACER_CALIBRATION_US );
+        overshootNs = os_getTimeNs (  ) - beforeNs;
+        overshootNs = ( overshootNs > PACER_CALIBRATION_US * 1000ULL ) ? overshootNs - PACER_CALIBRATION_US * 1000ULL : 0;
+        if ( overshootNs > maxOvershootNs ) {
+            maxOvershootNs = overshootNs;
+        }
+    }
+    pacer_p->spinNs = 2 * maxOvershootNs;
+    if ( pacer_p->spinNs < PACER_MIN_SPIN_NS ) {
+        pacer_p->spinNs = PACER_MIN_SPIN_NS;
+    } else if ( pacer_p->spinNs > PACER_MAX_SPIN_NS ) {
+        pacer_p->spinNs = PACER_MAX_SPIN_NS;
+    }
+
+    pacer_p->maxLagNs = PACER_DEFAULT_MAX_LAG_NS;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * pacer_start
+ *****************************************************************************/
+void
+pacer_start ( struct pacer *pacer_p )
+{
+    memset ( &pacer_p->stats, 0, sizeof ( pacer_p->stats ) );
+    pacer_p->nextNs = 0.0;
+    pacer_p->inBurst = 0;
+    pacer_p->startNs = os_getTimeNs (  );
+}
+
+/*****************************************************************************
+ * pacer_wait
+ *****************************************************************************/
+unsigned long long
+pacer_wait ( struct pacer *pacer_p )
+{
+    struct pacerStats *stats_p = &pacer_p->stats;
+    unsigned long long scheduledNs = pacer_p->startNs + ( unsigned long long ) pacer_p->nextNs;
+    unsigned long long nowNs = os_getTimeNs (  );
+    unsigned long long targetNs = scheduledNs;
+    unsigned long long lateNs;
+    unsigned long long jitterNs;
+    int             resync = 0;
+
+    if ( nowNs > scheduledNs + pacer_p->maxLagNs ) {
+        /* Too far behind to be worth catching up; move the timeline. */
+        pacer_p->startNs += nowNs - scheduledNs;
+        scheduledNs = nowNs;
+        stats_p->resyncs++;
+        resync = 1;
+    } else if ( nowNs > scheduledNs && stats_p->sends != 0 ) {
+        /* Behind: catch up, but at no more than PACER_CATCH_UP times the scheduled pace. */
+        targetNs = pacer_p->lastNs + ( scheduledNs - pacer_p->lastScheduledNs ) / PACER_CATCH_UP;
+    }
+    if ( targetNs > nowNs ) {
+        if ( targetNs - nowNs > pacer_p->spinNs ) {
+            OS_SLEEP_US ( ( targetNs - nowNs - pacer_p->spinNs ) / 1000ULL );
+        }
+        while ( ( nowNs = os_getTimeNs (  ) ) < targetNs ) {
+            /* Spin. */
+        }
+    }
+
+    lateNs = nowNs - scheduledNs;
+    common_histogramAdd ( &stats_p->lateNs, lateNs );
+    if ( stats_p->sends == 0 ) {
+        pacer_p->firstNs = nowNs;
+    } else if ( !resync ) {
+        jitterNs = nowNs - pacer_p->lastNs;
+        jitterNs = ( jitterNs > scheduledNs - pacer_p->lastScheduledNs ) ?
+            jitterNs - ( scheduledNs - pacer_p->lastScheduledNs ) : ( scheduledNs - pacer_p->lastScheduledNs ) - jitterNs;
+        common_histogramAdd ( &stats_p->jitterNs, jitterNs );
+    }
+    stats_p->sends++;
+    stats_p->elapsedNs = nowNs - pacer_p->firstNs;
+    pacer_p->lastNs = nowNs;
+    pacer_p->lastScheduledNs = scheduledNs;
+
+    pacer_advance ( pacer_p );
+    return scheduledNs;
+}
+
+/*****************************************************************************
+ * pacer_printStats
+ *****************************************************************************/
+void
+pacer_printStats ( const struct pacer *pacer_p )
+{
+    const struct pacerStats *stats_p = &pacer_p->stats;
+
+    printf ( "%-8s target %.0f msgs/s, achieved %.0f msgs/s over %llu sends, spin %.1f us, resyncs %llu\n",
+             pacer_patternToString ( pacer_p->pattern ), pacer_p->rate,
+             ( stats_p->elapsedNs != 0 ) ? ( double ) ( stats_p->sends - 1 ) * 1.0e9 / ( double ) stats_p->elapsedNs : 0.0,
+             ( unsigned long long ) stats_p->sends, ( double ) pacer_p->spinNs / 1000.0,
+             ( unsigned long long ) stats_p->resyncs );
+    printf ( "         late   p50 %8.2f us  p99 %8.2f us  max %8.2f us\n",
+             ( double ) common_histogramPercentile ( &stats_p->lateNs, 50.0 ) / 1000.0,
+             ( double ) common_histogramPercentile ( &stats_p->lateNs, 99.0 ) / 1000.0,
+             ( double ) stats_p->lateNs.max / 1000.0 );
+    printf ( "         jitter mean %7.2f us  p99 %8.2f us  max %8.2f us\n",
+             common_histogramMean ( &stats_p->jitterNs ) / 1000.0,
+             ( double ) common_histogramPercentile ( &stats_p->jitterNs, 99.0 ) / 1000.0,
+             ( double ) stats_p->jitterNs.max / 1000.0 );
+}
+
+/*****************************************************************************
+ * pacer_patternFromString
+ *****************************************************************************/
+int
+pacer_patternFromString ( const char *pattern_p )
+{
+    if ( strcmp ( pattern_p, "constant" ) == 0 ) {
+        return PACER_CONSTANT;
+    }
+    if ( strcmp ( pattern_p, "poisson" ) == 0 ) {
+        return PACER_POISSON;
+    }
+    if ( strcmp ( pattern_p, "burst" ) == 0 ) {
+        return PACER_BURST;
+    }
+    return -1;
+}
+
+/*****************************************************************************
+ * pacer_patternToString
+ *****************************************************************************/
+const char     *
+pacer_patternToString ( int pattern )
+{
+    switch ( pattern ) {
+        case PACER_CONSTANT:
+            return "constant";
+        case PACER_POISSON:
+            return "poisson";
+        case PACER_BURST:
+            return "burst";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,121 @@
+/** example Intro/pacer.h
+ */
+
+/**
+ *
+ * file pacer.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides an open-loop send pacer for publishers. Send
+ * times are laid out on a timeline fixed at pacer_start() for one of three
+ * arrival patterns:
+ *
+ *   PACER_CONSTANT   one send every 1/rate seconds.
+ *   PACER_POISSON    exponentially distributed gaps with mean 1/rate.
+ *   PACER_BURST      trains of burstSize back-to-back sends, burstSize/rate apart.
+ *
+ * pacer_wait() sleeps until shortly before the next send time and spins for
+ * the rest, the spin margin being measured by pacer_init() from how late
+ * the OS wakes sleepers. Because send times are computed from the start of
+ * the timeline rather than from the previous send, lateness does not
+ * accumulate into drift. A publisher that falls behind catches up, but with
+ * gaps no shorter than 1/PACER_CATCH_UP of the scheduled ones, so a stall is
+ * not followed by a burst. Beyond maxLagNs behind, the timeline is moved
+ * forward instead (a resync) and the missed sends are given up.
+ */
+
+#ifndef PACER_H_
+#define PACER_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "common.h"
+
+#define PACER_CONSTANT              0
+#define PACER_POISSON               1
+#define PACER_BURST                 2
+
+#define PACER_DEFAULT_BURST_SIZE    10
+#define PACER_MIN_SPIN_NS           20000ULL    /**< Spin at least the last 20 us. */
+#define PACER_MAX_SPIN_NS           2000000ULL  /**< And at most the last 2 ms. */
+#define PACER_CATCH_UP              2           /**< Pace multiple while behind schedule. */
+#define PACER_DEFAULT_MAX_LAG_NS    100000000ULL    /**< Resync when 100 ms behind. */
+
+/**
+ * @struct pacerStats
+ */
+struct pacerStats
+{
+    solClient_uint64_t sends;
+    solClient_uint64_t resyncs;         /**< Times the timeline was moved forward. */
+    unsigned long long elapsedNs;       /**< From the first send to the last. */
+    struct commonHistogram lateNs;      /**< Send time minus scheduled time. */
+    struct commonHistogram jitterNs;    /**< |actual gap - scheduled gap| between sends, after the first. */
+};
+
+/**
+ * @struct pacer
+ */
+struct pacer
+{
+    int             pattern;
+    double          rate;               /**< Sends per second. */
+    unsigned int    burstSize;
+    unsigned long long spinNs;          /**< Spin instead of sleeping for the last spinNs. */
+    unsigned long long maxLagNs;        /**< Resync rather than catch up beyond this. */
+    double          nextNs;             /**< Next send, relative to startNs. */
+    unsigned long long startNs;         /**< Start of the timeline, moved forward by resyncs. */
+    unsigned long long firstNs;         /**< Time of the first send. */
+    unsigned long long lastNs;          /**< Time of the previous send. */
+    unsigned long long lastScheduledNs;
+    unsigned int    inBurst;
+    solClient_uint64_t random;
+    struct pacerStats stats;
+};
+
+
+/**
+ * Configure a pacer and measure its spin margin, which takes a few ms.
+ * @param pacer_p The pacer to initialize.
+ * @param rate Sends per second, more than 0.
+ * @param pattern ::PACER_CONSTANT, ::PACER_POISSON or ::PACER_BURST.
+ * @param burstSize Sends per train for ::PACER_BURST, 0 for the default.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    pacer_init ( struct pacer *pacer_p, double rate, int pattern, unsigned int burstSize );
+
+/**
+ * Start the timeline; the first send is due at once.
+ */
+void
+    pacer_start ( struct pacer *pacer_p );
+
+/**
+ * Wait until the next send is due.
+ * @return The scheduled time of the send, on the os_getTimeNs() clock.
+ */
+unsigned long long
+    pacer_wait ( struct pacer *pacer_p );
+
+/**
+ * Print the achieved rate, lateness and jitter.
+ */
+void
+    pacer_printStats ( const struct pacer *pacer_p );
+
+/**
+ * Parse "constant", "poisson" or "burst".
+ * @return The pattern, or -1.
+ */
+int
+    pacer_patternFromString ( const char *pattern_p );
+
+/**
+ * The name of a pattern.
+ */
+const char     *
+    pacer_patternToString ( int pattern );
+
+#endif /* PACER_H_ */
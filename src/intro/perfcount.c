@@ -0,0 +1,232 @@
+
+/** example Intro/perfcount.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Hardware performance counters for the benchmarks. See perfcount.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "perfcount.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+static const struct
+{
+    solClient_uint32_t type;
+    solClient_uint64_t config;
+} perfcount_events[PERFCOUNT_NUM] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES }
+};
+
+/*****************************************************************************
+ * perfcount_openEvent
+ *****************************************************************************/
+static int
+perfcount_openEvent ( int counter, int userOnly )
+{
+    struct perf_event_attr attr;
+
+    memset ( &attr, 0, sizeof ( attr ) );
+    attr.size = sizeof ( attr );
+    attr.type = perfcount_events[counter].type;
+    attr.config = perfcount_events[counter].config;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.inherit = 1;
+    attr.exclude_kernel = userOnly;
+    attr.exclude_hv = 1;
+    return ( int ) syscall ( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+}
+
+/*****************************************************************************
+ * perfcount_read
+ *****************************************************************************/
+static void
+perfcount_read ( struct perfCount *perf_p, int counter, struct perfCountSample *sample_p )
+{
+    solClient_uint64_t buf[3];
+    struct rusage   usage;
+
+    memset ( sample_p, 0, sizeof ( *sample_p ) );
+    if ( perf_p->fd[counter] >= 0 ) {
+        if ( read ( perf_p->fd[counter], buf, sizeof ( buf ) ) == ( ssize_t ) sizeof ( buf ) ) {
+            sample_p->value = buf[0];
+            sample_p->enabledNs = buf[1];
+            sample_p->runningNs = buf[2];
+        }
+    } else if ( counter == PERFCOUNT_CONTEXT_SWITCHES && getrusage ( RUSAGE_SELF, &usage ) == 0 ) {
+        sample_p->value = ( solClient_uint64_t ) ( usage.ru_nvcsw + usage.ru_nivcsw );
+    }
+}
+#endif
+
+/*****************************************************************************
+ * perfcount_open
+ *****************************************************************************/
+solClient_returnCode_t
+perfcount_open ( struct perfCount *perf_p )
+{
+    int             counter;
+    int             numOpen = 0;
+
+    memset ( perf_p, 0, sizeof ( *perf_p ) );
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        perf_p->fd[counter] = -1;
+    }
+#ifdef __linux__
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        perf_p->fd[counter] = perfcount_openEvent ( counter, perf_p->userOnly );
+        if ( perf_p->fd[counter] < 0 && ( errno == EACCES || errno == EPERM ) && !perf_p->userOnly ) {
+            /* Not allowed to count the kernel: count the rest in user time only. */
+            perf_p->userOnly = 1;
+            while ( --counter >= 0 ) {
+                if ( perf_p->fd[counter] >= 0 ) {
+                    close ( perf_p->fd[counter] );
+                    perf_p->fd[counter] = -1;
+                    numOpen--;
+                }
+            }
+            continue;
+        }
+        if ( perf_p->fd[counter] >= 0 ) {
+            numOpen++;
+        }
+    }
+    /* A user-time context switch count is always zero. */
+    if ( perf_p->userOnly && perf_p->fd[PERFCOUNT_CONTEXT_SWITCHES] >= 0 ) {
+        close ( perf_p->fd[PERFCOUNT_CONTEXT_SWITCHES] );
+        perf_p->fd[PERFCOUNT_CONTEXT_SWITCHES] = -1;
+        numOpen--;
+    }
+    if ( numOpen == 0 ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "No performance counters available (perf_event_open(): %s)",
+                        strerror ( errno ) );
+        return SOLCLIENT_FAIL;
+    }
+    if ( perf_p->fd[PERFCOUNT_CYCLES] < 0 ) {
+        solClient_log ( SOLCLIENT_LOG_NOTICE, "No hardware performance counters on this host" );
+    }
+    return SOLCLIENT_OK;
+#else
+    solClient_log ( SOLCLIENT_LOG_WARNING, "Performance counters are only available on Linux" );
+    return SOLCLIENT_FAIL;
+#endif
+}
+
+/*****************************************************************************
+ * perfcount_start
+ *****************************************************************************/
+void
+perfcount_start ( struct perfCount *perf_p )
+{
+#ifdef __linux__
+    int             counter;
+
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        perfcount_read ( perf_p, counter, &perf_p->start[counter] );
+    }
+#endif
+}
+
+/*****************************************************************************
+ * perfcount_stop
+ *****************************************************************************/
+void
+perfcount_stop ( struct perfCount *perf_p, struct perfCountValues *values_p )
+{
+    int             counter;
+
+    memset ( values_p, 0, sizeof ( *values_p ) );
+#ifdef __linux__
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        struct perfCountSample end;
+        solClient_uint64_t enabledNs;
+        solClient_uint64_t runningNs;
+
+        perfcount_read ( perf_p, counter, &end );
+        values_p->count[counter] = end.value - perf_p->start[counter].value;
+        if ( perf_p->fd[counter] < 0 ) {
+            values_p->valid[counter] = ( counter == PERFCOUNT_CONTEXT_SWITCHES );
+            continue;
+        }
+        enabledNs = end.enabledNs - perf_p->start[counter].enabledNs;
+        runningNs = end.runningNs - perf_p->start[counter].runningNs;
+        if ( runningNs == 0 ) {
+            /* Never got onto the PMU during the measurement. */
+            continue;
+        }
+        if ( runningNs < enabledNs ) {
+            values_p->count[counter] = ( solClient_uint64_t ) ( ( double ) values_p->count[counter] *
+                                                                ( double ) enabledNs / ( double ) runningNs );
+        }
+        values_p->valid[counter] = 1;
+    }
+#endif
+}
+
+/*****************************************************************************
+ * perfcount_print
+ *****************************************************************************/
+void
+perfcount_print ( FILE * file_p, const char *prefix_p, const struct perfCountValues *values_p, double units,
+                  const char *unitName_p )
+{
+    static const char *names[PERFCOUNT_NUM] = { "cycles", "instr", "cache-miss", "branch-miss", "ctx-sw" };
+    int             counter;
+
+    if ( units <= 0 ) {
+        return;
+    }
+    fprintf ( file_p, "%sperf per %s:", prefix_p, unitName_p );
+    if ( values_p->valid[PERFCOUNT_CYCLES] && values_p->valid[PERFCOUNT_INSTRUCTIONS] &&
+         values_p->count[PERFCOUNT_CYCLES] != 0 ) {
+        fprintf ( file_p, " IPC %.2f,", ( double ) values_p->count[PERFCOUNT_INSTRUCTIONS] /
+                  ( double ) values_p->count[PERFCOUNT_CYCLES] );
+    } else {
+        fprintf ( file_p, " IPC n/a," );
+    }
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        if ( values_p->valid[counter] ) {
+            fprintf ( file_p, " %s %.*f%s", names[counter], ( counter < PERFCOUNT_CACHE_MISSES ) ? 1 : 4,
+                      ( double ) values_p->count[counter] / units, ( counter < PERFCOUNT_NUM - 1 ) ? "," : "" );
+        } else {
+            fprintf ( file_p, " %s n/a%s", names[counter], ( counter < PERFCOUNT_NUM - 1 ) ? "," : "" );
+        }
+    }
+    fprintf ( file_p, "\n" );
+}
+
+/*****************************************************************************
+ * perfcount_close
+ *****************************************************************************/
+void
+perfcount_close ( struct perfCount *perf_p )
+{
+#ifdef __linux__
+    int             counter;
+
+    for ( counter = 0; counter < PERFCOUNT_NUM; counter++ ) {
+        if ( perf_p->fd[counter] >= 0 ) {
+            close ( perf_p->fd[counter] );
+            perf_p->fd[counter] = -1;
+        }
+    }
+#endif
+}
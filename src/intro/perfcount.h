@@ -0,0 +1,113 @@
+/** example Intro/perfcount.h
+ */
+
+/**
+ *
+ * file perfcount.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides hardware performance counters for the
+ * benchmark samples (--perf): cycles, instructions, cache misses, branch
+ * misses and context switches, read with perf_event_open() on Linux.
+ *
+ * The counters follow the calling thread and every thread it starts after
+ * perfcount_open(), so open them before creating the Context (whose thread
+ * then counts too) and any worker threads. A measurement is the difference
+ * between perfcount_start() and perfcount_stop(); perfcount_print()
+ * divides it by the number of messages or operations.
+ *
+ * Counters the host does not offer (virtual machines often have no PMU)
+ * are reported as n/a. Kernel time is counted when the process may
+ * (kernel.perf_event_paranoid <= 1 or CAP_PERFMON), otherwise user time
+ * only; context switches are then taken from getrusage(), which also covers
+ * the whole process. Counters multiplexed with other users of the PMU are
+ * scaled up by the fraction of time they ran. Elsewhere than Linux,
+ * perfcount_open() fails and the benchmarks run without counters.
+ */
+
+#ifndef PERFCOUNT_H_
+#define PERFCOUNT_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+
+#define PERFCOUNT_CYCLES            0
+#define PERFCOUNT_INSTRUCTIONS      1
+#define PERFCOUNT_CACHE_MISSES      2
+#define PERFCOUNT_BRANCH_MISSES     3
+#define PERFCOUNT_CONTEXT_SWITCHES  4
+#define PERFCOUNT_NUM               5
+
+/**
+ * @struct perfCountValues
+ * Counts over one measurement.
+ */
+struct perfCountValues
+{
+    solClient_uint64_t count[PERFCOUNT_NUM];
+    int             valid[PERFCOUNT_NUM];
+};
+
+/**
+ * @struct perfCountSample
+ * Raw readings of one counter.
+ */
+struct perfCountSample
+{
+    solClient_uint64_t value;
+    solClient_uint64_t enabledNs;
+    solClient_uint64_t runningNs;
+};
+
+/**
+ * @struct perfCount
+ */
+struct perfCount
+{
+    int             fd[PERFCOUNT_NUM];  /**< -1 when not available. */
+    int             userOnly;           /**< Kernel time is not counted. */
+    struct perfCountSample start[PERFCOUNT_NUM];
+};
+
+
+/**
+ * Open the counters for this thread and the threads it starts from now on.
+ * @return ::SOLCLIENT_OK when at least one counter is available,
+ * ::SOLCLIENT_FAIL otherwise.
+ */
+solClient_returnCode_t
+    perfcount_open ( struct perfCount *perf_p );
+
+/**
+ * Start a measurement.
+ */
+void
+    perfcount_start ( struct perfCount *perf_p );
+
+/**
+ * End a measurement.
+ */
+void
+    perfcount_stop ( struct perfCount *perf_p, struct perfCountValues *values_p );
+
+/**
+ * Print one line of counts per unit: IPC, and cycles, instructions, cache
+ * misses, branch misses and context switches per unit.
+ * @param file_p Where to print.
+ * @param prefix_p Printed first, e.g. an indent or the benchmark name.
+ * @param values_p The measurement.
+ * @param units Messages or operations measured.
+ * @param unitName_p "msg", "op", ...
+ */
+void
+    perfcount_print ( FILE * file_p, const char *prefix_p, const struct perfCountValues *values_p, double units,
+                      const char *unitName_p );
+
+/**
+ * Close the counters.
+ */
+void
+    perfcount_close ( struct perfCount *perf_p );
+
+#endif /* PERFCOUNT_H_ */
@@ -0,0 +1,315 @@
+
+/** example Intro/provision.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Provisions and deprovisions many endpoints with a bounded number of
+ * non-blocking requests in flight. See provision.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "provision.h"
+
+#define PROVISION_MAX_PROPS         40
+
+
+/*****************************************************************************
+ * provision_complete
+ *
+ * Records the outcome of an in-flight entry. Must be called with the batch
+ * lock held.
+ *****************************************************************************/
+static void
+provision_complete ( struct provisionBatch *batch_p, struct provisionEntry *entry_p, int state,
+                     solClient_session_responseCode_t responseCode, solClient_subCode_t subCode, const char *info_p )
+{
+    entry_p->state = state;
+    entry_p->responseCode = responseCode;
+    entry_p->subCode = subCode;
+    entry_p->latencyNs = os_getTimeNs (  ) - entry_p->issuedNs;
+    if ( info_p != NULL ) {
+        snprintf ( entry_p->info, sizeof ( entry_p->info ), "%.*s", ( int ) sizeof ( entry_p->info ) - 1, info_p );
+    }
+    batch_p->outstanding--;
+    batch_p->completed++;
+}
+
+/*****************************************************************************
+ * provision_tag
+ *
+ * The correlation tag of an entry's request in the current run.
+ *****************************************************************************/
+static void    *
+provision_tag ( struct provisionBatch *batch_p, struct provisionEntry *entry_p )
+{
+    return ( char * ) entry_p + batch_p->generation % sizeof ( struct provisionEntry );
+}
+
+/*****************************************************************************
+ * provision_request
+ *
+ * Sends the non-blocking request for one entry.
+ *****************************************************************************/
+static          solClient_returnCode_t
+provision_request ( struct provisionBatch *batch_p, struct provisionEntry *entry_p )
+{
+    const char     *props[PROVISION_MAX_PROPS] = {0, };
+    int             propIndex = 0;
+    int             i;
+
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_ID;
+    props[propIndex++] = ( entry_p->endpointId_p != NULL ) ? entry_p->endpointId_p : SOLCLIENT_ENDPOINT_PROP_QUEUE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_NAME;
+    props[propIndex++] = entry_p->name_p;
+    if ( entry_p->op == PROVISION_OP_DELETE ) {
+        return solClient_session_endpointDeprovision ( ( char ** ) props, batch_p->session_p, batch_p->flags,
+                                                      provision_tag ( batch_p, entry_p ) );
+    }
+
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_PERMISSION;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PERM_DELETE;
+    props[propIndex++] = SOLCLIENT_ENDPOINT_PROP_QUOTA_MB;
+    props[propIndex++] = "100";
+    /* Later properties override the defaults above. */
+    for ( i = 0; batch_p->props_p != NULL && batch_p->props_p[i] != NULL && propIndex < PROVISION_MAX_PROPS - 1; i++ ) {
+        props[propIndex++] = batch_p->props_p[i];
+    }
+    return solClient_session_endpointProvision ( ( char ** ) props, batch_p->session_p, batch_p->flags,
+                                                provision_tag ( batch_p, entry_p ), NULL, 0 );
+}
+
+
+/*****************************************************************************
+ * provision_batchInit
+ *****************************************************************************/
+solClient_returnCode_t
+provision_batchInit ( struct provisionBatch *batch_p, solClient_opaqueSession_pt session_p,
+                      struct provisionEntry *entries_p, unsigned int numEntries, unsigned int maxOutstanding )
+{
+    memset ( batch_p, 0, sizeof ( *batch_p ) );
+    if ( os_eventInit ( &batch_p->completion ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "provision_batchInit() could not create an event" );
+        return SOLCLIENT_FAIL;
+    }
+    OS_MUTEX_INIT ( &batch_p->lock );
+    batch_p->session_p = session_p;
+    batch_p->entries_p = entries_p;
+    batch_p->numEntries = numEntries;
+    batch_p->maxOutstanding = ( maxOutstanding != 0 ) ? maxOutstanding : PROVISION_DEFAULT_MAX_OUTSTANDING;
+    batch_p->timeoutMs = PROVISION_DEFAULT_TIMEOUT_MS;
+    batch_p->flags = SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS;
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * provision_run
+ *****************************************************************************/
+solClient_returnCode_t
+provision_run ( struct provisionBatch *batch_p )
+{
+    solClient_returnCode_t rc;
+    solClient_errorInfo_pt errorInfo_p;
+    struct provisionEntry *entry_p;
+    unsigned long long startNs = os_getTimeNs (  );
+    unsigned long long progressNs = startNs;
+    unsigned int    lastCompleted = 0;
+    unsigned int    i;
+    int             blocked;
+
+    OS_MUTEX_LOCK ( &batch_p->lock );
+    for ( i = 0; i < batch_p->numEntries; i++ ) {
+        entry_p = &batch_p->entries_p[i];
+        entry_p->state = PROVISION_STATE_WAITING;
+        entry_p->responseCode = 0;
+        entry_p->subCode = SOLCLIENT_SUBCODE_OK;
+        entry_p->info[0] = ( char ) 0;
+        entry_p->latencyNs = 0;
+    }
+    batch_p->next = 0;
+    batch_p->outstanding = 0;
+    batch_p->completed = 0;
+    batch_p->peakOutstanding = 0;
+    batch_p->wouldBlocks = 0;
+    /* Events of the previous run no longer match. */
+    batch_p->generation++;
+    OS_MUTEX_UNLOCK ( &batch_p->lock );
+    os_eventWait ( &batch_p->completion, 0 );
+
+    for ( ;; ) {
+        /* Top up the requests in flight. Only this thread advances next. */
+        blocked = 0;
+        OS_MUTEX_LOCK ( &batch_p->lock );
+        while ( !blocked && batch_p->next < batch_p->numEntries && batch_p->outstanding < batch_p->maxOutstanding ) {
+            entry_p = &batch_p->entries_p[batch_p->next++];
+            entry_p->state = PROVISION_STATE_IN_FLIGHT;
+            entry_p->issuedNs = os_getTimeNs (  );
+            if ( ++batch_p->outstanding > batch_p->peakOutstanding ) {
+                batch_p->peakOutstanding = batch_p->outstanding;
+            }
+            /* The event may complete the entry as soon as it is requested. */
+            OS_MUTEX_UNLOCK ( &batch_p->lock );
+            rc = provision_request ( batch_p, entry_p );
+            errorInfo_p = ( rc == SOLCLIENT_IN_PROGRESS ) ? NULL : solClient_getLastErrorInfo (  );
+            OS_MUTEX_LOCK ( &batch_p->lock );
+
+            if ( rc == SOLCLIENT_IN_PROGRESS ) {
+                continue;
+            }
+            if ( rc == SOLCLIENT_WOULD_BLOCK ) {
+                /* Retried once a request completes. */
+                entry_p->state = PROVISION_STATE_WAITING;
+                batch_p->next--;
+                batch_p->outstanding--;
+                batch_p->wouldBlocks++;
+                blocked = 1;
+            } else if ( rc == SOLCLIENT_OK ) {
+                provision_complete ( batch_p, entry_p, PROVISION_STATE_OK, 0, SOLCLIENT_SUBCODE_OK, NULL );
+            } else {
+                provision_complete ( batch_p, entry_p, PROVISION_STATE_ERROR, errorInfo_p->responseCode,
+                                     errorInfo_p->subCode, errorInfo_p->errorStr );
+            }
+        }
+        if ( batch_p->completed == batch_p->numEntries ) {
+            OS_MUTEX_UNLOCK ( &batch_p->lock );
+            break;
+        }
+        if ( batch_p->completed != lastCompleted ) {
+            lastCompleted = batch_p->completed;
+            progressNs = os_getTimeNs (  );
+        } else if ( os_getTimeNs (  ) - progressNs >= ( unsigned long long ) batch_p->timeoutMs * 1000000ULL ) {
+            for ( i = 0; i < batch_p->numEntries; i++ ) {
+                entry_p = &batch_p->entries_p[i];
+                if ( entry_p->state == PROVISION_STATE_IN_FLIGHT ) {
+                    provision_complete ( batch_p, entry_p, PROVISION_STATE_TIMEOUT, 0, SOLCLIENT_SUBCODE_TIMEOUT, NULL );
+                } else if ( entry_p->state == PROVISION_STATE_WAITING ) {
+                    /* Never requested, so never outstanding. */
+                    entry_p->state = PROVISION_STATE_TIMEOUT;
+                    entry_p->subCode = SOLCLIENT_SUBCODE_TIMEOUT;
+                    batch_p->completed++;
+                }
+            }
+            OS_MUTEX_UNLOCK ( &batch_p->lock );
+            solClient_log ( SOLCLIENT_LOG_WARNING, "provision_run() gave up after %u ms without a completion",
+                            batch_p->timeoutMs );
+            break;
+        }
+        OS_MUTEX_UNLOCK ( &batch_p->lock );
+        os_eventWait ( &batch_p->completion, 100 );
+    }
+
+    batch_p->elapsedNs = os_getTimeNs (  ) - startNs;
+    batch_p->numOk = 0;
+    batch_p->numErrors = 0;
+    batch_p->numTimeouts = 0;
+    for ( i = 0; i < batch_p->numEntries; i++ ) {
+        switch ( batch_p->entries_p[i].state ) {
+            case PROVISION_STATE_OK:
+                batch_p->numOk++;
+                break;
+            case PROVISION_STATE_TIMEOUT:
+                batch_p->numTimeouts++;
+                break;
+            default:
+                batch_p->numErrors++;
+                break;
+        }
+    }
+    return ( batch_p->numOk == batch_p->numEntries ) ? SOLCLIENT_OK : SOLCLIENT_FAIL;
+}
+
+
+/*****************************************************************************
+ * provision_handleEvent
+ *****************************************************************************/
+int
+provision_handleEvent ( struct provisionBatch *batch_p, solClient_session_eventCallbackInfo_pt eventInfo_p )
+{
+    char           *tag_p = ( char * ) eventInfo_p->correlation_p;
+    char           *first_p = ( char * ) batch_p->entries_p;
+    struct provisionEntry *entry_p;
+    size_t          offset;
+    solClient_errorInfo_pt errorInfo_p;
+
+    if ( ( eventInfo_p->sessionEvent != SOLCLIENT_SESSION_EVENT_PROVISION_OK &&
+           eventInfo_p->sessionEvent != SOLCLIENT_SESSION_EVENT_PROVISION_ERROR ) ||
+         tag_p < first_p || tag_p >= first_p + batch_p->numEntries * sizeof ( struct provisionEntry ) ) {
+        return 0;
+    }
+    offset = ( size_t ) ( tag_p - first_p );
+    entry_p = &batch_p->entries_p[offset / sizeof ( struct provisionEntry )];
+
+    OS_MUTEX_LOCK ( &batch_p->lock );
+    /* A late event for an entry that timed out, in this run or an earlier one, is dropped. */
+    if ( offset % sizeof ( struct provisionEntry ) == batch_p->generation % sizeof ( struct provisionEntry ) &&
+         entry_p->state == PROVISION_STATE_IN_FLIGHT ) {
+        if ( eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_PROVISION_OK ) {
+            provision_complete ( batch_p, entry_p, PROVISION_STATE_OK, eventInfo_p->responseCode, SOLCLIENT_SUBCODE_OK,
+                                 NULL );
+        } else {
+            errorInfo_p = solClient_getLastErrorInfo (  );
+            provision_complete ( batch_p, entry_p, PROVISION_STATE_ERROR, eventInfo_p->responseCode,
+                                 errorInfo_p->subCode, eventInfo_p->info_p );
+        }
+    }
+    OS_MUTEX_UNLOCK ( &batch_p->lock );
+    os_eventSignal ( &batch_p->completion );
+    return 1;
+}
+
+/*****************************************************************************
+ * provision_eventCallback
+ *****************************************************************************/
+void
+provision_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                          solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    if ( user_p == NULL || !provision_handleEvent ( ( struct provisionBatch * ) user_p, eventInfo_p ) ) {
+        common_eventCallback ( opaqueSession_p, eventInfo_p, user_p );
+    }
+}
+
+
+/*****************************************************************************
+ * provision_batchDestroy
+ *****************************************************************************/
+void
+provision_batchDestroy ( struct provisionBatch *batch_p )
+{
+    OS_MUTEX_DESTROY ( &batch_p->lock );
+    os_eventDestroy ( &batch_p->completion );
+}
+
+/*****************************************************************************
+ * provision_stateToString
+ *****************************************************************************/
+const char     *
+provision_stateToString ( int state )
+{
+    switch ( state ) {
+        case PROVISION_STATE_WAITING:
+            return "WAITING";
+        case PROVISION_STATE_IN_FLIGHT:
+            return "IN_FLIGHT";
+        case PROVISION_STATE_OK:
+            return "OK";
+        case PROVISION_STATE_ERROR:
+            return "ERROR";
+        case PROVISION_STATE_TIMEOUT:
+            return "TIMEOUT";
+        default:
+            return "UNKNOWN";
+    }
+}
@@ -0,0 +1,152 @@
+/** example Intro/provision.h
+ */
+
+/**
+ *
+ * file provision.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides bulk endpoint provisioning. common_createQueue()
+ * and common_deleteQueue() wait for each request to be confirmed; a
+ * provisionBatch instead keeps up to maxOutstanding non-blocking
+ * solClient_session_endpointProvision() and
+ * solClient_session_endpointDeprovision() requests in flight, and completes
+ * the entries from the PROVISION_OK and PROVISION_ERROR Session events.
+ *
+ * Each request's correlation tag points into its ::provisionEntry, offset by
+ * the run's generation modulo the size of an entry. An event still on its way
+ * from an earlier run of the batch, for an entry that timed out, does not
+ * match the current generation and is dropped instead of completing the
+ * entry's new request.
+ *
+ * The Session's event callback must pass those events to
+ * provision_handleEvent(), or the Session can be created with
+ * provision_eventCallback() and the batch as its user pointer.
+ */
+
+#ifndef PROVISION_H_
+#define PROVISION_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define PROVISION_DEFAULT_MAX_OUTSTANDING 64    /**< Default requests in flight. */
+#define PROVISION_DEFAULT_TIMEOUT_MS 10000      /**< Default time without any completion before giving up. */
+
+#define PROVISION_OP_CREATE         0
+#define PROVISION_OP_DELETE         1
+
+#define PROVISION_STATE_WAITING     0   /**< Not requested yet. */
+#define PROVISION_STATE_IN_FLIGHT   1   /**< Requested, no event yet. */
+#define PROVISION_STATE_OK          2
+#define PROVISION_STATE_ERROR       3   /**< Rejected by the API or the broker. */
+#define PROVISION_STATE_TIMEOUT     4   /**< Still in flight, or not requested yet, when the batch gave up. */
+
+/**
+ * @struct provisionEntry
+ * One endpoint of a batch, and its result.
+ */
+struct provisionEntry
+{
+    const char     *name_p;             /**< Endpoint name, owned by the caller. */
+    const char     *endpointId_p;       /**< SOLCLIENT_ENDPOINT_PROP_QUEUE (if NULL) or _TE. */
+    int             op;                 /**< ::PROVISION_OP_CREATE or ::PROVISION_OP_DELETE. */
+    int             state;
+    solClient_session_responseCode_t responseCode;
+    solClient_subCode_t subCode;
+    char            info[80];           /**< Error text, if any. */
+    unsigned long long issuedNs;
+    unsigned long long latencyNs;       /**< Request to completion. */
+};
+
+/**
+ * @struct provisionBatch
+ * A table of entries and the state of their requests. provision_run() is
+ * called from an application thread; the events complete entries on the
+ * Context thread.
+ */
+struct provisionBatch
+{
+    solClient_opaqueSession_pt session_p;
+    struct provisionEntry *entries_p;
+    unsigned int    numEntries;
+    unsigned int    maxOutstanding;
+    unsigned int    timeoutMs;
+    solClient_uint32_t flags;           /**< SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS or 0. */
+    const char     *const *props_p;     /**< NULL-terminated extra endpoint properties, or NULL. */
+    OS_MUTEX        lock;
+    OS_EVENT        completion;
+    unsigned int    next;               /**< Next entry to request. */
+    unsigned int    outstanding;
+    unsigned int    completed;
+    unsigned int    peakOutstanding;
+    unsigned int    generation;         /**< Incremented by each provision_run(), part of the correlation tags. */
+
+    /* Results of the last provision_run() */
+    unsigned int    numOk;
+    unsigned int    numErrors;
+    unsigned int    numTimeouts;
+    unsigned int    wouldBlocks;        /**< Requests retried after SOLCLIENT_WOULD_BLOCK. */
+    unsigned long long elapsedNs;
+};
+
+
+/**
+ * Initialize a batch over a table of entries. The entries' name_p,
+ * endpointId_p and op are set by the caller; the rest is set by
+ * provision_run().
+ * @param batch_p The batch to initialize.
+ * @param session_p A connected Session.
+ * @param entries_p The result table.
+ * @param numEntries Number of entries.
+ * @param maxOutstanding Requests in flight at most.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    provision_batchInit ( struct provisionBatch *batch_p, solClient_opaqueSession_pt session_p,
+                          struct provisionEntry *entries_p, unsigned int numEntries, unsigned int maxOutstanding );
+
+/**
+ * Request every entry and wait until each has completed, or until no entry
+ * has completed for timeoutMs. Entries in flight or not requested yet at
+ * the timeout are ::PROVISION_STATE_TIMEOUT. Entries may be changed and the
+ * batch run again afterwards.
+ * @param batch_p The batch.
+ * @return ::SOLCLIENT_OK if every entry is ::PROVISION_STATE_OK,
+ * ::SOLCLIENT_FAIL otherwise.
+ */
+solClient_returnCode_t
+    provision_run ( struct provisionBatch *batch_p );
+
+/**
+ * Complete an entry from a Session event, on the Context thread.
+ * Events from an earlier run are dropped.
+ * @return 1 if the event belonged to the batch, 0 otherwise.
+ */
+int
+    provision_handleEvent ( struct provisionBatch *batch_p, solClient_session_eventCallbackInfo_pt eventInfo_p );
+
+/**
+ * A Session event callback taking the batch as user_p. Events that do not
+ * belong to the batch go to common_eventCallback().
+ */
+void
+    provision_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                              solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p );
+
+/**
+ * Release the batch. Late events of timed-out entries refer to the batch, so
+ * destroy it only after the Session.
+ */
+void
+    provision_batchDestroy ( struct provisionBatch *batch_p );
+
+/**
+ * Name of an entry state.
+ */
+const char     *
+    provision_stateToString ( int state );
+
+#endif /* PROVISION_H_ */
@@ -0,0 +1,460 @@
+
+/** example Intro/pubjournal.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Store-and-forward journal for Persistent publishing. See pubjournal.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "pubjournal.h"
+
+#define PUBJOURNAL_ALIGN(n)     ( ( (n) + 7 ) & ~( ( solClient_uint64_t ) 7 ) )
+#define PUBJOURNAL_WAIT_MS      100
+
+
+/*****************************************************************************
+ * pubjournal_skipEnd
+ *
+ * A record header never straddles the end of the ring: when too few bytes
+ * are left for one, the next record starts at the beginning.
+ *****************************************************************************/
+static          solClient_uint64_t
+pubjournal_skipEnd ( const struct pubjournal *journal_p, solClient_uint64_t offset )
+{
+    solClient_uint64_t left = journal_p->capacity - offset % journal_p->capacity;
+
+    return ( left < sizeof ( struct pubjournalRecordHeader ) ) ? offset + left : offset;
+}
+
+/*****************************************************************************
+ * pubjournal_record
+ *****************************************************************************/
+static struct pubjournalRecordHeader *
+pubjournal_record ( const struct pubjournal *journal_p, solClient_uint64_t offset )
+{
+    return ( struct pubjournalRecordHeader * ) ( journal_p->ring_p + offset % journal_p->capacity );
+}
+
+/*****************************************************************************
+ * pubjournal_trim
+ *
+ * Drops the records up to and including seq. Must be called with the lock
+ * held. Returns the number of records dropped.
+ *****************************************************************************/
+static          solClient_uint64_t
+pubjournal_trim ( struct pubjournal *journal_p, solClient_uint64_t seq )
+{
+    struct pubjournalHeader *header_p = journal_p->header_p;
+    struct pubjournalRecordHeader *record_p;
+    solClient_uint64_t offset;
+    solClient_uint64_t trimmed = 0;
+
+    while ( header_p->trimOffset < journal_p->tailOffset ) {
+        offset = pubjournal_skipEnd ( journal_p, header_p->trimOffset );
+        record_p = pubjournal_record ( journal_p, offset );
+        if ( record_p->smfLen != 0 && record_p->seq > seq ) {
+            break;
+        }
+        header_p->trimOffset = offset + record_p->recordLen;
+        if ( record_p->smfLen != 0 ) {
+            header_p->trimSeq++;
+            trimmed++;
+        }
+    }
+    /* Acks of a replayed window can overtake the send cursor. */
+    if ( header_p->trimSeq > journal_p->sendSeq ) {
+        journal_p->sendOffset = header_p->trimOffset;
+        journal_p->sendSeq = header_p->trimSeq;
+    }
+    return trimmed;
+}
+
+/*****************************************************************************
+ * pubjournal_recover
+ *
+ * Finds the records after the trim point. Returns their number.
+ *****************************************************************************/
+static          solClient_uint64_t
+pubjournal_recover ( struct pubjournal *journal_p )
+{
+    const struct pubjournalRecordHeader *record_p;
+    solClient_uint64_t offset = journal_p->header_p->trimOffset;
+    solClient_uint64_t seq = journal_p->header_p->trimSeq;
+    solClient_uint64_t position;
+    solClient_uint64_t recovered = 0;
+
+    for ( ;; ) {
+        offset = pubjournal_skipEnd ( journal_p, offset );
+        if ( offset - journal_p->header_p->trimOffset >= journal_p->capacity ) {
+            break;
+        }
+        position = offset % journal_p->capacity;
+        record_p = pubjournal_record ( journal_p, offset );
+        if ( record_p->recordLen == 0 || record_p->seq != seq || ( record_p->recordLen & 7 ) != 0 ||
+             record_p->recordLen > journal_p->capacity - position ||
+             offset + record_p->recordLen - journal_p->header_p->trimOffset > journal_p->capacity ) {
+            break;
+        }
+        if ( record_p->smfLen == 0 ) {
+            if ( record_p->recordLen != journal_p->capacity - position ) {
+                break;
+            }
+        } else if ( sizeof ( *record_p ) + record_p->smfLen > record_p->recordLen ) {
+            break;
+        } else {
+            seq++;
+            recovered++;
+        }
+        offset += record_p->recordLen;
+    }
+    journal_p->tailOffset = offset;
+    journal_p->tailSeq = seq;
+    return recovered;
+}
+
+/*****************************************************************************
+ * pubjournal_senderThread
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( pubjournal_senderThread, arg_p )
+{
+    struct pubjournal *journal_p = ( struct pubjournal * ) arg_p;
+
+    while ( !journal_p->stop ) {
+        if ( pubjournal_pump ( journal_p, PUBJOURNAL_PUMP_BATCH ) == 0 ) {
+            os_eventWait ( &journal_p->wake, PUBJOURNAL_WAIT_MS );
+        }
+    }
+    OS_THREAD_RETURN;
+}
+
+
+/*****************************************************************************
+ * pubjournal_open
+ *****************************************************************************/
+solClient_returnCode_t
+pubjournal_open ( struct pubjournal *journal_p, const char *path_p, solClient_uint64_t capacity, const char *idPrefix_p )
+{
+    static const char zeros[4] = { 0, 0, 0, 0 };
+    struct pubjournalHeader *header_p;
+
+    memset ( journal_p, 0, sizeof ( *journal_p ) );
+    if ( strlen ( idPrefix_p ) >= sizeof ( journal_p->idPrefix ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Journal message ID prefix '%s' is too long", idPrefix_p );
+        return SOLCLIENT_FAIL;
+    }
+    strcpy ( journal_p->idPrefix, idPrefix_p );
+    capacity = PUBJOURNAL_ALIGN ( ( capacity != 0 ) ? capacity : PUBJOURNAL_DEFAULT_CAPACITY );
+    if ( os_mapFileWritable ( path_p, ( size_t ) ( PUBJOURNAL_HEADER_BYTES + capacity ), &journal_p->map ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not map journal '%s'", path_p );
+        return SOLCLIENT_FAIL;
+    }
+    header_p = journal_p->header_p = ( struct pubjournalHeader * ) journal_p->map.addr_p;
+    journal_p->ring_p = ( char * ) journal_p->map.addr_p + PUBJOURNAL_HEADER_BYTES;
+
+    if ( memcmp ( header_p->magic, zeros, sizeof ( zeros ) ) == 0 ) {
+        memcpy ( header_p->magic, "PJNL", 4 );
+        header_p->byteOrder = PUBJOURNAL_BYTE_ORDER_MARK;
+        header_p->version = PUBJOURNAL_VERSION;
+        header_p->capacity = capacity;
+        header_p->trimOffset = 0;
+        header_p->trimSeq = 1;
+    } else if ( memcmp ( header_p->magic, "PJNL", 4 ) != 0 || header_p->byteOrder != PUBJOURNAL_BYTE_ORDER_MARK ||
+                header_p->version != PUBJOURNAL_VERSION || ( header_p->capacity & 7 ) != 0 ||
+                header_p->capacity == 0 || PUBJOURNAL_HEADER_BYTES + header_p->capacity > journal_p->map.size ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "'%s' is not a journal written by this kind of host", path_p );
+        os_unmapFile ( &journal_p->map );
+        return SOLCLIENT_FAIL;
+    }
+    journal_p->capacity = header_p->capacity;
+    journal_p->stats.recovered = pubjournal_recover ( journal_p );
+    journal_p->sendOffset = header_p->trimOffset;
+    journal_p->sendSeq = header_p->trimSeq;
+    journal_p->send_p = solClient_session_sendMsg;
+    OS_MUTEX_INIT ( &journal_p->lock );
+    if ( os_eventInit ( &journal_p->wake ) != 0 ) {
+        OS_MUTEX_DESTROY ( &journal_p->lock );
+        os_unmapFile ( &journal_p->map );
+        return SOLCLIENT_FAIL;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * pubjournal_startSender
+ *****************************************************************************/
+solClient_returnCode_t
+pubjournal_startSender ( struct pubjournal *journal_p )
+{
+    if ( os_threadCreate ( &journal_p->sender, pubjournal_senderThread, journal_p ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not start the journal sender thread" );
+        return SOLCLIENT_FAIL;
+    }
+    journal_p->senderRunning = 1;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * pubjournal_publish
+ *****************************************************************************/
+solClient_returnCode_t
+pubjournal_publish ( struct pubjournal *journal_p, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_returnCode_t rc;
+    solClient_bufInfo_t smf;
+    solClient_opaqueDatablock_pt datab_p = NULL;
+    struct pubjournalRecordHeader header;
+    struct pubjournalRecordHeader *record_p;
+    solClient_uint64_t offset;
+    solClient_uint64_t padLen = 0;
+    solClient_uint64_t recordLen;
+    solClient_uint64_t position;
+    char            appMsgId[PUBJOURNAL_MAX_ID_PREFIX + 24];
+
+    OS_MUTEX_LOCK ( &journal_p->lock );
+    /* The seq is only known under the lock, so the message is encoded there too. */
+    sprintf ( appMsgId, "%s-%llu", journal_p->idPrefix, ( unsigned long long ) journal_p->tailSeq );
+    if ( ( rc = solClient_msg_setApplicationMessageId ( msg_p, appMsgId ) ) != SOLCLIENT_OK ||
+         ( rc = solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_PERSISTENT ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_setApplicationMessageId()" );
+        goto unlock;
+    }
+    if ( ( rc = solClient_msg_encodeToSMF ( msg_p, &smf, &datab_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_encodeToSMF()" );
+        goto unlock;
+    }
+
+    recordLen = PUBJOURNAL_ALIGN ( sizeof ( header ) + smf.bufSize );
+    offset = pubjournal_skipEnd ( journal_p, journal_p->tailOffset );
+    position = offset % journal_p->capacity;
+    if ( journal_p->capacity - position < recordLen ) {
+        padLen = journal_p->capacity - position;
+    }
+    if ( offset + padLen + recordLen - journal_p->header_p->trimOffset > journal_p->capacity ) {
+        journal_p->stats.full++;
+        rc = SOLCLIENT_WOULD_BLOCK;
+        goto unlock;
+    }
+
+    header.appendNs = os_getRealTimeNs (  );
+    header.seq = journal_p->tailSeq;
+    if ( padLen != 0 ) {
+        record_p = pubjournal_record ( journal_p, offset );
+        record_p->recordLen = 0;
+        record_p->smfLen = 0;
+        record_p->seq = header.seq;
+        record_p->appendNs = header.appendNs;
+        *( volatile solClient_uint32_t * ) &record_p->recordLen = ( solClient_uint32_t ) padLen;
+        offset += padLen;
+    }
+    /* Length last: a record without one ends the journal when it is reopened. */
+    record_p = pubjournal_record ( journal_p, offset );
+    *( volatile solClient_uint32_t * ) &record_p->recordLen = 0;
+    header.recordLen = 0;
+    header.smfLen = smf.bufSize;
+    memcpy ( record_p, &header, sizeof ( header ) );
+    memcpy ( record_p + 1, smf.buf_p, smf.bufSize );
+    *( volatile solClient_uint32_t * ) &record_p->recordLen = ( solClient_uint32_t ) recordLen;
+
+    journal_p->tailOffset = offset + recordLen;
+    journal_p->tailSeq++;
+    journal_p->stats.appended++;
+    if ( journal_p->syncEvery != 0 && journal_p->stats.appended % journal_p->syncEvery == 0 ) {
+        os_syncMappedFile ( &journal_p->map, 0, ( size_t ) ( PUBJOURNAL_HEADER_BYTES + journal_p->capacity ) );
+    }
+
+  unlock:
+    OS_MUTEX_UNLOCK ( &journal_p->lock );
+    if ( datab_p != NULL ) {
+        solClient_datablock_free ( &datab_p );
+    }
+    if ( rc == SOLCLIENT_OK ) {
+        os_eventSignal ( &journal_p->wake );
+    }
+    return rc;
+}
+
+/*****************************************************************************
+ * pubjournal_pump
+ *****************************************************************************/
+solClient_uint32_t
+pubjournal_pump ( struct pubjournal *journal_p, solClient_uint32_t maxMsgs )
+{
+    solClient_returnCode_t rc;
+    solClient_bufInfo_t smf;
+    solClient_opaqueMsg_pt msg_p;
+    struct pubjournalRecordHeader *record_p;
+    solClient_uint64_t offset;
+    solClient_uint64_t seq;
+    solClient_uint32_t generation;
+    solClient_uint32_t sent = 0;
+
+    while ( sent < maxMsgs ) {
+        OS_MUTEX_LOCK ( &journal_p->lock );
+        for ( ;; ) {
+            if ( !journal_p->connected || journal_p->sendOffset >= journal_p->tailOffset ) {
+                OS_MUTEX_UNLOCK ( &journal_p->lock );
+                return sent;
+            }
+            offset = pubjournal_skipEnd ( journal_p, journal_p->sendOffset );
+            record_p = pubjournal_record ( journal_p, offset );
+            if ( record_p->smfLen != 0 ) {
+                break;
+            }
+            journal_p->sendOffset = offset + record_p->recordLen;
+        }
+        /* Decoded under the lock, as a trim would let the producer reuse the bytes. */
+        smf.buf_p = ( char * ) ( record_p + 1 );
+        smf.bufSize = record_p->smfLen;
+        seq = record_p->seq;
+        generation = journal_p->generation;
+        rc = solClient_msg_decodeFromSmf ( &smf, &msg_p );
+        OS_MUTEX_UNLOCK ( &journal_p->lock );
+        if ( rc != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_msg_decodeFromSmf()" );
+            msg_p = NULL;
+        } else {
+            solClient_msg_setDeliveryMode ( msg_p, SOLCLIENT_DELIVERY_MODE_PERSISTENT );
+            solClient_msg_setCorrelationTagPtr ( msg_p, ( void * ) ( size_t ) seq, 0 );
+            rc = journal_p->send_p ( journal_p->session_p, msg_p );
+            solClient_msg_free ( &msg_p );
+        }
+
+        OS_MUTEX_LOCK ( &journal_p->lock );
+        if ( rc == SOLCLIENT_OK ) {
+            journal_p->stats.sent++;
+            if ( generation == journal_p->generation && journal_p->sendSeq == seq ) {
+                journal_p->sendOffset = offset + record_p->recordLen;
+                journal_p->sendSeq++;
+            }
+            sent++;
+        } else if ( rc != SOLCLIENT_WOULD_BLOCK ) {
+            /* Wait for the next UP_NOTICE, which replays from the oldest entry. */
+            journal_p->stats.sendsFailed++;
+            journal_p->connected = 0;
+        }
+        OS_MUTEX_UNLOCK ( &journal_p->lock );
+        if ( rc != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    return sent;
+}
+
+/*****************************************************************************
+ * pubjournal_ack
+ *****************************************************************************/
+void
+pubjournal_ack ( struct pubjournal *journal_p, solClient_uint64_t seq )
+{
+    OS_MUTEX_LOCK ( &journal_p->lock );
+    journal_p->stats.acked += pubjournal_trim ( journal_p, seq );
+    OS_MUTEX_UNLOCK ( &journal_p->lock );
+}
+
+/*****************************************************************************
+ * pubjournal_eventCallback
+ *****************************************************************************/
+void
+pubjournal_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                           solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct pubjournal *journal_p = ( struct pubjournal * ) user_p;
+
+    switch ( eventInfo_p->sessionEvent ) {
+        case SOLCLIENT_SESSION_EVENT_ACKNOWLEDGEMENT:
+            pubjournal_ack ( journal_p, ( solClient_uint64_t ) ( size_t ) eventInfo_p->correlation_p );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_REJECTED_MSG_ERROR:
+            /* Resending would be rejected again; the rejection is final. */
+            solClient_log ( SOLCLIENT_LOG_WARNING, "Journal entry %llu rejected, responseCode %d, %s",
+                            ( unsigned long long ) ( size_t ) eventInfo_p->correlation_p,
+                            eventInfo_p->responseCode, eventInfo_p->info_p );
+            OS_MUTEX_LOCK ( &journal_p->lock );
+            journal_p->stats.rejected += pubjournal_trim ( journal_p, ( solClient_uint64_t ) ( size_t ) eventInfo_p->correlation_p );
+            OS_MUTEX_UNLOCK ( &journal_p->lock );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_UP_NOTICE:
+            OS_MUTEX_LOCK ( &journal_p->lock );
+            journal_p->session_p = opaqueSession_p;
+            journal_p->connected = 1;
+            if ( journal_p->sendSeq != journal_p->header_p->trimSeq ) {
+                journal_p->stats.replays++;
+            }
+            journal_p->sendOffset = journal_p->header_p->trimOffset;
+            journal_p->sendSeq = journal_p->header_p->trimSeq;
+            journal_p->generation++;
+            OS_MUTEX_UNLOCK ( &journal_p->lock );
+            os_eventSignal ( &journal_p->wake );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_RECONNECTED_NOTICE:
+            OS_MUTEX_LOCK ( &journal_p->lock );
+            journal_p->connected = 1;
+            OS_MUTEX_UNLOCK ( &journal_p->lock );
+            os_eventSignal ( &journal_p->wake );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_DOWN_ERROR:
+        case SOLCLIENT_SESSION_EVENT_RECONNECTING_NOTICE:
+            OS_MUTEX_LOCK ( &journal_p->lock );
+            journal_p->connected = 0;
+            OS_MUTEX_UNLOCK ( &journal_p->lock );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_CAN_SEND:
+            os_eventSignal ( &journal_p->wake );
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*****************************************************************************
+ * pubjournal_getStats
+ *****************************************************************************/
+void
+pubjournal_getStats ( struct pubjournal *journal_p, struct pubjournalStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &journal_p->lock );
+    *stats_p = journal_p->stats;
+    stats_p->pending = journal_p->tailSeq - journal_p->header_p->trimSeq;
+    stats_p->unsent = journal_p->tailSeq - journal_p->sendSeq;
+    stats_p->usedBytes = journal_p->tailOffset - journal_p->header_p->trimOffset;
+    stats_p->connected = journal_p->connected;
+    OS_MUTEX_UNLOCK ( &journal_p->lock );
+}
+
+/*****************************************************************************
+ * pubjournal_close
+ *****************************************************************************/
+void
+pubjournal_close ( struct pubjournal *journal_p )
+{
+    if ( journal_p->senderRunning ) {
+        journal_p->stop = 1;
+        os_eventSignal ( &journal_p->wake );
+        os_threadJoin ( journal_p->sender );
+        journal_p->senderRunning = 0;
+    }
+    os_syncMappedFile ( &journal_p->map, 0, journal_p->map.size );
+    os_unmapFile ( &journal_p->map );
+    os_eventDestroy ( &journal_p->wake );
+    OS_MUTEX_DESTROY ( &journal_p->lock );
+}
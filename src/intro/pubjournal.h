@@ -0,0 +1,207 @@
+/** example Intro/pubjournal.h
+ */
+
+/**
+ *
+ * file pubjournal.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a store-and-forward journal for a publisher of
+ * Persistent messages. pubjournal_publish() only appends the message, in
+ * SMF form (solClient_msg_encodeToSMF()), to a memory-mapped ring file; a
+ * sender thread sends it on. A journal entry is trimmed when its
+ * ACKNOWLEDGEMENT (or REJECTED_MSG_ERROR) event arrives, so the producer
+ * never waits for the broker and a message is not lost when the Session is,
+ * or when the process is: entries are replayed in order once the Session is
+ * up again, or when the journal is reopened.
+ *
+ * Replay can send a message the broker already has (its ack was lost, or
+ * the process stopped before the trim reached the file). Every message is
+ * therefore given the application message ID "<idPrefix>-<seq>", with seq
+ * counting up from 1 over the life of the journal, for consumers to drop
+ * duplicates by.
+ *
+ * File layout (integers in the byte order of the writing host):
+ *
+ *  +-------------------------------+-----------------------------------+
+ *  | header, PUBJOURNAL_HEADER_BYTES | ring of capacity bytes            |
+ *  +-------------------------------+-----------------------------------+
+ *
+ * The ring holds ::pubjournalRecordHeader records, each followed by the SMF
+ * bytes and padded to 8 bytes. A record that does not fit before the end of
+ * the ring is preceded by a padding record (smfLen 0) to the end. Offsets
+ * are logical and only grow; the ring position is offset % capacity. The
+ * header keeps the offset and seq of the oldest unacknowledged record, and
+ * reopening scans forward from there while records carry the next seq.
+ * Records are written with their length last, so a process that stops in
+ * the middle of an append leaves no partial record behind. Nothing is
+ * synced to disk unless syncEvery is set: the journal then survives a
+ * process crash, but not a power loss.
+ *
+ * The journal handles the events of its Session: pass
+ * pubjournal_eventCallback() with the journal as user pointer, or call it
+ * from the application's own event callback. Sending pauses when the
+ * Session goes down or a send fails, and all unacknowledged entries are
+ * replayed from the next UP_NOTICE. After RECONNECTED_NOTICE nothing is
+ * replayed: the API retransmits its own publisher window then.
+ */
+
+#ifndef PUBJOURNAL_H_
+#define PUBJOURNAL_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define PUBJOURNAL_VERSION              1
+#define PUBJOURNAL_BYTE_ORDER_MARK      0x01020304u
+#define PUBJOURNAL_HEADER_BYTES         4096
+#define PUBJOURNAL_DEFAULT_CAPACITY     ( 64 * 1024 * 1024 )
+#define PUBJOURNAL_MAX_ID_PREFIX        64
+#define PUBJOURNAL_PUMP_BATCH           256     /**< Sends per pubjournal_pump() by the sender thread. */
+
+/**
+ * @struct pubjournalHeader
+ * The start of the file.
+ */
+struct pubjournalHeader
+{
+    char            magic[4];           /**< "PJNL". */
+    solClient_uint32_t byteOrder;       /**< ::PUBJOURNAL_BYTE_ORDER_MARK as written. */
+    solClient_uint32_t version;
+    solClient_uint32_t reserved;
+    solClient_uint64_t capacity;        /**< Bytes in the ring. */
+    solClient_uint64_t trimOffset;      /**< Oldest unacknowledged record. */
+    solClient_uint64_t trimSeq;         /**< Its seq. */
+};
+
+/**
+ * @struct pubjournalRecordHeader
+ */
+struct pubjournalRecordHeader
+{
+    solClient_uint32_t recordLen;       /**< Whole record, padded; written last. */
+    solClient_uint32_t smfLen;          /**< 0 for a padding record. */
+    solClient_uint64_t seq;             /**< For a padding record, the seq of the record after it. */
+    solClient_uint64_t appendNs;        /**< Wall-clock append time. */
+};
+
+/**
+ * @struct pubjournalStats
+ */
+struct pubjournalStats
+{
+    solClient_uint64_t appended;
+    solClient_uint64_t full;            /**< Appends refused for lack of room. */
+    solClient_uint64_t sent;            /**< Including replays. */
+    solClient_uint64_t sendsFailed;
+    solClient_uint64_t acked;
+    solClient_uint64_t rejected;
+    solClient_uint64_t replays;         /**< Times sending restarted from the oldest entry. */
+    solClient_uint64_t recovered;       /**< Entries found when the journal was opened. */
+    solClient_uint64_t pending;         /**< Entries not yet acknowledged. */
+    solClient_uint64_t unsent;          /**< Entries not yet sent. */
+    solClient_uint64_t usedBytes;
+    int             connected;
+};
+
+/**
+ * A stand-in for solClient_session_sendMsg(), for running the journal
+ * without a Session.
+ */
+typedef         solClient_returnCode_t ( *pubjournal_sendFunc_t ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                                    solClient_opaqueMsg_pt msg_p );
+
+/**
+ * @struct pubjournal
+ */
+struct pubjournal
+{
+    OS_MUTEX        lock;
+    struct os_mappedFile map;
+    struct pubjournalHeader *header_p;
+    char           *ring_p;
+    solClient_uint64_t capacity;
+    char            idPrefix[PUBJOURNAL_MAX_ID_PREFIX];
+    solClient_uint32_t syncEvery;       /**< Sync the file every syncEvery appends, 0 for never. */
+    solClient_uint64_t tailOffset;      /**< Where the next record goes. */
+    solClient_uint64_t tailSeq;
+    solClient_uint64_t sendOffset;      /**< Next record to send. */
+    solClient_uint64_t sendSeq;
+    solClient_uint32_t generation;      /**< Counts replays, to drop sends that raced one. */
+    solClient_opaqueSession_pt session_p;
+    pubjournal_sendFunc_t send_p;
+    int             connected;
+    OS_EVENT        wake;
+    OS_THREAD       sender;
+    int             senderRunning;
+    volatile int    stop;
+    struct pubjournalStats stats;
+};
+
+
+/**
+ * Open or create a journal and recover its unacknowledged entries.
+ * @param journal_p The journal to initialize.
+ * @param path_p The journal file.
+ * @param capacity Ring size in bytes for a new file, 0 for ::PUBJOURNAL_DEFAULT_CAPACITY.
+ * An existing file keeps its own.
+ * @param idPrefix_p Prefix of the application message IDs.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    pubjournal_open ( struct pubjournal *journal_p, const char *path_p, solClient_uint64_t capacity,
+                      const char *idPrefix_p );
+
+/**
+ * Start the thread that sends journal entries while the Session is up.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    pubjournal_startSender ( struct pubjournal *journal_p );
+
+/**
+ * Journal a message for sending. The message is made Persistent and given
+ * its application message ID; it still belongs to the caller afterwards.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_WOULD_BLOCK when the journal is full,
+ * ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    pubjournal_publish ( struct pubjournal *journal_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Send up to maxMsgs entries, if the Session is up. The sender thread calls
+ * this; without one, the application does.
+ * @return The number of entries sent.
+ */
+solClient_uint32_t
+    pubjournal_pump ( struct pubjournal *journal_p, solClient_uint32_t maxMsgs );
+
+/**
+ * Trim the entries up to and including seq.
+ */
+void
+    pubjournal_ack ( struct pubjournal *journal_p, solClient_uint64_t seq );
+
+/**
+ * The Session event callback of the journal, with the journal as user_p.
+ */
+void
+    pubjournal_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                               solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    pubjournal_getStats ( struct pubjournal *journal_p, struct pubjournalStats *stats_p );
+
+/**
+ * Stop the sender, sync the file and close it. Unacknowledged entries stay
+ * in the file for the next pubjournal_open().
+ */
+void
+    pubjournal_close ( struct pubjournal *journal_p );
+
+#endif /* PUBJOURNAL_H_ */
@@ -0,0 +1,398 @@
+
+/** example Intro/smflog.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Writes received messages to SMF capture log segments, and reads segments
+ * back through a memory mapping. See smflog.h for the segment layout.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "solclient/solClientDeprecated.h"
+#include "common.h"
+#include "smflog.h"
+
+#define SMFLOG_ALIGN(n)  ( ( ( n ) + 7 ) & ~( ( solClient_uint64_t ) 7 ) )
+
+static const unsigned char smflog_padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+/*****************************************************************************
+ * smflog_hash
+ *****************************************************************************/
+solClient_uint32_t
+smflog_hash ( const char *str_p, size_t len )
+{
+    solClient_uint32_t hash = 2166136261u;
+    size_t          i;
+
+    for ( i = 0; i < len; i++ ) {
+        hash ^= ( unsigned char ) str_p[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/*****************************************************************************
+ * smflog_bloomSet
+ *****************************************************************************/
+static void
+smflog_bloomSet ( unsigned char *bloom_p, solClient_uint32_t hash )
+{
+    solClient_uint32_t step = ( hash >> 17 ) | ( hash << 15 );
+    solClient_uint32_t bit;
+    int             k;
+
+    for ( k = 0; k < SMFLOG_BLOOM_HASHES; k++ ) {
+        bit = ( hash + k * step ) % ( SMFLOG_BLOOM_BYTES * 8 );
+        bloom_p[bit >> 3] |= ( unsigned char ) ( 1 << ( bit & 7 ) );
+    }
+}
+
+/*****************************************************************************
+ * smflog_blockMayContain
+ *****************************************************************************/
+int
+smflog_blockMayContain ( const struct smflogBlock *block_p, solClient_uint32_t prefixHash )
+{
+    solClient_uint32_t step = ( prefixHash >> 17 ) | ( prefixHash << 15 );
+    solClient_uint32_t bit;
+    int             k;
+
+    for ( k = 0; k < SMFLOG_BLOOM_HASHES; k++ ) {
+        bit = ( prefixHash + k * step ) % ( SMFLOG_BLOOM_BYTES * 8 );
+        if ( ( block_p->bloom[bit >> 3] & ( 1 << ( bit & 7 ) ) ) == 0 ) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*****************************************************************************
+ * smflog_writeSegmentEnd
+ *
+ * Writes the block index and trailer, and closes the segment file.
+ *****************************************************************************/
+static void
+smflog_writeSegmentEnd ( struct smflogWriter *writer_p )
+{
+    struct smflogTrailer trailer;
+    solClient_uint32_t i;
+
+    if ( writer_p->file_p == NULL ) {
+        return;
+    }
+
+    memset ( &trailer, 0, sizeof ( trailer ) );
+    trailer.indexOffset = writer_p->offset;
+    trailer.records = writer_p->segmentRecords;
+    trailer.blocks = writer_p->numBlocks;
+    trailer.firstNs = ( writer_p->numBlocks > 0 ) ? writer_p->blocks_p[0].firstNs : 0;
+    for ( i = 0; i < writer_p->numBlocks; i++ ) {
+        if ( writer_p->blocks_p[i].firstNs < trailer.firstNs ) {
+            trailer.firstNs = writer_p->blocks_p[i].firstNs;
+        }
+        if ( writer_p->blocks_p[i].lastNs > trailer.lastNs ) {
+            trailer.lastNs = writer_p->blocks_p[i].lastNs;
+        }
+    }
+    memcpy ( trailer.magic, "SMFX", 4 );
+
+    fwrite ( writer_p->blocks_p, sizeof ( struct smflogBlock ), writer_p->numBlocks, writer_p->file_p );
+    fwrite ( &trailer, sizeof ( trailer ), 1, writer_p->file_p );
+    fclose ( writer_p->file_p );
+
+    writer_p->file_p = NULL;
+    writer_p->bytes += writer_p->offset + writer_p->numBlocks * sizeof ( struct smflogBlock ) + sizeof ( trailer );
+    writer_p->numBlocks = 0;
+    writer_p->segmentRecords = 0;
+    writer_p->segmentNum++;
+}
+
+/*****************************************************************************
+ * smflog_startSegment
+ *****************************************************************************/
+static          solClient_returnCode_t
+smflog_startSegment ( struct smflogWriter *writer_p )
+{
+    struct smflogHeader header;
+    char            path[sizeof ( writer_p->prefix ) + 32];
+
+    sprintf ( path, "%s.%06u.smfl", writer_p->prefix, writer_p->segmentNum );
+    if ( ( writer_p->file_p = fopen ( path, "wb" ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not create capture segment '%s'", path );
+        return SOLCLIENT_FAIL;
+    }
+    setvbuf ( writer_p->file_p, NULL, _IOFBF, 1024 * 1024 );
+
+    memset ( &header, 0, sizeof ( header ) );
+    memcpy ( header.magic, "SMFL", 4 );
+    header.byteOrder = SMFLOG_BYTE_ORDER_MARK;
+    header.version = SMFLOG_VERSION;
+    header.segmentNum = writer_p->segmentNum;
+    fwrite ( &header, sizeof ( header ), 1, writer_p->file_p );
+    writer_p->offset = sizeof ( header );
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * smflog_startBlock
+ *****************************************************************************/
+static          solClient_returnCode_t
+smflog_startBlock ( struct smflogWriter *writer_p )
+{
+    struct smflogBlock *blocks_p;
+    struct smflogBlock *block_p;
+
+    if ( writer_p->numBlocks == writer_p->maxBlocks ) {
+        blocks_p = ( struct smflogBlock * ) realloc ( writer_p->blocks_p,
+                                                      ( writer_p->maxBlocks * 2 + 16 ) * sizeof ( struct smflogBlock ) );
+        if ( blocks_p == NULL ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Could not grow the capture block index" );
+            return SOLCLIENT_FAIL;
+        }
+        writer_p->blocks_p = blocks_p;
+        writer_p->maxBlocks = writer_p->maxBlocks * 2 + 16;
+    }
+    block_p = &writer_p->blocks_p[writer_p->numBlocks++];
+    memset ( block_p, 0, sizeof ( *block_p ) );
+    block_p->offset = writer_p->offset;
+    block_p->endOffset = writer_p->offset;
+    block_p->firstNs = ~( solClient_uint64_t ) 0;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * smflog_writerOpen
+ *****************************************************************************/
+solClient_returnCode_t
+smflog_writerOpen ( struct smflogWriter *writer_p, const char *prefix_p, solClient_uint64_t maxSegmentBytes )
+{
+    memset ( writer_p, 0, sizeof ( *writer_p ) );
+    if ( strlen ( prefix_p ) >= sizeof ( writer_p->prefix ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Capture prefix '%s' is too long", prefix_p );
+        return SOLCLIENT_FAIL;
+    }
+    strcpy ( writer_p->prefix, prefix_p );
+    writer_p->maxSegmentBytes = ( maxSegmentBytes != 0 ) ? maxSegmentBytes : SMFLOG_DEFAULT_SEGMENT_BYTES;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * smflog_append
+ *****************************************************************************/
+solClient_returnCode_t
+smflog_append ( struct smflogWriter *writer_p, solClient_opaqueMsg_pt msg_p, solClient_uint64_t captureNs )
+{
+    solClient_returnCode_t rc;
+    solClient_destination_t destination;
+    solClient_bufInfo_t smf;
+    solClient_opaqueDatablock_pt datab_p = NULL;
+    struct smflogRecordHeader header;
+    struct smflogBlock *block_p;
+    solClient_uint64_t recordLen;
+    size_t          topicLen;
+    size_t          i;
+
+    if ( ( rc = solClient_msg_getDestination ( msg_p, &destination, sizeof ( destination ) ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_getDestination()" );
+        return rc;
+    }
+    if ( ( rc = solClient_msg_encodeToSMF ( msg_p, &smf, &datab_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_encodeToSMF()" );
+        return rc;
+    }
+    topicLen = strlen ( destination.dest );
+    recordLen = SMFLOG_ALIGN ( sizeof ( header ) + topicLen + smf.bufSize );
+
+    /* Start a new segment when this record would take the current one past its limit. */
+    if ( writer_p->file_p != NULL && writer_p->segmentRecords > 0 &&
+         writer_p->offset + recordLen > writer_p->maxSegmentBytes ) {
+        smflog_writeSegmentEnd ( writer_p );
+    }
+    if ( writer_p->file_p == NULL && ( rc = smflog_startSegment ( writer_p ) ) != SOLCLIENT_OK ) {
+        goto freeDatab;
+    }
+    block_p = ( writer_p->numBlocks > 0 ) ? &writer_p->blocks_p[writer_p->numBlocks - 1] : NULL;
+    if ( block_p == NULL || block_p->records >= SMFLOG_BLOCK_RECORDS ||
+         block_p->endOffset - block_p->offset >= SMFLOG_BLOCK_BYTES ) {
+        if ( ( rc = smflog_startBlock ( writer_p ) ) != SOLCLIENT_OK ) {
+            goto freeDatab;
+        }
+        block_p = &writer_p->blocks_p[writer_p->numBlocks - 1];
+    }
+
+    header.captureNs = captureNs;
+    header.smfLen = smf.bufSize;
+    header.topicLen = ( solClient_uint16_t ) topicLen;
+    header.reserved = 0;
+    if ( fwrite ( &header, sizeof ( header ), 1, writer_p->file_p ) != 1 ||
+         fwrite ( destination.dest, 1, topicLen, writer_p->file_p ) != topicLen ||
+         fwrite ( smf.buf_p, 1, smf.bufSize, writer_p->file_p ) != smf.bufSize ||
+         fwrite ( smflog_padding, 1, ( size_t ) ( recordLen - sizeof ( header ) - topicLen - smf.bufSize ),
+                  writer_p->file_p ) != ( size_t ) ( recordLen - sizeof ( header ) - topicLen - smf.bufSize ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not write to capture segment %u", writer_p->segmentNum );
+        rc = SOLCLIENT_FAIL;
+        goto freeDatab;
+    }
+
+    /* Index every level prefix of the topic, and the whole topic. */
+    for ( i = 1; i <= topicLen; i++ ) {
+        if ( i == topicLen || destination.dest[i] == '/' ) {
+            smflog_bloomSet ( block_p->bloom, smflog_hash ( destination.dest, i ) );
+        }
+    }
+    if ( captureNs < block_p->firstNs ) {
+        block_p->firstNs = captureNs;
+    }
+    if ( captureNs > block_p->lastNs ) {
+        block_p->lastNs = captureNs;
+    }
+    block_p->records++;
+    writer_p->offset += recordLen;
+    block_p->endOffset = writer_p->offset;
+    writer_p->segmentRecords++;
+    writer_p->records++;
+
+  freeDatab:
+    solClient_datablock_free ( &datab_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * smflog_writerClose
+ *****************************************************************************/
+void
+smflog_writerClose ( struct smflogWriter *writer_p )
+{
+    smflog_writeSegmentEnd ( writer_p );
+    free ( writer_p->blocks_p );
+    writer_p->blocks_p = NULL;
+    writer_p->maxBlocks = 0;
+}
+
+/*****************************************************************************
+ * smflog_segmentOpen
+ *****************************************************************************/
+solClient_returnCode_t
+smflog_segmentOpen ( struct smflogSegment *segment_p, const char *path_p )
+{
+    const unsigned char *base_p;
+    struct smflogHeader header;
+    struct smflogTrailer trailer;
+    size_t          size;
+
+    memset ( segment_p, 0, sizeof ( *segment_p ) );
+    if ( os_mapFile ( path_p, &segment_p->map ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not map capture segment '%s'", path_p );
+        return SOLCLIENT_FAIL;
+    }
+    base_p = ( const unsigned char * ) segment_p->map.addr_p;
+    size = segment_p->map.size;
+
+    if ( size < sizeof ( header ) ) {
+        goto notSegment;
+    }
+    memcpy ( &header, base_p, sizeof ( header ) );
+    if ( memcmp ( header.magic, "SMFL", 4 ) != 0 || header.byteOrder != SMFLOG_BYTE_ORDER_MARK ||
+         header.version != SMFLOG_VERSION ) {
+        goto notSegment;
+    }
+
+    if ( size >= sizeof ( header ) + sizeof ( trailer ) ) {
+        memcpy ( &trailer, base_p + size - sizeof ( trailer ), sizeof ( trailer ) );
+        if ( memcmp ( trailer.magic, "SMFX", 4 ) == 0 && trailer.indexOffset >= sizeof ( header ) &&
+             trailer.indexOffset % 8 == 0 &&
+             trailer.indexOffset + ( solClient_uint64_t ) trailer.blocks * sizeof ( struct smflogBlock ) ==
+             size - sizeof ( trailer ) ) {
+            segment_p->blocks_p = ( const struct smflogBlock * ) ( base_p + trailer.indexOffset );
+            segment_p->numBlocks = trailer.blocks;
+            segment_p->indexed = 1;
+            segment_p->records = trailer.records;
+            segment_p->firstNs = trailer.firstNs;
+            segment_p->lastNs = trailer.lastNs;
+            return SOLCLIENT_OK;
+        }
+    }
+
+    /* Not closed: one block covering everything, to be scanned. */
+    segment_p->scanBlock.offset = sizeof ( header );
+    segment_p->scanBlock.endOffset = size;
+    segment_p->scanBlock.firstNs = 0;
+    segment_p->scanBlock.lastNs = ~( solClient_uint64_t ) 0;
+    memset ( segment_p->scanBlock.bloom, 0xff, sizeof ( segment_p->scanBlock.bloom ) );
+    segment_p->blocks_p = &segment_p->scanBlock;
+    segment_p->numBlocks = 1;
+    segment_p->firstNs = 0;
+    segment_p->lastNs = ~( solClient_uint64_t ) 0;
+    return SOLCLIENT_OK;
+
+  notSegment:
+    solClient_log ( SOLCLIENT_LOG_ERROR, "'%s' is not a capture segment of this byte order and version", path_p );
+    os_unmapFile ( &segment_p->map );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * smflog_segmentClose
+ *****************************************************************************/
+void
+smflog_segmentClose ( struct smflogSegment *segment_p )
+{
+    if ( segment_p->map.addr_p != NULL ) {
+        os_unmapFile ( &segment_p->map );
+    }
+}
+
+/*****************************************************************************
+ * smflog_cursorInit
+ *****************************************************************************/
+void
+smflog_cursorInit ( struct smflogCursor *cursor_p, const struct smflogSegment *segment_p, const struct smflogBlock *block_p )
+{
+    const unsigned char *base_p = ( const unsigned char * ) segment_p->map.addr_p;
+    solClient_uint64_t end = ( block_p->endOffset < segment_p->map.size ) ? block_p->endOffset : segment_p->map.size;
+
+    cursor_p->pos_p = base_p + block_p->offset;
+    cursor_p->end_p = base_p + end;
+}
+
+/*****************************************************************************
+ * smflog_next
+ *****************************************************************************/
+solClient_returnCode_t
+smflog_next ( struct smflogCursor *cursor_p, struct smflogRecord *record_p )
+{
+    const struct smflogRecordHeader *header_p;
+    solClient_uint64_t recordLen;
+
+    if ( ( size_t ) ( cursor_p->end_p - cursor_p->pos_p ) < sizeof ( struct smflogRecordHeader ) ) {
+        return SOLCLIENT_EOS;
+    }
+    header_p = ( const struct smflogRecordHeader * ) cursor_p->pos_p;
+    recordLen = SMFLOG_ALIGN ( sizeof ( *header_p ) + header_p->topicLen + ( solClient_uint64_t ) header_p->smfLen );
+    if ( header_p->smfLen == 0 || recordLen > ( solClient_uint64_t ) ( cursor_p->end_p - cursor_p->pos_p ) ) {
+        /* The end of an unclosed segment, or a record cut short by a crash. */
+        cursor_p->pos_p = cursor_p->end_p;
+        return SOLCLIENT_EOS;
+    }
+
+    record_p->captureNs = header_p->captureNs;
+    record_p->topic_p = ( const char * ) ( header_p + 1 );
+    record_p->topicLen = header_p->topicLen;
+    record_p->smf.buf_p = ( void * ) ( cursor_p->pos_p + sizeof ( *header_p ) + header_p->topicLen );
+    record_p->smf.bufSize = header_p->smfLen;
+    cursor_p->pos_p += recordLen;
+    return SOLCLIENT_OK;
+}
@@ -0,0 +1,228 @@
+/** example Intro/smflog.h
+ */
+
+/**
+ *
+ * file smflog.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a capture log of received messages in SMF
+ * form (solClient_msg_encodeToSMF()), split into segment files that are
+ * read back through a memory mapping.
+ *
+ * Segment layout (integers in the byte order of the capturing host, which
+ * the header records):
+ *
+ *  +--------+---------+------------------------+-------------+---------+
+ *  | header | records | block index            | trailer     |
+ *  +--------+---------+------------------------+-------------+---------+
+ *
+ * Each record is a ::smflogRecordHeader, the topic, and the SMF encoding of
+ * the message, padded to 8 bytes. The topic is stored outside the SMF so
+ * that queries can filter records without decoding them.
+ *
+ * Records are grouped into blocks of up to ::SMFLOG_BLOCK_RECORDS records.
+ * The block index is sparse: one ::smflogBlock per block, giving its offset,
+ * its time range and a Bloom filter over the topic levels it contains
+ * ("a", "a/b", "a/b/c" for topic "a/b/c"), so a query skips blocks outside
+ * its time range or without its topic prefix. A segment that was not closed
+ * has no index or trailer; it is read by scanning its records.
+ */
+
+#ifndef SMFLOG_H_
+#define SMFLOG_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define SMFLOG_VERSION              1
+#define SMFLOG_BYTE_ORDER_MARK      0x01020304u
+#define SMFLOG_BLOCK_RECORDS        1024        /**< Records per index block. */
+#define SMFLOG_BLOCK_BYTES          ( 256 * 1024 )  /**< Record bytes that also end a block. */
+#define SMFLOG_BLOOM_BYTES          128         /**< Bloom filter size per block. */
+#define SMFLOG_BLOOM_HASHES         3
+#define SMFLOG_DEFAULT_SEGMENT_BYTES ( 256 * 1024 * 1024 )
+
+/**
+ * @struct smflogHeader
+ * The first bytes of every segment.
+ */
+struct smflogHeader
+{
+    char            magic[4];           /**< "SMFL". */
+    solClient_uint32_t byteOrder;       /**< ::SMFLOG_BYTE_ORDER_MARK as written. */
+    solClient_uint32_t version;
+    solClient_uint32_t segmentNum;
+};
+
+/**
+ * @struct smflogRecordHeader
+ * Precedes the topic and SMF bytes of each record.
+ */
+struct smflogRecordHeader
+{
+    solClient_uint64_t captureNs;       /**< Wall-clock receive time, ns since the epoch. */
+    solClient_uint32_t smfLen;
+    solClient_uint16_t topicLen;
+    solClient_uint16_t reserved;
+};
+
+/**
+ * @struct smflogBlock
+ * One entry of the sparse block index.
+ */
+struct smflogBlock
+{
+    solClient_uint64_t offset;          /**< Offset of the first record in the segment. */
+    solClient_uint64_t endOffset;       /**< Offset just past the last record. */
+    solClient_uint64_t firstNs;         /**< Lowest capture time in the block. */
+    solClient_uint64_t lastNs;          /**< Highest capture time in the block. */
+    solClient_uint32_t records;
+    solClient_uint32_t reserved;
+    unsigned char   bloom[SMFLOG_BLOOM_BYTES];
+};
+
+/**
+ * @struct smflogTrailer
+ * The last bytes of a closed segment.
+ */
+struct smflogTrailer
+{
+    solClient_uint64_t indexOffset;
+    solClient_uint64_t records;
+    solClient_uint64_t firstNs;
+    solClient_uint64_t lastNs;
+    solClient_uint32_t blocks;
+    char            magic[4];           /**< "SMFX". */
+};
+
+/**
+ * @struct smflogWriter
+ * Appends records to numbered segments <prefix>.<n>.smfl, starting a new
+ * segment once the current one reaches its size limit. Not thread-safe.
+ */
+struct smflogWriter
+{
+    FILE           *file_p;
+    char            prefix[512];
+    solClient_uint32_t segmentNum;
+    solClient_uint64_t maxSegmentBytes;
+    solClient_uint64_t offset;          /**< Bytes written to the current segment. */
+    struct smflogBlock *blocks_p;       /**< Index of the current segment. */
+    solClient_uint32_t numBlocks;
+    solClient_uint32_t maxBlocks;
+    solClient_uint64_t segmentRecords;
+    solClient_uint64_t records;         /**< Records written to all segments. */
+    solClient_uint64_t bytes;           /**< Bytes written to all segments. */
+};
+
+/**
+ * @struct smflogSegment
+ * A segment mapped for reading.
+ */
+struct smflogSegment
+{
+    struct os_mappedFile map;
+    const struct smflogBlock *blocks_p; /**< The block index, or &scanBlock. */
+    solClient_uint32_t numBlocks;
+    int             indexed;            /**< 0 if the segment was not closed. */
+    solClient_uint64_t records;         /**< 0 if not indexed. */
+    solClient_uint64_t firstNs;
+    solClient_uint64_t lastNs;
+    struct smflogBlock scanBlock;       /**< Whole-segment block used without an index. */
+};
+
+/**
+ * @struct smflogRecord
+ * A record returned by smflog_next(). The pointers refer to the mapping.
+ */
+struct smflogRecord
+{
+    solClient_uint64_t captureNs;
+    const char     *topic_p;            /**< Not NUL terminated. */
+    solClient_uint32_t topicLen;
+    solClient_bufInfo_t smf;            /**< For solClient_msg_decodeFromSmf(). */
+};
+
+/**
+ * @struct smflogCursor
+ * Iterates the records of one block.
+ */
+struct smflogCursor
+{
+    const unsigned char *pos_p;
+    const unsigned char *end_p;
+};
+
+
+/**
+ * Hash used for the Bloom filters (FNV-1a).
+ */
+solClient_uint32_t
+    smflog_hash ( const char *str_p, size_t len );
+
+/**
+ * Open a writer; the first segment is created by the first append.
+ * @param writer_p The writer to initialize.
+ * @param prefix_p Path prefix of the segment files.
+ * @param maxSegmentBytes Size after which a new segment is started.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    smflog_writerOpen ( struct smflogWriter *writer_p, const char *prefix_p, solClient_uint64_t maxSegmentBytes );
+
+/**
+ * Append a message, encoded with solClient_msg_encodeToSMF().
+ * @param writer_p The writer.
+ * @param msg_p The message; it must have a Topic destination.
+ * @param captureNs The capture time, ns since the epoch.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    smflog_append ( struct smflogWriter *writer_p, solClient_opaqueMsg_pt msg_p, solClient_uint64_t captureNs );
+
+/**
+ * Close the current segment, writing its index and trailer.
+ */
+void
+    smflog_writerClose ( struct smflogWriter *writer_p );
+
+/**
+ * Map a segment for reading and locate its index.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL if the file cannot be mapped or is
+ * not a segment written on a host of the same byte order.
+ */
+solClient_returnCode_t
+    smflog_segmentOpen ( struct smflogSegment *segment_p, const char *path_p );
+
+/**
+ * Unmap a segment.
+ */
+void
+    smflog_segmentClose ( struct smflogSegment *segment_p );
+
+/**
+ * Test a block's Bloom filter for a topic prefix of whole levels.
+ * @return 0 if no topic in the block starts with the prefix, 1 if one may.
+ */
+int
+    smflog_blockMayContain ( const struct smflogBlock *block_p, solClient_uint32_t prefixHash );
+
+/**
+ * Position a cursor at the first record of a block.
+ */
+void
+    smflog_cursorInit ( struct smflogCursor *cursor_p, const struct smflogSegment *segment_p,
+                        const struct smflogBlock *block_p );
+
+/**
+ * Return the next record of the block.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_EOS at the end of the block or at a
+ * truncated record.
+ */
+solClient_returnCode_t
+    smflog_next ( struct smflogCursor *cursor_p, struct smflogRecord *record_p );
+
+#endif /* SMFLOG_H_ */
@@ -0,0 +1,613 @@
+
+/** example Intro/solClientMock.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * A stand-in for the Context, Session, Flow and event functions of
+ * libsolclient, for driving application callbacks offline. See
+ * solClientMock.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "solClientMock.h"
+
+#define MOCK_CONTEXT_MAGIC  0x4d435458
+#define MOCK_SESSION_MAGIC  0x4d534553
+#define MOCK_FLOW_MAGIC     0x4d464c57
+
+struct mockTimer
+{
+    int             active;
+    solClient_context_timerMode_t mode;
+    solClient_uint32_t durationMs;
+    solClient_uint64_t expiryMs;
+    solClient_context_timerCallbackFunc_t callback_p;
+    void           *user_p;
+};
+
+struct mockEvent
+{
+    solClient_session_event_t sessionEvent;
+    solClient_session_responseCode_t responseCode;
+    void           *correlation_p;
+};
+
+struct mockSession;
+
+struct mockContext
+{
+    int             magic;
+    solClient_uint64_t nowMs;
+    struct mockTimer timers[SOLCLIENTMOCK_MAX_TIMERS];
+    struct mockSession *sessions_p;
+    solClientMock_connectHookFunc_t connectHook_p;
+    void           *connectHookUser_p;
+};
+
+struct mockSession
+{
+    int             magic;
+    struct mockContext *context_p;
+    struct mockSession *next_p;
+    solClient_session_createFuncInfo_t funcInfo;
+    int             connected;
+    solClientMock_sendHookFunc_t sendHook_p;
+    void           *sendHookUser_p;
+    struct mockEvent pending[SOLCLIENTMOCK_MAX_PENDING];
+    unsigned int    pendingHead;
+    unsigned int    pendingCount;
+    struct solClientMock_stats stats;
+};
+
+struct mockFlow
+{
+    int             magic;
+    struct mockSession *session_p;
+    solClient_flow_createFuncInfo_t funcInfo;
+    struct solClientMock_stats stats;
+};
+
+/* The message currently being delivered to a Flow callback, for getMsgId. */
+static solClient_opaqueMsg_pt deliveringMsg_p = NULL;
+static solClient_msgId_t deliveringMsgId = 0;
+
+
+/*****************************************************************************
+ * mock_queueEvent
+ *****************************************************************************/
+static void
+mock_queueEvent ( struct mockSession *session_p, solClient_session_event_t sessionEvent,
+                  solClient_session_responseCode_t responseCode, void *correlation_p )
+{
+    struct mockEvent *event_p;
+
+    if ( session_p->pendingCount == SOLCLIENTMOCK_MAX_PENDING ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "solClientMock: event queue full, dropping %s",
+                        solClient_session_eventToString ( sessionEvent ) );
+        return;
+    }
+    event_p = &session_p->pending[( session_p->pendingHead + session_p->pendingCount ) % SOLCLIENTMOCK_MAX_PENDING];
+    event_p->sessionEvent = sessionEvent;
+    event_p->responseCode = responseCode;
+    event_p->correlation_p = correlation_p;
+    session_p->pendingCount++;
+}
+
+
+/*****************************************************************************
+ * Context
+ *****************************************************************************/
+static solClient_returnCode_t
+mock_context_create ( solClient_propertyArray_pt props,
+                      solClient_opaqueContext_pt * opaqueContext_p,
+                      solClient_context_createFuncInfo_t * funcInfo_p, size_t funcInfoSize )
+{
+    struct mockContext *context_p;
+
+    /* No Context thread is created; the driver calls solClientMock_processEvents(). */
+    if ( ( context_p = ( struct mockContext * ) calloc ( 1, sizeof ( *context_p ) ) ) == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    context_p->magic = MOCK_CONTEXT_MAGIC;
+    *opaqueContext_p = context_p;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_context_destroy ( solClient_opaqueContext_pt * opaqueContext_p )
+{
+    struct mockContext *context_p = ( struct mockContext * ) *opaqueContext_p;
+
+    if ( context_p == NULL || context_p->magic != MOCK_CONTEXT_MAGIC ) {
+        return SOLCLIENT_FAIL;
+    }
+    context_p->magic = 0;
+    free ( context_p );
+    *opaqueContext_p = NULL;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_context_startTimer ( solClient_opaqueContext_pt opaqueContext_p,
+                          solClient_context_timerMode_t timerMode,
+                          solClient_uint32_t durationMs,
+                          solClient_context_timerCallbackFunc_t callback_p, void *user_p,
+                          solClient_context_timerId_t * timerId_p )
+{
+    struct mockContext *context_p = ( struct mockContext * ) opaqueContext_p;
+    solClient_uint32_t i;
+
+    for ( i = 0; i < SOLCLIENTMOCK_MAX_TIMERS; i++ ) {
+        if ( !context_p->timers[i].active ) {
+            context_p->timers[i].active = 1;
+            context_p->timers[i].mode = timerMode;
+            context_p->timers[i].durationMs = durationMs;
+            context_p->timers[i].expiryMs = context_p->nowMs + durationMs;
+            context_p->timers[i].callback_p = callback_p;
+            context_p->timers[i].user_p = user_p;
+            *timerId_p = i;
+            return SOLCLIENT_OK;
+        }
+    }
+    return SOLCLIENT_FAIL;
+}
+
+static solClient_returnCode_t
+mock_context_stopTimer ( solClient_opaqueContext_pt opaqueContext_p, solClient_context_timerId_t * timerId_p )
+{
+    struct mockContext *context_p = ( struct mockContext * ) opaqueContext_p;
+
+    if ( *timerId_p >= SOLCLIENTMOCK_MAX_TIMERS || !context_p->timers[*timerId_p].active ) {
+        return SOLCLIENT_FAIL;
+    }
+    context_p->timers[*timerId_p].active = 0;
+    *timerId_p = SOLCLIENT_CONTEXT_TIMER_ID_INVALID;
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * Session
+ *****************************************************************************/
+static solClient_returnCode_t
+mock_session_create ( solClient_propertyArray_pt props,
+                      solClient_opaqueContext_pt opaqueContext_p,
+                      solClient_opaqueSession_pt * opaqueSession_p,
+                      solClient_session_createFuncInfo_t * funcInfo_p, size_t funcInfoSize )
+{
+    struct mockContext *context_p = ( struct mockContext * ) opaqueContext_p;
+    struct mockSession *session_p;
+
+    if ( context_p == NULL || context_p->magic != MOCK_CONTEXT_MAGIC || funcInfo_p == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    if ( ( session_p = ( struct mockSession * ) calloc ( 1, sizeof ( *session_p ) ) ) == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    session_p->magic = MOCK_SESSION_MAGIC;
+    session_p->context_p = context_p;
+    session_p->funcInfo = *funcInfo_p;
+    session_p->next_p = context_p->sessions_p;
+    context_p->sessions_p = session_p;
+    *opaqueSession_p = session_p;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_destroy ( solClient_opaqueSession_pt * opaqueSession_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) *opaqueSession_p;
+    struct mockSession **link_pp;
+
+    if ( session_p == NULL || session_p->magic != MOCK_SESSION_MAGIC ) {
+        return SOLCLIENT_FAIL;
+    }
+    for ( link_pp = &session_p->context_p->sessions_p; *link_pp != NULL; link_pp = &( *link_pp )->next_p ) {
+        if ( *link_pp == session_p ) {
+            *link_pp = session_p->next_p;
+            break;
+        }
+    }
+    session_p->magic = 0;
+    free ( session_p );
+    *opaqueSession_p = NULL;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_getContext ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueContext_pt * opaqueContext_p )
+{
+    *opaqueContext_p = ( ( struct mockSession * ) opaqueSession_p )->context_p;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_connect ( solClient_opaqueSession_pt opaqueSession_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+    solClient_session_event_t sessionEvent = SOLCLIENT_SESSION_EVENT_UP_NOTICE;
+
+    session_p->stats.connects++;
+    if ( session_p->context_p->connectHook_p != NULL ) {
+        sessionEvent = session_p->context_p->connectHook_p ( opaqueSession_p, session_p->context_p->connectHookUser_p );
+    }
+    session_p->connected = ( sessionEvent == SOLCLIENT_SESSION_EVENT_UP_NOTICE );
+    mock_queueEvent ( session_p, sessionEvent, 0, NULL );
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_disconnect ( solClient_opaqueSession_pt opaqueSession_p )
+{
+    ( ( struct mockSession * ) opaqueSession_p )->connected = 0;
+    return SOLCLIENT_OK;
+}
+
+static solClient_bool_t
+mock_session_isCapable ( solClient_opaqueSession_pt opaqueSession_p, const char *capabilityName_p )
+{
+    return 1;
+}
+
+static solClient_returnCode_t
+mock_session_sendMsg ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    if ( !session_p->connected ) {
+        return SOLCLIENT_FAIL;
+    }
+    session_p->stats.msgsSent++;
+    if ( session_p->sendHook_p != NULL ) {
+        return session_p->sendHook_p ( opaqueSession_p, msg_p, NULL, session_p->sendHookUser_p );
+    }
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_sendMultipleMsg ( solClient_opaqueSession_pt opaqueSession_p,
+                               solClient_opaqueMsg_pt * msgArray_p,
+                               solClient_uint32_t numberOfMessages, solClient_uint32_t * numberOfMessagesWritten )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+    solClient_uint32_t i;
+
+    for ( i = 0; i < numberOfMessages; i++ ) {
+        if ( ( rc = mock_session_sendMsg ( opaqueSession_p, msgArray_p[i] ) ) != SOLCLIENT_OK ) {
+            break;
+        }
+    }
+    *numberOfMessagesWritten = i;
+    return rc;
+}
+
+static solClient_returnCode_t
+mock_session_sendRequest ( solClient_opaqueSession_pt opaqueSession_p,
+                           solClient_opaqueMsg_pt msg_p, solClient_opaqueMsg_pt * replyMsg_p, solClient_uint32_t timeout )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+    solClient_returnCode_t rc;
+
+    if ( !session_p->connected ) {
+        return SOLCLIENT_FAIL;
+    }
+    session_p->stats.requestsSent++;
+    if ( replyMsg_p != NULL ) {
+        *replyMsg_p = NULL;
+    }
+    if ( session_p->sendHook_p == NULL ) {
+        /* Nobody answers: a blocking request times out immediately. */
+        return ( replyMsg_p != NULL && timeout != 0 ) ? SOLCLIENT_INCOMPLETE : SOLCLIENT_OK;
+    }
+    rc = session_p->sendHook_p ( opaqueSession_p, msg_p, replyMsg_p, session_p->sendHookUser_p );
+    if ( rc == SOLCLIENT_OK && replyMsg_p != NULL && timeout != 0 && *replyMsg_p == NULL ) {
+        rc = SOLCLIENT_INCOMPLETE;
+    }
+    return rc;
+}
+
+static solClient_returnCode_t
+mock_session_sendReply ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt rxmsg_p, solClient_opaqueMsg_pt replyMsg_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    if ( !session_p->connected ) {
+        return SOLCLIENT_FAIL;
+    }
+    session_p->stats.repliesSent++;
+    if ( session_p->sendHook_p != NULL ) {
+        return session_p->sendHook_p ( opaqueSession_p, replyMsg_p, NULL, session_p->sendHookUser_p );
+    }
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_topicSubscribeExt ( solClient_opaqueSession_pt opaqueSession_p,
+                                 solClient_subscribeFlags_t flags, const char *topicSubscription_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    session_p->stats.subscribes++;
+    if ( !( flags & SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM ) && ( flags & SOLCLIENT_SUBSCRIBE_FLAGS_REQUEST_CONFIRM ) ) {
+        mock_queueEvent ( session_p, SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_OK, 0, NULL );
+    }
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_topicUnsubscribeExt ( solClient_opaqueSession_pt opaqueSession_p,
+                                   solClient_subscribeFlags_t flags, const char *topicSubscription_p )
+{
+    ( ( struct mockSession * ) opaqueSession_p )->stats.unsubscribes++;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_endpointProvision ( solClient_propertyArray_pt props,
+                                 solClient_opaqueSession_pt opaqueSession_p,
+                                 solClient_uint32_t provisionFlags,
+                                 void *correlationTag, char *queueNetworkName, size_t qnnSize )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    session_p->stats.provisions++;
+    if ( !( provisionFlags & SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM ) ) {
+        mock_queueEvent ( session_p, SOLCLIENT_SESSION_EVENT_PROVISION_OK, 0, correlationTag );
+        return SOLCLIENT_IN_PROGRESS;
+    }
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_session_endpointDeprovision ( solClient_propertyArray_pt props,
+                                   solClient_opaqueSession_pt opaqueSession_p,
+                                   solClient_uint32_t provisionFlags, void *correlationTag )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    session_p->stats.deprovisions++;
+    if ( !( provisionFlags & SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM ) ) {
+        mock_queueEvent ( session_p, SOLCLIENT_SESSION_EVENT_PROVISION_OK, 0, correlationTag );
+        return SOLCLIENT_IN_PROGRESS;
+    }
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * Flow
+ *****************************************************************************/
+static solClient_returnCode_t
+mock_session_createFlow ( solClient_propertyArray_pt props,
+                          solClient_opaqueSession_pt opaqueSession_p,
+                          solClient_opaqueFlow_pt * opaqueFlow_p,
+                          solClient_flow_createFuncInfo_t * funcInfo_p, size_t funcInfoSize )
+{
+    struct mockFlow *flow_p;
+
+    if ( funcInfo_p == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    if ( ( flow_p = ( struct mockFlow * ) calloc ( 1, sizeof ( *flow_p ) ) ) == NULL ) {
+        return SOLCLIENT_FAIL;
+    }
+    flow_p->magic = MOCK_FLOW_MAGIC;
+    flow_p->session_p = ( struct mockSession * ) opaqueSession_p;
+    flow_p->funcInfo = *funcInfo_p;
+    *opaqueFlow_p = flow_p;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_flow_destroy ( solClient_opaqueFlow_pt * opaqueFlow_p )
+{
+    struct mockFlow *flow_p = ( struct mockFlow * ) *opaqueFlow_p;
+
+    if ( flow_p == NULL || flow_p->magic != MOCK_FLOW_MAGIC ) {
+        return SOLCLIENT_FAIL;
+    }
+    flow_p->magic = 0;
+    free ( flow_p );
+    *opaqueFlow_p = NULL;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_flow_getSession ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueSession_pt * opaqueSession_p )
+{
+    *opaqueSession_p = ( ( struct mockFlow * ) opaqueFlow_p )->session_p;
+    return SOLCLIENT_OK;
+}
+
+static solClient_returnCode_t
+mock_flow_sendAck ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_msgId_t msgId )
+{
+    struct mockFlow *flow_p = ( struct mockFlow * ) opaqueFlow_p;
+
+    flow_p->stats.acks++;
+    flow_p->stats.lastAckedMsgId = msgId;
+    return SOLCLIENT_OK;
+}
+
+/*
+ * Guaranteed message IDs cannot be set through the message API, so the
+ * mock answers for the message it is delivering and asks the library about
+ * any other.
+ */
+static solClient_returnCode_t
+mock_msg_getMsgId ( solClient_opaqueMsg_pt msg_p, solClient_msgId_t * msgId_p )
+{
+    if ( msg_p != NULL && msg_p == deliveringMsg_p ) {
+        *msgId_p = deliveringMsgId;
+        return SOLCLIENT_OK;
+    }
+    return solClient_msg_getMsgId ( msg_p, msgId_p );
+}
+
+static const struct common_solClientApi mock_api = {
+    mock_context_create,
+    mock_context_destroy,
+    mock_context_startTimer,
+    mock_context_stopTimer,
+    mock_session_create,
+    mock_session_destroy,
+    mock_session_getContext,
+    mock_session_connect,
+    mock_session_disconnect,
+    mock_session_isCapable,
+    mock_session_sendMsg,
+    mock_session_sendMultipleMsg,
+    mock_session_sendRequest,
+    mock_session_sendReply,
+    mock_session_topicSubscribeExt,
+    mock_session_topicUnsubscribeExt,
+    mock_session_endpointProvision,
+    mock_session_endpointDeprovision,
+    mock_session_createFlow,
+    mock_flow_destroy,
+    mock_flow_getSession,
+    mock_flow_sendAck,
+    mock_msg_getMsgId
+};
+
+
+/*****************************************************************************
+ * Driver interface
+ *****************************************************************************/
+void
+solClientMock_install ( void )
+{
+    common_setSolClientApi ( &mock_api );
+}
+
+solClient_rxMsgCallback_returnCode_t
+solClientMock_injectMsg ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    return session_p->funcInfo.rxMsgInfo.callback_p ( opaqueSession_p, msg_p, session_p->funcInfo.rxMsgInfo.user_p );
+}
+
+solClient_rxMsgCallback_returnCode_t
+solClientMock_injectFlowMsg ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, solClient_msgId_t msgId )
+{
+    struct mockFlow *flow_p = ( struct mockFlow * ) opaqueFlow_p;
+    solClient_rxMsgCallback_returnCode_t rc;
+
+    deliveringMsg_p = msg_p;
+    deliveringMsgId = msgId;
+    rc = flow_p->funcInfo.rxMsgInfo.callback_p ( opaqueFlow_p, msg_p, flow_p->funcInfo.rxMsgInfo.user_p );
+    deliveringMsg_p = NULL;
+    return rc;
+}
+
+void
+solClientMock_injectSessionEvent ( solClient_opaqueSession_pt opaqueSession_p,
+                                   solClient_session_event_t sessionEvent,
+                                   solClient_session_responseCode_t responseCode, const char *info_p, void *correlation_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+    solClient_session_eventCallbackInfo_t eventInfo;
+
+    eventInfo.sessionEvent = sessionEvent;
+    eventInfo.responseCode = responseCode;
+    eventInfo.info_p = ( info_p != NULL ) ? info_p : "";
+    eventInfo.correlation_p = correlation_p;
+    if ( sessionEvent == SOLCLIENT_SESSION_EVENT_DOWN_ERROR ) {
+        session_p->connected = 0;
+    }
+    session_p->funcInfo.eventInfo.callback_p ( opaqueSession_p, &eventInfo, session_p->funcInfo.eventInfo.user_p );
+}
+
+void
+solClientMock_injectFlowEvent ( solClient_opaqueFlow_pt opaqueFlow_p,
+                                solClient_flow_event_t flowEvent,
+                                solClient_session_responseCode_t responseCode, const char *info_p )
+{
+    struct mockFlow *flow_p = ( struct mockFlow * ) opaqueFlow_p;
+    solClient_flow_eventCallbackInfo_t eventInfo;
+
+    eventInfo.flowEvent = flowEvent;
+    eventInfo.responseCode = responseCode;
+    eventInfo.info_p = ( info_p != NULL ) ? info_p : "";
+    flow_p->funcInfo.eventInfo.callback_p ( opaqueFlow_p, &eventInfo, flow_p->funcInfo.eventInfo.user_p );
+}
+
+int
+solClientMock_processEvents ( solClient_opaqueContext_pt opaqueContext_p, solClient_uint32_t elapsedMs )
+{
+    struct mockContext *context_p = ( struct mockContext * ) opaqueContext_p;
+    struct mockSession *session_p;
+    struct mockEvent event;
+    struct mockTimer *timer_p;
+    int             delivered = 0;
+    solClient_uint32_t i;
+
+    /* Queued events first, as the Context thread would have seen them before the time passed. */
+    for ( session_p = context_p->sessions_p; session_p != NULL; session_p = session_p->next_p ) {
+        while ( session_p->pendingCount != 0 ) {
+            event = session_p->pending[session_p->pendingHead];
+            session_p->pendingHead = ( session_p->pendingHead + 1 ) % SOLCLIENTMOCK_MAX_PENDING;
+            session_p->pendingCount--;
+            solClientMock_injectSessionEvent ( session_p, event.sessionEvent, event.responseCode, NULL, event.correlation_p );
+            delivered++;
+        }
+    }
+
+    context_p->nowMs += elapsedMs;
+    for ( i = 0; i < SOLCLIENTMOCK_MAX_TIMERS; i++ ) {
+        timer_p = &context_p->timers[i];
+        while ( timer_p->active && timer_p->expiryMs <= context_p->nowMs ) {
+            if ( timer_p->mode == SOLCLIENT_CONTEXT_TIMER_REPEAT && timer_p->durationMs != 0 ) {
+                timer_p->expiryMs += timer_p->durationMs;
+            } else {
+                timer_p->active = 0;
+            }
+            timer_p->callback_p ( opaqueContext_p, timer_p->user_p );
+            delivered++;
+        }
+    }
+    return delivered;
+}
+
+void
+solClientMock_setSendHook ( solClient_opaqueSession_pt opaqueSession_p, solClientMock_sendHookFunc_t hook_p, void *user_p )
+{
+    struct mockSession *session_p = ( struct mockSession * ) opaqueSession_p;
+
+    session_p->sendHook_p = hook_p;
+    session_p->sendHookUser_p = user_p;
+}
+
+void
+solClientMock_setConnectHook ( solClient_opaqueContext_pt opaqueContext_p,
+                               solClientMock_connectHookFunc_t hook_p, void *user_p )
+{
+    struct mockContext *context_p = ( struct mockContext * ) opaqueContext_p;
+
+    context_p->connectHook_p = hook_p;
+    context_p->connectHookUser_p = user_p;
+}
+
+void
+solClientMock_getStats ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueFlow_pt opaqueFlow_p,
+                         struct solClientMock_stats *stats_p )
+{
+    if ( opaqueFlow_p != NULL ) {
+        *stats_p = ( ( struct mockFlow * ) opaqueFlow_p )->stats;
+    } else {
+        *stats_p = ( ( struct mockSession * ) opaqueSession_p )->stats;
+    }
+}
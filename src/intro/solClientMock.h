@@ -0,0 +1,156 @@
+/** example Intro/solClientMock.h
+ */
+
+/**
+ *
+ * file solClientMock.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * solClientMock.c implements the Context, Session, Flow and event calls of
+ * ::common_solClientApi without a network connection. solClientMock_install()
+ * routes that table to the mock; the application then makes those calls
+ * through common_getSolClientApi(), as common.c and connmgr.c do, while
+ * messages, containers, logging and solClient_initialize() still come from
+ * the real library, so callbacks are exercised on real message objects. No
+ * libsolclient symbol is redefined, and the library's own calls are
+ * unaffected.
+ *
+ * Nothing happens on its own. A driver injects messages and events into the
+ * registered callbacks with the functions below, synchronously on the
+ * calling thread, and advances a virtual clock to fire Context timers. This
+ * makes callback benchmarks and profiles deterministic and free of network
+ * variance. The mock is not thread-safe; drive it from one thread.
+ */
+
+#ifndef SOLCLIENTMOCK_H_
+#define SOLCLIENTMOCK_H_
+
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+
+#define SOLCLIENTMOCK_MAX_TIMERS       64      /**< Timers per Context. */
+#define SOLCLIENTMOCK_MAX_PENDING      1024    /**< Queued Session events per Session. */
+
+/**
+ * @struct solClientMock_stats
+ * What the application did to a mock Session or Flow.
+ */
+struct solClientMock_stats
+{
+    solClient_uint64_t connects;            /**< session_connect calls. */
+    solClient_uint64_t msgsSent;            /**< session_sendMsg and session_sendMultipleMsg messages. */
+    solClient_uint64_t requestsSent;        /**< session_sendRequest calls. */
+    solClient_uint64_t repliesSent;         /**< session_sendReply calls. */
+    solClient_uint64_t subscribes;          /**< Topic subscriptions added. */
+    solClient_uint64_t unsubscribes;        /**< Topic subscriptions removed. */
+    solClient_uint64_t provisions;          /**< Endpoints provisioned. */
+    solClient_uint64_t deprovisions;        /**< Endpoints deprovisioned. */
+    solClient_uint64_t acks;                /**< flow_sendAck calls. */
+    solClient_msgId_t  lastAckedMsgId;      /**< Message ID of the most recent ack. */
+};
+
+/**
+ * A hook called for every message the application sends on a mock Session.
+ * For session_sendRequest, replyMsg_pp is not NULL and the hook
+ * may set it to a reply message that is handed to the requestor.
+ * @return The value returned to the application by the send call.
+ */
+typedef solClient_returnCode_t ( *solClientMock_sendHookFunc_t ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                                    solClient_opaqueMsg_pt msg_p,
+                                                                    solClient_opaqueMsg_pt * replyMsg_pp,
+                                                                    void *user_p );
+
+/**
+ * A hook called for session_connect on any Session of a mock
+ * Context, standing in for the broker's answer.
+ * @return The event to queue for the Session: ::SOLCLIENT_SESSION_EVENT_UP_NOTICE
+ * to accept the connection, or for example ::SOLCLIENT_SESSION_EVENT_CONNECT_FAILED_ERROR.
+ */
+typedef solClient_session_event_t ( *solClientMock_connectHookFunc_t ) ( solClient_opaqueSession_pt opaqueSession_p,
+                                                                         void *user_p );
+
+
+/**
+ * Route ::common_solClientApi to the mock, so that the Contexts, Sessions
+ * and Flows created through it from then on are mock ones. Call it after
+ * solClient_initialize() and before creating a Context.
+ */
+void
+    solClientMock_install ( void );
+
+/**
+ * Deliver a message to the Session's receive callback.
+ * @param opaqueSession_p A mock Session.
+ * @param msg_p The message. It still belongs to the caller afterwards unless
+ * the callback returned ::SOLCLIENT_CALLBACK_TAKE_MSG.
+ * @return The callback's return code.
+ */
+solClient_rxMsgCallback_returnCode_t
+    solClientMock_injectMsg ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Deliver a Guaranteed message to the Flow's receive callback. While the
+ * callback runs, the installed msg_getMsgId on msg_p returns msgId.
+ * @param opaqueFlow_p A mock Flow.
+ * @param msg_p The message; ownership as for solClientMock_injectMsg().
+ * @param msgId The message ID to report.
+ * @return The callback's return code.
+ */
+solClient_rxMsgCallback_returnCode_t
+    solClientMock_injectFlowMsg ( solClient_opaqueFlow_pt opaqueFlow_p, solClient_opaqueMsg_pt msg_p, solClient_msgId_t msgId );
+
+/**
+ * Deliver a Session event to the Session's event callback now. A
+ * ::SOLCLIENT_SESSION_EVENT_DOWN_ERROR also disconnects the Session.
+ */
+void
+    solClientMock_injectSessionEvent ( solClient_opaqueSession_pt opaqueSession_p,
+                                       solClient_session_event_t sessionEvent,
+                                       solClient_session_responseCode_t responseCode,
+                                       const char *info_p, void *correlation_p );
+
+/**
+ * Deliver a Flow event to the Flow's event callback now.
+ */
+void
+    solClientMock_injectFlowEvent ( solClient_opaqueFlow_pt opaqueFlow_p,
+                                    solClient_flow_event_t flowEvent,
+                                    solClient_session_responseCode_t responseCode, const char *info_p );
+
+/**
+ * Advance the Context's virtual clock, firing every timer that expires, and
+ * deliver the Session events queued by non-blocking calls (for example
+ * PROVISION_OK for session_endpointProvision without
+ * ::SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM).
+ * @param opaqueContext_p A mock Context.
+ * @param elapsedMs Milliseconds to advance the clock by, may be 0.
+ * @return The number of timer callbacks and events delivered.
+ */
+int
+    solClientMock_processEvents ( solClient_opaqueContext_pt opaqueContext_p, solClient_uint32_t elapsedMs );
+
+/**
+ * Install a hook for messages sent on a Session; NULL removes it.
+ */
+void
+    solClientMock_setSendHook ( solClient_opaqueSession_pt opaqueSession_p,
+                                solClientMock_sendHookFunc_t hook_p, void *user_p );
+
+/**
+ * Install a hook deciding the outcome of connects on a Context's Sessions;
+ * NULL removes it. Without a hook every connect succeeds.
+ */
+void
+    solClientMock_setConnectHook ( solClient_opaqueContext_pt opaqueContext_p,
+                                   solClientMock_connectHookFunc_t hook_p, void *user_p );
+
+/**
+ * Copy the counters of a mock Session (flow == NULL) or Flow.
+ */
+void
+    solClientMock_getStats ( solClient_opaqueSession_pt opaqueSession_p, solClient_opaqueFlow_pt opaqueFlow_p,
+                             struct solClientMock_stats *stats_p );
+
+#endif /* SOLCLIENTMOCK_H_ */
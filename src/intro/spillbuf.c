@@ -0,0 +1,353 @@
+
+/** example Intro/spillbuf.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Spill-to-disk consumer buffer. See spillbuf.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "spillbuf.h"
+
+/*****************************************************************************
+ * spillbuf_segmentPath
+ *****************************************************************************/
+static void
+spillbuf_segmentPath ( struct spillbuf *buf_p, solClient_uint32_t num, char *path_p )
+{
+    sprintf ( path_p, "%s.%u.spill", buf_p->prefix, num );
+}
+
+/*****************************************************************************
+ * spillbuf_startSegment
+ *
+ * A new write segment of at least size bytes. Called with the lock held.
+ *****************************************************************************/
+static          solClient_returnCode_t
+spillbuf_startSegment ( struct spillbuf *buf_p, size_t size )
+{
+    struct os_mappedFile map;
+    char            path[600];
+    solClient_uint32_t num = ( buf_p->stats.segments == 0 ) ? 0 : buf_p->writeNum + 1;
+
+    if ( size < buf_p->segmentBytes ) {
+        size = buf_p->segmentBytes;
+    }
+    spillbuf_segmentPath ( buf_p, num, path );
+    remove ( path );
+    if ( os_mapFileWritable ( path, size, &map ) != 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not map spill segment '%s'", path );
+        return SOLCLIENT_FAIL;
+    }
+
+    if ( buf_p->stats.segments > 0 ) {
+        if ( buf_p->writeMap.size - buf_p->writeOffset >= sizeof ( struct spillbufRecordHeader ) ) {
+            /* Ends the segment, over what a reused one held before. */
+            ( ( struct spillbufRecordHeader * ) ( ( char * ) buf_p->writeMap.addr_p + buf_p->writeOffset ) )->recordLen = 0;
+        }
+        if ( buf_p->readNum == buf_p->writeNum ) {
+            buf_p->readMap = buf_p->writeMap;
+        } else {
+            os_unmapFile ( &buf_p->writeMap );
+        }
+    } else {
+        buf_p->readNum = num;
+        buf_p->readOffset = 0;
+    }
+    buf_p->writeMap = map;
+    buf_p->writeNum = num;
+    buf_p->writeOffset = 0;
+    buf_p->stats.segments++;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * spillbuf_append
+ *
+ * Called with the lock held.
+ *****************************************************************************/
+static          solClient_returnCode_t
+spillbuf_append ( struct spillbuf *buf_p, solClient_opaqueFlow_pt flow_p, solClient_msgId_t msgId,
+                  solClient_opaqueMsg_pt msg_p )
+{
+    solClient_returnCode_t rc;
+    solClient_bufInfo_t smf;
+    solClient_opaqueDatablock_pt datab_p = NULL;
+    struct spillbufRecordHeader *record_p;
+    solClient_uint64_t recordLen;
+
+    if ( ( rc = solClient_msg_encodeToSMF ( msg_p, &smf, &datab_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_encodeToSMF()" );
+        return rc;
+    }
+    recordLen = SPILLBUF_ALIGN ( sizeof ( *record_p ) + smf.bufSize );
+    if ( buf_p->stats.segments == 0 || buf_p->writeOffset + recordLen > buf_p->writeMap.size ) {
+        if ( ( rc = spillbuf_startSegment ( buf_p, ( size_t ) recordLen ) ) != SOLCLIENT_OK ) {
+            goto done;
+        }
+    }
+    record_p = ( struct spillbufRecordHeader * ) ( ( char * ) buf_p->writeMap.addr_p + buf_p->writeOffset );
+    record_p->recordLen = ( solClient_uint32_t ) recordLen;
+    record_p->smfLen = smf.bufSize;
+    record_p->msgId = msgId;
+    record_p->flow = ( solClient_uint64_t ) ( size_t ) flow_p;
+    memcpy ( record_p + 1, smf.buf_p, smf.bufSize );
+    buf_p->writeOffset += ( size_t ) recordLen;
+
+    buf_p->diskBytes += recordLen;
+    if ( buf_p->diskBytes > buf_p->stats.diskHighWater ) {
+        buf_p->stats.diskHighWater = buf_p->diskBytes;
+    }
+    buf_p->stats.spilled++;
+    buf_p->stats.spilledBytes += smf.bufSize;
+    buf_p->stats.onDisk++;
+
+  done:
+    solClient_datablock_free ( &datab_p );
+    return rc;
+}
+
+/*****************************************************************************
+ * spillbuf_readNext
+ *
+ * The oldest record in the log. Called with the lock held, with records on
+ * disk.
+ *****************************************************************************/
+static          solClient_returnCode_t
+spillbuf_readNext ( struct spillbuf *buf_p, struct spillbufItem *item_p )
+{
+    solClient_returnCode_t rc;
+    const struct spillbufRecordHeader *record_p;
+    solClient_bufInfo_t smf;
+    const char     *base_p;
+    size_t          size;
+    char            path[600];
+
+    for ( ;; ) {
+        if ( buf_p->readNum == buf_p->writeNum ) {
+            base_p = ( const char * ) buf_p->writeMap.addr_p;
+            size = buf_p->writeOffset;
+        } else {
+            if ( buf_p->readMap.addr_p == NULL ) {
+                spillbuf_segmentPath ( buf_p, buf_p->readNum, path );
+                if ( os_mapFile ( path, &buf_p->readMap ) != 0 ) {
+                    solClient_log ( SOLCLIENT_LOG_ERROR, "Could not map spill segment '%s'", path );
+                    return SOLCLIENT_FAIL;
+                }
+            }
+            base_p = ( const char * ) buf_p->readMap.addr_p;
+            size = buf_p->readMap.size;
+        }
+        record_p = ( const struct spillbufRecordHeader * ) ( base_p + buf_p->readOffset );
+        if ( buf_p->readOffset + sizeof ( *record_p ) <= size && record_p->recordLen != 0 ) {
+            break;
+        }
+        /* The end of an older segment: on to the next. */
+        if ( buf_p->readMap.addr_p != NULL ) {
+            os_unmapFile ( &buf_p->readMap );
+        }
+        spillbuf_segmentPath ( buf_p, buf_p->readNum, path );
+        remove ( path );
+        buf_p->readNum++;
+        buf_p->readOffset = 0;
+    }
+
+    smf.buf_p = ( void * ) ( record_p + 1 );
+    smf.bufSize = record_p->smfLen;
+    item_p->flow_p = ( solClient_opaqueFlow_pt ) ( size_t ) record_p->flow;
+    item_p->msgId = record_p->msgId;
+    item_p->spilled = 1;
+    rc = solClient_msg_decodeFromSmf ( &smf, &item_p->msg_p );
+
+    buf_p->readOffset += record_p->recordLen;
+    buf_p->diskBytes -= record_p->recordLen;
+    buf_p->stats.onDisk--;
+    if ( buf_p->stats.onDisk == 0 && buf_p->readNum == buf_p->writeNum ) {
+        /* Drained: the segment is reused from the start. */
+        buf_p->readOffset = 0;
+        buf_p->writeOffset = 0;
+    }
+    if ( rc != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_msg_decodeFromSmf()" );
+        return SOLCLIENT_FAIL;
+    }
+    buf_p->stats.readBack++;
+    return SOLCLIENT_OK;
+}
+
+
+/*****************************************************************************
+ * spillbuf_init
+ *****************************************************************************/
+solClient_returnCode_t
+spillbuf_init ( struct spillbuf *buf_p, solClient_uint32_t window, const char *prefix_p, size_t segmentBytes )
+{
+    memset ( buf_p, 0, sizeof ( *buf_p ) );
+    if ( window == 0 ) {
+        window = SPILLBUF_DEFAULT_WINDOW;
+    }
+    if ( strlen ( prefix_p ) >= sizeof ( buf_p->prefix ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Spill prefix '%s' is too long", prefix_p );
+        return SOLCLIENT_FAIL;
+    }
+    if ( ( buf_p->window_p = ( struct spillbufItem * ) malloc ( window * sizeof ( struct spillbufItem ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate a window of %u messages", window );
+        return SOLCLIENT_FAIL;
+    }
+    if ( os_eventInit ( &buf_p->ready ) != 0 ) {
+        free ( buf_p->window_p );
+        buf_p->window_p = NULL;
+        return SOLCLIENT_FAIL;
+    }
+    OS_MUTEX_INIT ( &buf_p->lock );
+    strcpy ( buf_p->prefix, prefix_p );
+    buf_p->capacity = window;
+    buf_p->segmentBytes = ( segmentBytes != 0 ) ? segmentBytes : SPILLBUF_DEFAULT_SEGMENT_BYTES;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * spillbuf_put
+ *****************************************************************************/
+solClient_rxMsgCallback_returnCode_t
+spillbuf_put ( struct spillbuf *buf_p, solClient_opaqueFlow_pt flow_p, solClient_opaqueMsg_pt msg_p )
+{
+    solClient_rxMsgCallback_returnCode_t callbackRc = SOLCLIENT_CALLBACK_OK;
+    struct spillbufItem *item_p;
+    solClient_msgId_t msgId = 0;
+
+    if ( flow_p != NULL && solClient_msg_getMsgId ( msg_p, &msgId ) != SOLCLIENT_OK ) {
+        /* Nothing to acknowledge. */
+        flow_p = NULL;
+    }
+
+    OS_MUTEX_LOCK ( &buf_p->lock );
+    if ( buf_p->stats.onDisk == 0 && buf_p->count < buf_p->capacity ) {
+        item_p = &buf_p->window_p[( buf_p->head + buf_p->count ) % buf_p->capacity];
+        item_p->msg_p = msg_p;
+        item_p->flow_p = flow_p;
+        item_p->msgId = msgId;
+        item_p->spilled = 0;
+        buf_p->count++;
+        buf_p->stats.kept++;
+        callbackRc = SOLCLIENT_CALLBACK_TAKE_MSG;
+    } else if ( spillbuf_append ( buf_p, flow_p, msgId, msg_p ) != SOLCLIENT_OK ) {
+        buf_p->stats.spillFailed++;
+    }
+    OS_MUTEX_UNLOCK ( &buf_p->lock );
+
+    os_eventSignal ( &buf_p->ready );
+    return callbackRc;
+}
+
+/*****************************************************************************
+ * spillbuf_get
+ *****************************************************************************/
+solClient_returnCode_t
+spillbuf_get ( struct spillbuf *buf_p, struct spillbufItem *item_p, unsigned int timeoutMs )
+{
+    solClient_returnCode_t rc = SOLCLIENT_WOULD_BLOCK;
+    int             waited = 0;
+
+    for ( ;; ) {
+        OS_MUTEX_LOCK ( &buf_p->lock );
+        if ( buf_p->count > 0 ) {
+            *item_p = buf_p->window_p[buf_p->head];
+            buf_p->head = ( buf_p->head + 1 ) % buf_p->capacity;
+            buf_p->count--;
+            rc = SOLCLIENT_OK;
+        } else if ( buf_p->stats.onDisk > 0 ) {
+            rc = spillbuf_readNext ( buf_p, item_p );
+        }
+        OS_MUTEX_UNLOCK ( &buf_p->lock );
+        if ( rc != SOLCLIENT_WOULD_BLOCK || waited || timeoutMs == 0 ) {
+            return rc;
+        }
+        os_eventWait ( &buf_p->ready, timeoutMs );
+        waited = 1;
+    }
+}
+
+/*****************************************************************************
+ * spillbuf_done
+ *****************************************************************************/
+void
+spillbuf_done ( struct spillbuf *buf_p, struct spillbufItem *item_p )
+{
+    solClient_returnCode_t rc = SOLCLIENT_OK;
+
+    if ( item_p->flow_p != NULL && ( rc = solClient_flow_sendAck ( item_p->flow_p, item_p->msgId ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_flow_sendAck()" );
+    }
+    solClient_msg_free ( &item_p->msg_p );
+
+    OS_MUTEX_LOCK ( &buf_p->lock );
+    buf_p->stats.processed++;
+    if ( item_p->flow_p != NULL ) {
+        if ( rc == SOLCLIENT_OK ) {
+            buf_p->stats.acked++;
+        } else {
+            buf_p->stats.ackFailed++;
+        }
+    }
+    OS_MUTEX_UNLOCK ( &buf_p->lock );
+}
+
+/*****************************************************************************
+ * spillbuf_getStats
+ *****************************************************************************/
+void
+spillbuf_getStats ( struct spillbuf *buf_p, struct spillbufStats *stats_p )
+{
+    OS_MUTEX_LOCK ( &buf_p->lock );
+    *stats_p = buf_p->stats;
+    stats_p->inMemory = buf_p->count;
+    OS_MUTEX_UNLOCK ( &buf_p->lock );
+}
+
+/*****************************************************************************
+ * spillbuf_destroy
+ *****************************************************************************/
+void
+spillbuf_destroy ( struct spillbuf *buf_p )
+{
+    char            path[600];
+    solClient_uint32_t num;
+
+    if ( buf_p->window_p == NULL ) {
+        return;
+    }
+    while ( buf_p->count > 0 ) {
+        solClient_msg_free ( &buf_p->window_p[buf_p->head].msg_p );
+        buf_p->head = ( buf_p->head + 1 ) % buf_p->capacity;
+        buf_p->count--;
+    }
+    free ( buf_p->window_p );
+    buf_p->window_p = NULL;
+    if ( buf_p->readMap.addr_p != NULL ) {
+        os_unmapFile ( &buf_p->readMap );
+    }
+    if ( buf_p->writeMap.addr_p != NULL ) {
+        os_unmapFile ( &buf_p->writeMap );
+    }
+    if ( buf_p->stats.segments > 0 ) {
+        for ( num = buf_p->readNum; num <= buf_p->writeNum; num++ ) {
+            spillbuf_segmentPath ( buf_p, num, path );
+            remove ( path );
+        }
+    }
+    os_eventDestroy ( &buf_p->ready );
+    OS_MUTEX_DESTROY ( &buf_p->lock );
+}
@@ -0,0 +1,172 @@
+/** example Intro/spillbuf.h
+ */
+
+/**
+ *
+ * file spillbuf.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a consumer-side buffer that absorbs a backlog
+ * without holding it all in memory. spillbuf_put(), called from the
+ * receive callback, keeps a message in a bounded in-memory window
+ * (returning ::SOLCLIENT_CALLBACK_TAKE_MSG); once the window is full, it
+ * appends the message in SMF form (solClient_msg_encodeToSMF()) to a log
+ * of memory-mapped segment files instead, and the API frees it. The
+ * application thread takes messages with spillbuf_get() in the order they
+ * were received: the window first, then the log, read back sequentially
+ * and decoded (solClient_msg_decodeFromSmf()). While anything is on disk,
+ * new messages go to the log too, so the order holds.
+ *
+ * Guaranteed messages are acknowledged by spillbuf_done(), once processed,
+ * whether they were kept or spilled: the Flow must use
+ * ::SOLCLIENT_FLOW_PROP_ACKMODE_CLIENT. Nothing is lost if the process
+ * stops, as the broker redelivers what was not acknowledged; the log is
+ * therefore scratch, never synced, and removed by spillbuf_destroy(). The
+ * broker still stops delivering at the endpoint's maximum of delivered
+ * unacknowledged messages per Flow, which must cover the backlog to be
+ * absorbed.
+ *
+ * Segment files <prefix>.<n>.spill hold ::spillbufRecordHeader records,
+ * each followed by the SMF bytes and padded to 8 bytes; a zero recordLen,
+ * or the end of the file, ends a segment. A segment is removed once read,
+ * and when the log is drained the current one is reused from the start.
+ *
+ * spillbuf_put() may be called from any number of threads (Context
+ * threads of several Flows); spillbuf_get() and spillbuf_done() from one
+ * consumer thread.
+ */
+
+#ifndef SPILLBUF_H_
+#define SPILLBUF_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+
+#define SPILLBUF_DEFAULT_WINDOW         10000   /**< Messages kept in memory. */
+#define SPILLBUF_DEFAULT_SEGMENT_BYTES  ( 64 * 1024 * 1024 )
+#define SPILLBUF_ALIGN(n)               ( ( ( n ) + 7 ) & ~( ( solClient_uint64_t ) 7 ) )
+
+/**
+ * @struct spillbufRecordHeader
+ */
+struct spillbufRecordHeader
+{
+    solClient_uint32_t recordLen;       /**< Whole record, padded; 0 ends the segment. */
+    solClient_uint32_t smfLen;
+    solClient_uint64_t msgId;           /**< For solClient_flow_sendAck(). */
+    solClient_uint64_t flow;            /**< The Flow pointer, 0 for a Direct message. */
+};
+
+/**
+ * @struct spillbufItem
+ * A message handed out by spillbuf_get(), to give back to spillbuf_done().
+ */
+struct spillbufItem
+{
+    solClient_opaqueMsg_pt msg_p;
+    solClient_opaqueFlow_pt flow_p;     /**< NULL when there is nothing to acknowledge. */
+    solClient_msgId_t msgId;
+    int             spilled;            /**< Read back from the log. */
+};
+
+/**
+ * @struct spillbufStats
+ */
+struct spillbufStats
+{
+    solClient_uint64_t kept;            /**< Put in the memory window. */
+    solClient_uint64_t spilled;         /**< Appended to the log. */
+    solClient_uint64_t spilledBytes;
+    solClient_uint64_t readBack;        /**< Decoded from the log. */
+    solClient_uint64_t spillFailed;     /**< Neither kept nor spilled: left for redelivery. */
+    solClient_uint64_t processed;       /**< Given to spillbuf_done(). */
+    solClient_uint64_t acked;
+    solClient_uint64_t ackFailed;
+    solClient_uint64_t segments;        /**< Segment files created. */
+    solClient_uint64_t inMemory;
+    solClient_uint64_t onDisk;          /**< Records not yet read back. */
+    solClient_uint64_t diskHighWater;   /**< Most bytes in the log at once. */
+};
+
+/**
+ * @struct spillbuf
+ */
+struct spillbuf
+{
+    OS_MUTEX        lock;
+    OS_EVENT        ready;
+    struct spillbufItem *window_p;
+    solClient_uint32_t capacity;
+    solClient_uint32_t head;
+    solClient_uint32_t count;
+    char            prefix[512];
+    size_t          segmentBytes;
+    struct os_mappedFile writeMap;
+    solClient_uint32_t writeNum;
+    size_t          writeOffset;
+    struct os_mappedFile readMap;       /**< Only while reading an older segment. */
+    solClient_uint32_t readNum;
+    size_t          readOffset;
+    solClient_uint64_t diskBytes;
+    struct spillbufStats stats;
+};
+
+
+/**
+ * Initialize a buffer. Leftover segments with the same prefix are
+ * overwritten.
+ * @param buf_p The buffer to initialize.
+ * @param window Messages kept in memory, 0 for ::SPILLBUF_DEFAULT_WINDOW.
+ * @param prefix_p Path prefix of the segment files.
+ * @param segmentBytes Segment size, 0 for ::SPILLBUF_DEFAULT_SEGMENT_BYTES;
+ * a larger message gets a segment of its own.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    spillbuf_init ( struct spillbuf *buf_p, solClient_uint32_t window, const char *prefix_p, size_t segmentBytes );
+
+/**
+ * A received message. Call from the receive callback and return its result.
+ * @param buf_p The buffer.
+ * @param flow_p The Flow it came on, to acknowledge it; NULL for a Direct message.
+ * @param msg_p The message.
+ * @return ::SOLCLIENT_CALLBACK_TAKE_MSG when kept in memory;
+ * ::SOLCLIENT_CALLBACK_OK when spilled, or when it could not be.
+ */
+solClient_rxMsgCallback_returnCode_t
+    spillbuf_put ( struct spillbuf *buf_p, solClient_opaqueFlow_pt flow_p, solClient_opaqueMsg_pt msg_p );
+
+/**
+ * Take the oldest message, waiting for one.
+ * @param buf_p The buffer.
+ * @param item_p Filled in with the message.
+ * @param timeoutMs How long to wait, 0 not to.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_WOULD_BLOCK when none came in time,
+ * ::SOLCLIENT_FAIL when a spilled message could not be decoded (it is
+ * skipped, and not acknowledged).
+ */
+solClient_returnCode_t
+    spillbuf_get ( struct spillbuf *buf_p, struct spillbufItem *item_p, unsigned int timeoutMs );
+
+/**
+ * A message from spillbuf_get() was processed: acknowledge and free it.
+ */
+void
+    spillbuf_done ( struct spillbuf *buf_p, struct spillbufItem *item_p );
+
+/**
+ * Copy the counters.
+ */
+void
+    spillbuf_getStats ( struct spillbuf *buf_p, struct spillbufStats *stats_p );
+
+/**
+ * Free the messages in memory and remove the log. Spilled messages that
+ * were not processed are not acknowledged, for the broker to redeliver.
+ */
+void
+    spillbuf_destroy ( struct spillbuf *buf_p );
+
+#endif /* SPILLBUF_H_ */
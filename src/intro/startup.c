@@ -0,0 +1,540 @@
+
+/** example Intro/startup.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Startup profile and fast-start. See startup.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+#include "startup.h"
+
+#ifndef WIN32
+#include <dlfcn.h>
+#endif
+
+/*****************************************************************************
+ * startup_init
+ *****************************************************************************/
+void
+startup_init ( struct startup *cs_p, int fast )
+{
+    memset ( cs_p, 0, sizeof ( *cs_p ) );
+    cs_p->originNs = os_getTimeNs (  );
+    cs_p->fast = fast;
+    cs_p->tlsPhase = -1;
+    cs_p->provisionPhase = -1;
+    cs_p->criticalPhase = -1;
+    cs_p->deferredPhase = -1;
+    strcpy ( cs_p->sslLib, STARTUP_DEFAULT_SSL_LIB );
+    strcpy ( cs_p->cryptoLib, STARTUP_DEFAULT_CRYPTO_LIB );
+    OS_MUTEX_INIT ( &cs_p->lock );
+}
+
+/*****************************************************************************
+ * startup_setTls
+ *****************************************************************************/
+void
+startup_setTls ( struct startup *cs_p, const char *host_p, const char *sslLib_p, const char *cryptoLib_p )
+{
+    cs_p->tls = host_p != NULL &&
+        ( strstr ( host_p, "tcps:" ) != NULL || strstr ( host_p, "wss:" ) != NULL || strstr ( host_p, "https:" ) != NULL );
+    if ( sslLib_p != NULL ) {
+        strncpy ( cs_p->sslLib, sslLib_p, STARTUP_MAX_LIB - 1 );
+    }
+    if ( cryptoLib_p != NULL ) {
+        strncpy ( cs_p->cryptoLib, cryptoLib_p, STARTUP_MAX_LIB - 1 );
+    }
+}
+
+/*****************************************************************************
+ * startup_setQueue
+ *****************************************************************************/
+void
+startup_setQueue ( struct startup *cs_p, const char *queue_p )
+{
+    cs_p->queue_p = queue_p;
+}
+
+/*****************************************************************************
+ * startup_addSubscription
+ *****************************************************************************/
+solClient_returnCode_t
+startup_addSubscription ( struct startup *cs_p, const char *topic_p, int critical )
+{
+    if ( cs_p->numSubscriptions == STARTUP_MAX_SUBSCRIPTIONS ) {
+        return SOLCLIENT_FAIL;
+    }
+    cs_p->subscriptions[cs_p->numSubscriptions] = topic_p;
+    cs_p->critical[cs_p->numSubscriptions++] = critical;
+    if ( critical ) {
+        cs_p->numCritical++;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * startup_beginLocked, startup_endLocked
+ *****************************************************************************/
+static int
+startup_beginLocked ( struct startup *cs_p, const char *name_p, int helper )
+{
+    struct startupPhase *phase_p;
+
+    if ( cs_p->numPhases == STARTUP_MAX_PHASES ) {
+        return -1;
+    }
+    phase_p = &cs_p->phases[cs_p->numPhases];
+    phase_p->name_p = name_p;
+    phase_p->startNs = os_getTimeNs (  ) - cs_p->originNs;
+    phase_p->endNs = 0;
+    phase_p->helper = helper;
+    phase_p->failed = 0;
+    return cs_p->numPhases++;
+}
+
+static void
+startup_endLocked ( struct startup *cs_p, int phase, int failed )
+{
+    if ( phase < 0 || cs_p->phases[phase].endNs != 0 ) {
+        return;
+    }
+    /* At least 1 ns, so that it shows as ended. */
+    cs_p->phases[phase].endNs = os_getTimeNs (  ) - cs_p->originNs;
+    if ( cs_p->phases[phase].endNs <= cs_p->phases[phase].startNs ) {
+        cs_p->phases[phase].endNs = cs_p->phases[phase].startNs + 1;
+    }
+    cs_p->phases[phase].failed |= failed;
+}
+
+/*****************************************************************************
+ * startup_phaseBegin
+ *****************************************************************************/
+int
+startup_phaseBegin ( struct startup *cs_p, const char *name_p, int helper )
+{
+    int             phase;
+
+    OS_MUTEX_LOCK ( &cs_p->lock );
+    phase = startup_beginLocked ( cs_p, name_p, helper );
+    OS_MUTEX_UNLOCK ( &cs_p->lock );
+    return phase;
+}
+
+/*****************************************************************************
+ * startup_phaseEnd
+ *****************************************************************************/
+void
+startup_phaseEnd ( struct startup *cs_p, int phase, int failed )
+{
+    OS_MUTEX_LOCK ( &cs_p->lock );
+    startup_endLocked ( cs_p, phase, failed );
+    OS_MUTEX_UNLOCK ( &cs_p->lock );
+}
+
+/*****************************************************************************
+ * startup_loadTls
+ *
+ * Load the crypto library, then the TLS library that depends on it. They
+ * are left loaded for the API.
+ *****************************************************************************/
+static void
+startup_loadTls ( struct startup *cs_p )
+{
+    int             failed;
+
+#ifdef WIN32
+    failed = LoadLibraryA ( cs_p->cryptoLib ) == NULL || LoadLibraryA ( cs_p->sslLib ) == NULL;
+#else
+    failed = dlopen ( cs_p->cryptoLib, RTLD_NOW ) == NULL || dlopen ( cs_p->sslLib, RTLD_NOW ) == NULL;
+#endif
+    if ( failed ) {
+        solClient_log ( SOLCLIENT_LOG_WARNING, "startup_loadTls(): could not load '%s' and '%s'",
+                        cs_p->cryptoLib, cs_p->sslLib );
+    }
+    startup_phaseEnd ( cs_p, cs_p->tlsPhase, failed );
+}
+
+/*****************************************************************************
+ * startup_tlsThread
+ *****************************************************************************/
+static
+OS_THREAD_FUNC ( startup_tlsThread, arg_p )
+{
+    startup_loadTls ( ( struct startup * ) arg_p );
+    OS_THREAD_RETURN;
+}
+
+/*****************************************************************************
+ * startup_initialize
+ *****************************************************************************/
+solClient_returnCode_t
+startup_initialize ( struct startup *cs_p, solClient_log_level_t logLevel )
+{
+    solClient_returnCode_t rc;
+    const char     *props[5];
+    int             phase;
+
+    if ( cs_p->fast && cs_p->tls ) {
+        cs_p->tlsPhase = startup_phaseBegin ( cs_p, "tls.load", 1 );
+        if ( os_threadCreate ( &cs_p->tlsThread, startup_tlsThread, cs_p ) == 0 ) {
+            cs_p->tlsThreadStarted = 1;
+        } else {
+            /* Loaded in line by startup_connect(). */
+            startup_phaseEnd ( cs_p, cs_p->tlsPhase, 1 );
+            cs_p->tlsPhase = -1;
+        }
+    }
+
+    props[0] = SOLCLIENT_GLOBAL_PROP_SSL_LIB;
+    props[1] = cs_p->sslLib;
+    props[2] = SOLCLIENT_GLOBAL_PROP_CRYPTO_LIB;
+    props[3] = cs_p->cryptoLib;
+    props[4] = NULL;
+    phase = startup_phaseBegin ( cs_p, "initialize", 0 );
+    if ( ( rc = solClient_initialize ( SOLCLIENT_LOG_DEFAULT_FILTER, ( char ** ) props ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_initialize()" );
+    } else {
+        solClient_log_setFilterLevel ( SOLCLIENT_LOG_CATEGORY_ALL, logLevel );
+    }
+    startup_phaseEnd ( cs_p, phase, rc != SOLCLIENT_OK );
+    return rc;
+}
+
+/*****************************************************************************
+ * startup_subscribe
+ *
+ * Add the critical subscriptions, or the others. With fast-start the
+ * confirmations end the phase in startup_eventCallback().
+ *****************************************************************************/
+static void
+startup_subscribe ( struct startup *cs_p, int critical, const char *name_p, int *phase_p )
+{
+    solClient_returnCode_t rc;
+    solClient_subscribeFlags_t flags =
+        cs_p->fast ? SOLCLIENT_SUBSCRIBE_FLAGS_REQUEST_CONFIRM : SOLCLIENT_SUBSCRIBE_FLAGS_WAITFORCONFIRM;
+    int             failed = 0;
+    int             i;
+
+    if ( ( critical ? cs_p->numCritical : cs_p->numSubscriptions - cs_p->numCritical ) == 0 ) {
+        return;
+    }
+    *phase_p = startup_phaseBegin ( cs_p, name_p, 0 );
+    for ( i = 0; i < cs_p->numSubscriptions; i++ ) {
+        if ( cs_p->critical[i] != critical ) {
+            continue;
+        }
+        if ( ( rc = solClient_session_topicSubscribeExt ( cs_p->session_p, flags, cs_p->subscriptions[i] ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_topicSubscribeExt()" );
+            failed = 1;
+            /* No confirmation will come for it. */
+            if ( cs_p->fast ) {
+                OS_MUTEX_LOCK ( &cs_p->lock );
+                cs_p->confirmed++;
+                OS_MUTEX_UNLOCK ( &cs_p->lock );
+            }
+        }
+    }
+    if ( !cs_p->fast || failed ) {
+        startup_phaseEnd ( cs_p, *phase_p, failed );
+    }
+}
+
+/*****************************************************************************
+ * startup_createContext
+ *****************************************************************************/
+solClient_returnCode_t
+startup_createContext ( struct startup *cs_p )
+{
+    solClient_returnCode_t rc;
+    solClient_context_createFuncInfo_t contextFuncInfo = SOLCLIENT_CONTEXT_CREATEFUNC_INITIALIZER;
+    int             phase;
+
+    phase = startup_phaseBegin ( cs_p, "context.create", 0 );
+    rc = solClient_context_create ( SOLCLIENT_CONTEXT_PROPS_DEFAULT_WITH_CREATE_THREAD,
+                                    &cs_p->context_p, &contextFuncInfo, sizeof ( contextFuncInfo ) );
+    startup_phaseEnd ( cs_p, phase, rc != SOLCLIENT_OK );
+    if ( rc != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_create()" );
+        cs_p->context_p = NULL;
+        return SOLCLIENT_FAIL;
+    }
+
+    /* Where the API would load them, while connecting. */
+    if ( cs_p->tls && !cs_p->tlsThreadStarted ) {
+        cs_p->tlsPhase = startup_phaseBegin ( cs_p, "tls.load", 0 );
+        startup_loadTls ( cs_p );
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * startup_connect
+ *****************************************************************************/
+solClient_returnCode_t
+startup_connect ( struct startup *cs_p, struct commonOptions *commandOpts_p,
+                  solClient_session_rxMsgCallbackFunc_t rxCallback_p )
+{
+    solClient_returnCode_t rc;
+    const char     *provProps[20] = {0, };
+    int             provIndex = 0;
+    int             phase;
+
+    if ( cs_p->context_p == NULL && startup_createContext ( cs_p ) != SOLCLIENT_OK ) {
+        return SOLCLIENT_FAIL;
+    }
+
+    phase = startup_phaseBegin ( cs_p, "session.connect", 0 );
+    rc = common_createAndConnectSession ( cs_p->context_p, &cs_p->session_p, rxCallback_p,
+                                          startup_eventCallback, cs_p, commandOpts_p );
+    startup_phaseEnd ( cs_p, phase, rc != SOLCLIENT_OK );
+    if ( rc != SOLCLIENT_OK ) {
+        cs_p->session_p = NULL;
+        return SOLCLIENT_FAIL;
+    }
+
+    if ( cs_p->queue_p != NULL ) {
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PROP_ID;
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PROP_QUEUE;
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PROP_NAME;
+        provProps[provIndex++] = cs_p->queue_p;
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PROP_PERMISSION;
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PERM_DELETE;
+        provProps[provIndex++] = SOLCLIENT_ENDPOINT_PROP_QUOTA_MB;
+        provProps[provIndex++] = "100";
+        OS_MUTEX_LOCK ( &cs_p->lock );
+        phase = startup_beginLocked ( cs_p, "provision", 0 );
+        if ( cs_p->fast ) {
+            cs_p->provisionPhase = phase;
+        }
+        OS_MUTEX_UNLOCK ( &cs_p->lock );
+        rc = solClient_session_endpointProvision ( ( char ** ) provProps, cs_p->session_p,
+                                                   SOLCLIENT_PROVISION_FLAGS_IGNORE_EXIST_ERRORS |
+                                                   ( cs_p->fast ? 0 : SOLCLIENT_PROVISION_FLAGS_WAITFORCONFIRM ),
+                                                   NULL, NULL, 0 );
+        if ( rc != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_endpointProvision()" );
+        }
+        if ( !cs_p->fast || rc != SOLCLIENT_OK ) {
+            OS_MUTEX_LOCK ( &cs_p->lock );
+            startup_endLocked ( cs_p, phase, rc != SOLCLIENT_OK );
+            cs_p->provisionPhase = -1;
+            OS_MUTEX_UNLOCK ( &cs_p->lock );
+        }
+    }
+
+    startup_subscribe ( cs_p, 1, "subscribe.critical", &cs_p->criticalPhase );
+    if ( !cs_p->fast ) {
+        startup_subscribe ( cs_p, 0, "subscribe.rest", &cs_p->deferredPhase );
+        cs_p->deferredIssued = 1;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * startup_eventCallback
+ *****************************************************************************/
+void
+startup_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                        solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p )
+{
+    struct startup *cs_p = ( struct startup * ) user_p;
+    int             failed;
+
+    switch ( eventInfo_p->sessionEvent ) {
+        case SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_OK:
+        case SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_ERROR:
+            if ( !cs_p->fast ) {
+                break;
+            }
+            failed = eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_SUBSCRIPTION_ERROR;
+            OS_MUTEX_LOCK ( &cs_p->lock );
+            /* One confirmation per subscription, in the order added: the critical ones first. */
+            if ( ++cs_p->confirmed <= cs_p->numCritical ) {
+                if ( cs_p->criticalPhase >= 0 ) {
+                    cs_p->phases[cs_p->criticalPhase].failed |= failed;
+                }
+                if ( cs_p->confirmed == cs_p->numCritical ) {
+                    startup_endLocked ( cs_p, cs_p->criticalPhase, 0 );
+                }
+            } else {
+                if ( cs_p->deferredPhase >= 0 ) {
+                    cs_p->phases[cs_p->deferredPhase].failed |= failed;
+                }
+                if ( cs_p->confirmed == cs_p->numSubscriptions ) {
+                    startup_endLocked ( cs_p, cs_p->deferredPhase, 0 );
+                }
+            }
+            OS_MUTEX_UNLOCK ( &cs_p->lock );
+            break;
+
+        case SOLCLIENT_SESSION_EVENT_PROVISION_OK:
+        case SOLCLIENT_SESSION_EVENT_PROVISION_ERROR:
+            OS_MUTEX_LOCK ( &cs_p->lock );
+            startup_endLocked ( cs_p, cs_p->provisionPhase,
+                                eventInfo_p->sessionEvent == SOLCLIENT_SESSION_EVENT_PROVISION_ERROR );
+            cs_p->provisionPhase = -1;
+            OS_MUTEX_UNLOCK ( &cs_p->lock );
+            break;
+
+        default:
+            break;
+    }
+    common_eventCallback ( opaqueSession_p, eventInfo_p, user_p );
+}
+
+/*****************************************************************************
+ * startup_messageReceived
+ *****************************************************************************/
+void
+startup_messageReceived ( struct startup *cs_p )
+{
+    solClient_uint64_t elapsedNs;
+
+    if ( cs_p->firstMsgNs == 0 ) {
+        elapsedNs = os_getTimeNs (  ) - cs_p->originNs;
+        cs_p->firstMsgNs = ( elapsedNs > 0 ) ? elapsedNs : 1;
+    }
+}
+
+/*****************************************************************************
+ * startup_firstMessageNs
+ *****************************************************************************/
+solClient_uint64_t
+startup_firstMessageNs ( struct startup *cs_p )
+{
+    return cs_p->firstMsgNs;
+}
+
+/*****************************************************************************
+ * startup_pending
+ *
+ * Phases still waiting for a confirmation.
+ *****************************************************************************/
+static int
+startup_pending ( struct startup *cs_p )
+{
+    int             pending;
+
+    OS_MUTEX_LOCK ( &cs_p->lock );
+    pending = cs_p->provisionPhase >= 0 ||
+        ( cs_p->criticalPhase >= 0 && cs_p->phases[cs_p->criticalPhase].endNs == 0 ) ||
+        ( cs_p->deferredPhase >= 0 && cs_p->phases[cs_p->deferredPhase].endNs == 0 );
+    OS_MUTEX_UNLOCK ( &cs_p->lock );
+    return pending;
+}
+
+/*****************************************************************************
+ * startup_finish
+ *****************************************************************************/
+solClient_returnCode_t
+startup_finish ( struct startup *cs_p, int waitMs )
+{
+    solClient_uint64_t startNs = os_getTimeNs (  );
+
+    if ( !cs_p->deferredIssued && cs_p->session_p != NULL ) {
+        startup_subscribe ( cs_p, 0, "subscribe.deferred", &cs_p->deferredPhase );
+        cs_p->deferredIssued = 1;
+    }
+    if ( cs_p->tlsThreadStarted ) {
+        os_threadJoin ( cs_p->tlsThread );
+        cs_p->tlsThreadStarted = 0;
+    }
+    while ( startup_pending ( cs_p ) ) {
+        if ( os_getTimeNs (  ) - startNs >= waitMs * 1000000ULL ) {
+            return SOLCLIENT_INCOMPLETE;
+        }
+        OS_SLEEP_US ( 1000 );
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * startup_print
+ *****************************************************************************/
+void
+startup_print ( struct startup *cs_p )
+{
+    struct startupPhase phases[STARTUP_MAX_PHASES];
+    struct startupPhase phase;
+    solClient_uint64_t sumNs = 0;
+    solClient_uint64_t spanNs = 0;
+    int             numPhases;
+    int             i;
+    int             j;
+
+    OS_MUTEX_LOCK ( &cs_p->lock );
+    numPhases = cs_p->numPhases;
+    memcpy ( phases, cs_p->phases, sizeof ( struct startupPhase ) * numPhases );
+    OS_MUTEX_UNLOCK ( &cs_p->lock );
+
+    for ( i = 1; i < numPhases; i++ ) {
+        phase = phases[i];
+        for ( j = i; j > 0 && phases[j - 1].startNs > phase.startNs; j-- ) {
+            phases[j] = phases[j - 1];
+        }
+        phases[j] = phase;
+    }
+
+    printf ( "%s start:\n  %-22s %10s %10s %10s  %s\n", cs_p->fast ? "Fast" : "Serial", "phase", "start ms",
+             "end ms", "ms", "thread" );
+    for ( i = 0; i < numPhases; i++ ) {
+        if ( phases[i].endNs == 0 ) {
+            printf ( "  %-22s %10.3f %10s %10s  %s (unfinished)\n", phases[i].name_p, phases[i].startNs / 1e6, "-", "-",
+                     phases[i].helper ? "helper" : "main" );
+            continue;
+        }
+        printf ( "  %-22s %10.3f %10.3f %10.3f  %s%s\n", phases[i].name_p, phases[i].startNs / 1e6,
+                 phases[i].endNs / 1e6, ( phases[i].endNs - phases[i].startNs ) / 1e6,
+                 phases[i].helper ? "helper" : "main", phases[i].failed ? " FAILED" : "" );
+        sumNs += phases[i].endNs - phases[i].startNs;
+        if ( phases[i].endNs > spanNs ) {
+            spanNs = phases[i].endNs;
+        }
+    }
+    printf ( "  phases take %.3f ms, done %.3f ms after start: %.3f ms overlapped\n", sumNs / 1e6, spanNs / 1e6,
+             ( sumNs > spanNs ) ? ( sumNs - spanNs ) / 1e6 : 0.0 );
+    if ( cs_p->firstMsgNs != 0 ) {
+        printf ( "  time to first message: %.3f ms\n", cs_p->firstMsgNs / 1e6 );
+    } else {
+        printf ( "  no message received\n" );
+    }
+}
+
+/*****************************************************************************
+ * startup_destroy
+ *****************************************************************************/
+void
+startup_destroy ( struct startup *cs_p )
+{
+    solClient_returnCode_t rc;
+
+    if ( cs_p->tlsThreadStarted ) {
+        os_threadJoin ( cs_p->tlsThread );
+        cs_p->tlsThreadStarted = 0;
+    }
+    if ( cs_p->session_p != NULL ) {
+        if ( ( rc = solClient_session_disconnect ( cs_p->session_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_disconnect()" );
+        }
+        if ( ( rc = solClient_session_destroy ( &cs_p->session_p ) ) != SOLCLIENT_OK ) {
+            common_handleError ( rc, "solClient_session_destroy()" );
+        }
+    }
+    if ( cs_p->context_p != NULL && ( rc = solClient_context_destroy ( &cs_p->context_p ) ) != SOLCLIENT_OK ) {
+        common_handleError ( rc, "solClient_context_destroy()" );
+    }
+    OS_MUTEX_DESTROY ( &cs_p->lock );
+}
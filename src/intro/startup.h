@@ -0,0 +1,233 @@
+/** example Intro/startup.h
+ */
+
+/**
+ *
+ * file startup.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a profile of an application's startup, and a
+ * fast-start mode for the phases the samples otherwise run one after the
+ * other: solClient_initialize(), Context creation, Session connection,
+ * Queue provisioning and subscriptions. Each phase is timestamped from
+ * startup_init(), called first in main(), along with the loading of the
+ * TLS libraries named by ::SOLCLIENT_GLOBAL_PROP_SSL_LIB and
+ * ::SOLCLIENT_GLOBAL_PROP_CRYPTO_LIB, and the time to the first message
+ * received.
+ *
+ * The API loads the TLS libraries while connecting, and only for a secure
+ * host (tcps:, wss: or https:). Without fast-start, startup_connect()
+ * loads them as a phase of their own just before connecting, so that the
+ * profile shows their cost; for a plain TCP host they are never loaded.
+ *
+ * With fast-start:
+ * @li The TLS libraries are loaded on a helper thread while the API is
+ * initialized and the Context created, for a secure host only; the API
+ * then finds them already loaded.
+ * @li The Queue is provisioned and the critical subscriptions are added
+ * without waiting for each confirmation: all requests go out at once, and
+ * their phases end when the confirmations come back, on the Context
+ * thread.
+ * @li The other subscriptions are deferred until startup_finish(), which
+ * the application calls once it has its first message or is otherwise up.
+ *
+ * The Session's callbacks get the profile as user pointer: its event
+ * callback must be startup_eventCallback(), or hand it the events, and
+ * its receive callback must call startup_messageReceived().
+ */
+
+#ifndef STARTUP_H_
+#define STARTUP_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+#include "solclient/solClientMsg.h"
+#include "common.h"
+
+#define STARTUP_MAX_PHASES              32
+#define STARTUP_MAX_SUBSCRIPTIONS       256
+#define STARTUP_MAX_LIB                 256
+
+#if defined(__APPLE__)
+#define STARTUP_DEFAULT_SSL_LIB         SOLCLIENT_GLOBAL_PROP_DEFAULT_SSL_LIB_MACOSX
+#define STARTUP_DEFAULT_CRYPTO_LIB      SOLCLIENT_GLOBAL_PROP_DEFAULT_CRYPTO_LIB_MACOSX
+#elif defined(WIN32)
+#define STARTUP_DEFAULT_SSL_LIB         SOLCLIENT_GLOBAL_PROP_DEFAULT_SSL_LIB_WINDOWS
+#define STARTUP_DEFAULT_CRYPTO_LIB      SOLCLIENT_GLOBAL_PROP_DEFAULT_CRYPTO_LIB_WINDOWS
+#else
+#define STARTUP_DEFAULT_SSL_LIB         SOLCLIENT_GLOBAL_PROP_DEFAULT_SSL_LIB_UNIX
+#define STARTUP_DEFAULT_CRYPTO_LIB      SOLCLIENT_GLOBAL_PROP_DEFAULT_CRYPTO_LIB_UNIX
+#endif
+
+/**
+ * @struct startupPhase
+ */
+struct startupPhase
+{
+    const char     *name_p;
+    solClient_uint64_t startNs;         /**< From startup_init(). */
+    solClient_uint64_t endNs;           /**< 0 while running. */
+    int             helper;             /**< Ran off the main thread's path. */
+    int             failed;
+};
+
+/**
+ * @struct startup
+ */
+struct startup
+{
+    int             fast;
+    int             tls;                /**< The host is secure. */
+    char            sslLib[STARTUP_MAX_LIB];
+    char            cryptoLib[STARTUP_MAX_LIB];
+    const char     *queue_p;            /**< Provisioned when not NULL. */
+    const char     *subscriptions[STARTUP_MAX_SUBSCRIPTIONS];
+    int             critical[STARTUP_MAX_SUBSCRIPTIONS];
+    int             numSubscriptions;
+    int             numCritical;
+    solClient_opaqueContext_pt context_p;
+    solClient_opaqueSession_pt session_p;
+    OS_THREAD       tlsThread;
+    int             tlsThreadStarted;
+    int             tlsPhase;
+    OS_MUTEX        lock;               /**< For the phases and confirmations below. */
+    solClient_uint64_t originNs;
+    struct startupPhase phases[STARTUP_MAX_PHASES];
+    int             numPhases;
+    int             provisionPhase;     /**< Waiting for its confirmation, or -1. */
+    int             criticalPhase;
+    int             deferredPhase;
+    int             confirmed;          /**< Subscription confirmations. */
+    int             deferredIssued;
+    volatile solClient_uint64_t firstMsgNs;
+};
+
+
+/**
+ * Start the profile; call first in main().
+ * @param cs_p The profile.
+ * @param fast Use fast-start.
+ */
+void
+    startup_init ( struct startup *cs_p, int fast );
+
+/**
+ * The host and the TLS libraries.
+ * @param cs_p The profile.
+ * @param host_p The Session host list; secure when any entry is.
+ * @param sslLib_p The TLS library, NULL for ::STARTUP_DEFAULT_SSL_LIB.
+ * @param cryptoLib_p The crypto library, NULL for ::STARTUP_DEFAULT_CRYPTO_LIB.
+ */
+void
+    startup_setTls ( struct startup *cs_p, const char *host_p, const char *sslLib_p, const char *cryptoLib_p );
+
+/**
+ * A durable Queue to provision once connected. The name is not copied.
+ */
+void
+    startup_setQueue ( struct startup *cs_p, const char *queue_p );
+
+/**
+ * A subscription to add once connected. The topic is not copied.
+ * @param cs_p The profile.
+ * @param topic_p The topic subscription.
+ * @param critical Needed before the first message; the others are
+ * deferred with fast-start.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when full.
+ */
+solClient_returnCode_t
+    startup_addSubscription ( struct startup *cs_p, const char *topic_p, int critical );
+
+/**
+ * Start a phase of the application's own. Any thread.
+ * @param cs_p The profile.
+ * @param name_p The phase's name, not copied.
+ * @param helper Off the main thread's path.
+ * @return The phase, -1 when full.
+ */
+int
+    startup_phaseBegin ( struct startup *cs_p, const char *name_p, int helper );
+
+/**
+ * End a phase. Any thread; a phase of -1 is ignored.
+ */
+void
+    startup_phaseEnd ( struct startup *cs_p, int phase, int failed );
+
+/**
+ * Initialize the API with the TLS libraries set, loading them alongside
+ * with fast-start.
+ * @param cs_p The profile.
+ * @param logLevel The log filter level.
+ * @return The result of solClient_initialize().
+ */
+solClient_returnCode_t
+    startup_initialize ( struct startup *cs_p, solClient_log_level_t logLevel );
+
+/**
+ * Create the Context; without fast-start, then load the TLS libraries for
+ * a secure host.
+ * @param cs_p The profile.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    startup_createContext ( struct startup *cs_p );
+
+/**
+ * Create the Context unless startup_createContext() did, connect the
+ * Session, then provision and add the subscriptions; see startup::session_p.
+ * @param cs_p The profile.
+ * @param commandOpts_p The options of the Session.
+ * @param rxCallback_p The receive callback, which must call startup_messageReceived().
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL when the Session could not be connected.
+ */
+solClient_returnCode_t
+    startup_connect ( struct startup *cs_p, struct commonOptions *commandOpts_p,
+                      solClient_session_rxMsgCallbackFunc_t rxCallback_p );
+
+/**
+ * A Session event callback, with the profile as user pointer: records
+ * the confirmations and hands every event to common_eventCallback().
+ */
+void
+    startup_eventCallback ( solClient_opaqueSession_pt opaqueSession_p,
+                            solClient_session_eventCallbackInfo_pt eventInfo_p, void *user_p );
+
+/**
+ * A message was received; call from the receive callback.
+ */
+void
+    startup_messageReceived ( struct startup *cs_p );
+
+/**
+ * @return The time to the first message in ns from startup_init(), 0 until one came.
+ */
+solClient_uint64_t
+    startup_firstMessageNs ( struct startup *cs_p );
+
+/**
+ * The application is up: add the deferred subscriptions, and wait for
+ * outstanding confirmations and the TLS helper.
+ * @param cs_p The profile.
+ * @param waitMs Most time to wait for confirmations.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_INCOMPLETE when confirmations are still missing.
+ */
+solClient_returnCode_t
+    startup_finish ( struct startup *cs_p, int waitMs );
+
+/**
+ * Print the phases in order of start to STDOUT, with the time to the
+ * first message and the time the phases overlapped.
+ */
+void
+    startup_print ( struct startup *cs_p );
+
+/**
+ * Disconnect the Session if connected, destroy the Context, and free the
+ * profile's resources. The API stays initialized.
+ */
+void
+    startup_destroy ( struct startup *cs_p );
+
+#endif /* STARTUP_H_ */
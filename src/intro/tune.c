@@ -0,0 +1,419 @@
+
+/** example Intro/tune.c
+ */
+
+/**
+ * Example file for the Solace Messaging API for C.
+ *
+ * Budgeted search over API settings. See tune.h.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ */
+
+/**************************************************************************
+    For Windows builds, os.h should always be included first to ensure that
+    _WIN32_WINNT is defined before winsock2.h or windows.h get included.
+ **************************************************************************/
+#include "os.h"
+#include "solclient/solClient.h"
+#include "common.h"
+#include "tune.h"
+
+#define TUNE_GRID_LEVELS        3
+#define TUNE_SAMPLE_TRIES       8       /**< Draws per grid trial when sampling the grid. */
+
+/*****************************************************************************
+ * tune_parseValues
+ *****************************************************************************/
+static          solClient_returnCode_t
+tune_parseValues ( struct tuneParam *param_p, const char *values_p )
+{
+    const char     *next_p = values_p;
+    char           *end_p;
+    int             i;
+
+    param_p->numValues = 0;
+    while ( *next_p != '\0' ) {
+        if ( param_p->numValues == TUNE_MAX_VALUES ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "More than %d values for %s", TUNE_MAX_VALUES, param_p->name );
+            return SOLCLIENT_FAIL;
+        }
+        param_p->values[param_p->numValues++] = ( int ) strtol ( next_p, &end_p, 10 );
+        if ( end_p == next_p || ( *end_p != ',' && *end_p != '\0' ) ) {
+            solClient_log ( SOLCLIENT_LOG_ERROR, "Invalid values '%s' for %s", values_p, param_p->name );
+            return SOLCLIENT_FAIL;
+        }
+        next_p = ( *end_p == ',' ) ? end_p + 1 : end_p;
+    }
+    if ( param_p->numValues == 0 ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "No values for %s", param_p->name );
+        return SOLCLIENT_FAIL;
+    }
+    param_p->defaultIndex = -1;
+    for ( i = 0; i < param_p->numValues; i++ ) {
+        if ( param_p->values[i] == param_p->defaultValue ) {
+            param_p->defaultIndex = i;
+        }
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * tune_isFeasible
+ *****************************************************************************/
+static int
+tune_isFeasible ( const struct tuner *tuner_p, const struct tuneResult *result_p )
+{
+    return result_p->ok && ( tuner_p->objective != TUNE_MIN_P99 ||
+                             result_p->msgsPerSec >= tuner_p->targetRate * TUNE_FEASIBLE_SHARE );
+}
+
+/*****************************************************************************
+ * tune_isBetter
+ *
+ * Whether a beats b by more than TUNE_MIN_GAIN.
+ *****************************************************************************/
+static int
+tune_isBetter ( const struct tuner *tuner_p, const struct tuneResult *a_p, const struct tuneResult *b_p )
+{
+    int             feasibleA = tune_isFeasible ( tuner_p, a_p );
+    int             feasibleB = tune_isFeasible ( tuner_p, b_p );
+
+    if ( !a_p->ok || !b_p->ok ) {
+        return a_p->ok;
+    }
+    if ( tuner_p->objective == TUNE_MIN_P99 && feasibleA && feasibleB ) {
+        return a_p->p99Us < b_p->p99Us * ( 1.0 - TUNE_MIN_GAIN );
+    }
+    if ( feasibleA != feasibleB ) {
+        return feasibleA;
+    }
+    return a_p->msgsPerSec > b_p->msgsPerSec * ( 1.0 + TUNE_MIN_GAIN );
+}
+
+/*****************************************************************************
+ * tune_find
+ *****************************************************************************/
+static int
+tune_find ( const struct tuner *tuner_p, const int *index_p )
+{
+    int             trial;
+
+    for ( trial = 0; trial < tuner_p->numTrials; trial++ ) {
+        if ( memcmp ( tuner_p->trials_p[trial].index, index_p, tuner_p->numParams * sizeof ( int ) ) == 0 ) {
+            return trial;
+        }
+    }
+    return -1;
+}
+
+/*****************************************************************************
+ * tune_evaluate
+ *
+ * Measures a configuration unless it was measured before. Returns 0 once
+ * the budget is used.
+ *****************************************************************************/
+static int
+tune_evaluate ( struct tuner *tuner_p, const int *index_p, const char *phase_p )
+{
+    struct tuneTrial *trial_p;
+    int             values[TUNE_MAX_PARAMS];
+    int             p;
+
+    if ( tune_find ( tuner_p, index_p ) >= 0 ) {
+        return 1;
+    }
+    if ( tuner_p->numTrials >= tuner_p->budget ) {
+        return 0;
+    }
+    trial_p = &tuner_p->trials_p[tuner_p->numTrials];
+    memcpy ( trial_p->index, index_p, tuner_p->numParams * sizeof ( int ) );
+    trial_p->phase_p = phase_p;
+    for ( p = 0; p < tuner_p->numParams; p++ ) {
+        values[p] = tuner_p->params[p].values[index_p[p]];
+    }
+    memset ( &trial_p->result, 0, sizeof ( trial_p->result ) );
+    tuner_p->trial_p ( values, &trial_p->result, tuner_p->user_p );
+
+    if ( tuner_p->best < 0 || tune_isBetter ( tuner_p, &trial_p->result, &tuner_p->trials_p[tuner_p->best].result ) ) {
+        tuner_p->best = tuner_p->numTrials;
+    }
+    if ( tuner_p->log_p != NULL ) {
+        fprintf ( tuner_p->log_p, "%5d %-7s", tuner_p->numTrials + 1, phase_p );
+        for ( p = 0; p < tuner_p->numParams; p++ ) {
+            fprintf ( tuner_p->log_p, " %8d", values[p] );
+        }
+        if ( trial_p->result.ok ) {
+            fprintf ( tuner_p->log_p, " %10.0f %9.1f %9.1f", trial_p->result.msgsPerSec, trial_p->result.p50Us,
+                      trial_p->result.p99Us );
+            if ( trial_p->result.acksPerMsg >= 0 ) {
+                fprintf ( tuner_p->log_p, " %8.3f", trial_p->result.acksPerMsg );
+            } else {
+                fprintf ( tuner_p->log_p, " %8s", "-" );
+            }
+            fprintf ( tuner_p->log_p, "%s%s\n", tune_isFeasible ( tuner_p, &trial_p->result ) ? "" : " infeasible",
+                      ( tuner_p->best == tuner_p->numTrials ) ? " *" : "" );
+        } else {
+            fprintf ( tuner_p->log_p, " failed\n" );
+        }
+        fflush ( tuner_p->log_p );
+    }
+    tuner_p->numTrials++;
+    return 1;
+}
+
+/*****************************************************************************
+ * tune_runGrid
+ *****************************************************************************/
+static void
+tune_runGrid ( struct tuner *tuner_p )
+{
+    int             levels[TUNE_MAX_PARAMS][TUNE_GRID_LEVELS];
+    int             numLevels[TUNE_MAX_PARAMS];
+    int             level[TUNE_MAX_PARAMS];
+    int             index[TUNE_MAX_PARAMS];
+    int             gridBudget = ( tuner_p->budget - tuner_p->numTrials ) / 2;
+    int             gridEnd;
+    double          gridSize = 1.0;
+    solClient_uint64_t random = COMMON_RANDOM_SEED;
+    int             tries;
+    int             p;
+
+    for ( p = 0; p < tuner_p->numParams; p++ ) {
+        int             n = tuner_p->params[p].numValues;
+
+        numLevels[p] = 0;
+        levels[p][numLevels[p]++] = 0;
+        if ( ( n - 1 ) / 2 > 0 ) {
+            levels[p][numLevels[p]++] = ( n - 1 ) / 2;
+        }
+        if ( n - 1 > ( n - 1 ) / 2 ) {
+            levels[p][numLevels[p]++] = n - 1;
+        }
+        gridSize *= numLevels[p];
+    }
+    if ( gridBudget < 1 ) {
+        gridBudget = 1;
+    }
+    gridEnd = tuner_p->numTrials + gridBudget;
+
+    if ( gridSize <= gridBudget ) {
+        /* The whole grid, counting through the levels like an odometer. */
+        memset ( level, 0, sizeof ( level ) );
+        for ( ;; ) {
+            for ( p = 0; p < tuner_p->numParams; p++ ) {
+                index[p] = levels[p][level[p]];
+            }
+            if ( !tune_evaluate ( tuner_p, index, "grid" ) ) {
+                return;
+            }
+            for ( p = 0; p < tuner_p->numParams && ++level[p] == numLevels[p]; p++ ) {
+                level[p] = 0;
+            }
+            if ( p == tuner_p->numParams ) {
+                return;
+            }
+        }
+    }
+
+    /* A fixed sample of the grid; the seed keeps runs comparable. */
+    for ( tries = 0; tries < gridBudget * TUNE_SAMPLE_TRIES && tuner_p->numTrials < gridEnd; tries++ ) {
+        for ( p = 0; p < tuner_p->numParams; p++ ) {
+            index[p] = levels[p][common_random ( &random ) % ( solClient_uint64_t ) numLevels[p]];
+        }
+        if ( !tune_evaluate ( tuner_p, index, "grid" ) ) {
+            return;
+        }
+    }
+}
+
+/*****************************************************************************
+ * tune_runRefine
+ *****************************************************************************/
+static void
+tune_runRefine ( struct tuner *tuner_p )
+{
+    int             index[TUNE_MAX_PARAMS];
+    int             step = 2;
+    int             best;
+    int             moved;
+    int             p;
+    int             direction;
+
+    while ( step > 0 ) {
+        moved = 0;
+        best = tuner_p->best;
+        for ( p = 0; p < tuner_p->numParams && !moved; p++ ) {
+            for ( direction = -1; direction <= 1 && !moved; direction += 2 ) {
+                memcpy ( index, tuner_p->trials_p[best].index, sizeof ( index ) );
+                index[p] += direction * step;
+                if ( index[p] < 0 || index[p] >= tuner_p->params[p].numValues ) {
+                    continue;
+                }
+                if ( !tune_evaluate ( tuner_p, index, "refine" ) ) {
+                    return;
+                }
+                moved = ( tuner_p->best != best );
+            }
+        }
+        if ( !moved ) {
+            step--;
+        }
+    }
+}
+
+
+/*****************************************************************************
+ * tune_init
+ *****************************************************************************/
+solClient_returnCode_t
+tune_init ( struct tuner *tuner_p, int objective, double targetRate, int budget, tune_trialFunc_t trial_p, void *user_p )
+{
+    memset ( tuner_p, 0, sizeof ( *tuner_p ) );
+    if ( budget < 1 || budget > TUNE_MAX_TRIALS || ( objective == TUNE_MIN_P99 && targetRate <= 0 ) ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Invalid tuning budget %d or target rate %.0f", budget, targetRate );
+        return SOLCLIENT_FAIL;
+    }
+    if ( ( tuner_p->trials_p = ( struct tuneTrial * ) calloc ( budget, sizeof ( struct tuneTrial ) ) ) == NULL ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Could not allocate %d trials", budget );
+        return SOLCLIENT_FAIL;
+    }
+    tuner_p->objective = objective;
+    tuner_p->targetRate = targetRate;
+    tuner_p->budget = budget;
+    tuner_p->trial_p = trial_p;
+    tuner_p->user_p = user_p;
+    tuner_p->best = -1;
+    tuner_p->log_p = stdout;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * tune_addParam
+ *****************************************************************************/
+solClient_returnCode_t
+tune_addParam ( struct tuner *tuner_p, const char *name_p, const char *values_p, int defaultValue )
+{
+    struct tuneParam *param_p;
+
+    if ( tuner_p->numParams == TUNE_MAX_PARAMS || strlen ( name_p ) >= TUNE_MAX_NAME ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "Cannot add tuning parameter %s", name_p );
+        return SOLCLIENT_FAIL;
+    }
+    param_p = &tuner_p->params[tuner_p->numParams];
+    strcpy ( param_p->name, name_p );
+    param_p->defaultValue = defaultValue;
+    if ( tune_parseValues ( param_p, values_p ) != SOLCLIENT_OK ) {
+        return SOLCLIENT_FAIL;
+    }
+    tuner_p->numParams++;
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * tune_setValues
+ *****************************************************************************/
+solClient_returnCode_t
+tune_setValues ( struct tuner *tuner_p, const char *spec_p )
+{
+    const char     *equals_p = strchr ( spec_p, '=' );
+    int             p;
+
+    for ( p = 0; equals_p != NULL && p < tuner_p->numParams; p++ ) {
+        if ( strlen ( tuner_p->params[p].name ) == ( size_t ) ( equals_p - spec_p ) &&
+             strncmp ( tuner_p->params[p].name, spec_p, equals_p - spec_p ) == 0 ) {
+            return tune_parseValues ( &tuner_p->params[p], equals_p + 1 );
+        }
+    }
+    solClient_log ( SOLCLIENT_LOG_ERROR, "'%s' is not NAME=V1,V2,... for a tuned property", spec_p );
+    return SOLCLIENT_FAIL;
+}
+
+/*****************************************************************************
+ * tune_run
+ *****************************************************************************/
+solClient_returnCode_t
+tune_run ( struct tuner *tuner_p )
+{
+    int             index[TUNE_MAX_PARAMS];
+    int             haveDefaults = 1;
+    int             p;
+
+    if ( tuner_p->log_p != NULL ) {
+        fprintf ( tuner_p->log_p, "Parameters:\n" );
+        for ( p = 0; p < tuner_p->numParams; p++ ) {
+            int             v;
+
+            fprintf ( tuner_p->log_p, "  p%-2d %-32s", p + 1, tuner_p->params[p].name );
+            for ( v = 0; v < tuner_p->params[p].numValues; v++ ) {
+                fprintf ( tuner_p->log_p, "%s%d", ( v == 0 ) ? " " : ",", tuner_p->params[p].values[v] );
+            }
+            fprintf ( tuner_p->log_p, " (default %d)\n", tuner_p->params[p].defaultValue );
+        }
+        fprintf ( tuner_p->log_p, "\n%5s %-7s", "trial", "phase" );
+        for ( p = 0; p < tuner_p->numParams; p++ ) {
+            fprintf ( tuner_p->log_p, "      p%-2d", p + 1 );
+        }
+        fprintf ( tuner_p->log_p, " %10s %9s %9s %8s\n", "msgs/s", "p50 us", "p99 us", "acks/msg" );
+    }
+
+    for ( p = 0; p < tuner_p->numParams; p++ ) {
+        index[p] = tuner_p->params[p].defaultIndex;
+        haveDefaults = haveDefaults && ( index[p] >= 0 );
+    }
+    if ( haveDefaults ) {
+        tune_evaluate ( tuner_p, index, "default" );
+    }
+    tune_runGrid ( tuner_p );
+    if ( tuner_p->best >= 0 ) {
+        tune_runRefine ( tuner_p );
+    }
+    if ( tuner_p->best < 0 || !tuner_p->trials_p[tuner_p->best].result.ok ) {
+        solClient_log ( SOLCLIENT_LOG_ERROR, "No tuning trial succeeded" );
+        return SOLCLIENT_FAIL;
+    }
+    return SOLCLIENT_OK;
+}
+
+/*****************************************************************************
+ * tune_printBest
+ *****************************************************************************/
+void
+tune_printBest ( struct tuner *tuner_p, FILE * file_p )
+{
+    const struct tuneTrial *best_p;
+    const struct tuneResult *result_p;
+    int             p;
+
+    if ( tuner_p->best < 0 ) {
+        return;
+    }
+    best_p = &tuner_p->trials_p[tuner_p->best];
+    if ( tuner_p->objective == TUNE_MIN_P99 ) {
+        fprintf ( file_p, "# Lowest p99 at %.0f msgs/s, from %d trials\n", tuner_p->targetRate, tuner_p->numTrials );
+    } else {
+        fprintf ( file_p, "# Highest throughput, from %d trials\n", tuner_p->numTrials );
+    }
+    result_p = &best_p->result;
+    fprintf ( file_p, "# best:     %.0f msgs/s, p50 %.1f us, p99 %.1f us%s\n", result_p->msgsPerSec,
+              result_p->p50Us, result_p->p99Us, tune_isFeasible ( tuner_p, result_p ) ? "" : " (target rate not met)" );
+    if ( tuner_p->numTrials > 0 && strcmp ( tuner_p->trials_p[0].phase_p, "default" ) == 0 ) {
+        result_p = &tuner_p->trials_p[0].result;
+        fprintf ( file_p, "# defaults: %.0f msgs/s, p50 %.1f us, p99 %.1f us\n", result_p->msgsPerSec,
+                  result_p->p50Us, result_p->p99Us );
+    }
+    for ( p = 0; p < tuner_p->numParams; p++ ) {
+        fprintf ( file_p, "%s=%d\n", tuner_p->params[p].name, tuner_p->params[p].values[best_p->index[p]] );
+    }
+}
+
+/*****************************************************************************
+ * tune_destroy
+ *****************************************************************************/
+void
+tune_destroy ( struct tuner *tuner_p )
+{
+    free ( tuner_p->trials_p );
+    tuner_p->trials_p = NULL;
+}
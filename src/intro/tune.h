@@ -0,0 +1,167 @@
+/** example Intro/tune.h
+ */
+
+/**
+ *
+ * file tune.h Include file for the Solace C API samples.
+ *
+ * Copyright 2026 Solace Corporation. All rights reserved.
+ *
+ * This include file provides a budgeted search over API settings. Each
+ * parameter (a Session or Flow property) takes one of a short, ordered list
+ * of candidate values; a configuration picks one value per parameter, and a
+ * trial function, supplied by the application, measures it. Within
+ * budget trials the search:
+ *
+ *   1. measures the API defaults, as the baseline;
+ *   2. runs a coarse grid: the lowest, middle and highest candidate of every
+ *      parameter. When the grid has more points than half the budget, a
+ *      fixed pseudo-random sample of it is run instead;
+ *   3. refines around the best configuration so far with a pattern search:
+ *      each parameter is moved two candidates up and down, then one, and
+ *      every improvement restarts the sweep from the new best.
+ *
+ * A configuration is measured once. A configuration only replaces the best
+ * when it beats it by more than TUNE_MIN_GAIN, so that measurement noise on
+ * a live broker does not steer the search.
+ *
+ * The objective is either the highest throughput, or the lowest 99th
+ * percentile latency at a target rate. A configuration that does not carry
+ * 98% of the target rate is infeasible for the latter; infeasible ones are
+ * ranked by throughput below every feasible one.
+ */
+
+#ifndef TUNE_H_
+#define TUNE_H_
+
+#include "os.h"
+#include "solclient/solClient.h"
+
+#define TUNE_MAX_THROUGHPUT     0
+#define TUNE_MIN_P99            1
+
+#define TUNE_MAX_PARAMS         16
+#define TUNE_MAX_VALUES         16
+#define TUNE_MAX_NAME           64
+#define TUNE_MAX_TRIALS         4096
+#define TUNE_MIN_GAIN           0.01    /**< Relative score gain to prefer a configuration. */
+#define TUNE_FEASIBLE_SHARE     0.98    /**< Of the target rate, for ::TUNE_MIN_P99. */
+
+/**
+ * @struct tuneParam
+ */
+struct tuneParam
+{
+    char            name[TUNE_MAX_NAME];        /**< The property name, e.g. ::SOLCLIENT_FLOW_PROP_WINDOWSIZE. */
+    int             values[TUNE_MAX_VALUES];    /**< Candidates, in increasing order of effect. */
+    int             numValues;
+    int             defaultValue;               /**< The API default. */
+    int             defaultIndex;               /**< Its candidate index, -1 if not a candidate. */
+};
+
+/**
+ * @struct tuneResult
+ * What a trial measured.
+ */
+struct tuneResult
+{
+    int             ok;                 /**< 0 if the trial could not run. */
+    double          msgsPerSec;
+    double          p50Us;
+    double          p99Us;
+    double          acksPerMsg;         /**< Flow acknowledgements sent per message, negative if unknown. */
+};
+
+/**
+ * @struct tuneTrial
+ */
+struct tuneTrial
+{
+    int             index[TUNE_MAX_PARAMS];     /**< Candidate index per parameter. */
+    const char     *phase_p;            /**< "default", "grid" or "refine". */
+    struct tuneResult result;
+};
+
+/**
+ * Measure one configuration.
+ * @param values_p The value of each parameter, in the order they were added.
+ * @param result_p The measurement.
+ * @param user_p The user pointer given to tune_init().
+ */
+typedef void    ( *tune_trialFunc_t ) ( const int *values_p, struct tuneResult * result_p, void *user_p );
+
+/**
+ * @struct tuner
+ */
+struct tuner
+{
+    struct tuneParam params[TUNE_MAX_PARAMS];
+    int             numParams;
+    int             objective;          /**< ::TUNE_MAX_THROUGHPUT or ::TUNE_MIN_P99. */
+    double          targetRate;         /**< Messages per second, for ::TUNE_MIN_P99. */
+    int             budget;             /**< Trials, at most ::TUNE_MAX_TRIALS. */
+    tune_trialFunc_t trial_p;
+    void           *user_p;
+    struct tuneTrial *trials_p;
+    int             numTrials;
+    int             best;               /**< Index into trials_p, -1 before the first trial. */
+    FILE           *log_p;              /**< Each trial is printed here, NULL for none. */
+};
+
+
+/**
+ * Initialize a tuner.
+ * @param tuner_p The tuner to initialize.
+ * @param objective ::TUNE_MAX_THROUGHPUT or ::TUNE_MIN_P99.
+ * @param targetRate Messages per second, for ::TUNE_MIN_P99.
+ * @param budget Maximum number of trials.
+ * @param trial_p Measures one configuration.
+ * @param user_p Passed to trial_p.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    tune_init ( struct tuner *tuner_p, int objective, double targetRate, int budget, tune_trialFunc_t trial_p,
+                void *user_p );
+
+/**
+ * Add a parameter.
+ * @param tuner_p The tuner.
+ * @param name_p The property name.
+ * @param values_p Comma-separated candidate values, e.g. "1,8,64,255".
+ * @param defaultValue The API default, measured first when it is one of the
+ * candidates of every parameter.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    tune_addParam ( struct tuner *tuner_p, const char *name_p, const char *values_p, int defaultValue );
+
+/**
+ * Replace the candidates of a parameter, as given on a command line.
+ * @param tuner_p The tuner.
+ * @param spec_p "NAME=V1,V2,...", NAME being a property name added before.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL
+ */
+solClient_returnCode_t
+    tune_setValues ( struct tuner *tuner_p, const char *spec_p );
+
+/**
+ * Run the search until the budget is used or no move improves the best.
+ * @return ::SOLCLIENT_OK, ::SOLCLIENT_FAIL if no trial could run.
+ */
+solClient_returnCode_t
+    tune_run ( struct tuner *tuner_p );
+
+/**
+ * Print the best configuration as NAME=VALUE lines, with its measurement
+ * and that of the defaults as comments.
+ */
+void
+    tune_printBest ( struct tuner *tuner_p, FILE * file_p );
+
+/**
+ * Free the trials.
+ */
+void
+    tune_destroy ( struct tuner *tuner_p );
+
+#endif /* TUNE_H_ */